@@ -0,0 +1,34 @@
+/**************************************************************************
+ * Adafruit_NeoPixel.h (host)
+ *
+ * NeoPixel mock for building the watch firmware on Linux.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef Adafruit_NeoPixel_h
+#define Adafruit_NeoPixel_h
+
+#include "Arduino.h"
+
+#define NEO_GRB  ((1<<6) | (1<<4) | (0<<2) | (2))
+#define NEO_KHZ800 0x0000
+
+class Adafruit_NeoPixel {
+    public:
+        Adafruit_NeoPixel(uint16_t n = 1, uint16_t pin = 6, uint16_t type = NEO_GRB + NEO_KHZ800) {
+            (void)n; (void)pin; (void)type;
+        }
+        void begin() {}
+        void show() {}
+        void setPixelColor(uint16_t n, uint32_t c) { (void)n; color = c; }
+        static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+            return ((uint32_t)r << 16) | ((uint32_t)g <<  8) | b;
+        }
+        uint32_t color = 0;
+};
+
+#endif
@@ -0,0 +1,302 @@
+/**************************************************************************
+ * Arduino.cpp (host)
+ *
+ * Minimal Arduino core for building the watch firmware on Linux.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include "Arduino.h"
+#include <stdarg.h>
+#include <new>
+
+HardwareSerial Serial;
+uint32_t host_progmemReads = 0;
+
+/****** simulated clock ******/
+static uint64_t host_time_us = 0;
+static uint64_t (*host_timeline)(uint64_t now) = NULL;
+static uint64_t host_timelineNext = UINT64_MAX;
+
+void host_advanceMicros(uint64_t us){
+    uint64_t end = host_time_us + us;
+    while(host_timeline && host_timelineNext <= end){
+        host_time_us = max(host_time_us, host_timelineNext);
+        host_timelineNext = host_timeline(host_time_us);
+    }
+    host_time_us = end;
+}
+
+void host_setTimeline(uint64_t (*timeline)(uint64_t now)){
+    host_timeline = timeline;
+    host_timelineNext = timeline ? timeline(host_time_us) : UINT64_MAX;
+}
+
+uint64_t host_micros64(){
+    return host_time_us;
+}
+
+unsigned long millis(){
+    // the ESP8266 millis() is 32 bit wide and wraps after ~49 days
+    return (uint32_t)(host_time_us / 1000);
+}
+
+unsigned long micros(){
+    // wraps after ~71 minutes, like on the ESP8266
+    return (uint32_t)host_time_us;
+}
+
+void delay(unsigned long ms){
+    host_advanceMicros((uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us){
+    host_advanceMicros(us);
+}
+
+void yield(){
+}
+
+
+/****** simulated GPIO ******/
+// all buttons are connected with pull-ups: HIGH = released
+static uint32_t host_gpi = 0xFFFFFFFF;
+static void (*host_isr[HOST_NUM_PINS])(void);
+static int host_isrMode[HOST_NUM_PINS];
+static bool host_irqEnabled = true;
+
+void pinMode(uint8_t pin, uint8_t mode){
+    (void)pin;
+    (void)mode;
+}
+
+int digitalRead(uint8_t pin){
+    return (host_gpi >> pin) & 1;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val){
+    (void)pin;
+    (void)val;
+}
+
+void host_setPin(uint8_t pin, uint8_t level){
+    uint8_t oldLevel = (host_gpi >> pin) & 1;
+    if(level)
+        host_gpi |= (1UL << pin);
+    else
+        host_gpi &= ~(1UL << pin);
+    if(pin >= HOST_NUM_PINS || oldLevel == level || !host_isr[pin] || !host_irqEnabled)
+        return;
+    int mode = host_isrMode[pin];
+    if(mode == CHANGE || (mode == RISING && level) || (mode == FALLING && !level))
+        host_isr[pin]();
+}
+
+uint32_t host_readGPI(){
+    return host_gpi;
+}
+
+uint8_t digitalPinToInterrupt(uint8_t pin){
+    return pin;
+}
+
+void attachInterrupt(uint8_t interrupt, void (*isr)(void), int mode){
+    if(interrupt < HOST_NUM_PINS){
+        host_isr[interrupt] = isr;
+        host_isrMode[interrupt] = mode;
+    }
+}
+
+void detachInterrupt(uint8_t interrupt){
+    if(interrupt < HOST_NUM_PINS)
+        host_isr[interrupt] = NULL;
+}
+
+void noInterrupts(){
+    host_irqEnabled = false;
+}
+
+void interrupts(){
+    host_irqEnabled = true;
+}
+
+
+/****** heap statistics ******/
+static uint32_t host_allocationCount = 0;
+
+uint32_t host_allocations(){
+    return host_allocationCount;
+}
+
+void *operator new(size_t size){
+    host_allocationCount++;
+    void *p = malloc(size ? size : 1);
+    if(!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void *operator new[](size_t size){
+    return operator new(size);
+}
+
+void operator delete(void *p) noexcept{
+    free(p);
+}
+
+void operator delete[](void *p) noexcept{
+    free(p);
+}
+
+
+/****** String ******/
+String::String(const char *cstr):buffer(NULL), len(0) {
+    append(cstr, strlen(cstr));
+}
+
+String::String(const String &str):buffer(NULL), len(0) {
+    append(str.buffer, str.len);
+}
+
+String::String(char c):buffer(NULL), len(0) {
+    append(&c, 1);
+}
+
+String::String(int value):buffer(NULL), len(0) {
+    char buf[12];
+    append(buf, snprintf(buf, sizeof(buf), "%d", value));
+}
+
+String::String(unsigned int value):buffer(NULL), len(0) {
+    char buf[12];
+    append(buf, snprintf(buf, sizeof(buf), "%u", value));
+}
+
+String::String(long value):buffer(NULL), len(0) {
+    char buf[24];
+    append(buf, snprintf(buf, sizeof(buf), "%ld", value));
+}
+
+String::String(unsigned long value):buffer(NULL), len(0) {
+    char buf[24];
+    append(buf, snprintf(buf, sizeof(buf), "%lu", value));
+}
+
+String::~String(){
+    free(buffer);
+}
+
+String & String::operator = (const String &rhs){
+    if(this != &rhs){
+        len = 0;
+        append(rhs.buffer, rhs.len);
+    }
+    return *this;
+}
+
+String & String::operator = (const char *cstr){
+    len = 0;
+    append(cstr, strlen(cstr));
+    return *this;
+}
+
+String & String::operator += (const String &rhs){
+    append(rhs.buffer, rhs.len);
+    return *this;
+}
+
+String & String::operator += (const char *cstr){
+    append(cstr, strlen(cstr));
+    return *this;
+}
+
+String & String::operator += (char c){
+    append(&c, 1);
+    return *this;
+}
+
+String operator + (const String &lhs, const String &rhs){
+    String result(lhs);
+    result += rhs;
+    return result;
+}
+
+String operator + (const String &lhs, const char *rhs){
+    String result(lhs);
+    result += rhs;
+    return result;
+}
+
+String operator + (const String &lhs, char rhs){
+    String result(lhs);
+    result += rhs;
+    return result;
+}
+
+// like the Arduino String, every change of the length reallocates
+void String::append(const char *cstr, unsigned int n){
+    host_allocationCount++;
+    char *newBuffer = (char *)realloc(buffer, len + n + 1);
+    if(!newBuffer)
+        return;
+    buffer = newBuffer;
+    memmove(buffer + len, cstr, n);
+    len += n;
+    buffer[len] = 0;
+}
+
+
+/****** Serial ******/
+size_t HardwareSerial::print(const char *text){
+    if(enabled)
+        fputs(text, stdout);
+    return strlen(text);
+}
+
+size_t HardwareSerial::print(long value){
+    char buf[24];
+    snprintf(buf, sizeof(buf), "%ld", value);
+    return print(buf);
+}
+
+size_t HardwareSerial::println(const char *text){
+    size_t n = print(text);
+    return n + print("\n");
+}
+
+size_t HardwareSerial::println(long value){
+    size_t n = print(value);
+    return n + print("\n");
+}
+
+int HardwareSerial::printf(const char *format, ...){
+    va_list args;
+    va_start(args, format);
+    int n = 0;
+    if(enabled)
+        n = vprintf(format, args);
+    va_end(args);
+    return n;
+}
+
+
+/****** ESP ******/
+EspClass ESP;
+static uint8_t host_rtcMemory[HOST_RTC_USER_MEMORY];
+
+bool EspClass::rtcUserMemoryRead(uint32_t offset, uint32_t *data, size_t size){
+    if(size % 4 || offset * 4 + size > HOST_RTC_USER_MEMORY)
+        return false;
+    memcpy(data, host_rtcMemory + offset * 4, size);
+    return true;
+}
+
+bool EspClass::rtcUserMemoryWrite(uint32_t offset, uint32_t *data, size_t size){
+    if(size % 4 || offset * 4 + size > HOST_RTC_USER_MEMORY)
+        return false;
+    memcpy(host_rtcMemory + offset * 4, data, size);
+    return true;
+}
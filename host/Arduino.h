@@ -0,0 +1,160 @@
+/**************************************************************************
+ * Arduino.h (host)
+ *
+ * Minimal Arduino core for building the watch firmware on Linux.
+ * Only the parts used by the DSTIKE NTP Watch are provided.
+ * The clock is simulated: millis() and micros() only advance
+ * with delay() or host_advanceMicros().
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define ICACHE_RAM_ATTR
+#define IRAM_ATTR
+// every read out of PROGMEM is counted: on the ESP8266 each of them
+// is a 32 bit access to the flash, also for a single byte
+extern uint32_t host_progmemReads;
+#define pgm_read_byte(addr) (host_progmemReads++, *(const uint8_t *)(addr))
+#define pgm_read_word(addr) (host_progmemReads++, *(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (host_progmemReads++, *(const uint32_t *)(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#define HIGH 0x1
+#define LOW  0x0
+#define INPUT 0x00
+#define OUTPUT 0x01
+#define INPUT_PULLUP 0x02
+
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+
+// NodeMCU pin names
+#define D1 5
+#define D2 4
+
+#define _min(a,b) ((a)<(b)?(a):(b))
+#define _max(a,b) ((a)>(b)?(a):(b))
+using std::min;
+using std::max;
+// like the ESP8266 core: works for unsigned values too
+#ifdef abs
+#undef abs
+#endif
+#define abs(x) ((x)>0?(x):-(x))
+
+/****** simulated clock ******/
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+// advance the simulated clock
+void host_advanceMicros(uint64_t us);
+uint64_t host_micros64();
+// called while the clock advances, to change pins at their time (also
+// in the middle of a delay()): sets all pins up to now and returns
+// the time of the next change in us (UINT64_MAX: no more changes)
+void host_setTimeline(uint64_t (*timeline)(uint64_t now));
+
+/****** simulated GPIO ******/
+#define HOST_NUM_PINS 17
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+// set the level of an input pin (for button traces)
+void host_setPin(uint8_t pin, uint8_t level);
+// GPIO input register as seen by the ESP8266 (one bit per pin)
+uint32_t host_readGPI();
+#define GPI host_readGPI()
+uint8_t digitalPinToInterrupt(uint8_t pin);
+void attachInterrupt(uint8_t interrupt, void (*isr)(void), int mode);
+void detachInterrupt(uint8_t interrupt);
+void noInterrupts();
+void interrupts();
+
+/****** heap statistics ******/
+// number of heap allocations since start:
+// every change of a String and every new
+uint32_t host_allocations();
+
+/****** String ******/
+class String {
+    public:
+        String(const char *cstr = "");
+        String(const String &str);
+        explicit String(char c);
+        explicit String(int value);
+        explicit String(unsigned int value);
+        explicit String(long value);
+        explicit String(unsigned long value);
+        ~String();
+        String & operator = (const String &rhs);
+        String & operator = (const char *cstr);
+        String & operator += (const String &rhs);
+        String & operator += (const char *cstr);
+        String & operator += (char c);
+        friend String operator + (const String &lhs, const String &rhs);
+        friend String operator + (const String &lhs, const char *rhs);
+        friend String operator + (const String &lhs, char rhs);
+        const char * c_str() const { return buffer; }
+        unsigned int length() const { return len; }
+        char charAt(unsigned int index) const { return index < len ? buffer[index] : 0; }
+        char operator [] (unsigned int index) const { return charAt(index); }
+        bool operator == (const String &rhs) const { return strcmp(buffer, rhs.buffer) == 0; }
+        bool operator != (const String &rhs) const { return !(*this == rhs); }
+    private:
+        void append(const char *cstr, unsigned int n);
+        char *buffer;
+        unsigned int len;
+};
+
+/****** Serial ******/
+class HardwareSerial {
+    public:
+        void begin(unsigned long baud) { (void)baud; }
+        void flush() {}
+        size_t print(const char *text);
+        size_t print(const String &text) { return print(text.c_str()); }
+        size_t print(long value);
+        size_t println(const char *text = "");
+        size_t println(const String &text) { return println(text.c_str()); }
+        size_t println(long value);
+        int printf(const char *format, ...);
+        // Serial output is discarded unless enabled
+        bool enabled = false;
+};
+extern HardwareSerial Serial;
+
+/****** ESP ******/
+// RTC user memory (512 bytes) in the memory of the host: it keeps its
+// content like the ESP8266 over a reset, but not over a power loss
+#define HOST_RTC_USER_MEMORY 512
+class EspClass {
+    public:
+        // offset in blocks of 4 bytes, size in bytes (a multiple of 4)
+        bool rtcUserMemoryRead(uint32_t offset, uint32_t *data, size_t size);
+        bool rtcUserMemoryWrite(uint32_t offset, uint32_t *data, size_t size);
+};
+extern EspClass ESP;
+
+#endif
@@ -0,0 +1,54 @@
+/**************************************************************************
+ * EEPROM.cpp (host)
+ *
+ * EEPROM mock for building the watch firmware on Linux.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include "EEPROM.h"
+
+EEPROMClass EEPROM;
+
+void EEPROMClass::begin(size_t size){
+    if(size > HOST_EEPROM_SIZE)
+        size = HOST_EEPROM_SIZE;
+    this->size = size;
+    memcpy(data, flash, size);
+    dirty = false;
+}
+
+uint8_t EEPROMClass::read(int address){
+    if(address < 0 || (size_t)address >= size)
+        return 0;
+    return data[address];
+}
+
+// like the ESP8266 core: only a changed value makes the flash dirty
+void EEPROMClass::write(int address, uint8_t value){
+    if(address < 0 || (size_t)address >= size)
+        return;
+    if(data[address] != value){
+        data[address] = value;
+        dirty = true;
+    }
+}
+
+bool EEPROMClass::commit(){
+    if(size == 0)
+        return false;
+    if(!dirty)
+        return true;
+    memcpy(flash, data, size);
+    flashWrites++;
+    dirty = false;
+    return true;
+}
+
+void EEPROMClass::end(){
+    commit();
+    size = 0;
+}
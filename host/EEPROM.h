@@ -0,0 +1,41 @@
+/**************************************************************************
+ * EEPROM.h (host)
+ *
+ * EEPROM mock for building the watch firmware on Linux.
+ * Like on the ESP8266, the EEPROM is a copy in RAM that is written
+ * back by commit(). On the host the "flash" is also memory: it keeps
+ * its content as long as the program runs, over a simulated reset and
+ * power loss. Every commit() that changes the content is counted.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef EEPROM_h
+#define EEPROM_h
+
+#include "Arduino.h"
+
+#define HOST_EEPROM_SIZE 4096
+
+class EEPROMClass {
+    public:
+        void begin(size_t size);
+        uint8_t read(int address);
+        void write(int address, uint8_t value);
+        bool commit();
+        void end();
+        // statistics: commits that have written the flash
+        uint32_t flashWrites = 0;
+    private:
+        uint8_t flash[HOST_EEPROM_SIZE] = {0};
+        uint8_t data[HOST_EEPROM_SIZE] = {0};
+        size_t size = 0;
+        bool dirty = false;
+};
+
+extern EEPROMClass EEPROM;
+
+#endif
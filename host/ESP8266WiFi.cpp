@@ -0,0 +1,33 @@
+/**************************************************************************
+ * ESP8266WiFi.cpp (host)
+ *
+ * WiFi and NTP mock for building the watch firmware on Linux.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include "ESP8266WiFi.h"
+#include "Time.h"
+#include "coredecls.h"
+
+ESP8266WiFiClass WiFi;
+
+void configTime(int timezone, int daylightOffset_sec, const char* server1){
+    (void)timezone;
+    (void)daylightOffset_sec;
+    (void)server1;
+}
+
+static void (*host_sntpCallback)(void) = NULL;
+
+void settimeofday_cb(void (*cb)(void)){
+    host_sntpCallback = cb;
+}
+
+void host_sntpUpdate(){
+    if(host_sntpCallback)
+        host_sntpCallback();
+}
@@ -0,0 +1,49 @@
+/**************************************************************************
+ * ESP8266WiFi.h (host)
+ *
+ * WiFi mock for building the watch firmware on Linux.
+ * The connection is always established immediately.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef ESP8266WiFi_h
+#define ESP8266WiFi_h
+
+#include "Arduino.h"
+
+typedef enum {
+    WL_NO_SHIELD        = 255,
+    WL_IDLE_STATUS      = 0,
+    WL_NO_SSID_AVAIL    = 1,
+    WL_SCAN_COMPLETED   = 2,
+    WL_CONNECTED        = 3,
+    WL_CONNECT_FAILED   = 4,
+    WL_CONNECTION_LOST  = 5,
+    WL_DISCONNECTED     = 6
+} wl_status_t;
+
+class IPAddress {
+    public:
+        String toString() const { return String("127.0.0.1"); }
+};
+
+class ESP8266WiFiClass {
+    public:
+        wl_status_t status() { return connected ? WL_CONNECTED : WL_DISCONNECTED; }
+        wl_status_t begin(const char* ssid, const char *passphrase) {
+            (void)ssid; (void)passphrase;
+            connected = true;
+            return status();
+        }
+        bool disconnect() { connected = false; return true; }
+        IPAddress localIP() { return IPAddress(); }
+        bool connected = true;
+};
+
+extern ESP8266WiFiClass WiFi;
+
+#endif
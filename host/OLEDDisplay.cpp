@@ -0,0 +1,580 @@
+/**************************************************************************
+ * OLEDDisplay.cpp (host)
+ *
+ * In-memory replacement of the drawing surface of the
+ * "ESP8266 and ESP32 OLED driver for SSD1306 displays" v4.1.0
+ * The drawing code follows the library implementation.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include "OLEDDisplay.h"
+
+OLEDDisplay::OLEDDisplay() {
+    geometry = GEOMETRY_128_64;
+    displayWidth = 128;
+    displayHeight = 64;
+    displayBufferSize = displayWidth * displayHeight / 8;
+    textAlignment = TEXT_ALIGN_LEFT;
+    color = WHITE;
+    fontData = NULL;
+    buffer = NULL;
+}
+
+OLEDDisplay::~OLEDDisplay() {
+    end();
+}
+
+bool OLEDDisplay::init() {
+    if(!connect())
+        return false;
+    if(!buffer)
+        buffer = (uint8_t*) malloc(sizeof(uint8_t) * displayBufferSize);
+    if(!buffer)
+        return false;
+    sendInitCommands();
+    resetDisplay();
+    return true;
+}
+
+void OLEDDisplay::end() {
+    free(buffer);
+    buffer = NULL;
+}
+
+void OLEDDisplay::resetDisplay(void) {
+    clear();
+    display();
+}
+
+void OLEDDisplay::sendInitCommands() {
+    // the real init sequence has 25 commands, the last one is DISPLAYON
+    for(uint8_t i = 0; i < 24; i++)
+        sendCommand(0xE3); // NOP
+    displayOn();
+}
+
+void OLEDDisplay::setColor(OLEDDISPLAY_COLOR color) {
+    this->color = color;
+}
+
+OLEDDISPLAY_COLOR OLEDDisplay::getColor() {
+    return this->color;
+}
+
+void OLEDDisplay::setPixel(int16_t x, int16_t y) {
+    if (x >= 0 && x < width() && y >= 0 && y < height()) {
+        switch (color) {
+            case WHITE:   buffer[x + (y / 8) * width()] |=  (1 << (y & 7)); break;
+            case BLACK:   buffer[x + (y / 8) * width()] &= ~(1 << (y & 7)); break;
+            case INVERSE: buffer[x + (y / 8) * width()] ^=  (1 << (y & 7)); break;
+        }
+    }
+}
+
+void OLEDDisplay::clearPixel(int16_t x, int16_t y) {
+    if (x >= 0 && x < width() && y >= 0 && y < height()) {
+        switch (color) {
+            case BLACK:   buffer[x + (y >> 3) * width()] |=  (1 << (y & 7)); break;
+            case WHITE:   buffer[x + (y >> 3) * width()] &= ~(1 << (y & 7)); break;
+            case INVERSE: buffer[x + (y >> 3) * width()] ^=  (1 << (y & 7)); break;
+        }
+    }
+}
+
+void OLEDDisplay::drawRect(int16_t x, int16_t y, int16_t width, int16_t height) {
+    drawHorizontalLine(x, y, width);
+    drawVerticalLine(x, y, height);
+    drawVerticalLine(x + width - 1, y, height);
+    drawHorizontalLine(x, y + height - 1, width);
+}
+
+void OLEDDisplay::fillRect(int16_t xMove, int16_t yMove, int16_t width, int16_t height) {
+    for (int16_t x = xMove; x < xMove + width; x++) {
+        drawVerticalLine(x, yMove, height);
+    }
+}
+
+void OLEDDisplay::drawCircleQuads(int16_t x0, int16_t y0, int16_t radius, uint8_t quads) {
+    int16_t x = 0, y = radius;
+    int16_t dp = 1 - radius;
+    while (x < y) {
+        if (dp < 0)
+            dp = dp + 2 * (++x) + 3;
+        else
+            dp = dp + 2 * (++x) - 2 * (--y) + 5;
+        if (quads & 0x1) {
+            setPixel(x0 + x, y0 - y);
+            setPixel(x0 + y, y0 - x);
+        }
+        if (quads & 0x2) {
+            setPixel(x0 - y, y0 - x);
+            setPixel(x0 - x, y0 - y);
+        }
+        if (quads & 0x4) {
+            setPixel(x0 - y, y0 + x);
+            setPixel(x0 - x, y0 + y);
+        }
+        if (quads & 0x8) {
+            setPixel(x0 + x, y0 + y);
+            setPixel(x0 + y, y0 + x);
+        }
+    }
+    if (quads & 0x1 && quads & 0x8) {
+        setPixel(x0 + radius, y0);
+    }
+    if (quads & 0x4 && quads & 0x8) {
+        setPixel(x0, y0 + radius);
+    }
+    if (quads & 0x2 && quads & 0x4) {
+        setPixel(x0 - radius, y0);
+    }
+    if (quads & 0x1 && quads & 0x2) {
+        setPixel(x0, y0 - radius);
+    }
+}
+
+void OLEDDisplay::fillCircle(int16_t x0, int16_t y0, int16_t radius) {
+    int16_t x = 0, y = radius;
+    int16_t dp = 1 - radius;
+    do {
+        if (dp < 0)
+            dp = dp + 2 * (++x) + 3;
+        else
+            dp = dp + 2 * (++x) - 2 * (--y) + 5;
+
+        drawHorizontalLine(x0 - x, y0 - y, 2*x);
+        drawHorizontalLine(x0 - x, y0 + y, 2*x);
+        drawHorizontalLine(x0 - y, y0 - x, 2*y);
+        drawHorizontalLine(x0 - y, y0 + x, 2*y);
+    } while (x < y);
+    drawHorizontalLine(x0 - radius, y0, 2 * radius);
+}
+
+void OLEDDisplay::drawHorizontalLine(int16_t x, int16_t y, int16_t length) {
+    if (y < 0 || y >= height()) { return; }
+    if (x < 0) {
+        length += x;
+        x = 0;
+    }
+    if ( (x + length) > width()) {
+        length = (width() - x);
+    }
+    if (length <= 0) { return; }
+
+    uint8_t * bufferPtr = buffer;
+    bufferPtr += (y >> 3) * width();
+    bufferPtr += x;
+
+    uint8_t drawBit = 1 << (y & 7);
+
+    switch (color) {
+        case WHITE:   while (length--) {
+            *bufferPtr++ |= drawBit;
+        }; break;
+        case BLACK:   drawBit = ~drawBit;   while (length--) {
+            *bufferPtr++ &= drawBit;
+        }; break;
+        case INVERSE: while (length--) {
+            *bufferPtr++ ^= drawBit;
+        }; break;
+    }
+}
+
+void OLEDDisplay::drawVerticalLine(int16_t x, int16_t y, int16_t length) {
+    if (x < 0 || x >= width()) return;
+
+    if (y < 0) {
+        length += y;
+        y = 0;
+    }
+
+    if ( (y + length) > height()) {
+        length = (height() - y);
+    }
+
+    if (length <= 0) return;
+
+    uint8_t yOffset = y & 7;
+    uint8_t drawBit;
+    uint8_t *bufferPtr = buffer;
+
+    bufferPtr += (y >> 3) * width();
+    bufferPtr += x;
+
+    if (yOffset) {
+        yOffset = 8 - yOffset;
+        drawBit = ~(0xFF >> (yOffset));
+
+        if (length < yOffset) {
+            drawBit &= (0xFF >> (yOffset - length));
+        }
+
+        switch (color) {
+            case WHITE:   *bufferPtr |=  drawBit; break;
+            case BLACK:   *bufferPtr &= ~drawBit; break;
+            case INVERSE: *bufferPtr ^=  drawBit; break;
+        }
+
+        if (length < yOffset) return;
+
+        length -= yOffset;
+        bufferPtr += width();
+    }
+
+    if (length >= 8) {
+        switch (color) {
+            case WHITE:
+            case BLACK:
+                drawBit = (color == WHITE) ? 0xFF : 0x00;
+                do {
+                    *bufferPtr = drawBit;
+                    bufferPtr += width();
+                    length -= 8;
+                } while (length >= 8);
+                break;
+            case INVERSE:
+                do {
+                    *bufferPtr = ~(*bufferPtr);
+                    bufferPtr += width();
+                    length -= 8;
+                } while (length >= 8);
+                break;
+        }
+    }
+
+    if (length > 0) {
+        drawBit = (1 << (length & 7)) - 1;
+        switch (color) {
+            case WHITE:   *bufferPtr |=  drawBit; break;
+            case BLACK:   *bufferPtr &= ~drawBit; break;
+            case INVERSE: *bufferPtr ^=  drawBit; break;
+        }
+    }
+}
+
+void OLEDDisplay::drawProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t progress) {
+    uint16_t radius = height / 2;
+    uint16_t xRadius = x + radius;
+    uint16_t yRadius = y + radius;
+    uint16_t doubleRadius = 2 * radius;
+    uint16_t innerRadius = radius - 2;
+
+    setColor(WHITE);
+    drawCircleQuads(xRadius, yRadius, radius, 0b00000110);
+    drawHorizontalLine(xRadius, y, width - doubleRadius + 1);
+    drawHorizontalLine(xRadius, y + height, width - doubleRadius + 1);
+    drawCircleQuads(x + width - radius, yRadius, radius, 0b00001001);
+
+    uint16_t maxProgressWidth = (width - doubleRadius + 1) * progress / 100;
+
+    fillCircle(xRadius, yRadius, innerRadius);
+    fillRect(xRadius + 1, y + 2, maxProgressWidth, height - 3);
+    fillCircle(xRadius + maxProgressWidth, yRadius, innerRadius);
+}
+
+void OLEDDisplay::drawFastImage(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t *image) {
+    drawInternal(xMove, yMove, width, height, image, 0, 0);
+}
+
+void OLEDDisplay::drawXbm(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t *xbm) {
+    int16_t widthInXbm = (width + 7) / 8;
+    uint8_t data = 0;
+
+    for(int16_t y = 0; y < height; y++) {
+        for(int16_t x = 0; x < width; x++ ) {
+            if (x & 7) {
+                data >>= 1; // Move a bit
+            } else {  // Read new data every 8 bit
+                data = pgm_read_byte(xbm + (x / 8) + y * widthInXbm);
+            }
+            // if there is a bit draw it
+            if (data & 0x01) {
+                setPixel(xMove + x, yMove + y);
+            }
+        }
+    }
+}
+
+void OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, char* text, uint16_t textLength, uint16_t textWidth) {
+    uint8_t textHeight       = pgm_read_byte(fontData + HEIGHT_POS);
+    uint8_t firstChar        = pgm_read_byte(fontData + FIRST_CHAR_POS);
+    uint16_t sizeOfJumpTable = pgm_read_byte(fontData + CHAR_NUM_POS)  * JUMPTABLE_BYTES;
+
+    uint16_t cursorX         = 0;
+    uint16_t cursorY         = 0;
+
+    switch (textAlignment) {
+        case TEXT_ALIGN_CENTER_BOTH:
+            yMove -= textHeight >> 1;
+        // Fallthrough
+        case TEXT_ALIGN_CENTER:
+            xMove -= textWidth >> 1; // divide by 2
+            break;
+        case TEXT_ALIGN_RIGHT:
+            xMove -= textWidth;
+            break;
+        case TEXT_ALIGN_LEFT:
+            break;
+    }
+
+    // Don't draw anything if it is not on the screen.
+    if (xMove + textWidth  < 0 || xMove > width() ) {return;}
+    if (yMove + textHeight < 0 || yMove > width() ) {return;}
+
+    for (uint16_t j = 0; j < textLength; j++) {
+        int16_t xPos = xMove + cursorX;
+        int16_t yPos = yMove + cursorY;
+
+        byte code = text[j];
+        if (code >= firstChar) {
+            byte charCode = code - firstChar;
+
+            // 4 Bytes per char code
+            byte msbJumpToChar    = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES );                  // MSB  \ JumpAddress
+            byte lsbJumpToChar    = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES + JUMPTABLE_LSB);   // LSB /
+            byte charByteSize     = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES + JUMPTABLE_SIZE);  // Size
+            byte currentCharWidth = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES + JUMPTABLE_WIDTH); // Width
+
+            // Test if the char is drawable
+            if (!(msbJumpToChar == 255 && lsbJumpToChar == 255)) {
+                // Get the position of the char data
+                uint16_t charDataPosition = JUMPTABLE_START + sizeOfJumpTable + ((msbJumpToChar << 8) + lsbJumpToChar);
+                drawInternal(xPos, yPos, currentCharWidth, textHeight, fontData, charDataPosition, charByteSize);
+            }
+
+            cursorX += currentCharWidth;
+        }
+    }
+}
+
+void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, String strUser) {
+    uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
+
+    // char* text must be freed!
+    char* text = utf8ascii(strUser);
+
+    uint16_t yOffset = 0;
+    // If the string should be centered vertically too
+    // we need to now how heigh the string is.
+    if (textAlignment == TEXT_ALIGN_CENTER_BOTH) {
+        uint16_t lb = 0;
+        // Find number of linebreaks in text
+        for (uint16_t i=0; text[i] != 0; i++) {
+            lb += (text[i] == 10);
+        }
+        // Calculate center
+        yOffset = (lb * lineHeight) / 2;
+    }
+
+    uint16_t line = 0;
+    char* textPart = strtok(text,"\n");
+    while (textPart != NULL) {
+        uint16_t length = strlen(textPart);
+        drawStringInternal(xMove, yMove - yOffset + (line++) * lineHeight, textPart, length, getStringWidth(textPart, length));
+        textPart = strtok(NULL, "\n");
+    }
+    free(text);
+}
+
+uint16_t OLEDDisplay::getStringWidth(const char* text, uint16_t length) {
+    uint16_t firstChar        = pgm_read_byte(fontData + FIRST_CHAR_POS);
+
+    uint16_t stringWidth = 0;
+    uint16_t maxWidth = 0;
+
+    while (length--) {
+        stringWidth += pgm_read_byte(fontData + JUMPTABLE_START + (text[length] - firstChar) * JUMPTABLE_BYTES + JUMPTABLE_WIDTH);
+        if (text[length] == 10) {
+            maxWidth = max(maxWidth, stringWidth);
+            stringWidth = 0;
+        }
+    }
+
+    return max(maxWidth, stringWidth);
+}
+
+uint16_t OLEDDisplay::getStringWidth(String strUser) {
+    char* text = utf8ascii(strUser);
+    uint16_t length = strlen(text);
+    uint16_t width = getStringWidth(text, length);
+    free(text);
+    return width;
+}
+
+void OLEDDisplay::setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT textAlignment) {
+    this->textAlignment = textAlignment;
+}
+
+void OLEDDisplay::setFont(const uint8_t *fontData) {
+    this->fontData = fontData;
+}
+
+// the panel is on at the end of the command
+void OLEDDisplay::displayOn(void) {
+    panelOn = true;
+    sendCommand(DISPLAYON);
+}
+
+void OLEDDisplay::displayOff(void) {
+    sendCommand(DISPLAYOFF);
+    panelOn = false;
+}
+
+void OLEDDisplay::invertDisplay(void) {
+    sendCommand(0xA7);
+}
+
+void OLEDDisplay::normalDisplay(void) {
+    sendCommand(0xA6);
+}
+
+void OLEDDisplay::setContrast(uint8_t contrast, uint8_t precharge, uint8_t comdetect) {
+    sendCommand(0xD9); //0xD9
+    sendCommand(precharge); //0xF1 default, to lower the contrast, put 1-1F
+    sendCommand(SETCONTRAST);
+    sendCommand(contrast); // 0-255
+    sendCommand(0xDB); //0xDB, (additionally needed to lower the contrast)
+    sendCommand(comdetect);	//0x40 default, to lower the contrast, put 0
+    sendCommand(0xA4);
+    sendCommand(0xA6);
+    sendCommand(0xAF);
+}
+
+void OLEDDisplay::setBrightness(uint8_t brightness) {
+    uint8_t contrast = brightness;
+    if (brightness < 128) {
+        // Magic values to get a smooth/ safe transition from 0 to 50%
+        contrast = 0;
+    } else {
+        // Magic values to get a smooth/ safe transition from 50% to 100%
+        contrast = (brightness - 128) * 2;
+    }
+    panelBrightness = brightness;
+    setContrast(contrast, 241, 64);
+}
+
+void OLEDDisplay::flipScreenVertically() {
+    sendCommand(0xA1);
+    sendCommand(0xC8);
+}
+
+void OLEDDisplay::clear(void) {
+    memset(buffer, 0, displayBufferSize);
+}
+
+bool OLEDDisplay::writePBM(const char *fileName) {
+    FILE *file = fopen(fileName, "w");
+    if(!file)
+        return false;
+    fprintf(file, "P1\n%d %d\n", width(), height());
+    for(int16_t y = 0; y < height(); y++){
+        for(int16_t x = 0; x < width(); x++){
+            uint8_t pixel = (buffer[x + (y >> 3) * width()] >> (y & 7)) & 1;
+            fputc(pixel ? '1' : '0', file);
+        }
+        fputc('\n', file);
+    }
+    fclose(file);
+    return true;
+}
+
+void OLEDDisplay::drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t *data, uint16_t offset, uint16_t bytesInData) {
+    if (width < 0 || height < 0) return;
+    if (yMove + height < 0 || yMove > this->height())  return;
+    if (xMove + width  < 0 || xMove > this->width())   return;
+
+    uint8_t  rasterHeight = 1 + ((height - 1) >> 3); // fast ceil(height / 8.0)
+    int8_t   yOffset      = yMove & 7;
+
+    bytesInData = bytesInData == 0 ? width * rasterHeight : bytesInData;
+
+    int16_t initYMove   = yMove;
+    int8_t  initYOffset = yOffset;
+
+    for (uint16_t i = 0; i < bytesInData; i++) {
+
+        // Reset if next horizontal drawing phase is started.
+        if ( i % rasterHeight == 0) {
+            yMove   = initYMove;
+            yOffset = initYOffset;
+        }
+
+        byte currentByte = pgm_read_byte(data + offset + i);
+
+        int16_t xPos = xMove + (i / rasterHeight);
+        int16_t yPos = ((yMove >> 3) + (i % rasterHeight)) * this->width();
+
+        int16_t dataPos    = xPos  + yPos;
+
+        if (dataPos >=  0  && dataPos < displayBufferSize &&
+            xPos    >=  0  && xPos    < this->width() ) {
+
+            if (yOffset >= 0) {
+                switch (this->color) {
+                    case WHITE:   buffer[dataPos] |= currentByte << yOffset; break;
+                    case BLACK:   buffer[dataPos] &= ~(currentByte << yOffset); break;
+                    case INVERSE: buffer[dataPos] ^= currentByte << yOffset; break;
+                }
+
+                if (dataPos < (displayBufferSize - this->width())) {
+                    switch (this->color) {
+                        case WHITE:   buffer[dataPos + this->width()] |= currentByte >> (8 - yOffset); break;
+                        case BLACK:   buffer[dataPos + this->width()] &= ~(currentByte >> (8 - yOffset)); break;
+                        case INVERSE: buffer[dataPos + this->width()] ^= currentByte >> (8 - yOffset); break;
+                    }
+                }
+            } else {
+                // Make new offset position
+                yOffset = -yOffset;
+
+                switch (this->color) {
+                    case WHITE:   buffer[dataPos] |= currentByte >> yOffset; break;
+                    case BLACK:   buffer[dataPos] &= ~(currentByte >> yOffset); break;
+                    case INVERSE: buffer[dataPos] ^= currentByte >> yOffset; break;
+                }
+
+                // Prepare for next iteration by moving one block up
+                yMove -= 8;
+
+                // and setting the new yOffset
+                yOffset = 8 - yOffset;
+            }
+
+            yield();
+        }
+    }
+}
+
+// Code form http://playground.arduino.cc/Main/Utf8ascii
+// the returned buffer has to be freed by the caller
+char* OLEDDisplay::utf8ascii(String str) {
+    uint16_t k = 0;
+    uint16_t length = str.length() + 1;
+
+    char* s = (char*) malloc(length * sizeof(char));
+    if(!s)
+        return NULL;
+
+    static byte LASTUTF8 = 0;
+    length--;
+    for (uint16_t i = 0; i < length; i++) {
+        byte c = str.charAt(i);
+        byte last = LASTUTF8;
+        LASTUTF8 = c;
+        if (c < 128) {
+            s[k++] = c;
+            continue;
+        }
+        switch (last) {
+            case 0xC2: s[k++] = c; break;
+            case 0xC3: s[k++] = (c | 0xC0); break;
+            case 0x82: if (c == 0xAC) s[k++] = 128; break; // Euro symbol
+        }
+    }
+    s[k] = 0;
+    return s;
+}
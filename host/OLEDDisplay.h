@@ -0,0 +1,131 @@
+/**************************************************************************
+ * OLEDDisplay.h (host)
+ *
+ * In-memory replacement of the drawing surface of the
+ * "ESP8266 and ESP32 OLED driver for SSD1306 displays" v4.1.0
+ * The drawing functions used by the watch are implemented
+ * the same way as in the library, so the framebuffer content
+ * is identical to the one on the watch.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef OLEDDisplay_h
+#define OLEDDisplay_h
+
+#include "Arduino.h"
+#include "OLEDDisplayFonts.h"
+
+// Header Values
+#define JUMPTABLE_BYTES 4
+
+#define JUMPTABLE_LSB   1
+#define JUMPTABLE_SIZE  2
+#define JUMPTABLE_WIDTH 3
+#define JUMPTABLE_START 4
+
+#define WIDTH_POS 0
+#define HEIGHT_POS 1
+#define FIRST_CHAR_POS 2
+#define CHAR_NUM_POS 3
+
+// Display commands
+#define DISPLAYOFF 0xAE
+#define DISPLAYON 0xAF
+#define SETCONTRAST 0x81
+
+enum OLEDDISPLAY_COLOR {
+  BLACK = 0,
+  WHITE = 1,
+  INVERSE = 2
+};
+
+enum OLEDDISPLAY_TEXT_ALIGNMENT {
+  TEXT_ALIGN_LEFT = 0,
+  TEXT_ALIGN_RIGHT = 1,
+  TEXT_ALIGN_CENTER = 2,
+  TEXT_ALIGN_CENTER_BOTH = 3
+};
+
+enum OLEDDISPLAY_GEOMETRY {
+  GEOMETRY_128_64   = 0,
+  GEOMETRY_128_32   = 1
+};
+
+class OLEDDisplay {
+    public:
+        OLEDDisplay();
+        virtual ~OLEDDisplay();
+
+        uint16_t width(void) const { return displayWidth; }
+        uint16_t height(void) const { return displayHeight; }
+
+        bool init();
+        void end();
+        void resetDisplay(void);
+
+        /* Drawing functions */
+        void setColor(OLEDDISPLAY_COLOR color);
+        OLEDDISPLAY_COLOR getColor();
+        void setPixel(int16_t x, int16_t y);
+        void clearPixel(int16_t x, int16_t y);
+        void drawRect(int16_t x, int16_t y, int16_t width, int16_t height);
+        void fillRect(int16_t x, int16_t y, int16_t width, int16_t height);
+        void drawCircleQuads(int16_t x0, int16_t y0, int16_t radius, uint8_t quads);
+        void fillCircle(int16_t x, int16_t y, int16_t radius);
+        void drawHorizontalLine(int16_t x, int16_t y, int16_t length);
+        void drawVerticalLine(int16_t x, int16_t y, int16_t length);
+        void drawProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t progress);
+        void drawFastImage(int16_t x, int16_t y, int16_t width, int16_t height, const uint8_t *image);
+        void drawXbm(int16_t x, int16_t y, int16_t width, int16_t height, const uint8_t *xbm);
+
+        /* Text functions */
+        void drawString(int16_t x, int16_t y, String text);
+        uint16_t getStringWidth(const char* text, uint16_t length);
+        uint16_t getStringWidth(String text);
+        void setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT textAlignment);
+        void setFont(const uint8_t *fontData);
+
+        /* Display functions */
+        void displayOn(void);
+        void displayOff(void);
+        void invertDisplay(void);
+        void normalDisplay(void);
+        void setContrast(uint8_t contrast, uint8_t precharge = 241, uint8_t comdetect = 64);
+        void setBrightness(uint8_t brightness);
+        void flipScreenVertically();
+        void clear(void);
+        virtual void display(void) = 0;
+
+        // host only: write the framebuffer as plain PBM (P1) image
+        bool writePBM(const char *fileName);
+        // host only: state of the simulated panel
+        bool panelOn = false;
+        uint8_t panelBrightness = 0;
+
+        uint8_t *buffer;
+
+    protected:
+        OLEDDISPLAY_GEOMETRY geometry;
+        uint16_t displayWidth;
+        uint16_t displayHeight;
+        uint16_t displayBufferSize;
+
+        OLEDDISPLAY_TEXT_ALIGNMENT textAlignment;
+        OLEDDISPLAY_COLOR color;
+        const uint8_t *fontData;
+
+        virtual void sendCommand(uint8_t com) = 0;
+        virtual bool connect() = 0;
+        void sendInitCommands();
+
+    private:
+        void drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t *data, uint16_t offset, uint16_t bytesInData);
+        void drawStringInternal(int16_t xMove, int16_t yMove, char* text, uint16_t textLength, uint16_t textWidth);
+        char *utf8ascii(String s);
+};
+
+#endif
@@ -0,0 +1,20 @@
+/**************************************************************************
+ * OLEDDisplayFonts.h (host)
+ *
+ * The Arial fonts of the OLED library are not part of the host build.
+ * They are mapped onto fonts with a similar height from font.h
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef OLEDDisplayFonts_h
+#define OLEDDisplayFonts_h
+
+#define ArialMT_Plain_10 Lato_Hairline_12
+#define ArialMT_Plain_16 Lato_Hairline_17
+#define ArialMT_Plain_24 Lato_Hairline_18
+
+#endif
@@ -0,0 +1,67 @@
+/**************************************************************************
+ * SH1106Wire.h (host)
+ *
+ * SH1106 driver of the OLED library v4.1.0 on top of the I2C mock.
+ * display() sends the same I2C traffic as the library does.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef SH1106Wire_h
+#define SH1106Wire_h
+
+#include "OLEDDisplay.h"
+#include "Wire.h"
+
+class SH1106Wire : public OLEDDisplay {
+    private:
+        uint8_t _address;
+        uint8_t _sda;
+        uint8_t _scl;
+
+    public:
+        SH1106Wire(uint8_t _address, uint8_t _sda, uint8_t _scl, OLEDDISPLAY_GEOMETRY g = GEOMETRY_128_64) {
+            (void)g;
+            this->_address = _address;
+            this->_sda = _sda;
+            this->_scl = _scl;
+        }
+
+        bool connect() {
+            Wire.begin(this->_sda, this->_scl);
+            // Let's use ~700khz if ESP8266 is in 160Mhz mode
+            // this will be limited to ~400khz if the ESP8266 in 80Mhz mode.
+            Wire.setClock(700000);
+            return true;
+        }
+
+        void display(void) {
+            uint8_t * p = &buffer[0];
+            for (uint8_t y=0; y<8; y++) {
+                sendCommand(0xB0+y);
+                sendCommand(0x02);
+                sendCommand(0x10);
+                for( uint8_t x=0; x<8; x++) {
+                    Wire.beginTransmission(_address);
+                    Wire.write(0x40);
+                    for (uint8_t k = 0; k < 16; k++) {
+                        Wire.write(*p++);
+                    }
+                    Wire.endTransmission();
+                }
+            }
+        }
+
+    private:
+        inline void sendCommand(uint8_t command) __attribute__((always_inline)){
+            Wire.beginTransmission(_address);
+            Wire.write(0x80);
+            Wire.write(command);
+            Wire.endTransmission();
+        }
+};
+
+#endif
@@ -0,0 +1,22 @@
+/**************************************************************************
+ * Time.h (host)
+ *
+ * On the ESP8266 this header provides the POSIX time functions.
+ * On Linux they come from the C library.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef Time_h
+#define Time_h
+
+#include <time.h>
+#include <stdlib.h>
+
+// no NTP on the host: time() returns the time of the Linux system
+void configTime(int timezone, int daylightOffset_sec, const char* server1);
+
+#endif
@@ -0,0 +1,49 @@
+/**************************************************************************
+ * Wire.cpp (host)
+ *
+ * I2C mock for building the watch firmware on Linux.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include "Wire.h"
+
+TwoWire Wire;
+
+void TwoWire::begin(int sda, int scl){
+    (void)sda;
+    (void)scl;
+}
+
+void TwoWire::begin(){
+}
+
+void TwoWire::setClock(uint32_t frequency){
+    clock = frequency;
+}
+
+void TwoWire::beginTransmission(uint8_t address){
+    (void)address;
+    // the address byte is also sent over the bus
+    pending = 1;
+}
+
+size_t TwoWire::write(uint8_t data){
+    (void)data;
+    pending++;
+    return 1;
+}
+
+uint8_t TwoWire::endTransmission(){
+    bytes += pending;
+    transactions++;
+    // 9 clocks per byte (8 data + ACK) plus start and stop condition
+    host_advanceMicros(((uint64_t)pending * 9 + 2) * 1000000 / clock);
+    pending = 0;
+    if(onTransmission)
+        onTransmission();
+    return 0;
+}
@@ -0,0 +1,41 @@
+/**************************************************************************
+ * Wire.h (host)
+ *
+ * I2C mock for building the watch firmware on Linux.
+ * Nothing is sent anywhere, but every byte is counted and the
+ * simulated clock is advanced by the time the transfer would take
+ * on the bus (9 clock cycles per byte plus start/stop).
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef Wire_h
+#define Wire_h
+
+#include "Arduino.h"
+
+class TwoWire {
+    public:
+        void begin(int sda, int scl);
+        void begin();
+        void setClock(uint32_t frequency);
+        void beginTransmission(uint8_t address);
+        size_t write(uint8_t data);
+        uint8_t endTransmission();
+        // statistics of the simulated bus
+        uint32_t clock = 100000;
+        uint64_t bytes = 0;
+        uint64_t transactions = 0;
+        void resetStatistics() { bytes = 0; transactions = 0; }
+        // called after every transaction (latency benchmark)
+        void (*onTransmission)() = NULL;
+    private:
+        uint32_t pending = 0;
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,1832 @@
+/**************************************************************************
+ * bench.cpp (host)
+ *
+ * Render benchmark for the DSTIKE NTP Watch
+ * Runs print_dateTime() for one simulated day (86400 ticks) in the
+ * same way as loop() does. Once per hour a full refresh is forced,
+ * like after returning from another screen.
+ * Reports the render time per frame, the heap allocations, the
+ * number of bytes that would have been sent to the display over I2C
+ * and the longest slice of the background transfer that blocks the
+ * main loop.
+ * Before that, the time and date formatting is compared with the
+ * sprintf/String version used up to v2.2, the scrolling of the
+ * println() console and the incremental NTP progress bar are checked,
+ * and all fonts are drawn in the squix and in the indexed format.
+ * Compiled with FONT_COMPRESSED, the compressed fonts are drawn with
+ * an empty and with a filled glyph cache.
+ * The texts are drawn scaled by 2 and 3 and compared with the
+ * enlarged text. The clock time is drawn with FONT_2_XLARGE, with
+ * StrokeDigits and with FONT_2_NORMAL scaled by 2.
+ * Button presses during a delay() are read with and without the pin
+ * interrupt, recorded button traces are replayed through the gesture
+ * recognizer.
+ * The 64 bit system clock is checked over several wraps of micros().
+ * The drift of a slow crystal is fitted from NTP times with jitter,
+ * the error of the clock with and without the correction is compared.
+ * The state of the watch is restored after a reset, a power loss and
+ * with a broken copy in the RTC memory.
+ * The incremental calendar is compared with localtime_r() for a year
+ * and for one hour of loop() calls.
+ * The time zones with the precalculated DST transitions are compared
+ * with localtime_r() and the TZ variable for several rules.
+ * At the end, button timelines are replayed through loop() of the
+ * firmware: the time from the press edge to the first transfer to the
+ * display that shows the answer is reported.
+ * The day is rendered twice: first with the fonts from font.h and then
+ * with the clock fonts cached as sprites. Both runs have to produce
+ * identical frames.
+ * A third day is rendered with the screen switched off for 95% of the
+ * time. While the screen is on, the frames have to be the same as in
+ * the first run.
+ *
+ * usage: bench [output directory]
+ * If a directory is given, one frame per simulated hour is written
+ * as PBM image into it.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include <Arduino.h>
+#include <chrono>
+#include <vector>
+#include "Watch.h"
+#include "TimeFormat.h"
+#include "Widget.h"
+#include "SystemClock.h"
+#include "DriftEstimator.h"
+#include "Persistence.h"
+#include "TimeZone.h"
+#include "Calendar.h"
+#include <coredecls.h>
+
+// from main.cpp
+extern const char* TZ_INFO;
+void print_dateTime(time_t epochTime, bool refreshAll);
+// the font arrays of font.h exist once per source file:
+// the clock fonts have to be cached by main.cpp
+bool cache_clockFonts();
+const uint8_t *clock_timeFont();
+const uint8_t *clock_secondsFont();
+void add_compressedFonts();
+extern Screen clockFace;
+extern Screen NTPScreen;
+extern TextWidget NTPTitle;
+extern ProgressWidget NTPProgress;
+void loop();
+void catchUp_clockFace();
+extern SystemClock systemClock;
+extern WatchState watchState;
+extern bool time_valid;
+extern bool time_approximate;
+extern int8_t durable_hour;
+extern DriftEstimator clockDrift;
+extern Calendar calendar;
+void sample_clockDrift();
+void receive_sntpTime();
+uint8_t restore_watchState();
+void save_watchState(bool durable);
+void save_watchState_everySecond();
+extern tm dateTime;
+void select_timeZone(const char *rule);
+extern bool upTime_shown;
+extern bool Screen_permanent_on;
+extern unsigned long displayOffTimer;
+extern Screen upTimeScreen;
+extern Screen screenTimerScreen;
+extern TextWidget screenTimerText;
+extern time_t upTime_second;
+bool print_upTime();
+bool fetch_NTPTime(const char *title);
+bool WiFi_connection(bool force_reconnect);
+
+// 01.November.2020 00:00:00 CET
+#define BENCH_START_EPOCH 1604185200
+#define BENCH_TICKS (24*60*60)
+
+struct BenchResult {
+    uint32_t frames = 0;
+    uint64_t ns = 0;
+    uint64_t i2cBytes = 0;
+    uint64_t i2cTransactions = 0;
+    // simulated bus time: whole frame and longest blocking slice
+    uint64_t busUs = 0;
+    uint64_t maxSliceUs = 0;
+    // heap allocations (String and new)
+    uint64_t allocations = 0;
+};
+
+static void printResult(const char *name, const BenchResult &result){
+    if(result.frames == 0)
+        return;
+    printf("%-14s %8u frames %10.0f ns/frame %5.1f allocs/frame %8.1f bytes/frame %6.1f I2C transactions/frame %7.0f us bus/frame %5llu us max. slice\n",
+           name, result.frames,
+           (double)result.ns / result.frames,
+           (double)result.allocations / result.frames,
+           (double)result.i2cBytes / result.frames,
+           (double)result.i2cTransactions / result.frames,
+           (double)result.busUs / result.frames,
+           (unsigned long long)result.maxSliceUs);
+}
+
+// FNV-1a hash of the display buffer to compare the frames of two runs
+static uint32_t frameHash(){
+    uint32_t hash = 2166136261UL;
+    for(uint16_t i = 0; i < OLED_WIDTH * OLED_PAGES; i++){
+        hash ^= Watch.OLED.buffer[i];
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+// render one day, store the frame hashes and write every hour
+// a frame into outputDir (if not NULL)
+static void runDay(const char *name, const char *outputDir, std::vector<uint32_t> &hashes){
+    // 0 = seconds only, 1 = new minute, 2 = full refresh
+    BenchResult results[3];
+    hashes.clear();
+    Watch.clearLayoutCache();
+    Watch.layoutHits = 0;
+    Watch.layoutMisses = 0;
+    Watch.glyphCache.hits = 0;
+    Watch.glyphCache.misses = 0;
+    for(uint32_t tick = 0; tick < BENCH_TICKS; tick++){
+        time_t epoch = BENCH_START_EPOCH + tick;
+        bool refreshAll = tick % 3600 == 0;
+
+        Wire.resetStatistics();
+        uint32_t allocations = host_allocations();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        print_dateTime(epoch, refreshAll);
+        std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+        BenchResult &result = results[refreshAll ? 2 : (tick % 60 == 0 ? 1 : 0)];
+        result.allocations += host_allocations() - allocations;
+        // the frame is sent in slices by the main loop
+        while(Watch.isTransferBusy()){
+            uint64_t sliceStart = host_micros64();
+            Watch.serviceTransfer();
+            uint64_t sliceUs = host_micros64() - sliceStart;
+            result.busUs += sliceUs;
+            result.maxSliceUs = max(result.maxSliceUs, sliceUs);
+        }
+        result.frames++;
+        result.ns += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+        result.i2cBytes += Wire.bytes;
+        result.i2cTransactions += Wire.transactions;
+        hashes.push_back(frameHash());
+
+        if(outputDir && tick % 3600 == 0){
+            char fileName[256];
+            snprintf(fileName, sizeof(fileName), "%s/%s_%05u.pbm", outputDir, name, tick);
+            if(!Watch.OLED.writePBM(fileName))
+                fprintf(stderr, "unable to write %s\n", fileName);
+        }
+    }
+
+    BenchResult total;
+    for(uint8_t i = 0; i < 3; i++){
+        total.frames += results[i].frames;
+        total.ns += results[i].ns;
+        total.i2cBytes += results[i].i2cBytes;
+        total.i2cTransactions += results[i].i2cTransactions;
+        total.busUs += results[i].busUs;
+        total.maxSliceUs = max(total.maxSliceUs, results[i].maxSliceUs);
+        total.allocations += results[i].allocations;
+    }
+    printf("print_dateTime() for one day (%u ticks): %s\n", BENCH_TICKS, name);
+    printResult("seconds only", results[0]);
+    printResult("new minute", results[1]);
+    printResult("refreshAll", results[2]);
+    printResult("total", total);
+    printf("I2C bytes per day: %llu\n", (unsigned long long)total.i2cBytes);
+    printf("text layout cache: %u hits, %u misses\n", Watch.layoutHits, Watch.layoutMisses);
+    if(Watch.glyphCache.hits || Watch.glyphCache.misses)
+        printf("glyph cache: %u hits, %u misses\n", Watch.glyphCache.hits, Watch.glyphCache.misses);
+    printf("\n");
+}
+
+// catch-up render of the clock face after the screen was off
+static time_t benchEpoch;
+static void benchCatchUp(){
+    print_dateTime(benchEpoch, false);
+}
+
+// render one day with the screen on for 3 minutes per hour (5%)
+// the frames while the screen is on have to be the same as in
+// the reference run
+static bool runScreenOff(const std::vector<uint32_t> &reference){
+    // 0 = screen off, 1 = screen on
+    BenchResult results[2];
+    uint32_t differences = 0;
+    Watch.setCatchUpRender(benchCatchUp);
+    Watch.screenOff();
+    for(uint32_t tick = 0; tick < BENCH_TICKS; tick++){
+        benchEpoch = BENCH_START_EPOCH + tick;
+        uint32_t second = tick % 3600;
+
+        Wire.resetStatistics();
+        uint32_t allocations = host_allocations();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        // like loop(): a button switches the screen on, the timer off
+        if(second == 1800)
+            Watch.screenOn();
+        else if(second == 1980)
+            Watch.screenOff();
+        print_dateTime(benchEpoch, false);
+        std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+        BenchResult &result = results[Watch.screenState ? 1 : 0];
+        result.allocations += host_allocations() - allocations;
+        while(Watch.isTransferBusy()){
+            uint64_t sliceStart = host_micros64();
+            Watch.serviceTransfer();
+            uint64_t sliceUs = host_micros64() - sliceStart;
+            result.busUs += sliceUs;
+            result.maxSliceUs = max(result.maxSliceUs, sliceUs);
+        }
+        result.frames++;
+        result.ns += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+        result.i2cBytes += Wire.bytes;
+        result.i2cTransactions += Wire.transactions;
+        if(Watch.screenState && frameHash() != reference[tick])
+            differences++;
+    }
+    Watch.screenOn();
+    Watch.setCatchUpRender(NULL);
+
+    printf("print_dateTime() for one day (%u ticks): screen on 5%%\n", BENCH_TICKS);
+    printResult("screen off", results[0]);
+    printResult("screen on", results[1]);
+    printf("I2C bytes per day: %llu\n\n", (unsigned long long)(results[0].i2cBytes + results[1].i2cBytes));
+    if(differences)
+        printf("ERROR: %u frames differ after the screen was switched on\n", differences);
+    return differences == 0;
+}
+
+// print more lines than fit on the screen, like connect_Wifi() does
+// compares sending every line on its own with one transfer for all
+// lines, and the scrolled screen with the last lines drawn directly
+static bool runConsole(){
+    const char *lines[] = {"Connecting to ", "Home", "Connection attempt", "Connection attempt",
+                           "-Connection lost", "Connection attempt", "+ WiFi connected", "IP address: ",
+                           "192.168.1.42", "", "+ WiFi Connected", "Compare Time"};
+    const uint8_t nLines = sizeof(lines) / sizeof(lines[0]);
+    Watch.setFont(FONT_1_NORMAL);
+    Watch.setTextAlignment(TEXT_ALIGN_LEFT);
+    uint64_t bytes[2];
+    for(uint8_t coalesce = 0; coalesce < 2; coalesce++){
+        Watch.clearScreen();
+        Watch.updateDisplay();
+        Wire.resetStatistics();
+        for(uint8_t i = 0; i < nLines; i++){
+            Watch.println(lines[i]);
+            if(!coalesce)
+                Watch.updateDisplay();
+        }
+        Watch.updateDisplay();
+        bytes[coalesce] = Wire.bytes;
+    }
+    uint32_t scrolled = frameHash();
+    Watch.clearScreen();
+    for(uint8_t i = 0; i < OLED_nLines; i++)
+        Watch.drawString(0, OLED_lines[i], lines[nLines - OLED_nLines + i]);
+    bool same = frameHash() == scrolled;
+    Watch.clearScreen();
+    Watch.println(lines[0]);
+    uint32_t firstLine = frameHash();
+
+    // clearScreen() while the screen is off: the console starts at the
+    // first line again after screenOn() (the frame buffer is cleared
+    // directly, the catch-up render would draw it)
+    for(uint8_t i = 0; i < nLines; i++)
+        Watch.println(lines[i]);
+    Watch.screenOff();
+    Watch.clearScreen();
+    Watch.screenOn();
+    Watch.OLED.clear();
+    Watch.println(lines[0]);
+    bool firstLineAgain = frameHash() == firstLine;
+    Watch.clearScreen();
+    Watch.updateDisplay();
+
+    printf("println() console (%u lines)\n", nLines);
+    printf("%-14s %8llu bytes\n", "every line", (unsigned long long)bytes[0]);
+    printf("%-14s %8llu bytes\n\n", "all lines", (unsigned long long)bytes[1]);
+    if(!same)
+        printf("ERROR: the scrolled console differs from the lines drawn directly\n");
+    if(!firstLineAgain)
+        printf("ERROR: the console doesn't start at the first line after the screen was off\n");
+    return same && firstLineAgain;
+}
+
+// the NTP progress bar for 100 steps, like fetch_NTPTime() without answer
+// every step is drawn incrementally and then the whole bar is drawn
+// again as reference: both have to give the same frame
+static bool runProgress(){
+    uint64_t bytes[2] = {0, 0};
+    uint32_t differences = 0;
+    NTPTitle.setText("Get Server Time");
+    NTPProgress.setProgress(0);
+    NTPScreen.invalidate();
+    NTPScreen.update(Watch);
+    Watch.updateDisplay();
+    for(uint8_t step = 1; step <= 100; step++){
+        NTPProgress.setProgress(step);
+        Wire.resetStatistics();
+        NTPScreen.update(Watch);
+        Watch.updateDisplay();
+        bytes[0] += Wire.bytes;
+        uint32_t hash = frameHash();
+
+        NTPProgress.invalidate();
+        Wire.resetStatistics();
+        NTPScreen.update(Watch);
+        Watch.updateDisplay();
+        bytes[1] += Wire.bytes;
+        if(frameHash() != hash)
+            differences++;
+    }
+    // the fill must not change the color of the display
+    NTPProgress.setProgress(0);
+    NTPProgress.invalidate();
+    NTPScreen.update(Watch);
+    Watch.OLED.setColor(BLACK);
+    Watch.fillProgressBar(5, OLED_HEIGHT-16, OLED_WIDTH-10, 14, 0, 50);
+    bool colorKept = Watch.OLED.getColor() == BLACK;
+    Watch.OLED.setColor(WHITE);
+    Watch.clearScreen();
+    Watch.updateDisplay();
+
+    printf("NTP progress bar (100 steps)\n");
+    printf("%-14s %8llu bytes\n", "new columns", (unsigned long long)bytes[0]);
+    printf("%-14s %8llu bytes\n\n", "whole bar", (unsigned long long)bytes[1]);
+    if(differences)
+        printf("ERROR: %u progress bar frames differ from the whole bar\n", differences);
+    if(!colorKept)
+        printf("ERROR: the progress bar changed the color\n");
+    return differences == 0 && colorKept;
+}
+
+static const char *benchTexts[] = {"12:34", ": 56", "Sun 1.Nov.2020", "Connection attempt", "192.168.1.42",
+                                   " !\"#$%&'()*+,-./", "ABCDEFGHIJKLMNOPQRSTUVWXYZ", "abcdefghijklmnopqrstuvwxyz"};
+static const uint8_t nBenchTexts = sizeof(benchTexts) / sizeof(benchTexts[0]);
+// every text is drawn twice: first with all bit shifts of the pages,
+// then page-aligned (see DSTIKE_Watch::alignedGlyph())
+static const uint8_t nBenchDraws = 2 * nBenchTexts;
+static int16_t benchTextY(uint8_t draw){
+    return draw < nBenchTexts ? draw % 8 : 8 * (draw % 4);
+}
+
+// true if all characters of the text, that have glyph data in the
+// indexed font, have glyph data in the squix font
+// (not the case for the characters that are removed from a font
+// subset, and for all characters of a compressed font)
+static bool hasGlyphData(const IndexedFont *indexed, const char *text){
+    for(const char *c = text; *c; c++){
+        uint8_t index = (uint8_t)*c - indexed->firstChar;
+        if(index >= indexed->numChars || INDEXED_GLYPH_SIZE(indexed->glyphs[index]) == 0)
+            continue;
+        const uint8_t *jump = indexed->font + JUMPTABLE_START + index * JUMPTABLE_BYTES;
+        if(jump[0] == 255 && jump[JUMPTABLE_LSB] == 255)
+            return false;
+    }
+    return true;
+}
+
+// press and release a button with 3 bounces of 1 ms each
+static void benchPin(uint8_t pin, uint8_t level){
+    for(uint8_t i = 0; i < 3; i++){
+        host_setPin(pin, level);
+        delay(1);
+        host_setPin(pin, !level);
+        delay(1);
+    }
+    host_setPin(pin, level);
+}
+
+// read a button like loop() does, for the given time (every 10 ms)
+// counts the presses, the releases after a short press
+// and the releases after a long press (>= 1 s)
+struct BenchPresses {
+    uint32_t pressed = 0;
+    uint32_t released = 0;
+    uint32_t long_released = 0;
+};
+static void benchLoop(ButtonBank &bank, Button &button, uint32_t ms, BenchPresses &presses){
+    for(uint32_t t = 0; t < ms; t += 10){
+        bank.update();
+        presses.pressed += button.wasPressed();
+        presses.long_released += button.wasReleasefor(1000);
+        presses.released += button.wasReleased();
+        delay(10);
+    }
+}
+
+// the read() of the Button library up to v2.2 (one digitalRead() and
+// millis() per button, static variables), as reference for the time
+// of one scan of the buttons
+class LegacyButton {
+    public:
+        LegacyButton(uint8_t pin):pin(pin), state(0), lastChange(0) {}
+        uint8_t read(){
+            static uint32_t ms;
+            static uint8_t pinVal;
+            ms = millis();
+            pinVal = !digitalRead(pin);
+            if(ms - lastChange < 10)
+                return state;
+            if(pinVal != state){
+                lastChange = ms;
+                state = pinVal;
+            }
+            return state;
+        }
+    private:
+        uint8_t pin;
+        uint8_t state;
+        uint32_t lastChange;
+};
+
+// buttons of a bank with and without the pin interrupt: short presses
+// during a delay(), a long press while the loop runs and more bouncing
+// during a delay() than fits into the event ring
+// the time of one scan of all buttons is compared with the per
+// button read() of the Button library
+#define BUTTON_SCANS 1000000
+static bool runButtons(){
+    const uint8_t pin = NAV_BUTTON_PUSH_PIN;
+    Button polledButton(pin, true);
+    ButtonBank polled;
+    polled.add(&polledButton);
+    ButtonBank *banks[2] = {&polled, &Watch.buttons};
+    Button *buttons[2] = {&polledButton, &Watch.NavBtn_PUSH};
+    BenchPresses presses[2];
+    BenchPresses expected;
+    for(uint8_t n = 0; n < 5; n++){
+        // loop() in a delay(2500), 200 ms press
+        delay(500);
+        benchPin(pin, LOW);
+        delay(200);
+        benchPin(pin, HIGH);
+        delay(1800);
+        for(uint8_t b = 0; b < 2; b++)
+            benchLoop(*banks[b], *buttons[b], 50, presses[b]);
+        // 1.5 s press with the loop running
+        benchPin(pin, LOW);
+        for(uint8_t b = 0; b < 2; b++)
+            benchLoop(*banks[b], *buttons[b], 1500, presses[b]);
+        benchPin(pin, HIGH);
+        for(uint8_t b = 0; b < 2; b++)
+            benchLoop(*banks[b], *buttons[b], 50, presses[b]);
+        // 40 bounces in a delay(), then pressed
+        for(uint8_t i = 0; i < 40; i++){
+            host_setPin(pin, !(i & 1));
+            delayMicroseconds(100);
+        }
+        delay(1000);
+        for(uint8_t b = 0; b < 2; b++)
+            benchLoop(*banks[b], *buttons[b], 50, presses[b]);
+        benchPin(pin, HIGH);
+        for(uint8_t b = 0; b < 2; b++)
+            benchLoop(*banks[b], *buttons[b], 50, presses[b]);
+        expected.pressed += 3;
+        expected.released += 1;
+        expected.long_released += 2;
+    }
+
+    // a press without bouncing in a delay(): the release has the time of
+    // its edge, not of the next update()
+    BenchPresses edgePresses;
+    benchPin(pin, LOW);
+    delay(300);
+    host_setPin(pin, HIGH);
+    uint32_t releaseEdge = millis();
+    delay(300);
+    benchLoop(Watch.buttons, Watch.NavBtn_PUSH, 50, edgePresses);
+    bool edgeTime = Watch.NavBtn_PUSH.lastChange() == releaseEdge;
+    benchLoop(polled, polledButton, 50, edgePresses);
+
+    // the same 3 buttons for both scans, the time of the delay() alone
+    // is subtracted
+    LegacyButton legacy[3] = {LegacyButton(NAV_BUTTON_UP_PIN), LegacyButton(NAV_BUTTON_DOWN_PIN), LegacyButton(NAV_BUTTON_PUSH_PIN)};
+    Button scanButtons[3] = {Button(NAV_BUTTON_UP_PIN, true), Button(NAV_BUTTON_DOWN_PIN, true), Button(NAV_BUTTON_PUSH_PIN, true)};
+    ButtonBank scanned;
+    for(uint8_t b = 0; b < 3; b++)
+        scanned.add(&scanButtons[b]);
+    uint64_t ns[3] = {0, 0, 0};
+    uint32_t pressed = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(uint32_t i = 0; i < BUTTON_SCANS; i++)
+        delayMicroseconds(100);
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+    ns[2] = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    start = std::chrono::steady_clock::now();
+    for(uint32_t i = 0; i < BUTTON_SCANS; i++){
+        for(uint8_t b = 0; b < 3; b++)
+            pressed += legacy[b].read();
+        delayMicroseconds(100);
+    }
+    stop = std::chrono::steady_clock::now();
+    ns[0] = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    start = std::chrono::steady_clock::now();
+    for(uint32_t i = 0; i < BUTTON_SCANS; i++){
+        scanned.update();
+        for(uint8_t b = 0; b < 3; b++)
+            pressed += scanButtons[b].isPressed();
+        delayMicroseconds(100);
+    }
+    stop = std::chrono::steady_clock::now();
+    ns[1] = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+    printf("buttons (%u short presses in a delay(), %u long presses, %u bouncing presses in a delay())\n", 5, 5, 5);
+    const char *names[2] = {"polled", "pin interrupt"};
+    for(uint8_t b = 0; b < 2; b++){
+        printf("%-14s %4u pressed %4u released %4u released after 1 s\n", names[b],
+               presses[b].pressed, presses[b].released, presses[b].long_released);
+    }
+    printf("scan of 3 buttons (%u scans, %u pressed)\n", BUTTON_SCANS, pressed);
+    printf("%-14s %10.1f ns/scan\n", "Button::read()", ((double)ns[0] - ns[2]) / BUTTON_SCANS);
+    printf("%-14s %10.1f ns/scan\n\n", "ButtonBank", ((double)ns[1] - ns[2]) / BUTTON_SCANS);
+    // with the interrupt, no press is lost and a short press in a
+    // delay() is not taken as a long press
+    if(presses[1].pressed != expected.pressed || presses[1].released != expected.released ||
+       presses[1].long_released != expected.long_released){
+        printf("ERROR: button presses are lost\n");
+        return false;
+    }
+    if(!edgeTime){
+        printf("ERROR: button changes don't have the time of the edge\n");
+        return false;
+    }
+    return true;
+}
+
+// Button traces: "time button pressed" per line, as printed by the
+// firmware compiled with -DBUTTON_TRACE (button 0 = UP, 1 = DOWN, 2 = PUSH),
+// and the gestures that have to be recognized
+struct BenchGesture {
+    uint8_t gesture;
+    uint8_t buttons;
+    uint32_t time;
+};
+struct BenchTrace {
+    const char *name;
+    const char *trace;
+    BenchGesture expected[4];
+};
+static const BenchTrace benchTraces[] = {
+    {"click", "0 2 1\n120 2 0\n",
+        {{GESTURE_PRESS, NAV_PUSH, 0}, {GESTURE_CLICK, NAV_PUSH, 120}}},
+    {"double click", "0 2 1\n100 2 0\n250 2 1\n350 2 0\n",
+        {{GESTURE_PRESS, NAV_PUSH, 0}, {GESTURE_CLICK, NAV_PUSH, 100},
+         {GESTURE_PRESS, NAV_PUSH, 250}, {GESTURE_DOUBLE_CLICK, NAV_PUSH, 350}}},
+    {"two clicks", "0 0 1\n100 0 0\n600 0 1\n700 0 0\n",
+        {{GESTURE_PRESS, NAV_UP, 0}, {GESTURE_CLICK, NAV_UP, 100},
+         {GESTURE_PRESS, NAV_UP, 600}, {GESTURE_CLICK, NAV_UP, 700}}},
+    {"long press", "0 1 1\n1300 1 0\n",
+        {{GESTURE_PRESS, NAV_DOWN, 0}, {GESTURE_LONG_PRESS, NAV_DOWN, 800},
+         {GESTURE_HOLD_REPEAT, NAV_DOWN, 1000}, {GESTURE_HOLD_REPEAT, NAV_DOWN, 1200}}},
+    {"chord", "0 0 1\n40 1 1\n300 0 0\n320 1 0\n",
+        {{GESTURE_PRESS, NAV_UP, 0}, {GESTURE_PRESS, NAV_DOWN, 40}, {GESTURE_CHORD, NAV_UP | NAV_DOWN, 40}}},
+    {"no chord", "0 0 1\n200 1 1\n300 0 0\n350 1 0\n",
+        {{GESTURE_PRESS, NAV_UP, 0}, {GESTURE_PRESS, NAV_DOWN, 200},
+         {GESTURE_CLICK, NAV_UP, 300}, {GESTURE_CLICK, NAV_DOWN, 350}}},
+};
+static const uint8_t nBenchTraces = sizeof(benchTraces) / sizeof(benchTraces[0]);
+static const uint8_t benchButtonPins[GESTURE_BUTTONS] = {NAV_BUTTON_UP_PIN, NAV_BUTTON_DOWN_PIN, NAV_BUTTON_PUSH_PIN};
+
+// compare the recognized gestures with the expected ones
+// the times are only compared if compareTime is set
+static bool benchGestures(GestureRecognizer &gestures, const BenchGesture *expected, uint32_t startTime, bool compareTime){
+    GestureEvent event;
+    uint8_t n = 0;
+    bool same = true;
+    while(gestures.next(event)){
+        if(n >= 4 || expected[n].gesture == 0 || event.gesture != expected[n].gesture ||
+           event.buttons != expected[n].buttons || (compareTime && event.time - startTime != expected[n].time))
+            same = false;
+        n++;
+    }
+    return same && (n >= 4 || expected[n].gesture == 0);
+}
+
+// replay the traces through the gesture recognizer, and as pin levels
+// through the button bank and updateButtons() of the watch
+// (with the same times: the bank passes the times of the edges)
+static bool runGestures(){
+    uint32_t differences = 0;
+    printf("gestures (%u traces)\n", nBenchTraces);
+    printf("%-14s %-10s %-10s\n", "", "replayed", "pins");
+    for(uint8_t t = 0; t < nBenchTraces; t++){
+        const BenchTrace &trace = benchTraces[t];
+        GestureRecognizer gestures;
+        gestures.setChord(NAV_UP | NAV_DOWN);
+        uint32_t time = 0;
+        uint32_t lastTime = 0;
+        unsigned button;
+        unsigned pressed;
+        int length;
+        for(const char *line = trace.trace; sscanf(line, "%u %u %u\n%n", &time, &button, &pressed, &length) == 3; line += length){
+            gestures.transition(button, pressed, time);
+            lastTime = time;
+        }
+        gestures.update(lastTime + 2000);
+        bool replayed = benchGestures(gestures, trace.expected, 0, true);
+
+        // the same with the pins, updateButtons() every 10 ms
+        Watch.gestures.clear();
+        Watch.updateButtons();
+        uint32_t startTime = millis();
+        const char *line = trace.trace;
+        bool more = sscanf(line, "%u %u %u\n%n", &time, &button, &pressed, &length) == 3;
+        for(uint32_t ms = 0; ms < lastTime + 2000; ms++){
+            while(more && time == ms){
+                host_setPin(benchButtonPins[button], !pressed);
+                line += length;
+                more = sscanf(line, "%u %u %u\n%n", &time, &button, &pressed, &length) == 3;
+            }
+            if(ms % 10 == 0)
+                Watch.updateButtons();
+            delay(1);
+        }
+        bool pins = benchGestures(Watch.gestures, trace.expected, startTime, true);
+        printf("%-14s %-10s %-10s\n", trace.name, replayed ? "ok" : "DIFFERENT", pins ? "ok" : "DIFFERENT");
+        differences += !replayed + !pins;
+    }
+
+    // DOWN held during a delay(2500): the hold repeats leave room in the
+    // queue for a press of the other buttons, the rest is dropped
+    GestureRecognizer held;
+    held.transition(1, true, 0);
+    held.update(2500);
+    held.transition(0, true, 2500);
+    held.transition(2, true, 2500);
+    GestureEvent event;
+    uint32_t queued = 0;
+    while(held.next(event))
+        queued++;
+    printf("%-14s %u queued, %u repeats dropped, %u lost\n", "held 2.5 s", queued, held.droppedRepeats, held.lost);
+    // press, long press, 2 repeats and the 2 presses, 6 repeats dropped
+    if(queued != 6 || held.droppedRepeats != 6 || held.lost != 0)
+        differences++;
+    printf("\n");
+    if(differences)
+        printf("ERROR: %u gesture traces give other gestures\n", differences);
+    return differences == 0;
+}
+
+// sysTime_now() up to v2.2: one step per second since the last call
+class LegacySysTime {
+    public:
+        LegacySysTime():prevMillis(millis()), sysTime(0) {}
+        time_t now(){
+            while(millis() - prevMillis >= 1000){
+                sysTime++;
+                prevMillis += 1000;
+            }
+            return sysTime;
+        }
+    private:
+        uint32_t prevMillis;
+        uint32_t sysTime;
+};
+
+// the system clock over 4 wraps of micros() (4.8 hours), read every
+// 999.9 ms, and the time with a fraction after setTime()
+// the time of a read after one hour without a read is compared with
+// sysTime_now() up to v2.2
+#define CLOCK_STEPS 17300
+#define CLOCK_REPEAT 1000
+static bool runClock(){
+    uint32_t errors = 0;
+    SystemClock clock;
+    uint64_t hostStart = host_micros64();
+    uint64_t clockStart = clock.upTimeMicros();
+    for(uint32_t i = 0; i < CLOCK_STEPS; i++){
+        delayMicroseconds(999900);
+        if(clock.upTimeMicros() - clockStart != host_micros64() - hostStart)
+            errors++;
+    }
+    ClockTime time = {BENCH_START_EPOCH, 250000};
+    clock.setTime(time);
+    delay(1750);
+    ClockTime now = clock.now();
+    if(now.seconds != BENCH_START_EPOCH + 2 || now.micros != 0)
+        errors++;
+    time.seconds = BENCH_START_EPOCH + 1;
+    time.micros = 999000;
+    if(clock.difference(time) != 1000)
+        errors++;
+
+    uint64_t ns[2] = {0, 0};
+    time_t sum = 0;
+    for(uint32_t i = 0; i < CLOCK_REPEAT; i++){
+        LegacySysTime legacy;
+        delay(3600000);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        sum += legacy.now();
+        std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+        ns[0] += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+        // read once per wrap
+        clock.upTimeMicros();
+        delay(3600000);
+        start = std::chrono::steady_clock::now();
+        sum += clock.now().seconds;
+        stop = std::chrono::steady_clock::now();
+        ns[1] += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    }
+    // both clocks are read
+    if(sum == 0)
+        errors++;
+    printf("system clock (%u reads over %.1f hours, %u reads after 1 hour)\n", CLOCK_STEPS,
+           CLOCK_STEPS * 0.9999 / 3600, CLOCK_REPEAT);
+    printf("%-14s %10.1f ns/read\n", "sysTime_now()", (double)ns[0] / CLOCK_REPEAT);
+    printf("%-14s %10.1f ns/read\n\n", "SystemClock", (double)ns[1] / CLOCK_REPEAT);
+    if(errors)
+        printf("ERROR: %u wrong system clock times\n", errors);
+    return errors == 0;
+}
+
+// the up-time of the watch is 37 ppm slow against the server, which
+// answers with up to +-20 ms jitter. The time is fetched every 2 hours
+// for 12 hours, then the clock runs for 24 hours without a sync.
+#define DRIFT_PPB 37000
+#define DRIFT_JITTER_US 20000
+static uint32_t driftRandom = 12345;
+// server time in us at the up-time in us
+static int64_t driftServerTime(uint64_t upTime, bool jitter){
+    int64_t time = (int64_t)BENCH_START_EPOCH * 1000000 + upTime + (int64_t)upTime / 1000 * DRIFT_PPB / 1000000;
+    if(jitter){
+        driftRandom = driftRandom * 1103515245 + 12345;
+        time += (int32_t)((driftRandom >> 8) % (2 * DRIFT_JITTER_US + 1)) - DRIFT_JITTER_US;
+    }
+    return time;
+}
+
+static ClockTime driftClockTime(int64_t micros){
+    ClockTime time;
+    time.seconds = micros / 1000000;
+    time.micros = micros % 1000000;
+    return time;
+}
+
+// the clocks are read once per hour (at least once per wrap of micros())
+static void driftHours(SystemClock &corrected, SystemClock &uncorrected, uint32_t hours){
+    for(uint32_t i = 0; i < hours; i++){
+        delay(3600000);
+        corrected.upTimeMicros();
+        uncorrected.upTimeMicros();
+    }
+}
+
+static bool runDrift(){
+    SystemClock corrected;
+    SystemClock uncorrected;
+    DriftEstimator drift;
+    uint64_t start = corrected.upTimeMicros();
+    uncorrected.upTimeMicros();
+    for(uint8_t sync = 0; sync < 7; sync++){
+        if(sync > 0)
+            driftHours(corrected, uncorrected, 2);
+        // like "Get Server Time" and sample_clockDrift()
+        uint64_t upTime = corrected.upTimeMicros();
+        ClockTime server = driftClockTime(driftServerTime(upTime - start, true));
+        corrected.setTime(server);
+        uncorrected.setTime(server);
+        drift.add(upTime, SystemClock::toMicros(server) - (int64_t)upTime);
+        corrected.setRate(drift.rate());
+    }
+    driftHours(corrected, uncorrected, 24);
+    uint64_t upTime = corrected.upTimeMicros();
+    ClockTime server = driftClockTime(driftServerTime(upTime - start, false));
+    int64_t errors[2] = {corrected.difference(server), uncorrected.difference(server)};
+    printf("clock drift (%.1f ppm, +-%u ms jitter, 7 NTP times in 12 hours)\n", DRIFT_PPB / 1000.0, DRIFT_JITTER_US / 1000);
+    printf("fitted rate    %10.3f ppm\n", drift.rate() / 1000.0);
+    printf("%-14s %10.1f ms after 24 hours without NTP\n", "uncorrected", errors[1] / 1000.0);
+    printf("%-14s %10.1f ms after 24 hours without NTP\n\n", "corrected", errors[0] / 1000.0);
+    // 2 ppm of 24 hours: 173 ms
+    if(!drift.valid() || abs(drift.rate() - DRIFT_PPB) > 2000 || abs(errors[0]) > 200000){
+        printf("ERROR: the drift is not corrected\n");
+        return false;
+    }
+
+    // a time 5 s off after 2 hours is no drift (694 ppm):
+    // the fit is rejected and counted, the rate is kept
+    DriftEstimator wrong;
+    wrong.add(0, 0);
+    wrong.add(3600000000ULL, 3600);
+    bool accepted = wrong.add(7200000000ULL, 5000000);
+    printf("%-14s %10u rejected fits, %.3f ppm kept\n", "wrong time", wrong.rejected, wrong.rate() / 1000.0);
+    // the firmware samples only the times that SNTP has set, a second
+    // "Compare Time" without a new SNTP time adds no sample
+    clockDrift.clear();
+    // like setup()
+    settimeofday_cb(receive_sntpTime);
+    host_sntpUpdate();
+    sample_clockDrift();
+    sample_clockDrift();
+    uint8_t samples = clockDrift.count;
+    clockDrift.clear();
+    printf("%-14s %10u samples of 1 SNTP time\n\n", "SNTP", samples);
+    if(accepted || wrong.rejected != 1 || wrong.rate() != 1000 || samples != 1){
+        printf("ERROR: the drift samples are wrong\n");
+        return false;
+    }
+    return true;
+}
+
+static bool sameDateTime(const tm &a, const tm &b){
+    return a.tm_sec == b.tm_sec && a.tm_min == b.tm_min && a.tm_hour == b.tm_hour &&
+           a.tm_mday == b.tm_mday && a.tm_mon == b.tm_mon && a.tm_year == b.tm_year &&
+           a.tm_wday == b.tm_wday && a.tm_yday == b.tm_yday && a.tm_isdst == b.tm_isdst;
+}
+
+// the calendar against localtime_r(): every 7 s of 2020 (both DST
+// transitions at other seconds of the minute), the clock goes back 30 s
+// every 997 steps (a corrected time), and every second of the days of
+// the transitions
+// then one hour of loop() (100 calls per second) with both
+#define CALENDAR_2020 1577833200
+#define CALENDAR_SPRING 1585440000
+#define CALENDAR_AUTUMN 1603584000
+#define CALENDAR_CALLS 100
+static bool runCalendar(){
+    uint32_t differences = 0;
+    TimeZone zone;
+    zone.begin(TZ_INFO);
+    Calendar calendar(zone);
+    tm reference;
+    uint32_t steps = 0;
+    for(time_t epoch = CALENDAR_2020; epoch < CALENDAR_2020 + 366 * 24 * 3600; epoch += 7){
+        if(++steps % 997 == 0)
+            epoch -= 30;
+        localtime_r(&epoch, &reference);
+        if(!sameDateTime(calendar.update(epoch), reference))
+            differences++;
+    }
+    const time_t days[2] = {CALENDAR_SPRING, CALENDAR_AUTUMN};
+    for(uint8_t d = 0; d < 2; d++){
+        for(time_t epoch = days[d] - 24 * 3600; epoch < days[d] + 24 * 3600; epoch++){
+            steps++;
+            localtime_r(&epoch, &reference);
+            if(!sameDateTime(calendar.update(epoch), reference))
+                differences++;
+        }
+    }
+
+    uint64_t ns[2] = {0, 0};
+    uint32_t seconds = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(time_t epoch = BENCH_START_EPOCH; epoch < BENCH_START_EPOCH + 3600; epoch++){
+        for(uint8_t i = 0; i < CALENDAR_CALLS; i++){
+            localtime_r(&epoch, &reference);
+            seconds += reference.tm_sec;
+        }
+    }
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+    ns[0] = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    Calendar loopCalendar(zone);
+    start = std::chrono::steady_clock::now();
+    for(time_t epoch = BENCH_START_EPOCH; epoch < BENCH_START_EPOCH + 3600; epoch++){
+        for(uint8_t i = 0; i < CALENDAR_CALLS; i++)
+            seconds -= loopCalendar.update(epoch).tm_sec;
+    }
+    stop = std::chrono::steady_clock::now();
+    ns[1] = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+    printf("calendar (%u times of 2020 compared, %u conversions)\n", steps, calendar.conversions);
+    printf("one hour of loop() (%u calls per second)\n", CALENDAR_CALLS);
+    printf("%-14s %10.1f ns/call %8u conversions\n", "localtime_r()", (double)ns[0] / (3600 * CALENDAR_CALLS), 3600 * CALENDAR_CALLS);
+    printf("%-14s %10.1f ns/call %8u conversions\n\n", "Calendar", (double)ns[1] / (3600 * CALENDAR_CALLS), loopCalendar.conversions);
+    // both have read the same seconds
+    if(seconds != 0)
+        differences++;
+    if(differences)
+        printf("ERROR: %u local times differ from localtime_r()\n", differences);
+    return differences == 0;
+}
+
+// the time zones against localtime_r() with the same rule in TZ:
+// every 599 s of the years of the table, every 3607 s from 1970 to
+// 2100 (outside of the table, it is calculated again) and the second
+// before and at every transition of nextTransition()
+// then the time of begin() and of one local time
+#define ZONE_TABLE_START 1577836800
+#define ZONE_TABLE_END 1893456000
+#define ZONE_END 4102444800LL
+#define ZONE_CALLS 1000000
+static const char *benchZones[] = {
+    "CET-1CEST-2,M3.5.0/02:00:00,M10.5.0/03:00:00",
+    "GMT0BST,M3.5.0/1,M10.5.0",
+    "EST5EDT,M3.2.0,M11.1.0",
+    "AEST-10AEDT,M10.1.0,M4.1.0/3",
+    "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0",
+    "<-04>4<-03>,M9.1.6/24,M4.1.6/24",
+    "<-02>2<-01>,M3.5.0/-1,M10.5.0/0",
+    "XST3XDT,J60/2,J300/2",
+    "YST3YDT,59,299",
+    "IST-5:30",
+    "JST-9"
+};
+
+static bool compareZone(TimeZone &zone, time_t epoch){
+    tm reference;
+    tm dateTime;
+    localtime_r(&epoch, &reference);
+    zone.localTime(epoch, dateTime);
+    return sameDateTime(dateTime, reference) && zone.offset(epoch) == reference.tm_gmtoff;
+}
+
+static bool runTimeZone(){
+    uint32_t differences = 0;
+    uint32_t steps = 0;
+    uint32_t transitions = 0;
+    uint64_t ns[3] = {0, 0, 0};
+    uint32_t seconds = 0;
+    printf("time zones (%u years in the table)\n", TZ_YEARS);
+    for(uint8_t z = 0; z < sizeof(benchZones) / sizeof(benchZones[0]); z++){
+        setenv("TZ", benchZones[z], 1);
+        tzset();
+        TimeZone zone;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        bool valid = zone.begin(benchZones[z]);
+        std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+        ns[0] += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+        uint32_t zoneDifferences = valid ? 0 : 1;
+        for(time_t epoch = ZONE_TABLE_START; epoch < ZONE_TABLE_END; epoch += 599, steps++){
+            if(!compareZone(zone, epoch))
+                zoneDifferences++;
+        }
+        for(time_t epoch = 0; epoch < ZONE_END; epoch += 3607, steps++){
+            if(!compareZone(zone, epoch))
+                zoneDifferences++;
+        }
+        for(time_t epoch = zone.nextTransition(ZONE_TABLE_START); epoch < ZONE_TABLE_END; epoch = zone.nextTransition(epoch)){
+            tm before;
+            tm after;
+            time_t last = epoch - 1;
+            localtime_r(&last, &before);
+            localtime_r(&epoch, &after);
+            // only a transition at the end of the table has no change
+            if(after.tm_gmtoff == before.tm_gmtoff && zone.hasDaylightSaving())
+                zoneDifferences++;
+            if(!compareZone(zone, last) || !compareZone(zone, epoch))
+                zoneDifferences++;
+            transitions++;
+            steps += 2;
+        }
+        printf("%-40s %s\n", benchZones[z], zoneDifferences ? "differs" : "same");
+        differences += zoneDifferences;
+    }
+
+    setenv("TZ", TZ_INFO, 1);
+    tzset();
+    TimeZone zone;
+    zone.begin(TZ_INFO);
+    tm dateTime;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(time_t epoch = BENCH_START_EPOCH; epoch < BENCH_START_EPOCH + ZONE_CALLS * 31; epoch += 31){
+        localtime_r(&epoch, &dateTime);
+        seconds += dateTime.tm_sec;
+    }
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+    ns[1] = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    start = std::chrono::steady_clock::now();
+    for(time_t epoch = BENCH_START_EPOCH; epoch < BENCH_START_EPOCH + ZONE_CALLS * 31; epoch += 31){
+        zone.localTime(epoch, dateTime);
+        seconds -= dateTime.tm_sec;
+    }
+    stop = std::chrono::steady_clock::now();
+    ns[2] = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    if(seconds != 0)
+        differences++;
+
+    uint8_t nZones = sizeof(benchZones) / sizeof(benchZones[0]);
+    printf("%u times and %u transitions compared\n", steps, transitions);
+    printf("%-14s %10.1f ns/zone (parse and %u transitions)\n", "begin()", (double)ns[0] / nZones, 2 * TZ_YEARS);
+    printf("%-14s %10.1f ns/call\n", "localtime_r()", (double)ns[1] / ZONE_CALLS);
+    printf("%-14s %10.1f ns/call\n\n", "TimeZone", (double)ns[2] / ZONE_CALLS);
+    if(differences)
+        printf("ERROR: %u local times differ from localtime_r()\n", differences);
+    return differences == 0;
+}
+
+// the globals of main.cpp as after a reset
+static void benchReset(){
+    systemClock = SystemClock();
+    watchState = WatchState();
+    time_valid = false;
+    time_approximate = false;
+    durable_hour = -1;
+}
+
+// the time is set like by "Get Server Time" and saved every second
+// for 10 minutes, then the watch is reset, loses its power, is reset
+// with the approximate time and has a broken copy in the RTC memory.
+// A restore doesn't write the flash. The flash writes are counted for
+// one day of saves like in loop(), without the first seconds of the
+// hours.
+#define STATE_RATE 12345
+static bool runPersistence(){
+    uint32_t errors = 0;
+    uint32_t zero[sizeof(WatchState) / 4] = {0};
+    benchReset();
+    if(restore_watchState() != STATE_NONE || time_valid || watchState.bootCount != 1)
+        errors++;
+
+    ClockTime time = {BENCH_START_EPOCH, 500000};
+    systemClock.setTime(time);
+    systemClock.setRate(STATE_RATE);
+    time_valid = true;
+    save_watchState(true);
+    int64_t synced = SystemClock::toMicros(systemClock.now());
+    for(uint16_t i = 0; i < 600; i++){
+        delay(1000);
+        save_watchState(false);
+    }
+    int64_t saved = SystemClock::toMicros(systemClock.now());
+
+    // reset: the state of the RTC memory
+    benchReset();
+    uint32_t restoreWrites = EEPROM.flashWrites;
+    uint8_t source = restore_watchState();
+    int64_t restored = SystemClock::toMicros(systemClock.now());
+    printf("watch state (%u bytes)\n", (unsigned)sizeof(WatchState));
+    printf("%-14s boot %u, %.3f s after the sync, %d ppb\n", "reset", watchState.bootCount,
+           (restored - synced) / 1000000.0, systemClock.rate);
+    if(source != STATE_RTC || restored != saved || systemClock.rate != STATE_RATE || watchState.bootCount != 2 ||
+       !time_valid || time_approximate || durable_hour != calendar.update(systemClock.now().seconds).tm_hour)
+        errors++;
+
+    // power loss: the state of the EEPROM, saved with the sync
+    // (with the boot counter of then)
+    ESP.rtcUserMemoryWrite(STATE_RTC_OFFSET, zero, sizeof(zero));
+    benchReset();
+    source = restore_watchState();
+    printf("%-14s boot %u, %.3f s after the sync%s\n", "power loss", watchState.bootCount,
+           (SystemClock::toMicros(systemClock.now()) - synced) / 1000000.0, time_approximate ? ", approximate" : "");
+    // the time runs on, but it is only approximate
+    if(source != STATE_EEPROM || SystemClock::toMicros(systemClock.now()) != synced || watchState.bootCount != 2 ||
+       time_valid || !time_approximate)
+        errors++;
+
+    // the approximate time is saved into the RTC memory every second
+    // and restored after a reset, still approximate
+    for(uint16_t i = 0; i < 10; i++){
+        delay(1000);
+        save_watchState(false);
+    }
+    saved = SystemClock::toMicros(systemClock.now());
+    benchReset();
+    source = restore_watchState();
+    restoreWrites = EEPROM.flashWrites - restoreWrites;
+    printf("%-14s boot %u, %.3f s after the sync%s\n", "reset", watchState.bootCount,
+           (SystemClock::toMicros(systemClock.now()) - synced) / 1000000.0, time_approximate ? ", approximate" : "");
+    printf("%-14s %u flash writes\n", "3 restores", restoreWrites);
+    if(source != STATE_RTC || SystemClock::toMicros(systemClock.now()) != saved || watchState.bootCount != 3 ||
+       time_valid || !time_approximate || restoreWrites != 0)
+        errors++;
+
+    // one byte of the time is changed in the RTC memory
+    WatchState state;
+    ESP.rtcUserMemoryRead(STATE_RTC_OFFSET, (uint32_t *)&state, sizeof(state));
+    ((uint8_t *)&state.time)[2] ^= 0x10;
+    ESP.rtcUserMemoryWrite(STATE_RTC_OFFSET, (uint32_t *)&state, sizeof(state));
+    benchReset();
+    source = restore_watchState();
+    printf("%-14s %s\n", "broken copy", source == STATE_EEPROM ? "restored from EEPROM" : "NOT restored from EEPROM");
+    if(source != STATE_EEPROM || watchState.bootCount != 2)
+        errors++;
+
+    // the time is set again, like by "Get Server Time"
+    time_valid = true;
+    time_approximate = false;
+    uint32_t flashWrites = EEPROM.flashWrites;
+    uint32_t saves = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(uint32_t tick = 0; tick < BENCH_TICKS; tick++){
+        delay(1000);
+        // the first seconds of every hour are missed, like during
+        // the screen of "Compare Time"
+        if(tick % 3600 < 3)
+            continue;
+        // from the hour after the one of the restored time
+        dateTime.tm_hour = (tick / 3600 + 1) % 24;
+        save_watchState_everySecond();
+        saves++;
+    }
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+    uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    flashWrites = EEPROM.flashWrites - flashWrites;
+    printf("%-14s %10.1f ns/save, %u flash writes per day\n\n", "save", (double)ns / saves, flashWrites);
+    // once per hour
+    if(flashWrites != 24)
+        errors++;
+
+    benchReset();
+    if(errors)
+        printf("ERROR: %u wrong restored states or flash writes\n", errors);
+    return errors == 0;
+}
+
+// Button-to-photon latency: timelines of pin edges (time in us after
+// the start) are replayed with the simulated clock while loop() of the
+// firmware runs, also in the middle of its delay() calls. The latency of
+// the measured press is the time from its edge to the end of the first
+// transfer to the switched on display after loop() has read a gesture.
+// (loop() reacts on the press gesture.)
+struct BenchEdge {
+    uint32_t us;
+    uint8_t pin;
+    uint8_t level;
+};
+struct BenchTimeline {
+    const char *name;
+    // the screen is switched off before the timeline starts
+    bool screenOff;
+    // index of the measured edge
+    uint8_t measured;
+    // Screen_permanent_on at the end: the screen timer was switched
+    bool permanentOn;
+    uint8_t nEdges;
+    BenchEdge edges[8];
+};
+static const BenchTimeline benchTimelines[] = {
+    // a bouncing click switches the screen on
+    {"wake", true, 0, false, 6,
+        {{0, NAV_BUTTON_PUSH_PIN, LOW}, {300, NAV_BUTTON_PUSH_PIN, HIGH}, {700, NAV_BUTTON_PUSH_PIN, LOW},
+         {120000, NAV_BUTTON_PUSH_PIN, HIGH}, {120400, NAV_BUTTON_PUSH_PIN, LOW}, {120900, NAV_BUTTON_PUSH_PIN, HIGH}}},
+    {"UP-Time", false, 0, false, 2,
+        {{0, NAV_BUTTON_PUSH_PIN, LOW}, {120000, NAV_BUTTON_PUSH_PIN, HIGH}}},
+    // PUSH again while the UP-Time is shown
+    {"screen timer", false, 2, true, 4,
+        {{0, NAV_BUTTON_PUSH_PIN, LOW}, {120000, NAV_BUTTON_PUSH_PIN, HIGH},
+         {600000, NAV_BUTTON_PUSH_PIN, LOW}, {720000, NAV_BUTTON_PUSH_PIN, HIGH}}},
+    // the same within GESTURE_DOUBLE_MS: the second press is a press too
+    {"quick timer", false, 2, true, 4,
+        {{0, NAV_BUTTON_PUSH_PIN, LOW}, {120000, NAV_BUTTON_PUSH_PIN, HIGH},
+         {300000, NAV_BUTTON_PUSH_PIN, LOW}, {400000, NAV_BUTTON_PUSH_PIN, HIGH}}},
+    // PUSH while the result of "Compare Time" is shown
+    {"after compare", false, 2, false, 4,
+        {{0, NAV_BUTTON_UP_PIN, LOW}, {120000, NAV_BUTTON_UP_PIN, HIGH},
+         {1000000, NAV_BUTTON_PUSH_PIN, LOW}, {1120000, NAV_BUTTON_PUSH_PIN, HIGH}}},
+};
+static const uint8_t nBenchTimelines = sizeof(benchTimelines) / sizeof(benchTimelines[0]);
+
+// loop() of v1.x for the numbers before the button bank and the
+// gestures: the buttons are polled with the old read() once per pass,
+// the first press switches the screen on and waits 250 ms, the UP-Time
+// screen polls PUSH in a blocking loop of 2.5 s and "Compare Time"
+// blocks for 2.5 s. The screens and the clock face are the ones of the
+// firmware (loop() without a gesture). The buttons of this loop are on
+// other pins, so the button bank of the firmware doesn't see them.
+#define BASELINE_PIN(pin) ((pin) - NAV_BUTTON_UP_PIN)
+static LegacyButton baselineButtons[3] = {LegacyButton(BASELINE_PIN(NAV_BUTTON_UP_PIN)),
+    LegacyButton(BASELINE_PIN(NAV_BUTTON_DOWN_PIN)), LegacyButton(BASELINE_PIN(NAV_BUTTON_PUSH_PIN))};
+static uint8_t baselineStates[3];
+// presses seen by the old loop()
+static uint32_t baselineTaken;
+
+static bool baselineWasPressed(uint8_t button){
+    uint8_t state = baselineButtons[button].read();
+    bool pressed = state && !baselineStates[button];
+    baselineStates[button] = state;
+    if(pressed)
+        baselineTaken++;
+    return pressed;
+}
+
+static void baselineLoop(){
+    bool pressed[3];
+    for(uint8_t b = 0; b < 3; b++)
+        pressed[b] = baselineWasPressed(b);
+    if(pressed[0] || pressed[1] || pressed[2]){
+        if(!Watch.screenState){
+            Watch.screenOn();
+            // delay to prevent false button presses
+            delay(250);
+        } else if(pressed[0]){
+            if(WiFi_connection(false) && fetch_NTPTime("Compare Time")){
+                Watch.clearScreen();
+                Watch.println("Compare Time");
+            }
+            Watch.updateDisplay();
+            clockFace.invalidate();
+            delay(2500);
+        } else if(pressed[2]){
+            upTimeScreen.invalidate();
+            upTime_second = -1;
+            print_upTime();
+            Watch.updateDisplay();
+            clockFace.invalidate();
+            unsigned long display_timer = millis();
+            while(millis() - display_timer < 2500){
+                if(baselineWasPressed(2)){
+                    Screen_permanent_on = !Screen_permanent_on;
+                    display_timer = millis();
+                    screenTimerText.setText(Screen_permanent_on ? "Screen Timer: OFF" : "Screen Timer: ON");
+                    screenTimerScreen.invalidate();
+                    screenTimerScreen.update(Watch);
+                    Watch.updateDisplay();
+                }
+                delay(10);
+            }
+        }
+        displayOffTimer = millis();
+    }
+    // the clock face, the screen timer and the delay(10)
+    loop();
+}
+
+static const BenchTimeline *latencyTimeline;
+static bool latencyBaseline;
+static uint64_t latencyStart;
+static uint8_t latencyNext;
+static bool latencyArmed;
+static uint32_t latencyTaken;
+static uint64_t latencyPress;
+static uint64_t latencyPhoton;
+
+// presses (old loop()) or gestures (firmware) that loop() has read
+static uint32_t latencyReads(){
+    return latencyBaseline ? baselineTaken : Watch.gestures.taken;
+}
+
+// set the pins of the timeline up to now
+static uint64_t benchTimeline(uint64_t now){
+    while(latencyNext < latencyTimeline->nEdges){
+        const BenchEdge &edge = latencyTimeline->edges[latencyNext];
+        uint64_t time = latencyStart + edge.us;
+        if(time > now)
+            return time;
+        host_setPin(latencyBaseline ? BASELINE_PIN(edge.pin) : edge.pin, edge.level);
+        if(latencyNext == latencyTimeline->measured){
+            latencyArmed = true;
+            latencyTaken = latencyReads();
+            latencyPress = time;
+        }
+        latencyNext++;
+    }
+    return UINT64_MAX;
+}
+
+static void benchTransmission(){
+    if(latencyArmed && latencyReads() != latencyTaken && Watch.OLED.panelOn){
+        latencyPhoton = host_micros64();
+        latencyArmed = false;
+    }
+}
+
+// the value at the given fraction of the sorted latencies, in ms
+static double latencyAt(std::vector<uint64_t> &latencies, double fraction){
+    std::sort(latencies.begin(), latencies.end());
+    return latencies[(size_t)(latencies.size() * fraction)] / 1000.0;
+}
+
+// every timeline is replayed LATENCY_BATCHES x LATENCY_RUNS times with
+// both loops, starting at a random time within a second (other phase of
+// the loop and of the seconds). The clock is simulated, so a batch gives
+// the same numbers in every run of the benchmark: the spread of the
+// batches (other start times) shows how stable the numbers are.
+#define LATENCY_BATCHES 5
+#define LATENCY_RUNS 100
+static bool runLatency(){
+    uint32_t missing = 0;
+    uint32_t lostBefore = 0;
+    uint32_t wrongScreens = 0;
+    Watch.setCatchUpRender(catchUp_clockFace);
+    Wire.onTransmission = benchTransmission;
+    printf("button-to-photon latency (%u x %u runs per timeline, before: loop() of v1.x)\n", LATENCY_BATCHES, LATENCY_RUNS);
+    printf("%-14s %-7s %5s %26s %26s %10s\n", "", "", "lost", "median ms (batches)", "95% ms (batches)", "max ms");
+    for(uint8_t t = 0; t < nBenchTimelines; t++){
+        const BenchTimeline &timeline = benchTimelines[t];
+        for(uint8_t pass = 0; pass < 2; pass++){
+            bool baseline = pass == 0;
+            latencyBaseline = baseline;
+            std::vector<uint64_t> latencies;
+            double medians[2] = {1e12, 0};
+            double percentiles[2] = {1e12, 0};
+            uint32_t lost = 0;
+            uint32_t random = 12345;
+            for(uint8_t batch = 0; batch < LATENCY_BATCHES; batch++){
+                std::vector<uint64_t> batchLatencies;
+                for(uint32_t run = 0; run < LATENCY_RUNS; run++){
+                    // the clock face with the screen timer on
+                    upTime_shown = false;
+                    Screen_permanent_on = false;
+                    if(timeline.screenOff)
+                        Watch.screenOff();
+                    else if(!Watch.screenState)
+                        Watch.screenOn();
+                    Watch.gestures.clear();
+                    displayOffTimer = millis();
+                    loop();
+
+                    random = random * 1103515245 + 12345;
+                    latencyTimeline = &timeline;
+                    latencyStart = host_micros64() + (random >> 8) % 1000000;
+                    latencyNext = 0;
+                    latencyArmed = false;
+                    latencyPhoton = 0;
+                    host_setTimeline(benchTimeline);
+                    // long enough for the screens that block loop()
+                    uint64_t end = latencyStart + timeline.edges[timeline.nEdges - 1].us + 3000000;
+                    while(host_micros64() < end){
+                        if(baseline)
+                            baselineLoop();
+                        else
+                            loop();
+                    }
+                    host_setTimeline(NULL);
+                    if(latencyPhoton)
+                        batchLatencies.push_back(latencyPhoton - latencyPress);
+                    else
+                        lost++;
+                    // the old loop() loses the press after "Compare Time"
+                    if(!baseline && Screen_permanent_on != timeline.permanentOn)
+                        wrongScreens++;
+                }
+                if(batchLatencies.empty())
+                    continue;
+                double median = latencyAt(batchLatencies, 0.5);
+                double percentile = latencyAt(batchLatencies, 0.95);
+                medians[0] = min(medians[0], median);
+                medians[1] = max(medians[1], median);
+                percentiles[0] = min(percentiles[0], percentile);
+                percentiles[1] = max(percentiles[1], percentile);
+                latencies.insert(latencies.end(), batchLatencies.begin(), batchLatencies.end());
+            }
+            if(baseline)
+                lostBefore += lost;
+            else
+                missing += lost;
+            if(latencies.empty()){
+                printf("%-14s %-7s %5u\n", baseline ? timeline.name : "", baseline ? "before" : "now", lost);
+                continue;
+            }
+            printf("%-14s %-7s %5u %8.1f (%6.1f-%6.1f) %8.1f (%6.1f-%6.1f) %10.1f\n", baseline ? timeline.name : "",
+                   baseline ? "before" : "now", lost,
+                   latencyAt(latencies, 0.5), medians[0], medians[1],
+                   latencyAt(latencies, 0.95), percentiles[0], percentiles[1],
+                   latencies.back() / 1000.0);
+        }
+    }
+    printf("\n");
+    Wire.onTransmission = NULL;
+    Watch.setCatchUpRender(NULL);
+    Watch.screenOn();
+    if(missing)
+        printf("ERROR: %u presses are not shown on the display\n", missing);
+    if(wrongScreens)
+        printf("ERROR: the screen timer is wrong after %u runs\n", wrongScreens);
+    return missing == 0 && wrongScreens == 0;
+}
+
+// draw texts with every font of font.h: with the OLED library, with the
+// jump table of the squix format (text layout, not cached) and with the
+// indexed format. All three have to give the same pixels.
+// Texts with characters that have no glyph data in the squix format
+// (see hasGlyphData()) are timed, but not compared.
+#define INDEXED_REPEAT 500
+static bool runIndexed(){
+    struct BenchFont {
+        const char *name;
+        const uint8_t *font;
+        const IndexedFont *indexed;
+    };
+    const BenchFont fonts[] = {{"DejaVu_Sans_Mono_12", DejaVu_Sans_Mono_12, &DejaVu_Sans_Mono_12_Indexed},
+                               {"DejaVu_Sans_Mono_16", DejaVu_Sans_Mono_16, &DejaVu_Sans_Mono_16_Indexed},
+                               {"Lato_Hairline_12", Lato_Hairline_12, &Lato_Hairline_12_Indexed},
+                               {"Lato_Hairline_17", Lato_Hairline_17, &Lato_Hairline_17_Indexed},
+                               {"Lato_Hairline_18", Lato_Hairline_18, &Lato_Hairline_18_Indexed},
+                               {"Lato_Hairline_38", Lato_Hairline_38, &Lato_Hairline_38_Indexed}};
+    const uint8_t nTexts = nBenchDraws;
+    uint32_t differences = 0;
+    uint32_t notCompared = 0;
+    printf("text drawing per font (%u texts x %u)\n", nTexts, INDEXED_REPEAT);
+    printf("%-20s %10s %10s %10s %10s %10s %10s\n", "", "library", "jump table", "indexed", "library", "jump table", "indexed");
+    printf("%-20s %32s %32s\n", "", "ns/text", "PROGMEM reads/text");
+    Watch.setTextAlignment(TEXT_ALIGN_LEFT);
+    for(const BenchFont &font : fonts){
+        uint64_t ns[3] = {0, 0, 0};
+        uint64_t reads[3] = {0, 0, 0};
+        Watch.setFont(font.font);
+        for(uint8_t i = 0; i < nTexts; i++){
+            int16_t y = benchTextY(i);
+            const char *benchText = benchTexts[i % nBenchTexts];
+            String text = benchText;
+            uint32_t hash[3];
+            for(uint8_t method = 0; method < 3; method++){
+                if(method == 2)
+                    Watch.indexFont(font.indexed);
+                for(uint16_t n = 0; n < INDEXED_REPEAT; n++){
+                    Watch.OLED.clear();
+                    Watch.clearLayoutCache();
+                    uint32_t startReads = host_progmemReads;
+                    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                    if(method == 0)
+                        Watch.OLED.drawString(0, y, text);
+                    else
+                        Watch.drawString(0, y, benchText);
+                    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+                    ns[method] += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+                    reads[method] += host_progmemReads - startReads;
+                }
+                hash[method] = frameHash();
+            }
+            Watch.clearFontIndex();
+            if(!hasGlyphData(font.indexed, benchText))
+                notCompared++;
+            else if(hash[1] != hash[0] || hash[2] != hash[0])
+                differences++;
+        }
+        printf("%-20s %10.0f %10.0f %10.0f %10.0f %10.0f %10.0f\n", font.name,
+               (double)ns[0] / (nTexts * INDEXED_REPEAT),
+               (double)ns[1] / (nTexts * INDEXED_REPEAT),
+               (double)ns[2] / (nTexts * INDEXED_REPEAT),
+               (double)reads[0] / (nTexts * INDEXED_REPEAT),
+               (double)reads[1] / (nTexts * INDEXED_REPEAT),
+               (double)reads[2] / (nTexts * INDEXED_REPEAT));
+    }
+    if(notCompared)
+        printf("%u texts without glyph data in the squix format are not compared\n", notCompared);
+    printf("\n");
+    Watch.clearScreen();
+    Watch.updateDisplay();
+    if(differences)
+        printf("ERROR: %u texts differ between the font formats\n", differences);
+    return differences == 0;
+}
+
+// draw the texts with the compressed fonts: the first time (the glyphs
+// are decompressed) and from the glyph cache. The pixels have to be the
+// same as with the indexed format.
+// The compressed fonts of this file are used: call this before
+// add_compressedFonts(), both use all slots.
+static bool runCompressed(){
+#ifdef FONT_COMPRESSED
+    struct BenchFont {
+        const char *name;
+        const CompressedFont *compressed;
+        const IndexedFont *indexed;
+    };
+    const BenchFont fonts[] = {{"Lato_Hairline_38", &Lato_Hairline_38_Compressed, &Lato_Hairline_38_Indexed}};
+    uint32_t differences = 0;
+    printf("compressed fonts (%u texts x %u)\n", nBenchDraws, INDEXED_REPEAT);
+    printf("%-20s %10s %10s %10s %10s\n", "", "first", "cached", "first", "cached");
+    printf("%-20s %21s %21s\n", "", "ns/text", "PROGMEM reads/text");
+    Watch.setTextAlignment(TEXT_ALIGN_LEFT);
+    for(const BenchFont &font : fonts){
+        uint64_t ns[2] = {0, 0};
+        uint64_t reads[2] = {0, 0};
+        uint32_t misses = 0;
+        Watch.setFont(font.compressed->font);
+        for(uint8_t i = 0; i < nBenchDraws; i++){
+            int16_t y = benchTextY(i);
+            const char *benchText = benchTexts[i % nBenchTexts];
+            Watch.OLED.clear();
+            Watch.indexFont(font.indexed);
+            Watch.drawString(0, y, benchText);
+            Watch.clearFontIndex();
+            uint32_t reference = frameHash();
+            Watch.addCompressedFont(font.compressed);
+            for(uint16_t n = 0; n < INDEXED_REPEAT; n++){
+                uint8_t cached = n > 0;
+                // the first draw starts with an empty glyph cache
+                if(!cached)
+                    Watch.glyphCache.clear();
+                Watch.OLED.clear();
+                uint32_t startMisses = Watch.glyphCache.misses;
+                uint32_t startReads = host_progmemReads;
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                Watch.drawString(0, y, benchText);
+                std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+                ns[cached] += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+                reads[cached] += host_progmemReads - startReads;
+                if(cached)
+                    misses += Watch.glyphCache.misses - startMisses;
+            }
+            Watch.clearCompressedFonts();
+            if(frameHash() != reference)
+                differences++;
+        }
+        printf("%-20s %10.0f %10.0f %10.0f %10.0f %6u cache misses\n", font.name,
+               (double)ns[0] / nBenchDraws,
+               (double)ns[1] / (nBenchDraws * (INDEXED_REPEAT - 1)),
+               (double)reads[0] / nBenchDraws,
+               (double)reads[1] / (nBenchDraws * (INDEXED_REPEAT - 1)),
+               misses);
+    }
+
+    // the clock time: its 12 glyphs (digits, ':' and ' ') fit into the
+    // glyph cache, only the first use of a glyph is a miss
+    uint64_t clockNs[2] = {0, 0};
+    std::vector<uint32_t> clockHashes;
+    uint32_t clockMisses = 0;
+    Watch.setFont(Lato_Hairline_38);
+    for(uint8_t compressed = 0; compressed < 2; compressed++){
+        if(compressed){
+            Watch.addCompressedFont(&Lato_Hairline_38_Compressed);
+            clockMisses = Watch.glyphCache.misses;
+        } else {
+            Watch.indexFont(&Lato_Hairline_38_Indexed);
+        }
+        for(uint16_t minute = 0; minute < 24 * 60; minute++){
+            tm dateTime = {};
+            dateTime.tm_hour = minute / 60;
+            dateTime.tm_min = minute % 60;
+            char timeString[TIME_STRING_SIZE];
+            formatTime(timeString, dateTime);
+            Watch.OLED.clear();
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            Watch.drawString(0, 0, timeString);
+            std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+            clockNs[compressed] += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+            if(!compressed)
+                clockHashes.push_back(frameHash());
+            else if(frameHash() != clockHashes[minute])
+                differences++;
+        }
+        if(compressed)
+            clockMisses = Watch.glyphCache.misses - clockMisses;
+        Watch.clearFontIndex();
+        Watch.clearCompressedFonts();
+    }
+    printf("clock time (1440 times): %.0f ns/time indexed, %.0f ns/time compressed, %u cache misses\n",
+           (double)clockNs[0] / (24 * 60), (double)clockNs[1] / (24 * 60), clockMisses);
+    printf("\n");
+    Watch.clearScreen();
+    Watch.updateDisplay();
+    if(differences)
+        printf("ERROR: %u texts differ between the compressed and the indexed format\n", differences);
+    return differences == 0;
+#else
+    return true;
+#endif
+}
+
+// draw the bench texts scaled by 2 and 3 with all bit shifts and
+// compare them with the text drawn by the OLED library and enlarged
+// pixel by pixel
+static bool runScaled(){
+    const uint8_t *fonts[] = {DejaVu_Sans_Mono_12, Lato_Hairline_12, Lato_Hairline_17};
+    uint32_t differences = 0;
+    uint32_t texts = 0;
+    uint8_t original[OLED_WIDTH * OLED_PAGES];
+    uint8_t expected[OLED_WIDTH * OLED_PAGES];
+    Watch.setTextAlignment(TEXT_ALIGN_LEFT);
+    for(const uint8_t *font : fonts){
+        Watch.setFont(font);
+        for(uint8_t scale = 2; scale <= 3; scale++){
+            for(uint8_t i = 0; i < nBenchTexts; i++){
+                // some texts are wider than the screen: clipped on the right
+                int16_t x = -(int16_t)(i % 3);
+                int16_t y = i % 8;
+                Watch.OLED.clear();
+                Watch.OLED.drawString(0, 0, benchTexts[i]);
+                memcpy(original, Watch.OLED.buffer, sizeof(original));
+                memset(expected, 0, sizeof(expected));
+                for(int16_t row = 0; row < OLED_HEIGHT; row++){
+                    for(int16_t column = 0; column < OLED_WIDTH; column++){
+                        int16_t sourceX = (column - x) / scale;
+                        int16_t sourceY = (row - y) / scale;
+                        if(column < x || row < y || sourceX >= OLED_WIDTH || sourceY >= OLED_HEIGHT)
+                            continue;
+                        if(original[(sourceY >> 3) * OLED_WIDTH + sourceX] & (1 << (sourceY & 7)))
+                            expected[(row >> 3) * OLED_WIDTH + column] |= 1 << (row & 7);
+                    }
+                }
+                Watch.OLED.clear();
+                Watch.drawScaled(x, y, scale, benchTexts[i]);
+                if(memcmp(expected, Watch.OLED.buffer, sizeof(expected)))
+                    differences++;
+                texts++;
+            }
+        }
+    }
+    Watch.clearScreen();
+    Watch.updateDisplay();
+    printf("scaled text: %u texts at 2x and 3x compared\n\n", texts);
+    if(differences)
+        printf("ERROR: %u scaled texts differ from the enlarged text\n", differences);
+    return differences == 0;
+}
+
+// draw all times of a day (HH:MM) with FONT_2_XLARGE, with the
+// stroke digits of the same size and with FONT_2_NORMAL scaled by 2,
+// like the clock face does
+static void runDigits(){
+    StrokeDigits digits(27);
+    uint32_t fontSize = sizeof(FONT_2_XLARGE);
+#ifdef FONT_COMPRESSED
+    Watch.addCompressedFont(&Lato_Hairline_38_Compressed);
+    fontSize += sizeof(Lato_Hairline_38_offsets) + sizeof(Lato_Hairline_38_packed);
+#endif
+    // 0 = FONT_2_XLARGE, 1 = stroke digits, 2 = FONT_2_NORMAL at 2x
+    uint64_t ns[3] = {0, 0, 0};
+    uint64_t reads[3] = {0, 0, 0};
+    Watch.setTextAlignment(TEXT_ALIGN_RIGHT);
+    for(uint16_t minute = 0; minute < 24 * 60; minute++){
+        char timeString[8];
+        snprintf(timeString, sizeof(timeString), "%02u:%02u", minute / 60, minute % 60);
+        for(uint8_t mode = 0; mode < 3; mode++){
+            Watch.OLED.clear();
+            uint32_t startReads = host_progmemReads;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            if(mode == 0){
+                Watch.setFont(FONT_2_XLARGE);
+                Watch.drawString(96, 0, timeString);
+            } else if(mode == 1){
+                Watch.drawDigits(96, 11, digits, timeString);
+            } else {
+                Watch.setFont(FONT_2_NORMAL);
+                Watch.drawScaled(96, 3, 2, timeString);
+            }
+            std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+            ns[mode] += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+            reads[mode] += host_progmemReads - startReads;
+        }
+    }
+    printf("clock digits (%u times)\n", 24 * 60);
+    printf("%-16s %10.0f ns/time %7.0f PROGMEM reads/time %6u bytes font data\n", "FONT_2_XLARGE",
+           (double)ns[0] / (24 * 60), (double)reads[0] / (24 * 60), (unsigned)fontSize);
+    printf("%-16s %10.0f ns/time %7.0f PROGMEM reads/time %6u bytes stroke data\n", "StrokeDigits",
+           (double)ns[1] / (24 * 60), (double)reads[1] / (24 * 60), StrokeDigits::dataSize());
+    printf("%-16s %10.0f ns/time %7.0f PROGMEM reads/time   no extra font data (seconds font)\n\n", "FONT_2_NORMAL 2x",
+           (double)ns[2] / (24 * 60), (double)reads[2] / (24 * 60));
+#ifdef FONT_COMPRESSED
+    Watch.clearCompressedFonts();
+#endif
+    Watch.clearScreen();
+    Watch.updateDisplay();
+}
+
+// 10 minutes of the clock face with a full refresh every minute:
+// the time and the seconds are volatile texts, so the date has to be
+// drawn again out of the layout cache (if it is drawn with a layout)
+static bool runLayoutCache(){
+    const uint8_t refreshes = 10;
+    Watch.clearLayoutCache();
+    Watch.layoutHits = 0;
+    Watch.layoutMisses = 0;
+    for(uint32_t tick = 0; tick < refreshes * 60; tick++){
+        print_dateTime(BENCH_START_EPOCH + tick, tick % 60 == 0);
+        while(Watch.isTransferBusy())
+            Watch.serviceTransfer();
+    }
+    printf("text layout cache (%u full refreshes of the clock face): %u hits, %u misses\n\n", refreshes, Watch.layoutHits, Watch.layoutMisses);
+    bool dateHits = (Watch.layoutHits == 0 && Watch.layoutMisses == 0) || (Watch.layoutHits == refreshes - 1 && Watch.layoutMisses == 1);
+    if(!dateHits)
+        printf("ERROR: the date is not drawn out of the layout cache\n");
+    return dateHits;
+}
+
+// time only the drawing of the clock face strings
+// (without time conversion, formatting and display transfer)
+// the fonts of main.cpp, which are the cached ones
+// (without CLOCK_XLARGE_FONT, the time font is not cached)
+static void runText(const char *name, int16_t secondsY){
+    uint64_t ns = 0;
+    const uint8_t *timeFont = clock_timeFont() ? clock_timeFont() : FONT_2_XLARGE;
+    const uint8_t *secondsFont = clock_secondsFont();
+    for(uint32_t tick = 0; tick < BENCH_TICKS; tick++){
+        char timeString[8];
+        char secondsString[8];
+        snprintf(timeString, sizeof(timeString), "%02u:%02u", (tick / 3600) % 24, (tick / 60) % 60);
+        snprintf(secondsString, sizeof(secondsString), ": %02u", tick % 60);
+        String time = timeString;
+        String seconds = secondsString;
+        Watch.OLED.clear();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        Watch.setFont(timeFont);
+        Watch.setTextAlignment(TEXT_ALIGN_RIGHT);
+        Watch.drawString(96, 0, time);
+        Watch.setFont(secondsFont);
+        Watch.setTextAlignment(TEXT_ALIGN_LEFT);
+        Watch.drawString(98, secondsY, seconds);
+        std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+        ns += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    }
+    Watch.clearScreen();
+    // like returning from another screen: the clock face is drawn completely
+    clockFace.invalidate();
+    printf("%-14s %8u ticks  %10.0f ns/tick for time and seconds text (seconds at y=%d)\n", name, BENCH_TICKS, (double)ns / BENCH_TICKS, secondsY);
+}
+
+// same names as in main.cpp (these arrays are not visible outside)
+static const char dayNames[7][10]={"Sun","Mo","Tue","Wed","Thu","Fri","Sat"};
+static const char monthNames[12][6]={"Jan","Feb","Mar","Apr","May","Jun","Jul","Aug","Sep","Oct","Nov","Dec"};
+
+// the formatting of print_dateTime() up to v2.2, as reference
+static void formatLegacy(const tm &dateTime, char *timeString, char *secondsString, String &dateString){
+    sprintf(timeString, "%02d:%02d", dateTime.tm_hour, dateTime.tm_min);
+    sprintf(secondsString, ": %02d", dateTime.tm_sec);
+    dateString = String(dayNames[dateTime.tm_wday])+' ';
+    dateString += String(dateTime.tm_mday)+'.';
+    dateString += String(monthNames[dateTime.tm_mon])+'.';
+    dateString += String(dateTime.tm_year+1900);
+}
+
+// time the formatting of the time, seconds and date strings
+// with sprintf/String and with the formatter of TimeFormat.h
+// returns false if the strings are not the same
+static bool runFormat(){
+    uint64_t ns[2] = {0, 0};
+    uint64_t allocations[2] = {0, 0};
+    uint32_t differences = 0;
+    for(uint32_t tick = 0; tick < BENCH_TICKS; tick++){
+        // one day every hour: all days, months and hours are used
+        time_t epoch = BENCH_START_EPOCH + (time_t)tick * 86400 / 24 + tick % 3600;
+        tm dateTime;
+        localtime_r(&epoch, &dateTime);
+
+        char legacyTime[100];
+        char legacySeconds[100];
+        String legacyDate;
+        uint32_t startAllocations = host_allocations();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        formatLegacy(dateTime, legacyTime, legacySeconds, legacyDate);
+        std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+        ns[0] += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+        allocations[0] += host_allocations() - startAllocations;
+
+        char timeString[TIME_STRING_SIZE];
+        char secondsString[SECONDS_STRING_SIZE];
+        char dateString[DATE_STRING_SIZE];
+        startAllocations = host_allocations();
+        start = std::chrono::steady_clock::now();
+        formatTime(timeString, dateTime);
+        formatSeconds(secondsString, dateTime);
+        formatDate(dateString, dateTime, dayNames, monthNames);
+        stop = std::chrono::steady_clock::now();
+        ns[1] += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+        allocations[1] += host_allocations() - startAllocations;
+
+        if(strcmp(timeString, legacyTime) || strcmp(secondsString, legacySeconds) || strcmp(dateString, legacyDate.c_str()))
+            differences++;
+
+        // the UP-Time screen: up to about 21 years
+        uint32_t upTime = tick * 7919;
+        char legacyDays[100];
+        char legacyUpTime[100];
+        sprintf(legacyDays, "%i days", int(upTime / (60*60*24)));
+        sprintf(legacyUpTime, "%02d:%02d:%02d", int(upTime / (60*60)) % 24, int(upTime / 60) % 60, int(upTime) % 60);
+        char daysString[DAYS_STRING_SIZE];
+        char upTimeString[UPTIME_STRING_SIZE];
+        if(strcmp(formatUpTimeDays(daysString, upTime), legacyDays) || strcmp(formatUpTime(upTimeString, upTime), legacyUpTime))
+            differences++;
+    }
+    printf("time and date formatting (%u ticks)\n", BENCH_TICKS);
+    printf("%-14s %10.0f ns/tick %5.1f allocs/tick\n", "sprintf/String", (double)ns[0] / BENCH_TICKS, (double)allocations[0] / BENCH_TICKS);
+    printf("%-14s %10.0f ns/tick %5.1f allocs/tick\n\n", "TimeFormat", (double)ns[1] / BENCH_TICKS, (double)allocations[1] / BENCH_TICKS);
+    if(differences)
+        printf("ERROR: %u formatted strings differ\n", differences);
+    return differences == 0;
+}
+
+int main(int argc, char *argv[]){
+    const char *outputDir = argc > 1 ? argv[1] : NULL;
+    setenv("TZ", TZ_INFO, 1);
+    tzset();
+    Watch.begin();
+    // like setup(): the default time zone
+    select_timeZone(TZ_INFO);
+
+    if(!runFormat() || !runConsole() || !runProgress() || !runIndexed() || !runCompressed() || !runScaled() || !runButtons() || !runGestures() || !runClock() || !runDrift() || !runPersistence() || !runCalendar() || !runTimeZone())
+        return 1;
+    runDigits();
+    add_compressedFonts();
+
+    std::vector<uint32_t> reference;
+    std::vector<uint32_t> hashes;
+    runDay("font", outputDir, reference);
+    if(!runLayoutCache())
+        return 1;
+    // seconds as in the default and in the page-aligned clock face
+    runText("font", 21);
+    runText("font", 24);
+    printf("\n");
+    if(!runScreenOff(reference))
+        return 1;
+
+    if(!cache_clockFonts()){
+        printf("ERROR: the clock fonts are not cached\n");
+        return 1;
+    }
+    runDay("sprites", outputDir, hashes);
+    runText("sprites", 21);
+    runText("sprites", 24);
+    printf("\n");
+    Watch.clearFontCache();
+
+    if(hashes != reference){
+        printf("ERROR: sprite frames differ from font frames\n");
+        return 1;
+    }
+    printf("sprite frames are identical to font frames\n\n");
+    return runLatency() ? 0 : 1;
+}
@@ -0,0 +1,20 @@
+/**************************************************************************
+ * coredecls.h (host)
+ *
+ * On the ESP8266 this header declares the callback that is called when
+ * SNTP has set the time. On the host, host_sntpUpdate() calls it.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef coredecls_h
+#define coredecls_h
+
+void settimeofday_cb(void (*cb)(void));
+// an SNTP answer has set the time (the time of the Linux system)
+void host_sntpUpdate();
+
+#endif
@@ -4,7 +4,7 @@
  *                                                                      *
  * Library for reading momentary contact switches like tactile button   *
  * switches. Intended for use in state machine constructs.              *
- * Use the read() function to read all buttons in the main loop,        *
+ * Use ButtonBank::update() to read all buttons in the main loop,       *
  * which should execute as fast as possible.                            *
  *                                                                      *
  * This work is licensed under the Creative Commons Attribution-        *
@@ -17,68 +17,50 @@
 #include "Button.h"
 
 /*----------------------------------------------------------------------*
- * Button(pin, puEnable, invert, dbTime) instantiates a button object.  *
- * pin      Is the Arduino pin the button is connected to.              *
- * puEnable Enables the AVR internal pullup resistor if != 0 (can also  *
- *          use true or false).                                         *
+ * Button(pin, invert) instantiates a button object.                    *
+ * pin      Is the Arduino pin the button is connected to. The internal *
+ *          pullup resistor is enabled.                                 *
  * invert   If invert == 0, interprets a high state as pressed, low as  *
  *          released. If invert != 0, interprets a high state as        *
  *          released, low as pressed  (can also use true or false).     *
- * dbTime   Is the debounce time in milliseconds.                       *
- *                                                                      *
- * (Note that invert cannot be implied from puEnable since an external  *
- *  pullup could be used.)                                              *
+ * The button is read and debounced by a ButtonBank.                    *
  *----------------------------------------------------------------------*/
-Button::Button(uint8_t pin, uint8_t invert, uint32_t dbTime) {
+Button::Button(uint8_t pin, uint8_t invert) {
   _pin = pin;
   _invert = invert;
-  _dbTime = dbTime;
   pinMode(_pin, INPUT_PULLUP);
   _state = digitalRead(_pin);
   if (_invert != 0) _state = !_state;
   _time = millis();
-  _lastState = _state;
   _changed = 0;
   _hold_time = -1;
-  _lastTime = _time;
   _lastChange = _time;
   _pressTime = _time;
 }
 
 /*----------------------------------------------------------------------*
- * read() returns the state of the button, 1==pressed, 0==released,     *
- * does debouncing, captures and maintains times, previous states, etc. *
+ * update() is called by the ButtonBank with the debounced state, if it *
+ * has changed, the time of the change and the time up to which the     *
+ * state is known.                                                      *
  *----------------------------------------------------------------------*/
-uint8_t Button::read(void) {
-  static uint32_t ms;
-  static uint8_t pinVal;
-
-  ms = millis();
-  pinVal = digitalRead(_pin);
-  if (_invert != 0) pinVal = !pinVal;
-  if (ms - _lastChange < _dbTime) {
-    _lastTime = _time;
-    _time = ms;
-    _changed = 0;
-    return _state;
-  }
-  else {
-    _lastTime = _time;
-    _time = ms;
-    _lastState = _state;
-    _state = pinVal;
-    if (_state != _lastState) {
-      _lastChange = ms;
-      _changed = 1;
-      if (_state) { _pressTime = _time; }
-    }
-    else {
-      _changed = 0;
-    }
-    return _state;
+void Button::update(uint8_t state, uint8_t changed, uint32_t changeTime, uint32_t time) {
+  _state = state;
+  _changed = changed;
+  _time = time;
+  if (changed) {
+    _lastChange = changeTime;
+    if (_state) { _pressTime = changeTime; }
   }
 }
 
+uint8_t Button::pin(void) {
+  return _pin;
+}
+
+uint8_t Button::invert(void) {
+  return _invert;
+}
+
 /*----------------------------------------------------------------------*
  * isPressed() and isReleased() check the button state when it was last *
  * read, and return false (0) or true (!=0) accordingly.                *
@@ -94,7 +76,7 @@ uint8_t Button::isReleased(void) {
 
 /*----------------------------------------------------------------------*
  * wasPressed() and wasReleased() check the button state to see if it   *
- * changed between the last two reads and return false (0) or           *
+ * changed with the last update and return false (0) or                 *
  * true (!=0) accordingly.                                              *
  * These functions do not cause the button to be read.                  *
  *----------------------------------------------------------------------*/
@@ -102,13 +84,19 @@ uint8_t Button::wasPressed(void) {
   return _state && _changed;
 }
 
+// the press time is the time between the press and the release
 uint8_t Button::wasReleased(void) {
-  return !_state && _changed && millis() - _pressTime < _hold_time;
+  return !_state && _changed && _lastChange - _pressTime < _hold_time;
 }
 
 uint8_t Button::wasReleasefor(uint32_t ms) {
   _hold_time = ms;
-  return !_state && _changed && millis() - _pressTime >= ms;
+  return !_state && _changed && _lastChange - _pressTime >= ms;
+}
+
+// pressed or released with the last update
+uint8_t Button::wasChanged(void) {
+  return _changed;
 }
 /*----------------------------------------------------------------------*
  * pressedFor(ms) and releasedFor(ms) check to see if the button is     *
@@ -15,10 +15,12 @@
 // #else
 // #include <WProgram.h>
 // #endif
+// The buttons are sampled and debounced together by a ButtonBank
+// (see ButtonBank.h), the Button holds the state of one of them.
 class Button {
   public:
-    Button(uint8_t pin, uint8_t invert, uint32_t dbTime);
-    uint8_t read();
+    Button(uint8_t pin, uint8_t invert);
+    void update(uint8_t state, uint8_t changed, uint32_t changeTime, uint32_t time);
     uint8_t isPressed();
     uint8_t isReleased();
     uint8_t wasPressed();
@@ -26,19 +28,18 @@ class Button {
     uint8_t pressedFor(uint32_t ms);
     uint8_t releasedFor(uint32_t ms);
     uint8_t wasReleasefor(uint32_t ms);
+    uint8_t wasChanged();
     uint32_t lastChange();
+    uint8_t pin();
+    uint8_t invert();
 
   private:
     uint8_t _pin;           //arduino pin number
-    uint8_t _puEnable;      //internal pullup resistor enabled
     uint8_t _invert;        //if 0, interpret high state as pressed, else interpret low state as pressed
     uint8_t _state;         //current button state
-    uint8_t _lastState;     //previous button state
-    uint8_t _changed;       //state changed since last read
-    uint32_t _time;         //time of current state (all times are in ms)
-    uint32_t _lastTime;     //time of previous state
+    uint8_t _changed;       //state changed with the last update
+    uint32_t _time;         //time up to which the state is known (all times are in ms)
     uint32_t _lastChange;   //time of last state change
-    uint32_t _dbTime;       //debounce time
     uint32_t _pressTime;    //press time
     uint32_t _hold_time;    //hold time call wasreleasefor
 };
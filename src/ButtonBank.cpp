@@ -0,0 +1,127 @@
+/**************************************************************************
+ * ButtonBank.cpp
+ *
+ * Sampling and debouncing of the buttons of the DSTIKE OLED Wrist-Watch
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include "ButtonBank.h"
+
+
+ButtonBank *ButtonBank::interruptBank = NULL;
+
+ButtonBank::ButtonBank():state(0), time(0), nButtons(0), mask(0), invert(0), interrupt(false),
+    count0(0xFFFFFFFF), count1(0xFFFFFFFF), levels(0), lastTick(0), head(0), tail(0), pinLevels(0) {
+
+}
+
+bool ButtonBank::add(Button *button){
+    if(nButtons >= BANK_BUTTONS || button->pin() > 15)
+        return false;
+    uint32_t bit = 1UL << button->pin();
+    bits[nButtons] = bit;
+    edgeTime[nButtons] = millis();
+    buttons[nButtons++] = button;
+    mask |= bit;
+    if(button->invert())
+        invert |= bit;
+    // start with the current levels, without a change
+    pinLevels = (GPI ^ invert) & mask;
+    levels = pinLevels;
+    state = pinLevels;
+    lastTick = millis();
+    return true;
+}
+
+void ButtonBank::enableInterrupt(){
+    if(interrupt)
+        return;
+    interruptBank = this;
+    interrupt = true;
+    for(uint8_t i = 0; i < nButtons; i++)
+        attachInterrupt(digitalPinToInterrupt(buttons[i]->pin()), pinInterrupt, CHANGE);
+}
+
+void ICACHE_RAM_ATTR ButtonBank::pinInterrupt(){
+    interruptBank->sample();
+}
+
+// If the ring is full, the change is dropped: update() takes the
+// last levels (pinLevels) when the ring is empty.
+void ICACHE_RAM_ATTR ButtonBank::sample(){
+    uint32_t newLevels = (GPI ^ invert) & mask;
+    if(newLevels == pinLevels)
+        return;
+    pinLevels = newLevels;
+    uint8_t next = (head + 1) & (BANK_EVENTS - 1);
+    if(next == tail)
+        return;
+    eventTime[head] = millis();
+    eventLevels[head] = newLevels;
+    // the event is complete before it is visible to update()
+    head = next;
+}
+
+// one tick of the vertical counters of all pins
+// the counter of a pin with the same level as its state is reset,
+// the pins that reach the 4th tick with a new level are toggled
+// returns the toggled pins
+inline uint32_t ButtonBank::debounce(uint32_t newLevels){
+    uint32_t toggle = state ^ newLevels;
+    count0 = ~(count0 & toggle);
+    count1 = count0 ^ (count1 & toggle);
+    toggle &= count0 & count1;
+    state ^= toggle;
+    return toggle;
+}
+
+void ButtonBank::setLevels(uint32_t newLevels, uint32_t edge){
+    uint32_t leaving = (levels ^ newLevels) & (newLevels ^ state);
+    levels = newLevels;
+    if(!leaving)
+        return;
+    for(uint8_t i = 0; i < nButtons; i++){
+        if(leaving & bits[i])
+            edgeTime[i] = edge;
+    }
+}
+
+void ButtonBank::update(){
+    uint32_t ms = millis();
+    if(!interrupt)
+        sample();
+    uint32_t changed = 0;
+    uint8_t position = tail;
+    while(ms - lastTick >= BUTTON_TICK_MS){
+        uint32_t tick = lastTick + BUTTON_TICK_MS;
+        // the levels at the time of the tick
+        while(position != head && (int32_t)(eventTime[position] - tick) <= 0){
+            setLevels(eventLevels[position], eventTime[position]);
+            position = (position + 1) & (BANK_EVENTS - 1);
+        }
+        // a change that didn't fit into the ring has the time of the tick
+        if(position == head)
+            setLevels(pinLevels, tick);
+        lastTick = tick;
+        changed = debounce(levels);
+        if(changed)
+            break;
+        // all counters are reset: nothing changes until the next event
+        if(levels == state){
+            uint32_t until = ms;
+            if(position != head && (int32_t)(eventTime[position] - ms) < 0)
+                until = eventTime[position];
+            if(until - tick > BUTTON_TICK_MS)
+                lastTick += (until - tick - 1) / BUTTON_TICK_MS * BUTTON_TICK_MS;
+        }
+    }
+    tail = position;
+    // the state is known up to the next level change in the ring
+    time = ms - lastTick >= BUTTON_TICK_MS ? lastTick : ms;
+    for(uint8_t i = 0; i < nButtons; i++)
+        buttons[i]->update((state & bits[i]) != 0, (changed & bits[i]) != 0, edgeTime[i], time);
+}
@@ -0,0 +1,86 @@
+/**************************************************************************
+ * ButtonBank.h
+ *
+ * Sampling and debouncing of the buttons of the DSTIKE OLED Wrist-Watch
+ *
+ * All buttons are sampled together with one read of the GPIO input
+ * register (GPI), one bit per pin. An interrupt at every edge stores
+ * the time and the levels in a ring (single producer: the interrupt,
+ * single consumer: update()), so no press is lost while update() is not
+ * called. update() replays the levels in ticks of BUTTON_TICK_MS and
+ * debounces all buttons at once with vertical counters: a 2 bit counter
+ * per button, stored as two bit masks. A button changes its state after
+ * 4 ticks with the new level, a bounce starts the counter again. The
+ * time of the change is the time of the edge (of the last bounce), not
+ * the time of the tick.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef ButtonBank_h
+#define ButtonBank_h
+
+#include <Arduino.h>
+#include "Button.h"
+
+// time between two ticks of the debouncing:
+// a change is taken after 4 ticks (8 ms)
+#define BUTTON_TICK_MS 2
+// number of buttons of a bank
+#define BANK_BUTTONS 4
+// level changes that are not read yet (power of 2)
+#define BANK_EVENTS 16
+
+class ButtonBank{
+    public:
+        ButtonBank();
+        // only pins 0-15 are in the GPI register
+        bool add(Button *button);
+        // sample the pins with an interrupt at every edge
+        // (only one bank can use the interrupt)
+        void enableInterrupt();
+        // read the levels and update the state of all buttons
+        // only one change is taken per update: a press and a release
+        // while update() was not called are seen by two updates
+        void update();
+        // add the levels to the ring if they have changed
+        // called by the interrupt, or by update() without the interrupt
+        void sample();
+        // debounced state, 1 = pressed (one bit per pin)
+        uint32_t state;
+        // time up to which the state is known (ms)
+        uint32_t time;
+    private:
+        Button *buttons[BANK_BUTTONS];
+        uint8_t nButtons;
+        // pins of the buttons and pins that are pressed at LOW
+        uint32_t mask;
+        uint32_t invert;
+        bool interrupt;
+        // vertical counters: bit 0 and bit 1 of the counter of every pin
+        uint32_t count0;
+        uint32_t count1;
+        uint32_t debounce(uint32_t levels);
+        // take the levels of an edge, for the pins that leave their state
+        // the time of the edge is stored
+        void setLevels(uint32_t newLevels, uint32_t edge);
+        // level of the pins at the last tick
+        uint32_t levels;
+        uint32_t lastTick;
+        // bit of the pin and time of its last edge away from its state
+        uint32_t bits[BANK_BUTTONS];
+        uint32_t edgeTime[BANK_BUTTONS];
+        // ring of level changes
+        volatile uint32_t eventTime[BANK_EVENTS];
+        volatile uint32_t eventLevels[BANK_EVENTS];
+        volatile uint8_t head;     // only changed by sample()
+        volatile uint8_t tail;     // only changed by update()
+        volatile uint32_t pinLevels;  // last levels seen by sample()
+        static ButtonBank *interruptBank;
+        static void pinInterrupt();
+};
+
+#endif
@@ -0,0 +1,50 @@
+/**************************************************************************
+ * Calendar.cpp
+ *
+ * Incremental local time for the DSTIKE OLED Wrist-Watch
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include "Calendar.h"
+
+
+Calendar::Calendar(TimeZone &zone):conversions(0), zone(zone), epoch(0), nextConversion(0), valid(false) {
+    memset(&dateTime, 0, sizeof(dateTime));
+}
+
+void Calendar::invalidate(){
+    valid = false;
+}
+
+// up to the next conversion, the day doesn't change:
+// the seconds are added to the time of the day
+const tm &Calendar::update(time_t epoch){
+    if(valid && epoch == this->epoch)
+        return dateTime;
+    if(!valid || epoch < this->epoch || epoch >= nextConversion){
+        convert(epoch);
+        return dateTime;
+    }
+    uint32_t seconds = dateTime.tm_sec + (uint32_t)(epoch - this->epoch);
+    dateTime.tm_sec = seconds % 60;
+    uint32_t minutes = dateTime.tm_min + seconds / 60;
+    dateTime.tm_min = minutes % 60;
+    dateTime.tm_hour += minutes / 60;
+    this->epoch = epoch;
+    return dateTime;
+}
+
+void Calendar::convert(time_t epoch){
+    zone.localTime(epoch, dateTime);
+    conversions++;
+    this->epoch = epoch;
+    valid = true;
+    // local midnight or the DST transition before it
+    time_t midnight = epoch + 24 * 3600 - (dateTime.tm_hour * 3600 + dateTime.tm_min * 60 + dateTime.tm_sec);
+    time_t transition = zone.nextTransition(epoch);
+    nextConversion = transition < midnight ? transition : midnight;
+}
@@ -0,0 +1,48 @@
+/**************************************************************************
+ * Calendar.h
+ *
+ * Incremental local time for the DSTIKE OLED Wrist-Watch
+ *
+ * The time zone converts the epoch with a search in its table of DST
+ * transitions. The calendar converts only once per day: during the
+ * day, seconds, minutes and hours are counted on from the last
+ * conversion. A full conversion is done:
+ *   - at local midnight (new day, weekday, month, ...)
+ *   - at a DST transition (the next one is taken from the time zone)
+ *   - if the time goes back (the clock was corrected) or after
+ *     invalidate() (e.g. another time zone)
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef Calendar_h
+#define Calendar_h
+
+#include <Arduino.h>
+#include <time.h>
+#include "TimeZone.h"
+
+class Calendar{
+    public:
+        Calendar(TimeZone &zone);
+        // the local time of the epoch
+        const tm &update(time_t epoch);
+        // convert completely with the next update()
+        void invalidate();
+        // full conversions by the time zone
+        uint32_t conversions;
+    private:
+        void convert(time_t epoch);
+        TimeZone &zone;
+        tm dateTime;
+        // epoch of dateTime
+        time_t epoch;
+        // first epoch that needs a full conversion
+        time_t nextConversion;
+        bool valid;
+};
+
+#endif
@@ -0,0 +1,82 @@
+/**************************************************************************
+ * DriftEstimator.cpp
+ *
+ * Drift of the system clock of the DSTIKE OLED Wrist-Watch
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include "DriftEstimator.h"
+
+
+DriftEstimator::DriftEstimator() {
+    clear();
+}
+
+void DriftEstimator::clear(){
+    count = 0;
+    rejected = 0;
+    next = 0;
+    fittedRate = 0;
+}
+
+// the oldest sample is replaced
+bool DriftEstimator::add(uint64_t upTime, int64_t offset){
+    upTimes[next] = upTime;
+    offsets[next] = offset;
+    next = (next + 1) % DRIFT_SAMPLES;
+    if(count < DRIFT_SAMPLES)
+        count++;
+    return fit();
+}
+
+bool DriftEstimator::valid(){
+    if(count < 2)
+        return false;
+    uint8_t newest = (next + DRIFT_SAMPLES - 1) % DRIFT_SAMPLES;
+    uint8_t oldest = (next + DRIFT_SAMPLES - count) % DRIFT_SAMPLES;
+    return upTimes[newest] - upTimes[oldest] >= (uint64_t)DRIFT_MIN_SPAN * 1000000;
+}
+
+int32_t DriftEstimator::rate(){
+    return valid() ? fittedRate : 0;
+}
+
+// slope of offset(upTime) in us per s = ppm
+// the values are taken relative to the oldest sample, so the doubles
+// keep the resolution of 1 us (only done when the time is fetched)
+bool DriftEstimator::fit(){
+    if(count < 2)
+        return true;
+    uint8_t oldest = (next + DRIFT_SAMPLES - count) % DRIFT_SAMPLES;
+    double sumX = 0;
+    double sumY = 0;
+    for(uint8_t i = 0; i < count; i++){
+        uint8_t n = (oldest + i) % DRIFT_SAMPLES;
+        sumX += (double)(upTimes[n] - upTimes[oldest]) / 1000000;
+        sumY += (double)(offsets[n] - offsets[oldest]);
+    }
+    double meanX = sumX / count;
+    double meanY = sumY / count;
+    double sumXY = 0;
+    double sumXX = 0;
+    for(uint8_t i = 0; i < count; i++){
+        uint8_t n = (oldest + i) % DRIFT_SAMPLES;
+        double x = (double)(upTimes[n] - upTimes[oldest]) / 1000000 - meanX;
+        double y = (double)(offsets[n] - offsets[oldest]) - meanY;
+        sumXY += x * y;
+        sumXX += x * x;
+    }
+    if(sumXX <= 0)
+        return true;
+    double ppm = sumXY / sumXX;
+    if(ppm > DRIFT_MAX_PPM || ppm < -DRIFT_MAX_PPM){
+        rejected++;
+        return false;
+    }
+    fittedRate = (int32_t)lround(ppm * 1000);
+    return true;
+}
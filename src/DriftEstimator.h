@@ -0,0 +1,59 @@
+/**************************************************************************
+ * DriftEstimator.h
+ *
+ * Drift of the system clock of the DSTIKE OLED Wrist-Watch
+ *
+ * Every time the NTP time is fetched, the offset of the server time
+ * to the up-time (see SystemClock.h) is stored as a sample. Without
+ * drift, the offset would stay the same. The samples are fitted with a
+ * line by least squares: its slope in us per second is the rate of the
+ * up-time in ppm, which is corrected continuously by the clock. The
+ * rate is only valid when the samples span at least DRIFT_MIN_SPAN, so
+ * the error of a single NTP time (some 10 ms) is small against it.
+ * A fit above DRIFT_MAX_PPM is rejected and counted, the rate of the
+ * last fit is kept.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef DriftEstimator_h
+#define DriftEstimator_h
+
+#include <Arduino.h>
+
+// newest samples that are fitted
+#define DRIFT_SAMPLES 8
+// minimum time between the first and the last sample in s
+#define DRIFT_MIN_SPAN 3600
+// rates above are no drift of a crystal, but a wrong time, in ppm
+#define DRIFT_MAX_PPM 500
+
+class DriftEstimator{
+    public:
+        DriftEstimator();
+        // offset of the server time to the up-time in us, at the up-time
+        // false if the fit with the sample is rejected
+        bool add(uint64_t upTime, int64_t offset);
+        // true if the samples span at least DRIFT_MIN_SPAN
+        bool valid();
+        // rate that has to be added to the up-time in ppb (1/1000 ppm),
+        // positive: the up-time is slow
+        int32_t rate();
+        void clear();
+        uint8_t count;
+        // fits that were rejected (above DRIFT_MAX_PPM)
+        uint16_t rejected;
+    private:
+        // fit the line through the samples
+        bool fit();
+        uint64_t upTimes[DRIFT_SAMPLES];
+        int64_t offsets[DRIFT_SAMPLES];
+        // position of the next sample
+        uint8_t next;
+        int32_t fittedRate;
+};
+
+#endif
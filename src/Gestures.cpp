@@ -0,0 +1,120 @@
+/**************************************************************************
+ * Gestures.cpp
+ *
+ * Button gestures for the DSTIKE OLED Wrist-Watch
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include "Gestures.h"
+
+
+GestureRecognizer::GestureRecognizer():chord(0) {
+    clear();
+}
+
+void GestureRecognizer::setChord(uint8_t buttons){
+    chord = buttons;
+}
+
+void GestureRecognizer::clear(){
+    for(uint8_t i = 0; i < GESTURE_BUTTONS; i++)
+        state[i] = BUTTON_IDLE;
+    clickPending = 0;
+    head = 0;
+    tail = 0;
+}
+
+void GestureRecognizer::transition(uint8_t button, bool pressed, uint32_t time){
+    if(button >= GESTURE_BUTTONS)
+        return;
+    // the long press of another button can be older than this transition
+    update(time);
+    uint8_t bit = 1 << button;
+    if(pressed){
+        state[button] = BUTTON_PRESSED;
+        pressTime[button] = time;
+        add(GESTURE_PRESS, bit, time);
+        // all other buttons of the chord are pressed shortly before
+        if((chord & bit) == 0)
+            return;
+        for(uint8_t i = 0; i < GESTURE_BUTTONS; i++){
+            if(i != button && (chord & (1 << i)) &&
+               (state[i] != BUTTON_PRESSED || time - pressTime[i] > GESTURE_CHORD_MS))
+                return;
+        }
+        for(uint8_t i = 0; i < GESTURE_BUTTONS; i++){
+            if(chord & (1 << i))
+                state[i] = BUTTON_IN_CHORD;
+        }
+        clickPending &= ~chord;
+        add(GESTURE_CHORD, chord, time);
+        return;
+    }
+    if(state[button] == BUTTON_PRESSED){
+        if((clickPending & bit) && pressTime[button] - clickTime[button] <= GESTURE_DOUBLE_MS){
+            clickPending &= ~bit;
+            add(GESTURE_DOUBLE_CLICK, bit, time);
+        } else {
+            clickPending |= bit;
+            clickTime[button] = time;
+            add(GESTURE_CLICK, bit, time);
+        }
+    }
+    state[button] = BUTTON_IDLE;
+}
+
+// The gestures get the time when they happened, not the time of update().
+void GestureRecognizer::update(uint32_t time){
+    for(uint8_t i = 0; i < GESTURE_BUTTONS; i++){
+        if(state[i] == BUTTON_PRESSED && time - pressTime[i] >= GESTURE_LONG_MS){
+            state[i] = BUTTON_HELD;
+            clickPending &= ~(1 << i);
+            repeatTime[i] = pressTime[i] + GESTURE_LONG_MS;
+            add(GESTURE_LONG_PRESS, 1 << i, repeatTime[i]);
+            repeatTime[i] += GESTURE_REPEAT_MS;
+        }
+        while(state[i] == BUTTON_HELD && (int32_t)(time - repeatTime[i]) >= 0){
+            // not read for a while (e.g. a delay()): the other repeats
+            // up to this time are dropped
+            if(freePlaces() <= GESTURE_REPEAT_ROOM){
+                uint32_t repeats = (time - repeatTime[i]) / GESTURE_REPEAT_MS + 1;
+                droppedRepeats += repeats;
+                repeatTime[i] += repeats * GESTURE_REPEAT_MS;
+                break;
+            }
+            add(GESTURE_HOLD_REPEAT, 1 << i, repeatTime[i]);
+            repeatTime[i] += GESTURE_REPEAT_MS;
+        }
+    }
+}
+
+// If the queue is full, the gesture is dropped.
+void GestureRecognizer::add(uint8_t gesture, uint8_t buttons, uint32_t time){
+    uint8_t next = (head + 1) % GESTURE_EVENTS;
+    if(next == tail){
+        lost++;
+        return;
+    }
+    events[head].gesture = gesture;
+    events[head].buttons = buttons;
+    events[head].time = time;
+    head = next;
+}
+
+// free places in the queue
+uint8_t GestureRecognizer::freePlaces(){
+    return (tail + GESTURE_EVENTS - head - 1) % GESTURE_EVENTS;
+}
+
+bool GestureRecognizer::next(GestureEvent &event){
+    if(head == tail)
+        return false;
+    event = events[tail];
+    tail = (tail + 1) % GESTURE_EVENTS;
+    taken++;
+    return true;
+}
@@ -0,0 +1,98 @@
+/**************************************************************************
+ * Gestures.h
+ *
+ * Button gestures for the DSTIKE OLED Wrist-Watch
+ *
+ * The GestureRecognizer turns the transitions of the buttons (pressed
+ * or released, with the time of the change) into gestures:
+ *   press:        the button is pressed (every press, at once)
+ *   click:        a press shorter than GESTURE_LONG_MS
+ *   double click: a second click that starts within GESTURE_DOUBLE_MS
+ *                 after the first one (the first one is reported as
+ *                 click, so a click is never delayed)
+ *   long press:   the button is held for GESTURE_LONG_MS
+ *   hold repeat:  every GESTURE_REPEAT_MS after the long press, as long
+ *                 as the queue has room for a press of every button
+ *   chord:        the buttons of the chord are pressed within
+ *                 GESTURE_CHORD_MS, they make no other gesture until
+ *                 they are released
+ * Nothing is blocking: the timeouts are checked with update().
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef Gestures_h
+#define Gestures_h
+
+#include <Arduino.h>
+
+#define GESTURE_BUTTONS 3
+// gestures that are not read yet
+#define GESTURE_EVENTS 8
+// times in ms
+#define GESTURE_DOUBLE_MS 300
+#define GESTURE_LONG_MS 800
+#define GESTURE_REPEAT_MS 200
+#define GESTURE_CHORD_MS 80
+// free places in the queue that the hold repeats don't take
+#define GESTURE_REPEAT_ROOM GESTURE_BUTTONS
+
+#define GESTURE_CLICK 1
+#define GESTURE_DOUBLE_CLICK 2
+#define GESTURE_LONG_PRESS 3
+#define GESTURE_HOLD_REPEAT 4
+#define GESTURE_CHORD 5
+#define GESTURE_PRESS 6
+
+struct GestureEvent{
+    uint8_t gesture;
+    // one bit per button (bit 0 = button 0), both buttons of a chord
+    uint8_t buttons;
+    // time of the gesture in ms
+    uint32_t time;
+};
+
+class GestureRecognizer{
+    public:
+        GestureRecognizer();
+        // buttons (one bit per button) that are a chord, 0 = no chord
+        void setChord(uint8_t buttons);
+        // a button was pressed or released at the given time
+        // the transitions have to be in the order of their time
+        void transition(uint8_t button, bool pressed, uint32_t time);
+        // long press and hold repeat up to the given time
+        void update(uint32_t time);
+        // the next gesture, false if there is none
+        bool next(GestureEvent &event);
+        void clear();
+        // gestures that didn't fit into the queue
+        uint32_t lost = 0;
+        // hold repeats that were not queued, the queue was (nearly) full
+        uint32_t droppedRepeats = 0;
+        // gestures read with next()
+        uint32_t taken = 0;
+    private:
+        // state of a button
+        #define BUTTON_IDLE     0
+        #define BUTTON_PRESSED  1
+        #define BUTTON_HELD     2
+        #define BUTTON_IN_CHORD 3
+        uint8_t state[GESTURE_BUTTONS];
+        uint32_t pressTime[GESTURE_BUTTONS];
+        // long press: time of the next hold repeat
+        uint32_t repeatTime[GESTURE_BUTTONS];
+        // end of the last click, if the next click can be a double click
+        uint32_t clickTime[GESTURE_BUTTONS];
+        uint8_t clickPending;
+        uint8_t chord;
+        void add(uint8_t gesture, uint8_t buttons, uint32_t time);
+        uint8_t freePlaces();
+        GestureEvent events[GESTURE_EVENTS];
+        uint8_t head;
+        uint8_t tail;
+};
+
+#endif
@@ -0,0 +1,104 @@
+/**************************************************************************
+ * Persistence.cpp
+ *
+ * State of the DSTIKE OLED Wrist-Watch that survives a reset
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include "Persistence.h"
+#include <stddef.h>
+
+
+/****** RTC user memory ******/
+bool RtcStorage::read(WatchState &state){
+    return ESP.rtcUserMemoryRead(STATE_RTC_OFFSET, (uint32_t *)&state, sizeof(WatchState));
+}
+
+bool RtcStorage::write(const WatchState &state){
+    return ESP.rtcUserMemoryWrite(STATE_RTC_OFFSET, (uint32_t *)&state, sizeof(WatchState));
+}
+
+
+/****** EEPROM ******/
+EepromStorage::EepromStorage():started(false) {
+
+}
+
+void EepromStorage::begin(){
+    if(started)
+        return;
+    EEPROM.begin(STATE_EEPROM_ADDRESS + sizeof(WatchState));
+    started = true;
+}
+
+bool EepromStorage::read(WatchState &state){
+    begin();
+    uint8_t *data = (uint8_t *)&state;
+    for(uint16_t i = 0; i < sizeof(WatchState); i++)
+        data[i] = EEPROM.read(STATE_EEPROM_ADDRESS + i);
+    return true;
+}
+
+// the flash is only written if the content has changed
+bool EepromStorage::write(const WatchState &state){
+    begin();
+    const uint8_t *data = (const uint8_t *)&state;
+    bool changed = false;
+    for(uint16_t i = 0; i < sizeof(WatchState); i++){
+        if(EEPROM.read(STATE_EEPROM_ADDRESS + i) != data[i]){
+            EEPROM.write(STATE_EEPROM_ADDRESS + i, data[i]);
+            changed = true;
+        }
+    }
+    return changed ? EEPROM.commit() : true;
+}
+
+
+/****** State store ******/
+StateStore::StateStore(Storage &fast, Storage &durable):fastStorage(fast), durableStorage(durable) {
+
+}
+
+uint8_t StateStore::restore(WatchState &state){
+    uint8_t source = STATE_NONE;
+    if(fastStorage.read(state) && isValid(state)){
+        source = STATE_RTC;
+    } else if(durableStorage.read(state) && isValid(state)){
+        source = STATE_EEPROM;
+        // the time of the last durable save is older than the last second
+        state.approximate = 1;
+    } else {
+        memset(&state, 0, sizeof(WatchState));
+        state.magic = STATE_MAGIC;
+    }
+    state.bootCount++;
+    save(state, false);
+    return source;
+}
+
+void StateStore::save(WatchState &state, bool durable){
+    state.magic = STATE_MAGIC;
+    state.crc = crc32((const uint8_t *)&state, offsetof(WatchState, crc));
+    fastStorage.write(state);
+    if(durable)
+        durableStorage.write(state);
+}
+
+bool StateStore::isValid(const WatchState &state){
+    return state.magic == STATE_MAGIC && state.crc == crc32((const uint8_t *)&state, offsetof(WatchState, crc));
+}
+
+// CRC-32 (IEEE), bit by bit: the state is small and saved once per second
+uint32_t StateStore::crc32(const uint8_t *data, size_t size){
+    uint32_t crc = 0xFFFFFFFF;
+    for(size_t i = 0; i < size; i++){
+        crc ^= data[i];
+        for(uint8_t bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return ~crc;
+}
@@ -0,0 +1,106 @@
+/**************************************************************************
+ * Persistence.h
+ *
+ * State of the DSTIKE OLED Wrist-Watch that survives a reset
+ *
+ * The time, the drift correction of the clock, the boot counter and the
+ * last connected WiFi location are stored in two places:
+ *   RTC user memory: survives a reset and deep sleep, but not a power
+ *                    loss. Written every second, without wear.
+ *   EEPROM (flash):  survives a power loss. Written rarely (only
+ *                    changed content is written), the time is then
+ *                    older. Not written by restore(): the boot counter
+ *                    of the EEPROM is the one of its last save.
+ * The state is read from the first storage with a valid copy (magic
+ * number and CRC32), so the clock runs with the right time right
+ * after a reset.
+ * Both storages have the same interface (Storage): the benchmark on
+ * the host uses them with RTC memory and EEPROM in the host memory.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef Persistence_h
+#define Persistence_h
+
+#include <Arduino.h>
+#include <EEPROM.h>
+
+// "DSW1", a new number for a new layout of WatchState
+#define STATE_MAGIC 0x44535731
+// the first 128 bytes of the RTC user memory are used by the OTA update
+#define STATE_RTC_OFFSET 32
+#define STATE_EEPROM_ADDRESS 0
+
+// where the state was read from
+#define STATE_NONE    0
+#define STATE_RTC     1
+#define STATE_EEPROM  2
+
+struct WatchState{
+    uint32_t magic;
+    uint32_t bootCount;
+    // time in us at the save, 0 = the time was never set
+    int64_t time;
+    // drift correction of the clock in ppb (see SystemClock.h)
+    int32_t rate;
+    // index of the last connected WiFi location
+    uint8_t wifiLocation;
+    // 1: the time was restored from the EEPROM and not set since
+    // (set by restore(), kept by the following saves)
+    uint8_t approximate;
+    uint8_t reserved[2];
+    // CRC32 of all bytes before
+    uint32_t crc;
+};
+
+/****** Storage ******/
+// a place for the state
+class Storage{
+    public:
+        virtual ~Storage() {}
+        virtual bool read(WatchState &state) = 0;
+        virtual bool write(const WatchState &state) = 0;
+};
+
+// RTC user memory of the ESP8266
+class RtcStorage : public Storage{
+    public:
+        bool read(WatchState &state);
+        bool write(const WatchState &state);
+};
+
+// flash, through the EEPROM library
+class EepromStorage : public Storage{
+    public:
+        EepromStorage();
+        bool read(WatchState &state);
+        bool write(const WatchState &state);
+    private:
+        // EEPROM.begin() is called with the first access
+        void begin();
+        bool started;
+};
+
+/****** State store ******/
+class StateStore{
+    public:
+        // fast: written every time, durable: only with save(state, true)
+        StateStore(Storage &fast, Storage &durable);
+        // read the state out of the first storage with a valid copy
+        // (an empty state if there is none), increment the boot counter
+        // and save it into the fast storage
+        // returns STATE_NONE, STATE_RTC or STATE_EEPROM
+        uint8_t restore(WatchState &state);
+        void save(WatchState &state, bool durable);
+        static bool isValid(const WatchState &state);
+    private:
+        static uint32_t crc32(const uint8_t *data, size_t size);
+        Storage &fastStorage;
+        Storage &durableStorage;
+};
+
+#endif
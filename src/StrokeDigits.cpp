@@ -0,0 +1,221 @@
+/**************************************************************************
+ * StrokeDigits.cpp
+ *
+ * Procedural clock digits for the DSTIKE OLED Wrist-Watch
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include "StrokeDigits.h"
+#include "Watch.h"
+
+
+/****** Digit description ******/
+// grid: x = 0..54 (advance of a digit), y = 0..64 (top to baseline)
+// angles: 256 per circle, 0 = right, 64 = down, 128 = left, 192 = up
+#define STROKE_END  0
+// x0, y0, x1, y1
+#define STROKE_LINE 1
+// center x, center y, radius x, radius y, start angle, angle (0 = full circle)
+#define STROKE_ARC  2
+// x, y, width, height (filled rectangle)
+#define STROKE_DOT  3
+
+#define DIGIT_ADVANCE 54
+#define COLON_ADVANCE 22
+// same width as in Lato_Hairline_38
+#define SPACE_ADVANCE 27
+
+const uint8_t strokeData[] PROGMEM = {
+    // 0
+    STROKE_ARC, 26, 32, 24, 32, 0, 0, STROKE_END,
+    // 1
+    STROKE_LINE, 32, 0, 32, 64, STROKE_LINE, 32, 0, 15, 15, STROKE_LINE, 15, 64, 47, 64, STROKE_END,
+    // 2
+    STROKE_ARC, 26, 18, 22, 18, 120, 176, STROKE_LINE, 38, 33, 4, 64, STROKE_LINE, 4, 64, 50, 64, STROKE_END,
+    // 3
+    STROKE_ARC, 26, 16, 20, 16, 140, 180, STROKE_ARC, 26, 48, 23, 16, 192, 180, STROKE_END,
+    // 4
+    STROKE_LINE, 37, 0, 3, 46, STROKE_LINE, 3, 46, 50, 46, STROKE_LINE, 37, 0, 37, 64, STROKE_END,
+    // 5
+    STROKE_LINE, 46, 0, 12, 0, STROKE_LINE, 12, 0, 11, 28, STROKE_ARC, 27, 43, 23, 21, 160, 208, STROKE_END,
+    // 6
+    STROKE_ARC, 26, 43, 23, 21, 0, 0, STROKE_LINE, 38, 0, 5, 36, STROKE_END,
+    // 7
+    STROKE_LINE, 3, 0, 50, 0, STROKE_LINE, 50, 0, 16, 64, STROKE_END,
+    // 8
+    STROKE_ARC, 26, 16, 19, 16, 0, 0, STROKE_ARC, 26, 48, 23, 16, 0, 0, STROKE_END,
+    // 9
+    STROKE_ARC, 26, 21, 23, 21, 0, 0, STROKE_LINE, 14, 64, 47, 28, STROKE_END,
+    // :
+    STROKE_DOT, 14, 22, 7, 5, STROKE_DOT, 14, 61, 7, 5, STROKE_END
+};
+// start of the strokes of 0-9 and ':' in strokeData
+const uint8_t strokeStart[11] PROGMEM = {0, 8, 24, 42, 57, 73, 91, 104, 115, 130, 143};
+
+// sine of a quarter circle (64 steps), 255 = 1.0
+const uint8_t quarterSine[65] PROGMEM = {
+      0,   6,  13,  19,  25,  31,  37,  44,  50,  56,  62,  68,  74,  80,  86,  92,
+     98, 103, 109, 115, 120, 126, 131, 136, 142, 147, 152, 157, 162, 167, 171, 176,
+    180, 185, 189, 193, 197, 201, 205, 208, 212, 215, 219, 222, 225, 228, 231, 233,
+    236, 238, 240, 242, 244, 246, 247, 249, 250, 251, 252, 253, 254, 254, 255, 255,
+    255
+};
+// angle between two points of an arc
+#define ARC_STEP 4
+
+
+/****** Pixel ******/
+static int16_t sine(uint8_t angle){
+    uint8_t i = angle & 63;
+    switch(angle >> 6){
+        case 0:  return pgm_read_byte(&quarterSine[i]);
+        case 1:  return pgm_read_byte(&quarterSine[64 - i]);
+        case 2:  return -pgm_read_byte(&quarterSine[i]);
+        default: return -pgm_read_byte(&quarterSine[64 - i]);
+    }
+}
+
+static void setPixel(uint8_t *buffer, int16_t x, int16_t y){
+    if(x >= 0 && x < OLED_WIDTH && y >= 0 && y < OLED_HEIGHT)
+        buffer[(y >> 3) * OLED_WIDTH + x] |= 1 << (y & 7);
+}
+
+// Bresenham line, both end points are drawn
+static void drawLine(uint8_t *buffer, int16_t x0, int16_t y0, int16_t x1, int16_t y1){
+    int16_t dx = abs(x1 - x0);
+    int16_t dy = -abs(y1 - y0);
+    int8_t sx = x0 < x1 ? 1 : -1;
+    int8_t sy = y0 < y1 ? 1 : -1;
+    int16_t error = dx + dy;
+    while(true){
+        setPixel(buffer, x0, y0);
+        if(x0 == x1 && y0 == y1)
+            break;
+        int16_t error2 = 2 * error;
+        if(error2 >= dy){
+            error += dy;
+            x0 += sx;
+        }
+        if(error2 <= dx){
+            error += dx;
+            y0 += sy;
+        }
+    }
+}
+
+
+/****** Stroke digits ******/
+StrokeDigits::StrokeDigits(uint8_t height):height(height) {
+    // STROKE_UNITS units are height - 1 pixel (the baseline is the last row)
+    unitScale = (uint16_t)(height - 1) * 256 / STROKE_UNITS;
+}
+
+static int8_t strokeIndex(char c){
+    // ':' follows '9' in the ASCII table
+    if(c >= '0' && c <= ':')
+        return c - '0';
+    return -1;
+}
+
+static uint8_t strokeAdvance(char c){
+    if(c == ':')
+        return COLON_ADVANCE;
+    if(c == ' ')
+        return SPACE_ADVANCE;
+    return DIGIT_ADVANCE;
+}
+
+uint16_t StrokeDigits::dataSize(){
+    return sizeof(strokeData) + sizeof(strokeStart) + sizeof(quarterSine);
+}
+
+bool StrokeDigits::canDraw(const char *text){
+    for(; *text; text++){
+        if(strokeIndex(*text) < 0 && *text != ' ')
+            return false;
+    }
+    return true;
+}
+
+// the position of every character is rounded from the position in
+// grid units, so the rounding errors don't add up
+uint16_t StrokeDigits::getStringWidth(const char *text){
+    uint16_t units = 0;
+    for(; *text; text++)
+        units += strokeAdvance(*text);
+    return scale(units);
+}
+
+void StrokeDigits::draw(uint8_t *buffer, int16_t x, int16_t y, const char *text){
+    uint16_t units = 0;
+    for(; *text; text++){
+        int8_t index = strokeIndex(*text);
+        if(index >= 0)
+            drawStrokes(buffer, x + scale(units), y, strokeData + pgm_read_byte(&strokeStart[index]));
+        units += strokeAdvance(*text);
+    }
+}
+
+int16_t StrokeDigits::scale(int16_t units){
+    return ((int32_t)units * unitScale + 128) >> 8;
+}
+
+void StrokeDigits::drawStrokes(uint8_t *buffer, int16_t x, int16_t y, const uint8_t *strokes){
+    uint8_t p[4];
+    while(true){
+        uint8_t type = pgm_read_byte(strokes++);
+        if(type == STROKE_ARC){
+            drawArc(buffer, x, y, strokes);
+            strokes += 6;
+            continue;
+        }
+        if(type != STROKE_LINE && type != STROKE_DOT)
+            return;
+        for(uint8_t i = 0; i < 4; i++)
+            p[i] = pgm_read_byte(strokes++);
+        if(type == STROKE_LINE){
+            drawLine(buffer, x + scale(p[0]), y + scale(p[1]), x + scale(p[2]), y + scale(p[3]));
+        } else {
+            // at least one pixel
+            int16_t x1 = max(scale(p[0] + p[2]), (int16_t)(scale(p[0]) + 1));
+            int16_t y1 = max(scale(p[1] + p[3]), (int16_t)(scale(p[1]) + 1));
+            for(int16_t dotY = scale(p[1]); dotY < y1; dotY++){
+                for(int16_t dotX = scale(p[0]); dotX < x1; dotX++)
+                    setPixel(buffer, x + dotX, y + dotY);
+            }
+        }
+    }
+}
+
+// an ellipse arc as lines between points every ARC_STEP
+// the points are calculated in 1/256 pixel (fixed-point 8.8)
+void StrokeDigits::drawArc(uint8_t *buffer, int16_t x, int16_t y, const uint8_t *arc){
+    int32_t centerX = (int32_t)pgm_read_byte(arc) * unitScale + 128;
+    int32_t centerY = (int32_t)pgm_read_byte(arc + 1) * unitScale + 128;
+    int32_t radiusX = (int32_t)pgm_read_byte(arc + 2) * unitScale;
+    int32_t radiusY = (int32_t)pgm_read_byte(arc + 3) * unitScale;
+    uint8_t angle = pgm_read_byte(arc + 4);
+    uint16_t sweep = pgm_read_byte(arc + 5);
+    if(sweep == 0)
+        sweep = 256;
+    int16_t lastX = 0;
+    int16_t lastY = 0;
+    for(uint16_t step = 0; ; step += ARC_STEP){
+        // the last point is exactly at the end of the arc
+        if(step > sweep)
+            step = sweep;
+        uint8_t pointAngle = angle + step;
+        int16_t pointX = x + ((centerX + radiusX * sine(pointAngle + 64) / 255) >> 8);
+        int16_t pointY = y + ((centerY + radiusY * sine(pointAngle) / 255) >> 8);
+        if(step > 0)
+            drawLine(buffer, lastX, lastY, pointX, pointY);
+        if(step == sweep)
+            break;
+        lastX = pointX;
+        lastY = pointY;
+    }
+}
@@ -0,0 +1,50 @@
+/**************************************************************************
+ * StrokeDigits.h
+ *
+ * Procedural clock digits for the DSTIKE OLED Wrist-Watch
+ *
+ * The digits 0-9 and ':' are described by a few lines, arcs and dots
+ * on a grid with a digit height of 64 units. They are scaled to any
+ * height in fixed-point and drawn with 1 pixel lines directly into the
+ * display buffer, in the thin style of the Lato Hairline fonts.
+ * The description and a sine table need 230 bytes of flash instead of
+ * the 24 kB of Lato_Hairline_38.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef StrokeDigits_h
+#define StrokeDigits_h
+
+#include <Arduino.h>
+
+// digit height in grid units
+#define STROKE_UNITS 64
+
+class StrokeDigits{
+    public:
+        // height: height of the digits in pixel (from the top of
+        // the digits to the baseline, 27 for the size of Lato_Hairline_38)
+        StrokeDigits(uint8_t height);
+        // true if the text has only digits, ':' and ' '
+        bool canDraw(const char *text);
+        uint16_t getStringWidth(const char *text);
+        // draw the text (left aligned) into the display buffer
+        // y is the top of the digits
+        void draw(uint8_t *buffer, int16_t x, int16_t y, const char *text);
+        // bytes of flash used by the digit description and the sine table
+        static uint16_t dataSize();
+        uint8_t height;
+    private:
+        // grid units to pixel
+        int16_t scale(int16_t units);
+        void drawStrokes(uint8_t *buffer, int16_t x, int16_t y, const uint8_t *strokes);
+        void drawArc(uint8_t *buffer, int16_t x, int16_t y, const uint8_t *arc);
+        // pixel per grid unit in 1/256 (fixed-point 8.8)
+        uint16_t unitScale;
+};
+
+#endif
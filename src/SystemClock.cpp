@@ -0,0 +1,77 @@
+/**************************************************************************
+ * SystemClock.cpp
+ *
+ * Monotonic system clock of the DSTIKE OLED Wrist-Watch
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include "SystemClock.h"
+
+
+SystemClock::SystemClock():offset(0), rate(0), rateStart(0), lastMicros(0), wraps(0) {
+
+}
+
+// a smaller value than last time: micros() has wrapped
+uint64_t SystemClock::upTimeMicros(){
+    uint32_t micro = micros();
+    if(micro < lastMicros)
+        wraps++;
+    lastMicros = micro;
+    return ((uint64_t)wraps << 32) | micro;
+}
+
+ClockTime SystemClock::upTime(){
+    return fromMicros(upTimeMicros());
+}
+
+ClockTime SystemClock::now(){
+    return fromMicros(timeAt(upTimeMicros()));
+}
+
+void SystemClock::setTime(const ClockTime &time){
+    rateStart = upTimeMicros();
+    offset = toMicros(time) - rateStart;
+}
+
+int64_t SystemClock::difference(const ClockTime &time){
+    return timeAt(upTimeMicros()) - toMicros(time);
+}
+
+// the correction up to now is moved into the offset
+void SystemClock::setRate(int32_t ppb){
+    uint64_t upTime = upTimeMicros();
+    offset = timeAt(upTime) - upTime;
+    rateStart = upTime;
+    rate = ppb;
+}
+
+int64_t SystemClock::toMicros(const ClockTime &time){
+    return (int64_t)time.seconds * CLOCK_US_PER_SECOND + time.micros;
+}
+
+// the correction is calculated in whole seconds and the rest, so the
+// product doesn't overflow (500 ppm for more than 500 years)
+int64_t SystemClock::timeAt(uint64_t upTime){
+    uint64_t elapsed = upTime - rateStart;
+    int64_t correction = (int64_t)(elapsed / CLOCK_US_PER_SECOND) * rate / 1000 +
+                         (int64_t)(elapsed % CLOCK_US_PER_SECOND) * rate / 1000000000;
+    return (int64_t)upTime + offset + correction;
+}
+
+// the fraction is always positive, also before 1970
+ClockTime SystemClock::fromMicros(int64_t micros){
+    ClockTime time;
+    time.seconds = micros / CLOCK_US_PER_SECOND;
+    int32_t fraction = micros % CLOCK_US_PER_SECOND;
+    if(fraction < 0){
+        fraction += CLOCK_US_PER_SECOND;
+        time.seconds--;
+    }
+    time.micros = fraction;
+    return time;
+}
@@ -0,0 +1,70 @@
+/**************************************************************************
+ * SystemClock.h
+ *
+ * Monotonic system clock of the DSTIKE OLED Wrist-Watch
+ *
+ * The 32 bit micros() wraps after 71.6 minutes. The clock extends it to
+ * 64 bit by counting the wraps, so the up-time is known in us for more
+ * than 500000 years. It has to be read at least once per wrap (loop()
+ * does that every 10 ms).
+ * The time is the up-time plus an offset in us, which is set from the
+ * NTP time: every read is a constant number of operations, there is no
+ * catching up second by second, and the time is corrected with the
+ * fraction of the second.
+ * A rate in ppb (see DriftEstimator.h) corrects the drift of the
+ * up-time since the time was set.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef SystemClock_h
+#define SystemClock_h
+
+#include <Arduino.h>
+#include <time.h>
+
+#define CLOCK_US_PER_SECOND 1000000
+
+// a point in time: seconds and the fraction of the second
+struct ClockTime{
+    time_t seconds;
+    // 0 .. 999999
+    uint32_t micros;
+};
+
+class SystemClock{
+    public:
+        SystemClock();
+        // us since the start
+        uint64_t upTimeMicros();
+        // time since the start
+        ClockTime upTime();
+        // up-time + offset: the epoch after setTime()
+        ClockTime now();
+        // set the time (only the offset is changed)
+        void setTime(const ClockTime &time);
+        // the clock time minus the given time in us
+        // (positive: the clock is ahead)
+        int64_t difference(const ClockTime &time);
+        // correction of the up-time in ppb from now on
+        // the time doesn't jump
+        void setRate(int32_t ppb);
+        static int64_t toMicros(const ClockTime &time);
+        static ClockTime fromMicros(int64_t micros);
+        // time - up-time in us at rateStart
+        int64_t offset;
+        int32_t rate;
+    private:
+        // time in us at the up-time (with the rate)
+        int64_t timeAt(uint64_t upTime);
+        // up-time of the last setTime() or setRate()
+        uint64_t rateStart;
+        // last value of micros() and the number of wraps
+        uint32_t lastMicros;
+        uint32_t wraps;
+};
+
+#endif
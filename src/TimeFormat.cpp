@@ -0,0 +1,115 @@
+/**************************************************************************
+ * TimeFormat.cpp
+ *
+ * Formatting of the time and date for the DSTIKE OLED Wrist-Watch
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include "TimeFormat.h"
+
+// "00" to "99": the two characters of a value are at 2*value
+static const char digitPairs[200] PROGMEM = {
+    '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+    '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+    '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+    '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+    '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+    '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+    '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+    '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+    '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+    '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'};
+
+// the append functions return the position behind the last character
+
+// always two digits, values above 99 are limited to 99
+static char *appendTwoDigits(char *position, int value){
+    if(value < 0)
+        value = 0;
+    if(value > 99)
+        value = 99;
+    *position++ = pgm_read_byte(&digitPairs[2*value]);
+    *position++ = pgm_read_byte(&digitPairs[2*value+1]);
+    return position;
+}
+
+// one or two digits
+static char *appendNumber(char *position, int value){
+    if(value >= 0 && value < 10){
+        *position++ = '0' + value;
+        return position;
+    }
+    return appendTwoDigits(position, value);
+}
+
+// all digits of an unsigned value
+static char *appendUnsigned(char *position, uint32_t value){
+    char digits[10];
+    uint8_t count = 0;
+    do {
+        digits[count++] = '0' + value % 10;
+        value /= 10;
+    } while(value);
+    while(count)
+        *position++ = digits[--count];
+    return position;
+}
+
+// at most maxLength characters
+static char *appendText(char *position, const char *text, uint8_t maxLength){
+    while(*text && maxLength--)
+        *position++ = *text++;
+    return position;
+}
+
+char *formatTime(char *buffer, const tm &dateTime){
+    char *position = appendTwoDigits(buffer, dateTime.tm_hour);
+    *position++ = ':';
+    position = appendTwoDigits(position, dateTime.tm_min);
+    *position = 0;
+    return buffer;
+}
+
+char *formatSeconds(char *buffer, const tm &dateTime){
+    buffer[0] = ':';
+    buffer[1] = ' ';
+    char *position = appendTwoDigits(buffer + 2, dateTime.tm_sec);
+    *position = 0;
+    return buffer;
+}
+
+char *formatDate(char *buffer, const tm &dateTime, const char dayNames[][10], const char monthNames[][6]){
+    char *position = appendText(buffer, dayNames[dateTime.tm_wday % 7], 9);
+    *position++ = ' ';
+    position = appendNumber(position, dateTime.tm_mday);
+    *position++ = '.';
+    position = appendText(position, monthNames[dateTime.tm_mon % 12], 5);
+    *position++ = '.';
+    // years 1000 to 9999
+    int year = dateTime.tm_year + 1900;
+    position = appendTwoDigits(position, year / 100);
+    position = appendTwoDigits(position, year % 100);
+    *position = 0;
+    return buffer;
+}
+
+char *formatUpTimeDays(char *buffer, uint32_t upTime){
+    char *position = appendUnsigned(buffer, upTime / 86400);
+    position = appendText(position, " days", 5);
+    *position = 0;
+    return buffer;
+}
+
+char *formatUpTime(char *buffer, uint32_t upTime){
+    char *position = appendTwoDigits(buffer, upTime / 3600 % 24);
+    *position++ = ':';
+    position = appendTwoDigits(position, upTime / 60 % 60);
+    *position++ = ':';
+    position = appendTwoDigits(position, upTime % 60);
+    *position = 0;
+    return buffer;
+}
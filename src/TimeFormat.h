@@ -0,0 +1,46 @@
+/**************************************************************************
+ * TimeFormat.h
+ *
+ * Formatting of the time and date for the DSTIKE OLED Wrist-Watch
+ *
+ * The strings are written into fixed buffers without sprintf and
+ * without String, so no heap memory is used. Two digit values are
+ * copied out of a table instead of being divided down.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef TimeFormat_h
+#define TimeFormat_h
+
+#include <Arduino.h>
+#include <time.h>
+
+// buffer sizes including the terminating 0
+// "HH:MM"
+#define TIME_STRING_SIZE 6
+// ": SS"
+#define SECONDS_STRING_SIZE 5
+// "Wed 30.Sep.2020" with day and month names of up to 9 and 5 characters
+#define DATE_STRING_SIZE 24
+// "49710 days": the up-time in days (32 bit seconds)
+#define DAYS_STRING_SIZE 11
+// "HH:MM:SS" for the up-time
+#define UPTIME_STRING_SIZE 9
+
+// "HH:MM"
+char *formatTime(char *buffer, const tm &dateTime);
+// ": SS"
+char *formatSeconds(char *buffer, const tm &dateTime);
+// "<day name> <day>.<month name>.<year>"
+// the names are taken out of the same arrays as used in main.cpp
+char *formatDate(char *buffer, const tm &dateTime, const char dayNames[][10], const char monthNames[][6]);
+// "<days> days" of the up-time in s
+char *formatUpTimeDays(char *buffer, uint32_t upTime);
+// "HH:MM:SS" of the up-time in s (the hours without the days)
+char *formatUpTime(char *buffer, uint32_t upTime);
+
+#endif
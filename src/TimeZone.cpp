@@ -0,0 +1,288 @@
+/**************************************************************************
+ * TimeZone.cpp
+ *
+ * Local time from a POSIX TZ rule for the DSTIKE OLED Wrist-Watch
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include "TimeZone.h"
+#include <ctype.h>
+
+#define DAY_SECONDS 86400L
+
+
+/****** Days ******/
+// days since 01.01.1970 of a date (month 1..12)
+// proleptic Gregorian calendar, in eras of 400 years
+static int32_t daysFromCivil(int16_t year, uint8_t month, uint8_t day){
+    if(month <= 2)
+        year--;
+    int32_t era = (year >= 0 ? year : year - 399) / 400;
+    uint32_t yearOfEra = year - era * 400;
+    uint32_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    uint32_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + (int32_t)dayOfEra - 719468;
+}
+
+// the date of the days since 01.01.1970 (month 1..12)
+static void civilFromDays(int32_t days, int16_t &year, uint8_t &month, uint8_t &day){
+    days += 719468;
+    int32_t era = (days >= 0 ? days : days - 146096) / 146097;
+    uint32_t dayOfEra = days - era * 146097;
+    uint32_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    uint32_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    // the year starts in March
+    uint32_t monthIndex = (5 * dayOfYear + 2) / 153;
+    day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+    month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+    year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+}
+
+// 0 = Sunday, 01.01.1970 was a Thursday
+static uint8_t weekDay(int32_t days){
+    int32_t day = (days + 4) % 7;
+    return day < 0 ? day + 7 : day;
+}
+
+static bool isLeapYear(int16_t year){
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+static int32_t daysOf(time_t epoch){
+    int32_t days = epoch / DAY_SECONDS;
+    if(epoch % DAY_SECONDS < 0)
+        days--;
+    return days;
+}
+
+
+/****** Parser ******/
+// letters (at least 3) or any characters in <>
+static const char *parseName(const char *text){
+    if(*text == '<'){
+        while(*text && *text != '>')
+            text++;
+        return *text == '>' ? text + 1 : NULL;
+    }
+    const char *name = text;
+    while(isalpha(*text))
+        text++;
+    return text - name >= 3 ? text : NULL;
+}
+
+// [+|-]hh[:mm[:ss]] in s
+static const char *parseTime(const char *text, int32_t &seconds){
+    const int32_t scale[3] = {3600, 60, 1};
+    int8_t sign = 1;
+    if(*text == '+' || *text == '-'){
+        if(*text == '-')
+            sign = -1;
+        text++;
+    }
+    seconds = 0;
+    for(uint8_t part = 0; part < 3; part++){
+        if(!isdigit(*text))
+            return NULL;
+        int32_t number = 0;
+        while(isdigit(*text))
+            number = number * 10 + (*text++ - '0');
+        seconds += number * scale[part];
+        if(*text != ':' || part == 2)
+            break;
+        text++;
+    }
+    seconds *= sign;
+    return text;
+}
+
+static const char *parseNumber(const char *text, uint16_t &number){
+    if(!isdigit(*text))
+        return NULL;
+    number = 0;
+    while(isdigit(*text))
+        number = number * 10 + (*text++ - '0');
+    return text;
+}
+
+
+/****** Time zone ******/
+TimeZone::TimeZone():stdOffset(0), dstOffset(0), daylightSaving(false), nTransitions(0), tableStart(0), tableEnd(0) {
+
+}
+
+bool TimeZone::begin(const char *rule, int16_t firstYear){
+    if(!parse(rule)){
+        stdOffset = 0;
+        dstOffset = 0;
+        daylightSaving = false;
+        calculate(firstYear);
+        return false;
+    }
+    calculate(firstYear);
+    return true;
+}
+
+bool TimeZone::hasDaylightSaving(){
+    return daylightSaving;
+}
+
+// std offset [dst [offset] [,start[/time],end[/time]]]
+// the offsets of the rule are west of UTC
+bool TimeZone::parse(const char *rule){
+    daylightSaving = false;
+    if(rule == NULL || (rule = parseName(rule)) == NULL)
+        return false;
+    if((rule = parseTime(rule, stdOffset)) == NULL)
+        return false;
+    stdOffset = -stdOffset;
+    dstOffset = stdOffset;
+    if(*rule == 0)
+        return true;
+    if((rule = parseName(rule)) == NULL)
+        return false;
+    daylightSaving = true;
+    dstOffset = stdOffset + 3600;
+    if(*rule != ',' && *rule != 0){
+        if((rule = parseTime(rule, dstOffset)) == NULL)
+            return false;
+        dstOffset = -dstOffset;
+    }
+    if(*rule == 0)
+        rule = ",M3.2.0,M11.1.0";
+    Rule *rules[2] = {&start, &end};
+    for(uint8_t i = 0; i < 2; i++){
+        Rule &next = *rules[i];
+        if(*rule++ != ',')
+            return false;
+        uint16_t number;
+        if(*rule == 'M'){
+            next.type = RULE_MONTH;
+            if((rule = parseNumber(rule + 1, number)) == NULL || number < 1 || number > 12 || *rule != '.')
+                return false;
+            next.month = number;
+            if((rule = parseNumber(rule + 1, number)) == NULL || number < 1 || number > 5 || *rule != '.')
+                return false;
+            next.week = number;
+            if((rule = parseNumber(rule + 1, number)) == NULL || number > 6)
+                return false;
+            next.weekDay = number;
+        } else if(*rule == 'J'){
+            next.type = RULE_JULIAN;
+            if((rule = parseNumber(rule + 1, number)) == NULL || number < 1 || number > 365)
+                return false;
+            next.day = number;
+        } else {
+            next.type = RULE_DAY;
+            if((rule = parseNumber(rule, number)) == NULL || number > 365)
+                return false;
+            next.day = number;
+        }
+        next.time = 2 * 3600;
+        if(*rule == '/' && (rule = parseTime(rule + 1, next.time)) == NULL)
+            return false;
+    }
+    return *rule == 0;
+}
+
+// UTC of the transition, the time of the rule is in the local time
+// before the transition
+time_t TimeZone::ruleTime(const Rule &rule, int16_t year, int32_t offsetBefore){
+    int32_t days = daysFromCivil(year, 1, 1);
+    if(rule.type == RULE_JULIAN){
+        days += rule.day - 1;
+        if(isLeapYear(year) && rule.day >= 60)
+            days++;
+    } else if(rule.type == RULE_DAY){
+        days += rule.day;
+    } else {
+        int32_t first = daysFromCivil(year, rule.month, 1);
+        int32_t last = rule.month == 12 ? daysFromCivil(year + 1, 1, 1) - 1 : daysFromCivil(year, rule.month + 1, 1) - 1;
+        days = first + (rule.weekDay + 7 - weekDay(first)) % 7 + (rule.week - 1) * 7;
+        // week 5: the last one in the month
+        while(days > last)
+            days -= 7;
+    }
+    return (time_t)days * DAY_SECONDS + rule.time - offsetBefore;
+}
+
+// the table covers the years from firstYear on (one day before the
+// start, the offset is the one before the first transition)
+void TimeZone::calculate(int16_t firstYear){
+    nTransitions = 0;
+    tableStart = (time_t)(daysFromCivil(firstYear, 1, 1) - 1) * DAY_SECONDS;
+    tableEnd = (time_t)daysFromCivil(firstYear + TZ_YEARS, 1, 1) * DAY_SECONDS;
+    if(!daylightSaving)
+        return;
+    for(int16_t year = firstYear; year < firstYear + TZ_YEARS; year++){
+        Transition toDst = {ruleTime(start, year, stdOffset), dstOffset};
+        Transition toStd = {ruleTime(end, year, dstOffset), stdOffset};
+        // on the southern hemisphere, the DST ends first
+        if(toStd.utc < toDst.utc){
+            Transition first = toStd;
+            toStd = toDst;
+            toDst = first;
+        }
+        transitions[nTransitions++] = toDst;
+        transitions[nTransitions++] = toStd;
+    }
+}
+
+int8_t TimeZone::find(time_t epoch){
+    if(epoch < tableStart || epoch >= tableEnd){
+        int16_t year;
+        uint8_t month, day;
+        civilFromDays(daysOf(epoch), year, month, day);
+        calculate(year);
+    }
+    // the first transition after the epoch
+    uint8_t low = 0;
+    uint8_t high = nTransitions;
+    while(low < high){
+        uint8_t middle = (low + high) / 2;
+        if(transitions[middle].utc <= epoch)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return (int8_t)low - 1;
+}
+
+int32_t TimeZone::offset(time_t epoch){
+    int8_t index = find(epoch);
+    if(index >= 0)
+        return transitions[index].offset;
+    if(nTransitions == 0)
+        return stdOffset;
+    // before the first transition: the other offset
+    return transitions[0].offset == dstOffset ? stdOffset : dstOffset;
+}
+
+time_t TimeZone::nextTransition(time_t epoch){
+    int8_t index = find(epoch) + 1;
+    if(index < nTransitions)
+        return transitions[index].utc;
+    return tableEnd;
+}
+
+void TimeZone::localTime(time_t epoch, tm &dateTime){
+    int32_t zoneOffset = offset(epoch);
+    time_t local = epoch + zoneOffset;
+    int32_t days = daysOf(local);
+    int32_t seconds = local - (time_t)days * DAY_SECONDS;
+    int16_t year;
+    uint8_t month, day;
+    civilFromDays(days, year, month, day);
+    dateTime.tm_sec = seconds % 60;
+    dateTime.tm_min = seconds / 60 % 60;
+    dateTime.tm_hour = seconds / 3600;
+    dateTime.tm_mday = day;
+    dateTime.tm_mon = month - 1;
+    dateTime.tm_year = year - 1900;
+    dateTime.tm_wday = weekDay(days);
+    dateTime.tm_yday = days - daysFromCivil(year, 1, 1);
+    dateTime.tm_isdst = daylightSaving && zoneOffset != stdOffset ? 1 : 0;
+}
@@ -0,0 +1,90 @@
+/**************************************************************************
+ * TimeZone.h
+ *
+ * Local time from a POSIX TZ rule for the DSTIKE OLED Wrist-Watch
+ *
+ * The rule (e.g. "CET-1CEST-2,M3.5.0/02:00:00,M10.5.0/03:00:00") is
+ * parsed once by begin(), and the UTC times of the DST transitions of
+ * TZ_YEARS years are calculated into a sorted table. The local time
+ * of an epoch is then a binary search in the table, an addition and
+ * the conversion of the days into a date: the TZ variable is not
+ * needed, newlib doesn't parse it again for every localtime_r().
+ * If the epoch is outside of the table, the transitions of the years
+ * from its year on are calculated again from the parsed rule.
+ * Every TimeZone has its own rule, so several zones can be used and
+ * switched at runtime.
+ *
+ * Supported: names as letters or in <>, offsets [+|-]hh[:mm[:ss]],
+ * the rules Mm.w.d, Jn and n with an optional /time (also negative
+ * or more than 24 hours). Without a rule, the DST follows the US rule
+ * (M3.2.0,M11.1.0) like in newlib.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef TimeZone_h
+#define TimeZone_h
+
+#include <Arduino.h>
+#include <time.h>
+
+// years with transitions in the table (2 transitions per year)
+#define TZ_YEARS 10
+#define TZ_FIRST_YEAR 2020
+
+class TimeZone{
+    public:
+        // UTC until begin()
+        TimeZone();
+        // parse the rule and calculate the transitions from firstYear on
+        // returns false if the rule is not valid (the zone is then UTC)
+        bool begin(const char *rule, int16_t firstYear = TZ_FIRST_YEAR);
+        // offset of the local time to UTC in s at the epoch
+        int32_t offset(time_t epoch);
+        // the local time of the epoch (like localtime_r())
+        void localTime(time_t epoch, tm &dateTime);
+        // the first transition after the epoch, or the end of the table
+        time_t nextTransition(time_t epoch);
+        // true if the rule has a DST
+        bool hasDaylightSaving();
+    private:
+        // day of a transition in the year
+        #define RULE_JULIAN 0   // Jn: 1..365, without February 29
+        #define RULE_DAY    1   // n: 0..365
+        #define RULE_MONTH  2   // Mm.w.d: day d (0 = Sunday) of week w (5 = last) of month m
+        struct Rule{
+            uint8_t type;
+            uint8_t month;
+            uint8_t week;
+            uint8_t weekDay;
+            uint16_t day;
+            // local time of the transition in s
+            int32_t time;
+        };
+        struct Transition{
+            time_t utc;
+            // offset after the transition
+            int32_t offset;
+        };
+        bool parse(const char *rule);
+        void calculate(int16_t firstYear);
+        time_t ruleTime(const Rule &rule, int16_t year, int32_t offsetBefore);
+        // index of the last transition up to the epoch, -1 if none
+        int8_t find(time_t epoch);
+        // offsets east of UTC in s
+        int32_t stdOffset;
+        int32_t dstOffset;
+        bool daylightSaving;
+        Rule start;
+        Rule end;
+        Transition transitions[2 * TZ_YEARS];
+        uint8_t nTransitions;
+        // the table is valid from tableStart to tableEnd
+        time_t tableStart;
+        time_t tableEnd;
+};
+
+#endif
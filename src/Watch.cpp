@@ -100,10 +100,194 @@ void RGB_LED::cycle(uint8_t brightness, int delay_ms){
 }
 
 
+/****** Glyph cache ******/
+GlyphCache::GlyphCache():useCounter(0) {
+    clear();
+}
+
+// returns the decompressed glyph, a glyph that is not in the cache
+// replaces the least recently used one
+const uint8_t *GlyphCache::get(const CompressedFont *font, uint8_t index, uint8_t byteSize){
+    CachedGlyph *oldest = &slots[0];
+    for(uint8_t i = 0; i < GLYPH_CACHE_SIZE; i++){
+        CachedGlyph &slot = slots[i];
+        if(slot.font == font && slot.index == index){
+            slot.lastUse = ++useCounter;
+            hits++;
+            return slot.data;
+        }
+        // unused slots have lastUse = 0
+        if(slot.lastUse < oldest->lastUse)
+            oldest = &slot;
+    }
+    misses++;
+    decompress(font, index, byteSize, oldest->data);
+    oldest->font = font;
+    oldest->index = index;
+    oldest->lastUse = ++useCounter;
+    return oldest->data;
+}
+
+void GlyphCache::clear(){
+    for(uint8_t i = 0; i < GLYPH_CACHE_SIZE; i++){
+        slots[i].font = NULL;
+        slots[i].lastUse = 0;
+    }
+}
+
+// byteSize bytes of glyph data out of the bit mask and the
+// bytes that are not empty (see CompressedFont)
+void GlyphCache::decompress(const CompressedFont *font, uint8_t index, uint8_t byteSize, uint8_t *glyph){
+    const uint8_t *mask = font->data + pgm_read_word(&font->offsets[index]);
+    const uint8_t *values = mask + ((byteSize + 7) >> 3);
+    uint8_t bits = 0;
+    for(uint8_t k = 0; k < byteSize; k++){
+        if((k & 7) == 0)
+            bits = pgm_read_byte(mask + (k >> 3));
+        glyph[k] = (bits & 1) ? pgm_read_byte(values++) : 0;
+        bits >>= 1;
+    }
+}
+
+
+/****** Sprite font ******/
+SpriteFont::SpriteFont():font(NULL), height(0), pages(0), data(NULL) {
+
+}
+
+// decode the glyphs of the clock face characters into RAM
+// returns false if there is not enough memory
+bool SpriteFont::begin(const uint8_t *fontData, const CompressedFont *compressed){
+    end();
+    height = pgm_read_byte(fontData + HEIGHT_POS);
+    pages = 1 + ((height - 1) >> 3);
+    uint8_t firstChar = pgm_read_byte(fontData + FIRST_CHAR_POS);
+    uint16_t sizeOfJumpTable = pgm_read_byte(fontData + CHAR_NUM_POS) * JUMPTABLE_BYTES;
+    const char chars[SPRITE_CHARS+1] = "0123456789: ";
+    // first pass: widths and memory size
+    uint16_t size = 0;
+    for(uint8_t i = 0; i < SPRITE_CHARS; i++){
+        const uint8_t *jump = fontData + JUMPTABLE_START + (chars[i] - firstChar) * JUMPTABLE_BYTES;
+        width[i] = pgm_read_byte(jump + JUMPTABLE_WIDTH);
+        offset[i] = size;
+        size += width[i] * pages;
+    }
+    data = (uint8_t *)calloc(size, 1);
+    if(!data)
+        return false;
+    // second pass: copy the glyph data, it is stored column by column
+    // and the empty bytes at the end are not stored in the font
+    for(uint8_t i = 0; i < SPRITE_CHARS; i++){
+        const uint8_t *jump = fontData + JUMPTABLE_START + (chars[i] - firstChar) * JUMPTABLE_BYTES;
+        uint8_t msbJump = pgm_read_byte(jump);
+        uint8_t lsbJump = pgm_read_byte(jump + JUMPTABLE_LSB);
+        // not drawable (e.g. space)
+        if(msbJump == 255 && lsbJump == 255)
+            continue;
+        uint8_t byteSize = pgm_read_byte(jump + JUMPTABLE_SIZE);
+        const uint8_t *glyph = fontData + JUMPTABLE_START + sizeOfJumpTable + ((msbJump << 8) + lsbJump);
+        for(uint16_t k = 0; k < byteSize && k < width[i] * pages; k++){
+            uint8_t column = k / pages;
+            uint8_t page = k % pages;
+            data[offset[i] + page * width[i] + column] = pgm_read_byte(glyph + k);
+        }
+    }
+    // compressed fonts: all glyphs are marked as not drawable,
+    // the size in the jump table is the size of the decompressed glyph
+    for(uint8_t i = 0; compressed && i < SPRITE_CHARS; i++){
+        const uint8_t *jump = fontData + JUMPTABLE_START + (chars[i] - firstChar) * JUMPTABLE_BYTES;
+        uint8_t byteSize = pgm_read_byte(jump + JUMPTABLE_SIZE);
+        uint8_t glyph[GLYPH_MAX_BYTES];
+        GlyphCache::decompress(compressed, chars[i] - firstChar, byteSize, glyph);
+        for(uint16_t k = 0; k < byteSize && k < width[i] * pages; k++){
+            uint8_t column = k / pages;
+            uint8_t page = k % pages;
+            data[offset[i] + page * width[i] + column] = glyph[k];
+        }
+    }
+    font = fontData;
+    return true;
+}
+
+void SpriteFont::end(){
+    free(data);
+    data = NULL;
+    font = NULL;
+}
+
+int8_t SpriteFont::charIndex(char c){
+    // ':' follows '9' in the ASCII table
+    if(c >= '0' && c <= ':')
+        return c - '0';
+    if(c == ' ')
+        return SPRITE_CHARS - 1;
+    return -1;
+}
+
+// true if all characters of the text are in the cache
+bool SpriteFont::canDraw(const char *text){
+    if(!data)
+        return false;
+    for(; *text; text++){
+        if(charIndex(*text) < 0)
+            return false;
+    }
+    return true;
+}
+
+uint16_t SpriteFont::getStringWidth(const char *text){
+    uint16_t textWidth = 0;
+    for(; *text; text++)
+        textWidth += width[charIndex(*text)];
+    return textWidth;
+}
+
+// draw the text (left aligned) into the display buffer
+// only for texts that passed canDraw()
+void SpriteFont::draw(uint8_t *buffer, int16_t x, int16_t y, const char *text){
+    for(; *text; text++){
+        uint8_t index = charIndex(*text);
+        drawGlyph(buffer, x, y, index);
+        x += width[index];
+    }
+}
+
+void SpriteFont::drawGlyph(uint8_t *buffer, int16_t x, int16_t y, uint8_t index){
+    uint8_t glyphWidth = width[index];
+    // clip the columns to the screen
+    int16_t col_start = x < 0 ? -x : 0;
+    int16_t col_end = x + glyphWidth > OLED_WIDTH ? OLED_WIDTH - x : glyphWidth;
+    if(col_start >= col_end)
+        return;
+    // y >> 3 rounds down, also for negative values
+    int16_t firstPage = y >> 3;
+    uint8_t shift = y & 7;
+    const uint8_t *src = data + offset[index];
+    for(uint8_t page = 0; page < pages; page++, src += glyphWidth){
+        int16_t upper = firstPage + page;
+        int16_t lower = upper + 1;
+        // like the OLED library: bytes that start above the
+        // screen are skipped completely
+        if(upper < 0)
+            continue;
+        if(upper < OLED_PAGES){
+            uint8_t *dst = buffer + upper * OLED_WIDTH + x;
+            for(int16_t col = col_start; col < col_end; col++)
+                dst[col] |= src[col] << shift;
+        }
+        if(shift && lower < OLED_PAGES){
+            uint8_t *dst = buffer + lower * OLED_WIDTH + x;
+            for(int16_t col = col_start; col < col_end; col++)
+                dst[col] |= src[col] >> (8 - shift);
+        }
+    }
+}
+
 
 /****** DSTIKE_Watch ******/
 DSTIKE_Watch::DSTIKE_Watch():isInitialized(0) {
-
+    clearDirty();
+    clearLayoutCache();
 }
 
 void DSTIKE_Watch::begin(){
@@ -129,62 +313,805 @@ void DSTIKE_Watch::begin(){
     // flip to fit for the Watch
     OLED.flipScreenVertically();
     // default font
-    OLED.setFont(ArialMT_Plain_10);
+    setFont(ArialMT_Plain_10);
     // default text alignment
-    OLED.setTextAlignment(TEXT_ALIGN_LEFT);
+    setTextAlignment(TEXT_ALIGN_LEFT);
     // activate (if not already activated)
     OLED.displayOn();
     // clear the display
     OLED.clear();
     // show the content (Write the buffer to the display memory)
     OLED.display();
+    // display memory and buffer are now in sync
+    clearDirty();
 
     
     // turm off the Neopixel
     // otherwise it will ligt up green
     RGBLED.off();
 
+    // the button pins are sampled by an interrupt at every edge:
+    // a press during a delay() is read by the next updateButtons()
+    buttons.add(&NavBtn_UP);
+    buttons.add(&NavBtn_DOWN);
+    buttons.add(&NavBtn_PUSH);
+    buttons.enableInterrupt();
+    // pressing UP and DOWN together is a gesture
+    gestures.setChord(NAV_UP | NAV_DOWN);
+
 	Serial.println("[OK] Init done");
 }
 
 // call this function inside the main loop
-// to update the button states
+// to update the button states out of the button events
+// and to recognize the gestures
+// a running display transfer (see flushAsync()) is continued
+// after the buttons are read
 void DSTIKE_Watch::updateButtons() {
-	Watch.NavBtn_UP.read();
-	Watch.NavBtn_DOWN.read();
-	Watch.NavBtn_PUSH.read();
+    buttons.update();
+    // same order as the bits NAV_UP, NAV_DOWN, NAV_PUSH
+    Button *navButtons[GESTURE_BUTTONS] = {&NavBtn_UP, &NavBtn_DOWN, &NavBtn_PUSH};
+    for(uint8_t i = 0; i < GESTURE_BUTTONS; i++){
+        if(navButtons[i]->wasChanged()){
+            gestures.transition(i, navButtons[i]->isPressed(), navButtons[i]->lastChange());
+#ifdef BUTTON_TRACE
+            // record a trace for the gesture test of the benchmark
+            Serial.printf("%lu %u %u\n", (unsigned long)navButtons[i]->lastChange(), i, navButtons[i]->isPressed());
+#endif
+        }
+    }
+    gestures.update(buttons.time);
+    serviceTransfer();
 }
 
 // dont forget to call this function after every drawing function
 // otherwise, you will not see any changes
+// Only the changed columns of every page are transferred.
+// If only the seconds are redrawn, that's a few percent of the frame.
 void DSTIKE_Watch::updateDisplay(){
-    OLED.display();
+    // the changes are kept until the screen is switched on
+    if(!screenState)
+        return;
+    for(uint8_t page = 0; page < OLED_PAGES; page++){
+        if(dirtyStart[page] < dirtyEnd[page])
+            sendPage(page, dirtyStart[page], dirtyEnd[page]);
+    }
+    clearDirty();
+    transferPending = false;
+}
+
+// start the transfer of the changed pages to the display
+// the pages are sent one by one by serviceTransfer()
+void DSTIKE_Watch::flushAsync(){
+    if(screenState)
+        transferPending = true;
+}
+
+// true until all changed pages are sent
+bool DSTIKE_Watch::isTransferBusy(){
+    if(!transferPending || !screenState)
+        return false;
+    for(uint8_t page = 0; page < OLED_PAGES; page++){
+        if(dirtyStart[page] < dirtyEnd[page])
+            return true;
+    }
+    return false;
+}
+
+// send the next changed page to the display (one slice of the frame)
+// If a page is changed again after it was sent, it is sent again.
+// Don't call this function from an interrupt: it uses the Wire library.
+void DSTIKE_Watch::serviceTransfer(){
+    if(!transferPending || !screenState)
+        return;
+    for(uint8_t i = 0; i < OLED_PAGES; i++){
+        uint8_t page = (transferPage + i) % OLED_PAGES;
+        if(dirtyStart[page] < dirtyEnd[page]){
+            sendPage(page, dirtyStart[page], dirtyEnd[page]);
+            dirtyStart[page] = OLED_WIDTH;
+            dirtyEnd[page] = 0;
+            transferPage = (page + 1) % OLED_PAGES;
+            return;
+        }
+    }
+    // nothing left to send
+    transferPending = false;
+    transferPage = 0;
+}
+
+// mark an area of the screen as changed
+// the area is extended to full pages (8 pixel rows)
+void DSTIKE_Watch::invalidate(int16_t x, int16_t y, int16_t width, int16_t height){
+    // clip the area to the screen
+    if(x < 0){
+        width += x;
+        x = 0;
+    }
+    if(y < 0){
+        height += y;
+        y = 0;
+    }
+    if(x + width > OLED_WIDTH)
+        width = OLED_WIDTH - x;
+    if(y + height > OLED_HEIGHT)
+        height = OLED_HEIGHT - y;
+    if(width <= 0 || height <= 0)
+        return;
+    uint8_t lastPage = (y + height - 1) >> 3;
+    for(uint8_t page = y >> 3; page <= lastPage; page++){
+        if(dirtyStart[page] >= dirtyEnd[page]){
+            dirtyStart[page] = x;
+            dirtyEnd[page] = x + width;
+        } else {
+            dirtyStart[page] = min<uint8_t>(dirtyStart[page], x);
+            dirtyEnd[page] = max<uint8_t>(dirtyEnd[page], x + width);
+        }
+    }
+}
+
+void DSTIKE_Watch::invalidateAll(){
+    invalidate(0, 0, OLED_WIDTH, OLED_HEIGHT);
+}
+
+void DSTIKE_Watch::clearDirty(){
+    for(uint8_t page = 0; page < OLED_PAGES; page++){
+        dirtyStart[page] = OLED_WIDTH;
+        dirtyEnd[page] = 0;
+    }
+}
+
+// write the columns x_start <= x < x_end of one page into the display memory
+// same protocol as SH1106Wire::display(), but only for a part of the page
+void DSTIKE_Watch::sendPage(uint8_t page, uint8_t x_start, uint8_t x_end){
+    sendCommand(0xB0 + page);
+    sendCommand((x_start + OLED_COLUMN_OFFSET) & 0x0F);
+    sendCommand(0x10 | ((x_start + OLED_COLUMN_OFFSET) >> 4));
+    uint8_t *p = &OLED.buffer[page * OLED_WIDTH + x_start];
+    uint8_t x = x_start;
+    while(x < x_end){
+        uint8_t chunk = min<uint8_t>(OLED_I2C_CHUNK, x_end - x);
+        Wire.beginTransmission(OLED_ADDR);
+        Wire.write(0x40);
+        for(uint8_t k = 0; k < chunk; k++)
+            Wire.write(*p++);
+        Wire.endTransmission();
+        x += chunk;
+    }
+}
+
+void DSTIKE_Watch::sendCommand(uint8_t command){
+    Wire.beginTransmission(OLED_ADDR);
+    Wire.write(0x80);
+    Wire.write(command);
+    Wire.endTransmission();
+}
+
+// true if the text has no line breaks or UTF-8 characters
+static bool isPlainText(const char *text){
+    for(const char *c = text; *c; c++){
+        if(*c == '\n' || (uint8_t)*c >= 128)
+            return false;
+    }
+    return true;
 }
 
 // simple methos to draw a string on a specific position
-void DSTIKE_Watch::drawString(int16_t x, int16_t y, String text){
-    OLED.drawString(x, y, text);
+// texts with cached characters (see cacheFont()) are copied from the cache
+// texts in a compressed font are drawn out of the glyph cache
+// other texts are drawn with the cached layout, if possible
+// the text is measured once, with the path that draws it
+ScreenArea DSTIKE_Watch::drawString(int16_t x, int16_t y, const char *text){
+    if(!screenState){
+        ScreenArea none = {x, y, 0, 0};
+        return none;
+    }
+    TextPath path;
+    ScreenArea area = measureText(x, y, text, path);
+    const CompressedFont *compressed = findCompressedFont(currentFont);
+    if(OLED.getColor() != WHITE)
+        OLED.drawString(x, y, text);
+    else if(path.sprites)
+        path.sprites->draw(OLED.buffer, area.x, area.y, text);
+    else if(path.indexed)
+        drawIndexed(path.indexed, area.x, area.y, text);
+    else if(compressed && isPlainText(text))
+        drawCompressed(compressed, area.x, area.y, text);
+    else if(path.layout)
+        drawLayout(path.layout, area.x, area.y);
+    else
+        OLED.drawString(x, y, text);
+    // the glyphs are stored in full bytes: the raster height of the
+    // last line is rounded up to a multiple of 8 pixel
+    uint8_t textHeight = pgm_read_byte(currentFont + HEIGHT_POS);
+    uint8_t rasterHeight = (1 + ((textHeight - 1) >> 3)) * 8;
+    invalidate(area.x, area.y, area.width, area.height - textHeight + rasterHeight);
+    return area;
+}
+
+// returns the area that drawString() would cover with the
+// current font and text alignment
+ScreenArea DSTIKE_Watch::getTextArea(int16_t x, int16_t y, const char *text){
+    TextPath path;
+    return measureText(x, y, text, path);
+}
+
+// the width comes from the first of sprites, indexed font and cached
+// layout that can draw the text, path tells drawString() which one
+ScreenArea DSTIKE_Watch::measureText(int16_t x, int16_t y, const char *text, TextPath &path){
+    uint8_t textHeight = pgm_read_byte(currentFont + HEIGHT_POS);
+    uint16_t nLines = 1;
+    uint16_t textWidth;
+    path.sprites = findSpriteFont(currentFont);
+    path.indexed = NULL;
+    path.layout = NULL;
+    if(path.sprites && !path.sprites->canDraw(text))
+        path.sprites = NULL;
+    if(path.sprites)
+        textWidth = path.sprites->getStringWidth(text);
+    else if((path.indexed = findIndexedFont(text)) != NULL)
+        textWidth = getIndexedWidth(path.indexed, text);
+    else if((path.layout = getLayout(text)) != NULL)
+        textWidth = path.layout->width;
+    else {
+        for(const char *c = text; *c; c++)
+            nLines += (*c == '\n');
+        // the library converts UTF-8 characters first
+        textWidth = OLED.getStringWidth(String(text));
+    }
+    alignText(x, y, textWidth, textHeight, nLines);
+    ScreenArea area = {x, y, (int16_t)textWidth, (int16_t)(nLines * textHeight)};
+    return area;
+}
+
+// returns the layout of a text in the current font from the cache
+// If it is not in the cache, the text is measured and stored in
+// place of the least recently used layout. With layout caching
+// disabled, the text is measured into volatileLayout.
+// returns NULL for texts that can't have a layout:
+// too long, line breaks or UTF-8 characters
+TextLayout *DSTIKE_Watch::getLayout(const char *text){
+    // FNV-1a hash
+    uint32_t hash = 2166136261UL;
+    uint8_t length = 0;
+    for(const char *c = text; *c; c++, length++){
+        if(length >= LAYOUT_MAX_GLYPHS || *c == '\n' || (uint8_t)*c >= 128)
+            return NULL;
+        hash ^= (uint8_t)*c;
+        hash *= 16777619UL;
+    }
+    if(!layoutCaching){
+        measureLayout(&volatileLayout, text);
+        return &volatileLayout;
+    }
+    TextLayout *layout = &layoutCache[0];
+    for(uint8_t i = 0; i < LAYOUT_CACHE_SIZE; i++){
+        TextLayout &cached = layoutCache[i];
+        if(cached.font == currentFont && cached.hash == hash && strcmp(cached.text, text) == 0){
+            cached.lastUse = ++layoutUses;
+            layoutHits++;
+            return &cached;
+        }
+        if(cached.lastUse < layout->lastUse)
+            layout = &cached;
+    }
+    layoutMisses++;
+    measureLayout(layout, text);
+    layout->hash = hash;
+    layout->lastUse = ++layoutUses;
+    strcpy(layout->text, text);
+    return layout;
+}
+
+// measure the text and store the position of every glyph
+void DSTIKE_Watch::measureLayout(TextLayout *layout, const char *text){
+    uint8_t firstChar = pgm_read_byte(currentFont + FIRST_CHAR_POS);
+    uint8_t nChars = pgm_read_byte(currentFont + CHAR_NUM_POS);
+    uint16_t dataStart = JUMPTABLE_START + nChars * JUMPTABLE_BYTES;
+    uint16_t cursorX = 0;
+    layout->nGlyphs = 0;
+    for(const char *c = text; *c; c++){
+        uint8_t code = *c;
+        // like the OLED library: characters below the font are ignored
+        if(code < firstChar || code - firstChar >= nChars)
+            continue;
+        const uint8_t *jump = currentFont + JUMPTABLE_START + (code - firstChar) * JUMPTABLE_BYTES;
+        uint8_t msbJump = pgm_read_byte(jump);
+        uint8_t lsbJump = pgm_read_byte(jump + JUMPTABLE_LSB);
+        GlyphLayout &glyph = layout->glyphs[layout->nGlyphs++];
+        glyph.x = cursorX;
+        if(msbJump == 255 && lsbJump == 255){
+            glyph.byteSize = 0;
+            glyph.dataOffset = 0;
+        } else {
+            glyph.byteSize = pgm_read_byte(jump + JUMPTABLE_SIZE);
+            glyph.dataOffset = dataStart + ((msbJump << 8) + lsbJump);
+        }
+        cursorX += pgm_read_byte(jump + JUMPTABLE_WIDTH);
+    }
+    layout->width = cursorX;
+    layout->font = currentFont;
+}
+
+void DSTIKE_Watch::clearLayoutCache(){
+    for(uint8_t i = 0; i < LAYOUT_CACHE_SIZE; i++){
+        layoutCache[i].font = NULL;
+        layoutCache[i].lastUse = 0;
+    }
+    layoutUses = 0;
+}
+
+void DSTIKE_Watch::setLayoutCaching(bool enabled){
+    layoutCaching = enabled;
+}
+
+// draw a text (in white) with the glyph positions from the layout
+// the glyph data is stored column by column, 1 byte = 8 pixel rows
+void DSTIKE_Watch::drawLayout(TextLayout *layout, int16_t x, int16_t y){
+    uint8_t textHeight = pgm_read_byte(layout->font + HEIGHT_POS);
+    uint8_t rasterHeight = 1 + ((textHeight - 1) >> 3);
+    // y >> 3 rounds down, also for negative values
+    int16_t firstPage = y >> 3;
+    uint8_t shift = y & 7;
+    for(uint8_t i = 0; i < layout->nGlyphs; i++){
+        const GlyphLayout &glyph = layout->glyphs[i];
+        const uint8_t *data = layout->font + glyph.dataOffset;
+        int16_t column = x + glyph.x;
+        uint8_t *aligned = alignedGlyph(column, y, glyph.byteSize, rasterHeight);
+        if(aligned){
+            // straight copy, column by column
+            for(uint8_t k = 0; k < glyph.byteSize; aligned++){
+                for(uint8_t page = 0; page < rasterHeight && k < glyph.byteSize; page++, k++)
+                    aligned[page * OLED_WIDTH] |= pgm_read_byte(data + k);
+            }
+            continue;
+        }
+        uint8_t page = 0;
+        for(uint8_t k = 0; k < glyph.byteSize; k++){
+            drawGlyphByte(column, firstPage + page, shift, pgm_read_byte(data + k));
+            if(++page == rasterHeight){
+                page = 0;
+                column++;
+            }
+        }
+    }
+}
+
+// returns the indexed version of the current font, if the text can
+// be drawn with it (no line breaks or UTF-8 characters), otherwise NULL
+const IndexedFont *DSTIKE_Watch::findIndexedFont(const char *text){
+    const IndexedFont *indexed = NULL;
+    for(uint8_t i = 0; i < INDEXED_FONTS && !indexed; i++){
+        if(indexedFonts[i] && indexedFonts[i]->font == currentFont)
+            indexed = indexedFonts[i];
+    }
+    if(!indexed || !isPlainText(text))
+        return NULL;
+    return indexed;
+}
+
+
+// like the OLED library: characters below the font are ignored
+uint16_t DSTIKE_Watch::getIndexedWidth(const IndexedFont *indexed, const char *text){
+    uint16_t width = 0;
+    for(const char *c = text; *c; c++){
+        uint8_t index = (uint8_t)*c - indexed->firstChar;
+        if(index < indexed->numChars)
+            width += INDEXED_GLYPH_WIDTH(pgm_read_dword(&indexed->glyphs[index]));
+    }
+    return width;
+}
+
+// draw a text (in white) with an indexed font
+// same pixels as the OLED library, but one read per glyph entry
+// and one read per 4 bytes of glyph data
+void DSTIKE_Watch::drawIndexed(const IndexedFont *indexed, int16_t x, int16_t y, const char *text){
+    uint8_t rasterHeight = 1 + ((indexed->height - 1) >> 3);
+    int16_t firstPage = y >> 3;
+    uint8_t shift = y & 7;
+    for(const char *c = text; *c; c++){
+        uint8_t index = (uint8_t)*c - indexed->firstChar;
+        if(index >= indexed->numChars)
+            continue;
+        uint32_t entry = pgm_read_dword(&indexed->glyphs[index]);
+        const uint32_t *data = indexed->data + INDEXED_GLYPH_OFFSET(entry);
+        uint8_t size = INDEXED_GLYPH_SIZE(entry);
+        int16_t column = x;
+        uint8_t page = 0;
+        uint8_t *aligned = alignedGlyph(x, y, size, rasterHeight);
+        if(aligned){
+            // straight copy, column by column
+            for(uint8_t k = 0; k < size; k += 4){
+                uint32_t word = pgm_read_dword(data + (k >> 2));
+                uint8_t nBytes = min<uint8_t>(4, size - k);
+                if(word == 0){
+                    page += nBytes;
+                    while(page >= rasterHeight){
+                        page -= rasterHeight;
+                        aligned++;
+                    }
+                    continue;
+                }
+                for(uint8_t b = 0; b < nBytes; b++, word >>= 8){
+                    aligned[page * OLED_WIDTH] |= (uint8_t)word;
+                    if(++page == rasterHeight){
+                        page = 0;
+                        aligned++;
+                    }
+                }
+            }
+            x += INDEXED_GLYPH_WIDTH(entry);
+            continue;
+        }
+        for(uint8_t k = 0; k < size; k += 4){
+            uint32_t word = pgm_read_dword(data + (k >> 2));
+            uint8_t nBytes = min<uint8_t>(4, size - k);
+            // thin fonts have many empty bytes: skip 4 at once
+            if(word == 0){
+                page += nBytes;
+                while(page >= rasterHeight){
+                    page -= rasterHeight;
+                    column++;
+                }
+                continue;
+            }
+            for(uint8_t b = 0; b < nBytes; b++){
+                drawGlyphByte(column, firstPage + page, shift, (uint8_t)word);
+                word >>= 8;
+                if(++page == rasterHeight){
+                    page = 0;
+                    column++;
+                }
+            }
+        }
+        x += INDEXED_GLYPH_WIDTH(entry);
+    }
+}
+
+// returns the compressed version of a font or NULL
+const CompressedFont *DSTIKE_Watch::findCompressedFont(const uint8_t *fontData){
+    for(uint8_t i = 0; i < COMPRESSED_FONTS; i++){
+        if(compressedFonts[i] && compressedFonts[i]->font == fontData)
+            return compressedFonts[i];
+    }
+    return NULL;
+}
+
+// draw a text (in white) with a compressed font
+// the width and the size of the glyphs are in the jump table,
+// the glyph data comes out of the glyph cache
+void DSTIKE_Watch::drawCompressed(const CompressedFont *compressed, int16_t x, int16_t y, const char *text){
+    uint8_t rasterHeight = 1 + ((pgm_read_byte(compressed->font + HEIGHT_POS) - 1) >> 3);
+    uint8_t firstChar = pgm_read_byte(compressed->font + FIRST_CHAR_POS);
+    uint8_t nChars = pgm_read_byte(compressed->font + CHAR_NUM_POS);
+    int16_t firstPage = y >> 3;
+    uint8_t shift = y & 7;
+    for(const char *c = text; *c; c++){
+        uint8_t index = (uint8_t)*c - firstChar;
+        if(index >= nChars)
+            continue;
+        const uint8_t *jump = compressed->font + JUMPTABLE_START + index * JUMPTABLE_BYTES;
+        uint8_t byteSize = pgm_read_byte(jump + JUMPTABLE_SIZE);
+        if(byteSize){
+            const uint8_t *glyph = glyphCache.get(compressed, index, byteSize);
+            uint8_t *aligned = alignedGlyph(x, y, byteSize, rasterHeight);
+            if(aligned){
+                // straight copy, column by column
+                for(uint8_t k = 0; k < byteSize; aligned++){
+                    for(uint8_t page = 0; page < rasterHeight && k < byteSize; page++, k++)
+                        aligned[page * OLED_WIDTH] |= glyph[k];
+                }
+            } else {
+                int16_t column = x;
+                uint8_t page = 0;
+                for(uint8_t k = 0; k < byteSize; k++){
+                    drawGlyphByte(column, firstPage + page, shift, glyph[k]);
+                    if(++page == rasterHeight){
+                        page = 0;
+                        column++;
+                    }
+                }
+            }
+        }
+        x += pgm_read_byte(jump + JUMPTABLE_WIDTH);
+    }
+}
+
+// Page-aligned fast path: a glyph at a multiple of 8 pixel rows, that
+// is completely on the screen, needs no bit shift and no clipping.
+// The glyph bytes of a column are ORed directly into the pages.
+// returns the position of the first glyph byte in the display buffer,
+// or NULL if the glyph has to be drawn with drawGlyphByte()
+inline uint8_t *DSTIKE_Watch::alignedGlyph(int16_t x, int16_t y, uint8_t byteSize, uint8_t rasterHeight){
+    if((y & 7) || x < 0 || y < 0 || (y >> 3) + rasterHeight > OLED_PAGES)
+        return NULL;
+    // the glyph data can be wider than the glyph
+    if(x + (byteSize + rasterHeight - 1) / rasterHeight > OLED_WIDTH)
+        return NULL;
+    return OLED.buffer + (y >> 3) * OLED_WIDTH + x;
+}
+
+// OR one byte of glyph data (8 pixel rows) into the display buffer
+// at a page that is shifted down by 0..7 pixel
+inline void DSTIKE_Watch::drawGlyphByte(int16_t column, int16_t page, uint8_t shift, uint8_t glyphByte){
+    // like the OLED library: bytes that start above the
+    // screen are skipped completely
+    if(glyphByte && column >= 0 && column < OLED_WIDTH && page >= 0 && page < OLED_PAGES){
+        OLED.buffer[page * OLED_WIDTH + column] |= glyphByte << shift;
+        if(shift && page + 1 < OLED_PAGES)
+            OLED.buffer[(page + 1) * OLED_WIDTH + column] |= glyphByte >> (8 - shift);
+    }
+}
+
+// move the position of a text according to the text alignment
+// in the same way as the OLED library
+void DSTIKE_Watch::alignText(int16_t &x, int16_t &y, uint16_t textWidth, uint8_t textHeight, uint16_t nLines){
+    switch(currentAlignment){
+        case TEXT_ALIGN_CENTER_BOTH:
+            y -= (textHeight >> 1) + ((nLines - 1) * textHeight) / 2;
+            // Fallthrough
+        case TEXT_ALIGN_CENTER:
+            x -= textWidth >> 1;
+            break;
+        case TEXT_ALIGN_RIGHT:
+            x -= textWidth;
+            break;
+        case TEXT_ALIGN_LEFT:
+            break;
+    }
+}
+
+// the digits are drawn in white, like the other texts
+ScreenArea DSTIKE_Watch::drawDigits(int16_t x, int16_t y, StrokeDigits &digits, const char *text){
+    if(!screenState){
+        ScreenArea none = {x, y, 0, 0};
+        return none;
+    }
+    ScreenArea area = getDigitsArea(x, y, digits, text);
+    digits.draw(OLED.buffer, area.x, area.y, text);
+    invalidate(area.x, area.y, area.width, area.height);
+    return area;
+}
+
+ScreenArea DSTIKE_Watch::getDigitsArea(int16_t x, int16_t y, StrokeDigits &digits, const char *text){
+    uint16_t textWidth = digits.getStringWidth(text);
+    alignText(x, y, textWidth, digits.height, 1);
+    ScreenArea area = {x, y, (int16_t)textWidth, (int16_t)digits.height};
+    return area;
+}
+
+// Byte spreading for drawScaled(): every bit of a nibble (4 pixel
+// rows) is repeated 2 or 3 times. A glyph byte becomes 2 or 3 bytes
+// (pages) with two table reads.
+static const uint8_t spread2[16] = {
+    0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+    0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF
+};
+static const uint16_t spread3[16] = {
+    0x000, 0x007, 0x038, 0x03F, 0x1C0, 0x1C7, 0x1F8, 0x1FF,
+    0xE00, 0xE07, 0xE38, 0xE3F, 0xFC0, 0xFC7, 0xFF8, 0xFFF
+};
+
+// the scaled glyph byte: page 0 in bits 0-7, page 1 in bits 8-15, ...
+static inline uint32_t spreadByte(uint8_t glyphByte, uint8_t scale){
+    if(scale == 2)
+        return spread2[glyphByte & 15] | (spread2[glyphByte >> 4] << 8);
+    if(scale == 3)
+        return spread3[glyphByte & 15] | ((uint32_t)spread3[glyphByte >> 4] << 12);
+    return glyphByte;
+}
+
+// drawn in white, glyph by glyph out of the jump table of the font
+// (or out of the glyph cache for a compressed font)
+ScreenArea DSTIKE_Watch::drawScaled(int16_t x, int16_t y, uint8_t scale, const char *text){
+    if(!screenState){
+        ScreenArea none = {x, y, 0, 0};
+        return none;
+    }
+    ScreenArea area = getScaledArea(x, y, scale, text);
+    uint8_t rasterHeight = 1 + ((pgm_read_byte(currentFont + HEIGHT_POS) - 1) >> 3);
+    if(scale >= 1 && scale <= 3){
+        const CompressedFont *compressed = findCompressedFont(currentFont);
+        uint8_t firstChar = pgm_read_byte(currentFont + FIRST_CHAR_POS);
+        uint8_t nChars = pgm_read_byte(currentFont + CHAR_NUM_POS);
+        const uint8_t *fontData = currentFont + JUMPTABLE_START + nChars * JUMPTABLE_BYTES;
+        int16_t firstPage = area.y >> 3;
+        uint8_t shift = area.y & 7;
+        int16_t glyphX = area.x;
+        for(const char *c = text; *c; c++){
+            uint8_t index = (uint8_t)*c - firstChar;
+            if(index >= nChars)
+                continue;
+            const uint8_t *jump = currentFont + JUMPTABLE_START + index * JUMPTABLE_BYTES;
+            uint16_t offset = (pgm_read_byte(jump) << 8) | pgm_read_byte(jump + JUMPTABLE_LSB);
+            uint8_t byteSize = pgm_read_byte(jump + JUMPTABLE_SIZE);
+            const uint8_t *glyph = NULL;
+            if(compressed && byteSize)
+                glyph = glyphCache.get(compressed, index, byteSize);
+            else if(offset == 0xFFFF)
+                byteSize = 0;
+            int16_t column = glyphX;
+            int16_t page = firstPage;
+            for(uint8_t k = 0; k < byteSize; k++){
+                uint8_t glyphByte = glyph ? glyph[k] : pgm_read_byte(fontData + offset + k);
+                if(glyphByte){
+                    uint32_t spread = spreadByte(glyphByte, scale);
+                    for(uint8_t j = 0; j < scale; j++, spread >>= 8){
+                        for(uint8_t r = 0; r < scale; r++)
+                            drawGlyphByte(column + r, page + j, shift, (uint8_t)spread);
+                    }
+                }
+                page += scale;
+                if(page == firstPage + rasterHeight * scale){
+                    page = firstPage;
+                    column += scale;
+                }
+            }
+            glyphX += pgm_read_byte(jump + JUMPTABLE_WIDTH) * scale;
+        }
+    }
+    invalidate(area.x, area.y, area.width, rasterHeight * 8 * scale);
+    return area;
+}
+
+ScreenArea DSTIKE_Watch::getScaledArea(int16_t x, int16_t y, uint8_t scale, const char *text){
+    uint16_t textWidth = getTextArea(x, y, text).width * scale;
+    uint8_t textHeight = pgm_read_byte(currentFont + HEIGHT_POS) * scale;
+    alignText(x, y, textWidth, textHeight, 1);
+    ScreenArea area = {x, y, (int16_t)textWidth, (int16_t)textHeight};
+    return area;
+}
+
+void DSTIKE_Watch::fillRect(int16_t x, int16_t y, int16_t width, int16_t height){
+    if(!screenState)
+        return;
+    OLED.fillRect(x, y, width, height);
+    invalidate(x, y, width, height);
+}
+
+// the progress bar is drawn with the outline (width+1) x (height+1)
+// progress goes from 0 to 100
+void DSTIKE_Watch::drawProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t progress){
+    if(!screenState)
+        return;
+    OLED.drawProgressBar(x, y, width, height, progress);
+    invalidate(x, y, width + 1, height + 1);
+}
+
+// same drawing as OLED.drawProgressBar() for a growing bar:
+// the filled part (between the rounded ends) is extended by a rectangle,
+// the rounded end is drawn at the new position
+// the bar is filled in white, the color of the display is kept
+void DSTIKE_Watch::fillProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t fromProgress, uint8_t progress){
+    if(!screenState || progress <= fromProgress)
+        return;
+    uint16_t radius = height / 2;
+    uint16_t innerRadius = radius - 2;
+    uint16_t xRadius = x + radius;
+    uint16_t fromWidth = (width - 2 * radius + 1) * fromProgress / 100;
+    uint16_t toWidth = (width - 2 * radius + 1) * progress / 100;
+    if(toWidth == fromWidth)
+        return;
+    OLEDDISPLAY_COLOR color = OLED.getColor();
+    OLED.setColor(WHITE);
+    OLED.fillRect(xRadius + 1 + fromWidth, y + 2, toWidth - fromWidth, height - 3);
+    OLED.fillCircle(xRadius + toWidth, y + radius, innerRadius);
+    OLED.setColor(color);
+    // from the end of the old fill to the right side of the new end
+    invalidate(xRadius + 1 + fromWidth, y + 2, toWidth - fromWidth + innerRadius - 1, height - 3);
 }
 
 // simple method to print text line by line
-// if last line is reached, the screen is cleared automatically
+// the line is only drawn into the frame buffer and is sent with the
+// following lines: once per loop (see flushAsync()) or by updateDisplay()
+// if last line is reached, the screen scrolls up by one line
 // Note:
 // Works with this font: Watch.setFont(DejaVu_Sans_Mono_12);
 // or other fonts with a line height of 12px
-void DSTIKE_Watch::println(String text){
+void DSTIKE_Watch::println(const char *text){
+    if(!screenState)
+        return;
     if(print_line >= OLED_nLines){
-        OLED.clear();
-        print_line = 0; 
+        scrollUp(OLED_Line_2 - OLED_Line_1);
+        print_line = OLED_nLines - 1;
     }
-    OLED.drawString(0, OLED_lines[print_line], text);
-    OLED.display();
+    DSTIKE_Watch::drawString(0, OLED_lines[print_line], text);
+    flushAsync();
     print_line++;
 }
 
+// move the whole screen up by a number of pixel rows
+// the 8 bytes of a column are shifted together as one 64 bit value
+// (bit 0 of page 0 is the top row), the new rows at the bottom are empty
+// only the bytes that have changed are marked: the empty columns right
+// of the text lines are not sent again
+void DSTIKE_Watch::scrollUp(uint8_t rows){
+    for(uint8_t x = 0; x < OLED_WIDTH; x++){
+        uint64_t column = 0;
+        for(uint8_t page = 0; page < OLED_PAGES; page++)
+            column |= (uint64_t)OLED.buffer[page * OLED_WIDTH + x] << (8 * page);
+        uint64_t scrolled = column >> rows;
+        if(scrolled == column)
+            continue;
+        for(uint8_t page = 0; page < OLED_PAGES; page++){
+            uint8_t value = (uint8_t)(scrolled >> (8 * page));
+            if(OLED.buffer[page * OLED_WIDTH + x] == value)
+                continue;
+            OLED.buffer[page * OLED_WIDTH + x] = value;
+            invalidate(x, page << 3, 1, 8);
+        }
+    }
+}
+
 // to change fonts
 // see font.h for available fonts
 void DSTIKE_Watch::setFont(const uint8_t *fontData){
     OLED.setFont(fontData);
+    currentFont = fontData;
+}
+
+// decode the digits, ':' and ' ' of a font once into RAM
+// returns false if all cache slots are used or the memory is too small
+bool DSTIKE_Watch::cacheFont(const uint8_t *fontData){
+    if(findSpriteFont(fontData))
+        return true;
+    SpriteFont *sprites = findSpriteFont(NULL);
+    if(!sprites)
+        return false;
+    return sprites->begin(fontData, findCompressedFont(fontData));
+}
+
+void DSTIKE_Watch::clearFontCache(){
+    for(uint8_t i = 0; i < SPRITE_FONTS; i++)
+        spriteFonts[i].end();
+}
+
+// returns false if all slots are used
+bool DSTIKE_Watch::indexFont(const IndexedFont *indexed){
+    for(uint8_t i = 0; i < INDEXED_FONTS; i++){
+        if(indexedFonts[i] == indexed)
+            return true;
+    }
+    for(uint8_t i = 0; i < INDEXED_FONTS; i++){
+        if(!indexedFonts[i]){
+            indexedFonts[i] = indexed;
+            return true;
+        }
+    }
+    return false;
+}
+
+void DSTIKE_Watch::clearFontIndex(){
+    for(uint8_t i = 0; i < INDEXED_FONTS; i++)
+        indexedFonts[i] = NULL;
+}
+
+// returns false if all slots are used
+bool DSTIKE_Watch::addCompressedFont(const CompressedFont *compressed){
+    if(findCompressedFont(compressed->font))
+        return true;
+    for(uint8_t i = 0; i < COMPRESSED_FONTS; i++){
+        if(!compressedFonts[i]){
+            compressedFonts[i] = compressed;
+            return true;
+        }
+    }
+    return false;
+}
+
+void DSTIKE_Watch::clearCompressedFonts(){
+    for(uint8_t i = 0; i < COMPRESSED_FONTS; i++)
+        compressedFonts[i] = NULL;
+    glyphCache.clear();
+}
+
+// returns the cache of a font or NULL
+// findSpriteFont(NULL) returns an unused cache slot
+SpriteFont *DSTIKE_Watch::findSpriteFont(const uint8_t *fontData){
+    for(uint8_t i = 0; i < SPRITE_FONTS; i++){
+        if(spriteFonts[i].font == fontData)
+            return &spriteFonts[i];
+    }
+    return NULL;
 }
 
 // possible values for Text Alignment:
@@ -194,23 +1121,39 @@ void DSTIKE_Watch::setFont(const uint8_t *fontData){
 // TEXT_ALIGN_CENTER_BOTH
 void DSTIKE_Watch::setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT textAlignment){
     OLED.setTextAlignment(textAlignment);
+    currentAlignment = textAlignment;
 }
 
 // to switch the screen ON or OFF
+// the panel keeps its memory while it is off:
+// only the changes of the catch-up render are sent
 void DSTIKE_Watch::screenOn(){
-    OLED.displayOn();
     DSTIKE_Watch::screenState = true;
+    if(catchUpRender)
+        catchUpRender();
+    updateDisplay();
+    OLED.displayOn();
 }
 void DSTIKE_Watch::screenOff(){
     OLED.displayOff();
     DSTIKE_Watch::screenState = false;
 }
 
+// function that draws the current state after the screen was off
+// (e.g. the clock face)
+void DSTIKE_Watch::setCatchUpRender(void (*render)()){
+    catchUpRender = render;
+}
+
 // clear teh screen and reset the line pointer for println()
+// the empty screen is shown with the next updateDisplay()
+// while the screen is off, only the line pointer is reset
 void DSTIKE_Watch::clearScreen(){
-    OLED.clear();
-    OLED.display();
     print_line = 0;
+    if(!screenState)
+        return;
+    OLED.clear();
+    invalidateAll();
 }
 
 // Values goes from 0 to 255
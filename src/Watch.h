@@ -20,6 +20,11 @@
 #include <Wire.h>
 // Arduino Button Library
 #include "Button.h"
+#include "ButtonBank.h"
+// press, click, double click, long press, chord
+#include "Gestures.h"
+// procedural clock digits
+#include "StrokeDigits.h"
 
 /****** Neopixel ******/
 // library to control the WS2812B Neopixel LED
@@ -44,12 +49,16 @@
 // With version 4.2.0 the screen is not working
 //
 // include Custom fonts Created by http://oleddisplay.squix.ch/
-#include "font.h"
+// (see "Fonts" below)
 
 // Navigation Button on the side
 #define NAV_BUTTON_UP_PIN 12
 #define NAV_BUTTON_DOWN_PIN 13
 #define NAV_BUTTON_PUSH_PIN 14
+// the buttons in the gestures (one bit per button)
+#define NAV_UP   0x01
+#define NAV_DOWN 0x02
+#define NAV_PUSH 0x04
 
 /****** OLED display ******/
 // Display type: SH1106 1.3" OLED display
@@ -62,6 +71,14 @@
 #define OLED_CENTER_W   64
 #define OLED_HEIGHT     64
 #define OLED_CENTER_H   32
+// the display memory is organized in pages of 8 pixel rows
+// every byte in the buffer is one column of a page
+#define OLED_PAGES      8
+// the SH1106 has 132 columns, the visible area starts at column 2
+#define OLED_COLUMN_OFFSET 2
+// number of data bytes per I2C transmission
+// (same as in the SH1106Wire library)
+#define OLED_I2C_CHUNK  16
 
 // usefull values to display strings at the right positions
 #define OLED_nLines 5
@@ -107,17 +124,167 @@ class RGB_LED{
 };
 
 
+/****** Screen area ******/
+// rectangle on the screen in pixel
+struct ScreenArea{
+    int16_t x;
+    int16_t y;
+    int16_t width;
+    int16_t height;
+};
+
+
+/****** Compressed font ******/
+// Font out of font.h with bit-packed glyph data, generated by
+// tools/font_compress.py into font_compressed.h.
+// The squix array (font) has the jump table with the width and the
+// size of every glyph, but no glyph data. The glyph data starts at
+// data + offsets[character - firstChar]: one bit per glyph byte
+// (1 = not empty), followed by the bytes that are not empty.
+struct CompressedFont{
+    const uint8_t *font;     // squix array without glyph data
+    const uint16_t *offsets; // one entry per character
+    const uint8_t *data;     // compressed glyph data
+};
+
+
+/****** Glyph cache ******/
+// Decompressed glyphs of the compressed fonts in RAM.
+// If all slots are used, the glyph that was not used for the
+// longest time is replaced (least recently used).
+#define GLYPH_CACHE_SIZE 12
+// the size of a glyph in the jump table is one byte
+#define GLYPH_MAX_BYTES 255
+struct CachedGlyph{
+    const CompressedFont *font; // NULL: slot is unused
+    uint8_t index;              // character - firstChar
+    uint32_t lastUse;
+    uint8_t data[GLYPH_MAX_BYTES];
+};
+class GlyphCache{
+    public:
+        GlyphCache();
+        // returns the glyph data in the squix format (column by column)
+        const uint8_t *get(const CompressedFont *font, uint8_t index, uint8_t byteSize);
+        void clear();
+        static void decompress(const CompressedFont *font, uint8_t index, uint8_t byteSize, uint8_t *glyph);
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+    private:
+        CachedGlyph slots[GLYPH_CACHE_SIZE];
+        uint32_t useCounter;
+};
+
+
+/****** Sprite font ******/
+// Pre-rasterized glyphs of the clock face characters (0-9, ':' and ' ')
+// The glyphs are decoded once from the font data into RAM.
+// Every glyph is stored page by page, one byte per column, in the
+// same format as the display buffer. Drawing is a simple copy with
+// a bit shift if y is not a multiple of 8.
+#define SPRITE_CHARS 12
+class SpriteFont{
+    public:
+        SpriteFont();
+        // the glyph data of a compressed font is read from compressed
+        bool begin(const uint8_t *fontData, const CompressedFont *compressed = NULL);
+        void end();
+        bool canDraw(const char *text);
+        uint16_t getStringWidth(const char *text);
+        void draw(uint8_t *buffer, int16_t x, int16_t y, const char *text);
+        const uint8_t *font;
+        uint8_t height;
+        // raster height in pages
+        uint8_t pages;
+    private:
+        static int8_t charIndex(char c);
+        void drawGlyph(uint8_t *buffer, int16_t x, int16_t y, uint8_t index);
+        uint8_t width[SPRITE_CHARS];
+        uint16_t offset[SPRITE_CHARS];
+        uint8_t *data;
+};
+
+
+/****** Text layout ******/
+// Measured text with the position of every glyph in the font data.
+// The layout is cached, so a text that is drawn again doesn't need
+// the jump table of the font, neither for the width nor for drawing.
+// number of cached layouts, a new text replaces the least recently
+// used one
+#define LAYOUT_CACHE_SIZE 8
+// longer texts are not cached
+#define LAYOUT_MAX_GLYPHS 24
+struct GlyphLayout{
+    uint16_t dataOffset; // position of the glyph data in the font
+    uint16_t x;          // position of the glyph in the text
+    uint8_t byteSize;    // 0: glyph is not drawable (e.g. space)
+};
+struct TextLayout{
+    const uint8_t *font;
+    uint32_t hash;
+    // layout use counter at the last use, 0 = never used
+    uint32_t lastUse;
+    uint16_t width;
+    uint8_t nGlyphs;
+    char text[LAYOUT_MAX_GLYPHS+1];
+    GlyphLayout glyphs[LAYOUT_MAX_GLYPHS];
+};
+
+
+/****** Indexed font ******/
+// Alternative format of a font out of font.h, generated by
+// tools/font_index.py into font_indexed.h.
+// Every character has one 32 bit entry with the position of the glyph
+// data (in 32 bit words), the number of data bytes and the width, so a
+// glyph is found with one aligned read. The glyph data of a character
+// starts at a 32 bit word and is read 4 bytes at once.
+#define INDEXED_GLYPH_OFFSET(entry) ((entry) & 0xFFFF)
+#define INDEXED_GLYPH_SIZE(entry) (((entry) >> 16) & 0xFF)
+#define INDEXED_GLYPH_WIDTH(entry) ((entry) >> 24)
+struct IndexedFont{
+    const uint8_t *font;    // same font in the squix format
+    const uint32_t *glyphs; // one entry per character
+    const uint32_t *data;   // glyph data
+    uint8_t firstChar;
+    uint8_t numChars;
+    uint8_t height;
+};
+
+
+/****** Fonts ******/
+// with FONT_SUBSET only the used characters (see tools/font_subset.py)
+// with FONT_COMPRESSED the large fonts are compressed (see tools/font_compress.py)
+#if defined(FONT_COMPRESSED)
+#include "font_compressed.h"
+#elif defined(FONT_SUBSET)
+#include "font_subset.h"
+#else
+#include "font.h"
+#endif
+#include "font_indexed.h"
+
+
 /****** DSTIKE_Watch ******/
+// number of fonts that can be cached as sprites
+#define SPRITE_FONTS 2
+// number of fonts that can be drawn with an index
+#define INDEXED_FONTS 6
+// number of compressed fonts that can be drawn
+#define COMPRESSED_FONTS 2
 class DSTIKE_Watch{
     public:
         DSTIKE_Watch();
         void begin();
         void updateButtons();
         // Buttons
-        #define DEBOUNCE_MS 10
-        Button NavBtn_UP = Button(NAV_BUTTON_UP_PIN, true, DEBOUNCE_MS);
-        Button NavBtn_DOWN = Button(NAV_BUTTON_DOWN_PIN, true, DEBOUNCE_MS);
-        Button NavBtn_PUSH = Button(NAV_BUTTON_PUSH_PIN, true, DEBOUNCE_MS);
+        Button NavBtn_UP = Button(NAV_BUTTON_UP_PIN, true);
+        Button NavBtn_DOWN = Button(NAV_BUTTON_DOWN_PIN, true);
+        Button NavBtn_PUSH = Button(NAV_BUTTON_PUSH_PIN, true);
+        // samples and debounces the three buttons together
+        ButtonBank buttons;
+        // gestures of the buttons, GestureEvent.buttons:
+        // NAV_UP, NAV_DOWN, NAV_PUSH or NAV_UP | NAV_DOWN (chord)
+        GestureRecognizer gestures;
         // LEDS
         White_LED WhiteLED = White_LED(WHITE_LED_PIN); 
         RGB_LED RGBLED = RGB_LED(PIXEL_PIN); 
@@ -125,24 +292,136 @@ class DSTIKE_Watch{
 
         SH1106Wire OLED = SH1106Wire(OLED_ADDR, OLED_SDA_PIN, OLED_SCL_PIN);
 
-        void drawString(int16_t x, int16_t y, String text);
-        void println(String text);
+        // All drawing functions mark the area they have changed.
+        // updateDisplay() transfers only the changed columns of each page.
+        // If you draw directly with Watch.OLED, call invalidate() for the
+        // area you have changed, otherwise it will not be shown.
+        // The text functions return the area of the text (like the
+        // get...Area() functions), nothing is drawn while the screen is off
+        ScreenArea drawString(int16_t x, int16_t y, const char *text);
+        ScreenArea drawString(int16_t x, int16_t y, const String &text) { return drawString(x, y, text.c_str()); }
+        ScreenArea getTextArea(int16_t x, int16_t y, const char *text);
+        ScreenArea getTextArea(int16_t x, int16_t y, const String &text) { return getTextArea(x, y, text.c_str()); }
+        // text with the procedural clock digits (see StrokeDigits.h)
+        // y is the top of the digits, the text alignment is used
+        ScreenArea drawDigits(int16_t x, int16_t y, StrokeDigits &digits, const char *text);
+        ScreenArea getDigitsArea(int16_t x, int16_t y, StrokeDigits &digits, const char *text);
+        // text in the current font, scaled by 2 or 3: every pixel of the
+        // font is drawn as scale x scale pixel (e.g. a 17 pixel font
+        // at 2x instead of a 38 pixel font), the text alignment is used
+        // only for texts with one line
+        ScreenArea drawScaled(int16_t x, int16_t y, uint8_t scale, const char *text);
+        ScreenArea getScaledArea(int16_t x, int16_t y, uint8_t scale, const char *text);
+        void fillRect(int16_t x, int16_t y, int16_t width, int16_t height);
+        void drawProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t progress);
+        // fill a progress bar, that was drawn with drawProgressBar(), from
+        // fromProgress to progress: only the new columns are drawn and sent
+        void fillProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t fromProgress, uint8_t progress);
+        // Console: println() draws the text in the next line, but
+        // doesn't send it. All lines printed in a row are sent together
+        // in the background of the main loop (see flushAsync()) or
+        // with the next updateDisplay().
+        // If the last line is used, the screen scrolls up by one line.
+        void println(const char *text);
+        void println(const String &text) { println(text.c_str()); }
         void updateDisplay();
+        // Non-blocking version of updateDisplay():
+        // flushAsync() only starts the transfer. Every call of
+        // serviceTransfer() sends one changed page to the display.
+        // serviceTransfer() is called by updateButtons(), so the
+        // transfer runs in the background of the main loop.
+        void flushAsync();
+        bool isTransferBusy();
+        void serviceTransfer();
+        void invalidate(int16_t x, int16_t y, int16_t width, int16_t height);
+        void invalidateAll();
         void setFont(const uint8_t *fontData);
+        // Rasterize the clock face characters of a font into RAM.
+        // Strings with only these characters are then drawn from
+        // the cache instead of the font data.
+        bool cacheFont(const uint8_t *fontData);
+        void clearFontCache();
+        // Draw a font with its indexed version out of font_indexed.h,
+        // e.g. indexFont(&Lato_Hairline_12_Indexed). setFont() is still
+        // called with the font out of font.h.
+        bool indexFont(const IndexedFont *indexed);
+        void clearFontIndex();
+        // Draw a font out of font_compressed.h (compiled with FONT_COMPRESSED),
+        // e.g. addCompressedFont(&Lato_Hairline_38_Compressed).
+        // The glyphs are decompressed into the glyph cache when they are
+        // used. setFont() is still called with the font (Lato_Hairline_38).
+        bool addCompressedFont(const CompressedFont *compressed);
+        void clearCompressedFonts();
+        GlyphCache glyphCache;
+        // statistics of the text layout cache
+        uint32_t layoutHits = 0;
+        uint32_t layoutMisses = 0;
+        void clearLayoutCache();
+        // Texts that are new on almost every draw (e.g. the seconds) are
+        // drawn with setLayoutCaching(false): they are measured into a
+        // layout outside of the cache and don't push out the texts that
+        // are drawn again.
+        void setLayoutCaching(bool enabled);
         // possible values for Text Alignment:
         // TEXT_ALIGN_LEFT
         // TEXT_ALIGN_RIGHT
         // TEXT_ALIGN_CENTER
         // TEXT_ALIGN_CENTER_BOTH
         void setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT textAlignment);
+        // While the screen is off, rendering is suspended: all drawing
+        // functions do nothing and nothing is sent to the display.
+        // screenOn() calls the catch-up function once to draw the
+        // current state and sends it before the panel is switched on.
         void screenOn();
         void screenOff();
+        void setCatchUpRender(void (*render)());
         void clearScreen();
         void screenBrightness(uint8_t brightness);
         bool screenState = true;
     private:
         bool isInitialized;
+        void (*catchUpRender)() = NULL;
         uint8_t print_line = 0;
+        // font and alignment are needed to calculate the text area
+        const uint8_t *currentFont = ArialMT_Plain_10;
+        OLEDDISPLAY_TEXT_ALIGNMENT currentAlignment = TEXT_ALIGN_LEFT;
+        // changed columns per page: dirtyStart <= x < dirtyEnd
+        // a page is clean if dirtyStart >= dirtyEnd
+        uint8_t dirtyStart[OLED_PAGES];
+        uint8_t dirtyEnd[OLED_PAGES];
+        // background transfer started by flushAsync()
+        bool transferPending = false;
+        uint8_t transferPage = 0;
+        SpriteFont spriteFonts[SPRITE_FONTS];
+        SpriteFont *findSpriteFont(const uint8_t *fontData);
+        TextLayout layoutCache[LAYOUT_CACHE_SIZE];
+        uint32_t layoutUses = 0;
+        bool layoutCaching = true;
+        TextLayout volatileLayout;
+        TextLayout *getLayout(const char *text);
+        void measureLayout(TextLayout *layout, const char *text);
+        // how a text is drawn: sprites, indexed, layout or none of them
+        struct TextPath{
+            SpriteFont *sprites;
+            const IndexedFont *indexed;
+            TextLayout *layout;
+        };
+        ScreenArea measureText(int16_t x, int16_t y, const char *text, TextPath &path);
+        void drawLayout(TextLayout *layout, int16_t x, int16_t y);
+        const IndexedFont *indexedFonts[INDEXED_FONTS] = {};
+        const IndexedFont *findIndexedFont(const char *text);
+        uint16_t getIndexedWidth(const IndexedFont *indexed, const char *text);
+        void drawIndexed(const IndexedFont *indexed, int16_t x, int16_t y, const char *text);
+        const CompressedFont *compressedFonts[COMPRESSED_FONTS] = {};
+        const CompressedFont *findCompressedFont(const uint8_t *fontData);
+        void drawCompressed(const CompressedFont *compressed, int16_t x, int16_t y, const char *text);
+        uint8_t *alignedGlyph(int16_t x, int16_t y, uint8_t byteSize, uint8_t rasterHeight);
+        void drawGlyphByte(int16_t column, int16_t page, uint8_t shift, uint8_t glyphByte);
+        void scrollUp(uint8_t rows);
+        void alignText(int16_t &x, int16_t &y, uint16_t textWidth, uint8_t textHeight, uint16_t nLines);
+        void clearDirty();
+        void sendPage(uint8_t page, uint8_t x_start, uint8_t x_end);
+        void sendCommand(uint8_t command);
 };
 
 extern DSTIKE_Watch Watch;
@@ -0,0 +1,215 @@
+/**************************************************************************
+ * Widget.cpp
+ *
+ * Retained drawing elements for the DSTIKE OLED Wrist-Watch
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#include "Widget.h"
+
+
+/****** Widget ******/
+Widget::Widget(Screen &screen, int16_t x, int16_t y):x(x), y(y), changed(true) {
+    area.x = x;
+    area.y = y;
+    area.width = 0;
+    area.height = 0;
+    screen.add(this);
+}
+
+bool Widget::update(DSTIKE_Watch &watch){
+    clear(watch);
+    return draw(watch);
+}
+
+// remove the old content
+void Widget::clear(DSTIKE_Watch &watch){
+    if(!changed || area.width <= 0 || area.height <= 0)
+        return;
+    watch.OLED.setColor(BLACK);
+    watch.fillRect(area.x, area.y, area.width, area.height);
+    watch.OLED.setColor(WHITE);
+    area.width = 0;
+    area.height = 0;
+}
+
+bool Widget::draw(DSTIKE_Watch &watch){
+    if(!changed)
+        return false;
+    render(watch);
+    changed = false;
+    return true;
+}
+
+void Widget::invalidate(){
+    changed = true;
+}
+
+bool Widget::isChanged(){
+    return changed;
+}
+
+
+/****** Text ******/
+TextWidget::TextWidget(Screen &screen, int16_t x, int16_t y, const uint8_t *fontData, OLEDDISPLAY_TEXT_ALIGNMENT textAlignment, bool cacheLayout)
+    :Widget(screen, x, y), font(fontData), alignment(textAlignment), cacheLayout(cacheLayout) {
+    text[0] = 0;
+}
+
+// the text is copied, longer texts are truncated
+void TextWidget::setText(const char *newText){
+    if(strncmp(text, newText, WIDGET_TEXT_LEN) == 0)
+        return;
+    strncpy(text, newText, WIDGET_TEXT_LEN);
+    text[WIDGET_TEXT_LEN] = 0;
+    changed = true;
+}
+
+const char *TextWidget::getText(){
+    return text;
+}
+
+void TextWidget::render(DSTIKE_Watch &watch){
+    watch.setFont(font);
+    watch.setTextAlignment(alignment);
+    watch.setLayoutCaching(cacheLayout);
+    area = watch.drawString(x, y, text);
+    watch.setLayoutCaching(true);
+}
+
+
+/****** Digits ******/
+DigitsWidget::DigitsWidget(Screen &screen, int16_t x, int16_t y, StrokeDigits &digits, OLEDDISPLAY_TEXT_ALIGNMENT textAlignment)
+    :TextWidget(screen, x, y, NULL, textAlignment), digits(digits) {
+
+}
+
+void DigitsWidget::render(DSTIKE_Watch &watch){
+    watch.setTextAlignment(alignment);
+    area = watch.drawDigits(x, y, digits, text);
+}
+
+
+/****** Scaled text ******/
+ScaledTextWidget::ScaledTextWidget(Screen &screen, int16_t x, int16_t y, const uint8_t *fontData, uint8_t scale, OLEDDISPLAY_TEXT_ALIGNMENT textAlignment, bool cacheLayout)
+    :TextWidget(screen, x, y, fontData, textAlignment, cacheLayout), scale(scale) {
+
+}
+
+void ScaledTextWidget::render(DSTIKE_Watch &watch){
+    watch.setFont(font);
+    watch.setTextAlignment(alignment);
+    watch.setLayoutCaching(cacheLayout);
+    area = watch.drawScaled(x, y, scale, text);
+    watch.setLayoutCaching(true);
+}
+
+
+/****** Progress bar ******/
+ProgressWidget::ProgressWidget(Screen &screen, int16_t x, int16_t y, uint16_t width, uint16_t height)
+    :Widget(screen, x, y), width(width), height(height), progress(0), shownProgress(0), redraw(true) {
+
+}
+
+void ProgressWidget::setProgress(uint8_t newProgress){
+    newProgress = min<uint8_t>(newProgress, 100);
+    if(newProgress == progress)
+        return;
+    // a shorter bar can't be drawn over the old one
+    if(newProgress < shownProgress)
+        redraw = true;
+    progress = newProgress;
+    changed = true;
+}
+
+// the bar is only cleared if it has to be drawn completely
+void ProgressWidget::clear(DSTIKE_Watch &watch){
+    if(!changed || (!redraw && area.width > 0))
+        return;
+    Widget::clear(watch);
+}
+
+void ProgressWidget::invalidate(){
+    redraw = true;
+    Widget::invalidate();
+}
+
+void ProgressWidget::render(DSTIKE_Watch &watch){
+    if(!redraw && area.width > 0)
+        watch.fillProgressBar(x, y, width, height, shownProgress, progress);
+    else
+        watch.drawProgressBar(x, y, width, height, progress);
+    shownProgress = progress;
+    redraw = false;
+    area.x = x;
+    area.y = y;
+    area.width = width + 1;
+    area.height = height + 1;
+}
+
+
+/****** Screen ******/
+Screen::Screen():nWidgets(0), cleared(true) {
+
+}
+
+bool Screen::add(Widget *widget){
+    if(nWidgets >= SCREEN_WIDGETS)
+        return false;
+    widgets[nWidgets++] = widget;
+    return true;
+}
+
+static bool overlaps(const ScreenArea &a, const ScreenArea &b){
+    return a.width > 0 && a.height > 0 && b.width > 0 && b.height > 0 &&
+           a.x < b.x + b.width && b.x < a.x + a.width &&
+           a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+void Screen::update(DSTIKE_Watch &watch){
+    // rendering is suspended while the screen is off:
+    // the new values are drawn after the screen is switched on
+    if(!watch.screenState)
+        return;
+    if(cleared){
+        // the screen was used by something else: draw everything
+        watch.clearScreen();
+        for(uint8_t i = 0; i < nWidgets; i++){
+            widgets[i]->area.width = 0;
+            widgets[i]->area.height = 0;
+            widgets[i]->invalidate();
+        }
+        cleared = false;
+    } else {
+        // clearing a changed widget also clears the parts of other
+        // widgets in the same area: draw them again
+        bool found;
+        do {
+            found = false;
+            for(uint8_t i = 0; i < nWidgets; i++){
+                if(!widgets[i]->isChanged())
+                    continue;
+                for(uint8_t j = 0; j < nWidgets; j++){
+                    if(!widgets[j]->isChanged() && overlaps(widgets[i]->area, widgets[j]->area)){
+                        widgets[j]->invalidate();
+                        found = true;
+                    }
+                }
+            }
+        } while(found);
+    }
+    // first clear all changed widgets, then draw them
+    // otherwise a cleared area could remove a widget that is already drawn
+    for(uint8_t i = 0; i < nWidgets; i++)
+        widgets[i]->clear(watch);
+    for(uint8_t i = 0; i < nWidgets; i++)
+        widgets[i]->draw(watch);
+}
+
+void Screen::invalidate(){
+    cleared = true;
+}
@@ -0,0 +1,145 @@
+/**************************************************************************
+ * Widget.h
+ *
+ * Retained drawing elements for the DSTIKE OLED Wrist-Watch
+ *
+ * Every widget holds a value (text, progress). Setting the same
+ * value again does nothing. Only widgets with a new value are drawn
+ * again, and only their area is transferred to the display.
+ *
+ * https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+ *
+ *
+ * Distributed as-is; no warranty is given.
+**************************************************************************/
+
+#ifndef Widget_h
+#define Widget_h
+
+#include <Arduino.h>
+#include "Watch.h"
+
+// maximum text length of a TextWidget (without the terminating 0):
+// the longest date with " ?" (DATE_STRING_SIZE + 1)
+#define WIDGET_TEXT_LEN 25
+// maximum number of widgets on one screen
+#define SCREEN_WIDGETS 8
+// TextWidget: a volatile text is new on almost every change (e.g. the
+// seconds), its layout is not cached (see Watch.setLayoutCaching())
+#define TEXT_STATIC   true
+#define TEXT_VOLATILE false
+
+
+class Screen;
+
+/****** Widget ******/
+// base class of all widgets
+// every widget is placed on a screen when it is created
+class Widget{
+    public:
+        Widget(Screen &screen, int16_t x, int16_t y);
+        virtual ~Widget() {}
+        // clear the old content and draw the widget if the value has changed
+        // returns true if the widget was drawn
+        bool update(DSTIKE_Watch &watch);
+        // the two steps of update(), both do nothing if nothing has changed
+        virtual void clear(DSTIKE_Watch &watch);
+        bool draw(DSTIKE_Watch &watch);
+        // draw the widget with the next update(), even without a new value
+        virtual void invalidate();
+        bool isChanged();
+        // area covered by the widget on the screen (empty if not drawn)
+        ScreenArea area;
+    protected:
+        // draw the widget and set the area
+        virtual void render(DSTIKE_Watch &watch) = 0;
+        int16_t x;
+        int16_t y;
+        bool changed;
+};
+
+
+/****** Text ******/
+class TextWidget : public Widget{
+    public:
+        TextWidget(Screen &screen, int16_t x, int16_t y, const uint8_t *fontData, OLEDDISPLAY_TEXT_ALIGNMENT textAlignment, bool cacheLayout = TEXT_STATIC);
+        void setText(const char *newText);
+        const char *getText();
+    protected:
+        void render(DSTIKE_Watch &watch);
+        const uint8_t *font;
+        OLEDDISPLAY_TEXT_ALIGNMENT alignment;
+        bool cacheLayout;
+        char text[WIDGET_TEXT_LEN+1];
+};
+
+
+/****** Digits ******/
+// text with the procedural clock digits instead of a font
+// (digits, ':' and ' ', see StrokeDigits.h), y is the top of the digits
+class DigitsWidget : public TextWidget{
+    public:
+        DigitsWidget(Screen &screen, int16_t x, int16_t y, StrokeDigits &digits, OLEDDISPLAY_TEXT_ALIGNMENT textAlignment);
+    protected:
+        void render(DSTIKE_Watch &watch);
+    private:
+        StrokeDigits &digits;
+};
+
+
+/****** Scaled text ******/
+// text in a font of font.h, drawn 2 or 3 times larger
+// (see DSTIKE_Watch::drawScaled())
+class ScaledTextWidget : public TextWidget{
+    public:
+        ScaledTextWidget(Screen &screen, int16_t x, int16_t y, const uint8_t *fontData, uint8_t scale, OLEDDISPLAY_TEXT_ALIGNMENT textAlignment, bool cacheLayout = TEXT_STATIC);
+    protected:
+        void render(DSTIKE_Watch &watch);
+    private:
+        uint8_t scale;
+};
+
+
+/****** Progress bar ******/
+// a growing bar is not cleared: only the new part is filled and sent
+// For the least transfer, place the bar so that the filled part
+// (y+2 to y+height-2) is inside one page (8 pixel rows).
+class ProgressWidget : public Widget{
+    public:
+        ProgressWidget(Screen &screen, int16_t x, int16_t y, uint16_t width, uint16_t height);
+        // progress goes from 0 to 100
+        void setProgress(uint8_t newProgress);
+        void clear(DSTIKE_Watch &watch);
+        void invalidate();
+    protected:
+        void render(DSTIKE_Watch &watch);
+    private:
+        uint16_t width;
+        uint16_t height;
+        uint8_t progress;
+        // progress on the screen
+        uint8_t shownProgress;
+        // the whole bar has to be drawn again
+        bool redraw;
+};
+
+
+/****** Screen ******/
+// a set of widgets that are shown together
+class Screen{
+    public:
+        Screen();
+        bool add(Widget *widget);
+        // draw all widgets with a new value
+        // widgets that are overlapped by a changed widget are drawn too
+        void update(DSTIKE_Watch &watch);
+        // clear the screen and draw all widgets with the next update()
+        // (e.g. after another screen was shown)
+        void invalidate();
+    private:
+        Widget *widgets[SCREEN_WIDGETS];
+        uint8_t nWidgets;
+        bool cleared;
+};
+
+#endif
@@ -0,0 +1,3441 @@
+/**************************************************************************
+ * font_compressed.h
+ *
+ * GENERATED by tools/font_compress.py out of font.h - do not edit!
+ * Same fonts as font.h, some of them compressed.
+ * Size in bytes:
+ * font                   font.h compressed  saved
+ * Lato_Hairline_38        23899      11674    51%
+ * all fonts               49597      37372    25%
+**************************************************************************/
+
+#include <Arduino.h>
+
+// easy to remember and easy to handle font names
+#define FONT_0_SMALL ArialMT_Plain_10
+#define FONT_0_NORMAL ArialMT_Plain_16 
+#define FONT_0_LARGE ArialMT_Plain_24 
+#define FONT_1_NORMAL DejaVu_Sans_Mono_12
+#define FONT_1_LARGE DejaVu_Sans_Mono_16
+#define FONT_2_SMALL Lato_Hairline_12
+#define FONT_2_NORMAL Lato_Hairline_17
+#define FONT_2_LARGE Lato_Hairline_18
+#define FONT_2_XLARGE Lato_Hairline_38
+
+// DejaVu_Sans_Mono_12 --> Height = 15 --> lineHeight = 12
+// DejaVu_Sans_Mono_16 --> Height = 19
+// Lato_Hairline_12 --> Height = 15
+// Lato_Hairline_16 --> Height = 20
+// Lato_Hairline_18 --> Height = 22
+// Lato_Hairline_38 --> Height = 47
+
+// Created by http://oleddisplay.squix.ch/ Consider a donation
+// In case of problems make sure that you are using the font file with the correct version!
+const uint8_t DejaVu_Sans_Mono_12[] PROGMEM = {
+	0x07, // Width: 7
+	0x0F, // Height: 15
+	0x20, // First Char: 32
+	0xE0, // Numbers of Chars: 224
+
+	// Jump Table:
+	0xFF, 0xFF, 0x00, 0x07,  // 32:65535
+	0x00, 0x00, 0x08, 0x07,  // 33:0
+	0x00, 0x08, 0x09, 0x07,  // 34:8
+	0x00, 0x11, 0x0D, 0x07,  // 35:17
+	0x00, 0x1E, 0x0C, 0x07,  // 36:30
+	0x00, 0x2A, 0x0E, 0x07,  // 37:42
+	0x00, 0x38, 0x0E, 0x07,  // 38:56
+	0x00, 0x46, 0x07, 0x07,  // 39:70
+	0x00, 0x4D, 0x0C, 0x07,  // 40:77
+	0x00, 0x59, 0x0A, 0x07,  // 41:89
+	0x00, 0x63, 0x0B, 0x07,  // 42:99
+	0x00, 0x6E, 0x0E, 0x07,  // 43:110
+	0x00, 0x7C, 0x08, 0x07,  // 44:124
+	0x00, 0x84, 0x0A, 0x07,  // 45:132
+	0x00, 0x8E, 0x08, 0x07,  // 46:142
+	0x00, 0x96, 0x0D, 0x07,  // 47:150
+	0x00, 0xA3, 0x0E, 0x07,  // 48:163
+	0x00, 0xB1, 0x0C, 0x07,  // 49:177
+	0x00, 0xBD, 0x0E, 0x07,  // 50:189
+	0x00, 0xCB, 0x0E, 0x07,  // 51:203
+	0x00, 0xD9, 0x0E, 0x07,  // 52:217
+	0x00, 0xE7, 0x0E, 0x07,  // 53:231
+	0x00, 0xF5, 0x0E, 0x07,  // 54:245
+	0x01, 0x03, 0x0D, 0x07,  // 55:259
+	0x01, 0x10, 0x0E, 0x07,  // 56:272
+	0x01, 0x1E, 0x0E, 0x07,  // 57:286
+	0x01, 0x2C, 0x08, 0x07,  // 58:300
+	0x01, 0x34, 0x08, 0x07,  // 59:308
+	0x01, 0x3C, 0x0E, 0x07,  // 60:316
+	0x01, 0x4A, 0x0E, 0x07,  // 61:330
+	0x01, 0x58, 0x0E, 0x07,  // 62:344
+	0x01, 0x66, 0x0D, 0x07,  // 63:358
+	0x01, 0x73, 0x0E, 0x07,  // 64:371
+	0x01, 0x81, 0x0E, 0x07,  // 65:385
+	0x01, 0x8F, 0x0E, 0x07,  // 66:399
+	0x01, 0x9D, 0x0E, 0x07,  // 67:413
+	0x01, 0xAB, 0x0E, 0x07,  // 68:427
+	0x01, 0xB9, 0x0E, 0x07,  // 69:441
+	0x01, 0xC7, 0x0D, 0x07,  // 70:455
+	0x01, 0xD4, 0x0E, 0x07,  // 71:468
+	0x01, 0xE2, 0x0E, 0x07,  // 72:482
+	0x01, 0xF0, 0x0C, 0x07,  // 73:496
+	0x01, 0xFC, 0x0C, 0x07,  // 74:508
+	0x02, 0x08, 0x0E, 0x07,  // 75:520
+	0x02, 0x16, 0x0E, 0x07,  // 76:534
+	0x02, 0x24, 0x0E, 0x07,  // 77:548
+	0x02, 0x32, 0x0E, 0x07,  // 78:562
+	0x02, 0x40, 0x0E, 0x07,  // 79:576
+	0x02, 0x4E, 0x0D, 0x07,  // 80:590
+	0x02, 0x5B, 0x0E, 0x07,  // 81:603
+	0x02, 0x69, 0x0E, 0x07,  // 82:617
+	0x02, 0x77, 0x0E, 0x07,  // 83:631
+	0x02, 0x85, 0x0D, 0x07,  // 84:645
+	0x02, 0x92, 0x0E, 0x07,  // 85:658
+	0x02, 0xA0, 0x0D, 0x07,  // 86:672
+	0x02, 0xAD, 0x0E, 0x07,  // 87:685
+	0x02, 0xBB, 0x0E, 0x07,  // 88:699
+	0x02, 0xC9, 0x0D, 0x07,  // 89:713
+	0x02, 0xD6, 0x0E, 0x07,  // 90:726
+	0x02, 0xE4, 0x0A, 0x07,  // 91:740
+	0x02, 0xEE, 0x0E, 0x07,  // 92:750
+	0x02, 0xFC, 0x08, 0x07,  // 93:764
+	0x03, 0x04, 0x0B, 0x07,  // 94:772
+	0x03, 0x0F, 0x0E, 0x07,  // 95:783
+	0x03, 0x1D, 0x09, 0x07,  // 96:797
+	0x03, 0x26, 0x0C, 0x07,  // 97:806
+	0x03, 0x32, 0x0C, 0x07,  // 98:818
+	0x03, 0x3E, 0x0C, 0x07,  // 99:830
+	0x03, 0x4A, 0x0C, 0x07,  // 100:842
+	0x03, 0x56, 0x0C, 0x07,  // 101:854
+	0x03, 0x62, 0x0B, 0x07,  // 102:866
+	0x03, 0x6D, 0x0C, 0x07,  // 103:877
+	0x03, 0x79, 0x0C, 0x07,  // 104:889
+	0x03, 0x85, 0x0C, 0x07,  // 105:901
+	0x03, 0x91, 0x0A, 0x07,  // 106:913
+	0x03, 0x9B, 0x0C, 0x07,  // 107:923
+	0x03, 0xA7, 0x0C, 0x07,  // 108:935
+	0x03, 0xB3, 0x0C, 0x07,  // 109:947
+	0x03, 0xBF, 0x0C, 0x07,  // 110:959
+	0x03, 0xCB, 0x0C, 0x07,  // 111:971
+	0x03, 0xD7, 0x0C, 0x07,  // 112:983
+	0x03, 0xE3, 0x0C, 0x07,  // 113:995
+	0x03, 0xEF, 0x0D, 0x07,  // 114:1007
+	0x03, 0xFC, 0x0C, 0x07,  // 115:1020
+	0x04, 0x08, 0x0C, 0x07,  // 116:1032
+	0x04, 0x14, 0x0C, 0x07,  // 117:1044
+	0x04, 0x20, 0x0B, 0x07,  // 118:1056
+	0x04, 0x2B, 0x0D, 0x07,  // 119:1067
+	0x04, 0x38, 0x0C, 0x07,  // 120:1080
+	0x04, 0x44, 0x0B, 0x07,  // 121:1092
+	0x04, 0x4F, 0x0C, 0x07,  // 122:1103
+	0x04, 0x5B, 0x0C, 0x07,  // 123:1115
+	0x04, 0x67, 0x08, 0x07,  // 124:1127
+	0x04, 0x6F, 0x0B, 0x07,  // 125:1135
+	0x04, 0x7A, 0x0E, 0x07,  // 126:1146
+	0x04, 0x88, 0x0E, 0x07,  // 127:1160
+	0x04, 0x96, 0x0E, 0x07,  // 128:1174
+	0x04, 0xA4, 0x0E, 0x07,  // 129:1188
+	0x04, 0xB2, 0x0E, 0x07,  // 130:1202
+	0x04, 0xC0, 0x0E, 0x07,  // 131:1216
+	0x04, 0xCE, 0x0E, 0x07,  // 132:1230
+	0x04, 0xDC, 0x0E, 0x07,  // 133:1244
+	0x04, 0xEA, 0x0E, 0x07,  // 134:1258
+	0x04, 0xF8, 0x0E, 0x07,  // 135:1272
+	0x05, 0x06, 0x0E, 0x07,  // 136:1286
+	0x05, 0x14, 0x0E, 0x07,  // 137:1300
+	0x05, 0x22, 0x0E, 0x07,  // 138:1314
+	0x05, 0x30, 0x0E, 0x07,  // 139:1328
+	0x05, 0x3E, 0x0E, 0x07,  // 140:1342
+	0x05, 0x4C, 0x0E, 0x07,  // 141:1356
+	0x05, 0x5A, 0x0E, 0x07,  // 142:1370
+	0x05, 0x68, 0x0E, 0x07,  // 143:1384
+	0x05, 0x76, 0x0E, 0x07,  // 144:1398
+	0x05, 0x84, 0x0E, 0x07,  // 145:1412
+	0x05, 0x92, 0x0E, 0x07,  // 146:1426
+	0x05, 0xA0, 0x0E, 0x07,  // 147:1440
+	0x05, 0xAE, 0x0E, 0x07,  // 148:1454
+	0x05, 0xBC, 0x0E, 0x07,  // 149:1468
+	0x05, 0xCA, 0x0E, 0x07,  // 150:1482
+	0x05, 0xD8, 0x0E, 0x07,  // 151:1496
+	0x05, 0xE6, 0x0E, 0x07,  // 152:1510
+	0x05, 0xF4, 0x0E, 0x07,  // 153:1524
+	0x06, 0x02, 0x0E, 0x07,  // 154:1538
+	0x06, 0x10, 0x0E, 0x07,  // 155:1552
+	0x06, 0x1E, 0x0E, 0x07,  // 156:1566
+	0x06, 0x2C, 0x0E, 0x07,  // 157:1580
+	0x06, 0x3A, 0x0E, 0x07,  // 158:1594
+	0x06, 0x48, 0x0E, 0x07,  // 159:1608
+	0xFF, 0xFF, 0x00, 0x07,  // 160:65535
+	0x06, 0x56, 0x08, 0x07,  // 161:1622
+	0x06, 0x5E, 0x0C, 0x07,  // 162:1630
+	0x06, 0x6A, 0x0C, 0x07,  // 163:1642
+	0x06, 0x76, 0x0E, 0x07,  // 164:1654
+	0x06, 0x84, 0x0D, 0x07,  // 165:1668
+	0x06, 0x91, 0x08, 0x07,  // 166:1681
+	0x06, 0x99, 0x0C, 0x07,  // 167:1689
+	0x06, 0xA5, 0x09, 0x07,  // 168:1701
+	0x06, 0xAE, 0x0E, 0x07,  // 169:1710
+	0x06, 0xBC, 0x0A, 0x07,  // 170:1724
+	0x06, 0xC6, 0x0E, 0x07,  // 171:1734
+	0x06, 0xD4, 0x0E, 0x07,  // 172:1748
+	0x06, 0xE2, 0x0A, 0x07,  // 173:1762
+	0x06, 0xEC, 0x0E, 0x07,  // 174:1772
+	0x06, 0xFA, 0x0B, 0x07,  // 175:1786
+	0x07, 0x05, 0x0B, 0x07,  // 176:1797
+	0x07, 0x10, 0x0E, 0x07,  // 177:1808
+	0x07, 0x1E, 0x09, 0x07,  // 178:1822
+	0x07, 0x27, 0x0B, 0x07,  // 179:1831
+	0x07, 0x32, 0x09, 0x07,  // 180:1842
+	0x07, 0x3B, 0x0E, 0x07,  // 181:1851
+	0x07, 0x49, 0x0E, 0x07,  // 182:1865
+	0x07, 0x57, 0x08, 0x07,  // 183:1879
+	0x07, 0x5F, 0x0A, 0x07,  // 184:1887
+	0x07, 0x69, 0x09, 0x07,  // 185:1897
+	0x07, 0x72, 0x0A, 0x07,  // 186:1906
+	0x07, 0x7C, 0x0E, 0x07,  // 187:1916
+	0x07, 0x8A, 0x0E, 0x07,  // 188:1930
+	0x07, 0x98, 0x0C, 0x07,  // 189:1944
+	0x07, 0xA4, 0x0E, 0x07,  // 190:1956
+	0x07, 0xB2, 0x0A, 0x07,  // 191:1970
+	0x07, 0xBC, 0x0E, 0x07,  // 192:1980
+	0x07, 0xCA, 0x0E, 0x07,  // 193:1994
+	0x07, 0xD8, 0x0E, 0x07,  // 194:2008
+	0x07, 0xE6, 0x0E, 0x07,  // 195:2022
+	0x07, 0xF4, 0x0E, 0x07,  // 196:2036
+	0x08, 0x02, 0x0E, 0x07,  // 197:2050
+	0x08, 0x10, 0x0E, 0x07,  // 198:2064
+	0x08, 0x1E, 0x0E, 0x07,  // 199:2078
+	0x08, 0x2C, 0x0E, 0x07,  // 200:2092
+	0x08, 0x3A, 0x0E, 0x07,  // 201:2106
+	0x08, 0x48, 0x0E, 0x07,  // 202:2120
+	0x08, 0x56, 0x0E, 0x07,  // 203:2134
+	0x08, 0x64, 0x0C, 0x07,  // 204:2148
+	0x08, 0x70, 0x0C, 0x07,  // 205:2160
+	0x08, 0x7C, 0x0C, 0x07,  // 206:2172
+	0x08, 0x88, 0x0C, 0x07,  // 207:2184
+	0x08, 0x94, 0x0E, 0x07,  // 208:2196
+	0x08, 0xA2, 0x0E, 0x07,  // 209:2210
+	0x08, 0xB0, 0x0E, 0x07,  // 210:2224
+	0x08, 0xBE, 0x0E, 0x07,  // 211:2238
+	0x08, 0xCC, 0x0E, 0x07,  // 212:2252
+	0x08, 0xDA, 0x0E, 0x07,  // 213:2266
+	0x08, 0xE8, 0x0E, 0x07,  // 214:2280
+	0x08, 0xF6, 0x0C, 0x07,  // 215:2294
+	0x09, 0x02, 0x0E, 0x07,  // 216:2306
+	0x09, 0x10, 0x0E, 0x07,  // 217:2320
+	0x09, 0x1E, 0x0E, 0x07,  // 218:2334
+	0x09, 0x2C, 0x0E, 0x07,  // 219:2348
+	0x09, 0x3A, 0x0E, 0x07,  // 220:2362
+	0x09, 0x48, 0x0D, 0x07,  // 221:2376
+	0x09, 0x55, 0x0D, 0x07,  // 222:2389
+	0x09, 0x62, 0x0C, 0x07,  // 223:2402
+	0x09, 0x6E, 0x0C, 0x07,  // 224:2414
+	0x09, 0x7A, 0x0C, 0x07,  // 225:2426
+	0x09, 0x86, 0x0C, 0x07,  // 226:2438
+	0x09, 0x92, 0x0C, 0x07,  // 227:2450
+	0x09, 0x9E, 0x0C, 0x07,  // 228:2462
+	0x09, 0xAA, 0x0C, 0x07,  // 229:2474
+	0x09, 0xB6, 0x0C, 0x07,  // 230:2486
+	0x09, 0xC2, 0x0C, 0x07,  // 231:2498
+	0x09, 0xCE, 0x0C, 0x07,  // 232:2510
+	0x09, 0xDA, 0x0C, 0x07,  // 233:2522
+	0x09, 0xE6, 0x0C, 0x07,  // 234:2534
+	0x09, 0xF2, 0x0C, 0x07,  // 235:2546
+	0x09, 0xFE, 0x0C, 0x07,  // 236:2558
+	0x0A, 0x0A, 0x0C, 0x07,  // 237:2570
+	0x0A, 0x16, 0x0C, 0x07,  // 238:2582
+	0x0A, 0x22, 0x0C, 0x07,  // 239:2594
+	0x0A, 0x2E, 0x0C, 0x07,  // 240:2606
+	0x0A, 0x3A, 0x0C, 0x07,  // 241:2618
+	0x0A, 0x46, 0x0C, 0x07,  // 242:2630
+	0x0A, 0x52, 0x0C, 0x07,  // 243:2642
+	0x0A, 0x5E, 0x0C, 0x07,  // 244:2654
+	0x0A, 0x6A, 0x0C, 0x07,  // 245:2666
+	0x0A, 0x76, 0x0C, 0x07,  // 246:2678
+	0x0A, 0x82, 0x0C, 0x07,  // 247:2690
+	0x0A, 0x8E, 0x0C, 0x07,  // 248:2702
+	0x0A, 0x9A, 0x0C, 0x07,  // 249:2714
+	0x0A, 0xA6, 0x0C, 0x07,  // 250:2726
+	0x0A, 0xB2, 0x0C, 0x07,  // 251:2738
+	0x0A, 0xBE, 0x0C, 0x07,  // 252:2750
+	0x0A, 0xCA, 0x0B, 0x07,  // 253:2762
+	0x0A, 0xD5, 0x0C, 0x07,  // 254:2773
+	0x0A, 0xE1, 0x0B, 0x07,  // 255:2785
+
+	// Font Data:
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x0D,	// 33
+	0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,	// 34
+	0x00,0x02,0x40,0x0E,0xE0,0x03,0x50,0x0A,0xC0,0x07,0x70,0x02,0x40,	// 35
+	0x00,0x00,0xE0,0x04,0x90,0x08,0xF8,0x3F,0x10,0x09,0x20,0x07,	// 36
+	0x30,0x00,0x48,0x01,0x48,0x01,0xB0,0x06,0x80,0x09,0x40,0x09,0x00,0x06,	// 37
+	0x00,0x00,0x00,0x07,0xF0,0x0C,0xC8,0x08,0x08,0x0B,0x08,0x06,0x00,0x0B,	// 38
+	0x00,0x00,0x00,0x00,0x00,0x00,0x38,	// 39
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0x1C,0x1C,0x04,0x10,	// 40
+	0x00,0x00,0x00,0x00,0x04,0x10,0x1C,0x1C,0xE0,0x03,	// 41
+	0x00,0x00,0x90,0x00,0x60,0x00,0xF8,0x01,0x60,0x00,0x90,	// 42
+	0x00,0x01,0x00,0x01,0x00,0x01,0xE0,0x0F,0x00,0x01,0x00,0x01,0x00,0x01,	// 43
+	0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x0C,	// 44
+	0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,	// 45
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,	// 46
+	0x00,0x00,0x00,0x10,0x00,0x0C,0x00,0x03,0xC0,0x00,0x30,0x00,0x08,	// 47
+	0x00,0x00,0xE0,0x03,0x18,0x0C,0x08,0x08,0x88,0x08,0x18,0x0C,0xE0,0x03,	// 48
+	0x00,0x00,0x08,0x08,0x08,0x08,0xF8,0x0F,0x00,0x08,0x00,0x08,	// 49
+	0x00,0x00,0x10,0x08,0x08,0x0C,0x08,0x0A,0x08,0x09,0x88,0x08,0x70,0x08,	// 50
+	0x00,0x00,0x10,0x04,0x08,0x08,0x88,0x08,0x88,0x08,0x88,0x08,0x70,0x07,	// 51
+	0x00,0x00,0x00,0x03,0xC0,0x02,0x60,0x02,0x18,0x02,0xF8,0x0F,0x00,0x02,	// 52
+	0x00,0x00,0x78,0x04,0x48,0x08,0x48,0x08,0x48,0x08,0xC8,0x0C,0x80,0x07,	// 53
+	0x00,0x00,0xE0,0x03,0x90,0x0C,0x48,0x08,0x48,0x08,0xC8,0x0C,0x90,0x07,	// 54
+	0x00,0x00,0x08,0x00,0x08,0x08,0x08,0x06,0x88,0x01,0x78,0x00,0x18,	// 55
+	0x00,0x00,0x70,0x07,0x88,0x08,0x88,0x08,0x88,0x08,0x88,0x08,0x70,0x07,	// 56
+	0x00,0x00,0xF0,0x04,0x18,0x09,0x08,0x09,0x08,0x09,0x98,0x04,0xE0,0x03,	// 57
+	0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x0C,	// 58
+	0x00,0x00,0x00,0x00,0x00,0x10,0xC0,0x0C,	// 59
+	0x00,0x00,0x80,0x01,0x80,0x01,0x40,0x02,0x40,0x02,0x40,0x02,0x20,0x04,	// 60
+	0x00,0x00,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,	// 61
+	0x00,0x00,0x20,0x04,0x40,0x02,0x40,0x02,0x40,0x02,0x80,0x01,0x80,0x01,	// 62
+	0x00,0x00,0x00,0x00,0x10,0x00,0x88,0x0D,0xC8,0x00,0x48,0x00,0x30,	// 63
+	0x00,0x00,0xC0,0x0F,0x20,0x18,0x10,0x23,0x90,0x24,0xB0,0x24,0xE0,0x07,	// 64
+	0x00,0x00,0x00,0x0C,0xC0,0x03,0x38,0x02,0x38,0x02,0xC0,0x03,0x00,0x0C,	// 65
+	0x00,0x00,0xF8,0x0F,0x88,0x08,0x88,0x08,0x88,0x08,0x88,0x08,0x70,0x07,	// 66
+	0x00,0x00,0xE0,0x03,0x10,0x04,0x08,0x08,0x08,0x08,0x08,0x08,0x10,0x04,	// 67
+	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0x10,0x04,0xE0,0x03,	// 68
+	0x00,0x00,0xF8,0x0F,0x88,0x08,0x88,0x08,0x88,0x08,0x88,0x08,0x88,0x08,	// 69
+	0x00,0x00,0xF8,0x0F,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,	// 70
+	0x00,0x00,0xE0,0x03,0x10,0x04,0x08,0x08,0x08,0x08,0x88,0x08,0x90,0x07,	// 71
+	0x00,0x00,0xF8,0x0F,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xF8,0x0F,	// 72
+	0x00,0x00,0x08,0x08,0x08,0x08,0xF8,0x0F,0x08,0x08,0x08,0x08,	// 73
+	0x00,0x00,0x00,0x04,0x00,0x08,0x08,0x08,0x08,0x08,0xF8,0x07,	// 74
+	0x00,0x00,0xF8,0x0F,0x80,0x00,0xC0,0x00,0x20,0x03,0x10,0x06,0x08,0x08,	// 75
+	0x00,0x00,0xF8,0x0F,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,	// 76
+	0x00,0x00,0xF8,0x0F,0x30,0x00,0xC0,0x01,0xC0,0x01,0x30,0x00,0xF8,0x0F,	// 77
+	0x00,0x00,0xF8,0x0F,0x18,0x00,0xE0,0x00,0x80,0x03,0x00,0x0C,0xF8,0x0F,	// 78
+	0x00,0x00,0xE0,0x03,0x18,0x0C,0x08,0x08,0x08,0x08,0x18,0x0C,0xE0,0x03,	// 79
+	0x00,0x00,0xF8,0x0F,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x70,	// 80
+	0x00,0x00,0xE0,0x03,0x18,0x0C,0x08,0x08,0x08,0x08,0x18,0x3C,0xE0,0x07,	// 81
+	0x00,0x00,0xF8,0x0F,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x01,0x70,0x06,	// 82
+	0x00,0x00,0x70,0x04,0xC8,0x08,0x88,0x08,0x88,0x08,0x88,0x08,0x10,0x07,	// 83
+	0x08,0x00,0x08,0x00,0x08,0x00,0xF8,0x0F,0x08,0x00,0x08,0x00,0x08,	// 84
+	0x00,0x00,0xF8,0x07,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0xF8,0x07,	// 85
+	0x00,0x00,0x18,0x00,0xE0,0x01,0x00,0x0E,0x00,0x0E,0xE0,0x01,0x18,	// 86
+	0xF8,0x01,0x00,0x0E,0xC0,0x03,0x30,0x00,0xC0,0x03,0x00,0x0E,0xF8,0x01,	// 87
+	0x00,0x00,0x08,0x08,0x30,0x06,0xC0,0x01,0xC0,0x01,0x30,0x06,0x08,0x08,	// 88
+	0x08,0x00,0x10,0x00,0x60,0x00,0x80,0x0F,0x60,0x00,0x10,0x00,0x08,	// 89
+	0x00,0x00,0x08,0x0C,0x08,0x0E,0x88,0x09,0xC8,0x08,0x38,0x08,0x18,0x08,	// 90
+	0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x1F,0x04,0x10,	// 91
+	0x00,0x00,0x08,0x00,0x30,0x00,0xC0,0x00,0x00,0x03,0x00,0x0C,0x00,0x10,	// 92
+	0x00,0x00,0x00,0x00,0x04,0x10,0xFC,0x1F,	// 93
+	0x20,0x00,0x10,0x00,0x08,0x00,0x08,0x00,0x10,0x00,0x20,	// 94
+	0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,	// 95
+	0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x08,	// 96
+	0x00,0x00,0x40,0x06,0x20,0x09,0x20,0x09,0x20,0x09,0xC0,0x0F,	// 97
+	0x00,0x00,0xFC,0x0F,0x20,0x08,0x20,0x08,0x20,0x08,0xC0,0x07,	// 98
+	0x00,0x00,0xC0,0x07,0x60,0x0C,0x20,0x08,0x20,0x08,0x40,0x08,	// 99
+	0x00,0x00,0xC0,0x07,0x20,0x08,0x20,0x08,0x20,0x08,0xFC,0x0F,	// 100
+	0x00,0x00,0xC0,0x07,0x60,0x09,0x20,0x09,0x20,0x09,0xC0,0x05,	// 101
+	0x00,0x00,0x20,0x00,0x20,0x00,0xF8,0x0F,0x24,0x00,0x24,	// 102
+	0x00,0x00,0xC0,0x07,0x20,0x28,0x20,0x48,0x20,0x48,0xE0,0x3F,	// 103
+	0x00,0x00,0xFC,0x0F,0x40,0x00,0x20,0x00,0x20,0x00,0xC0,0x0F,	// 104
+	0x00,0x00,0x20,0x08,0x20,0x08,0xE4,0x0F,0x00,0x08,0x00,0x08,	// 105
+	0x00,0x00,0x00,0x00,0x20,0x40,0x20,0x40,0xE4,0x3F,	// 106
+	0x00,0x00,0xFC,0x0F,0x00,0x01,0x80,0x02,0x40,0x04,0x20,0x08,	// 107
+	0x00,0x00,0x04,0x00,0x04,0x00,0xFC,0x07,0x00,0x08,0x00,0x08,	// 108
+	0x00,0x00,0xE0,0x0F,0x20,0x00,0xE0,0x0F,0x20,0x00,0xE0,0x0F,	// 109
+	0x00,0x00,0xE0,0x0F,0x40,0x00,0x20,0x00,0x20,0x00,0xC0,0x0F,	// 110
+	0x00,0x00,0xC0,0x07,0x20,0x08,0x20,0x08,0x20,0x08,0xC0,0x07,	// 111
+	0x00,0x00,0xE0,0x7F,0x20,0x08,0x20,0x08,0x20,0x08,0xC0,0x07,	// 112
+	0x00,0x00,0xC0,0x07,0x20,0x08,0x20,0x08,0x20,0x08,0xE0,0x7F,	// 113
+	0x00,0x00,0x00,0x00,0xE0,0x0F,0x60,0x00,0x20,0x00,0x20,0x00,0x40,	// 114
+	0x00,0x00,0xC0,0x04,0x20,0x09,0x20,0x09,0x20,0x09,0x40,0x06,	// 115
+	0x00,0x00,0x20,0x00,0x20,0x00,0xF8,0x0F,0x20,0x08,0x20,0x08,	// 116
+	0x00,0x00,0xE0,0x07,0x00,0x08,0x00,0x08,0x00,0x08,0xE0,0x0F,	// 117
+	0x00,0x00,0x60,0x00,0x80,0x03,0x00,0x0C,0x80,0x03,0x60,	// 118
+	0x60,0x00,0x80,0x03,0x00,0x0E,0x80,0x01,0x00,0x0E,0x80,0x03,0x60,	// 119
+	0x00,0x00,0x20,0x08,0xC0,0x06,0x00,0x01,0xC0,0x06,0x20,0x08,	// 120
+	0x00,0x00,0x60,0x40,0x80,0x67,0x00,0x1C,0x80,0x03,0x60,	// 121
+	0x00,0x00,0x20,0x0C,0x20,0x0A,0x20,0x09,0xA0,0x08,0x60,0x08,	// 122
+	0x00,0x00,0x80,0x00,0x80,0x00,0x7C,0x1F,0x04,0x10,0x04,0x10,	// 123
+	0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,	// 124
+	0x00,0x00,0x04,0x10,0x04,0x10,0x7C,0x1F,0x80,0x00,0x80,	// 125
+	0x00,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x01,0x00,0x01,0x00,0x01,	// 126
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 127
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 128
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 129
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 130
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 131
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 132
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 133
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 134
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 135
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 136
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 137
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 138
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 139
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 140
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 141
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 142
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 143
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 144
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 145
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 146
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 147
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 148
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 149
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 150
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 151
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 152
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 153
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 154
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 155
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 156
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 157
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 158
+	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 159
+	0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x3F,	// 161
+	0x00,0x00,0xC0,0x07,0x20,0x08,0xF8,0x3F,0x20,0x08,0x40,0x04,	// 162
+	0x00,0x00,0x80,0x08,0xF0,0x0F,0x88,0x08,0x88,0x08,0x08,0x08,	// 163
+	0x00,0x00,0x20,0x04,0xC0,0x03,0x40,0x02,0x40,0x02,0xC0,0x03,0x20,0x04,	// 164
+	0x08,0x00,0x50,0x01,0x60,0x01,0x80,0x0F,0x60,0x01,0x50,0x01,0x08,	// 165
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3C,	// 166
+	0x00,0x00,0xF0,0x11,0x28,0x13,0x48,0x12,0xC8,0x14,0x88,0x0F,	// 167
+	0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x08,	// 168
+	0xC0,0x01,0x20,0x02,0xD0,0x05,0x50,0x05,0x50,0x05,0x20,0x02,0xC0,0x01,	// 169
+	0x00,0x00,0xE8,0x02,0xA8,0x02,0xA8,0x02,0xF0,0x02,	// 170
+	0x00,0x00,0x00,0x01,0x80,0x02,0x40,0x04,0x00,0x01,0x80,0x02,0x40,0x04,	// 171
+	0x00,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x03,	// 172
+	0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,	// 173
+	0xC0,0x01,0x20,0x02,0xD0,0x05,0xD0,0x05,0xD0,0x05,0x20,0x02,0xC0,0x01,	// 174
+	0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,	// 175
+	0x00,0x00,0x00,0x00,0x30,0x00,0x48,0x00,0x48,0x00,0x30,	// 176
+	0x80,0x08,0x80,0x08,0x80,0x08,0xE0,0x0B,0x80,0x08,0x80,0x08,0x80,0x08,	// 177
+	0x00,0x00,0x00,0x00,0x88,0x00,0xE8,0x00,0xB8,	// 178
+	0x00,0x00,0x00,0x00,0x88,0x00,0xA8,0x00,0xA8,0x00,0xD8,	// 179
+	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x04,	// 180
+	0x00,0x00,0xE0,0x7F,0x00,0x08,0x00,0x08,0x00,0x08,0xE0,0x0F,0x00,0x08,	// 181
+	0x00,0x00,0x70,0x00,0xF8,0x00,0xF8,0x00,0xF8,0x1F,0x08,0x00,0xF8,0x1F,	// 182
+	0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x01,	// 183
+	0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x30,	// 184
+	0x00,0x00,0x00,0x00,0x88,0x00,0xF8,0x00,0x80,	// 185
+	0x00,0x00,0x70,0x02,0x88,0x02,0x88,0x02,0x70,0x02,	// 186
+	0x00,0x00,0x40,0x04,0x80,0x02,0x00,0x01,0x40,0x04,0x80,0x02,0x00,0x01,	// 187
+	0x44,0x02,0x7C,0x03,0x40,0x01,0x00,0x0D,0x80,0x0B,0x80,0x1F,0x00,0x08,	// 188
+	0x44,0x02,0x7C,0x03,0x40,0x01,0x00,0x11,0x80,0x1D,0x80,0x17,	// 189
+	0x00,0x02,0x44,0x03,0x54,0x01,0x54,0x0D,0xEC,0x0B,0x80,0x1F,0x00,0x08,	// 190
+	0x00,0x38,0x00,0x4C,0x00,0x44,0x60,0x43,0x00,0x20,	// 191
+	0x00,0x00,0x00,0x0C,0xC1,0x03,0x3A,0x02,0x38,0x02,0xC0,0x03,0x00,0x0C,	// 192
+	0x00,0x00,0x00,0x0C,0xC0,0x03,0x3A,0x02,0x39,0x02,0xC0,0x03,0x00,0x0C,	// 193
+	0x00,0x00,0x00,0x0C,0xC2,0x03,0x39,0x02,0x39,0x02,0xC2,0x03,0x00,0x0C,	// 194
+	0x00,0x00,0x00,0x0C,0xC3,0x03,0x39,0x02,0x3A,0x02,0xC3,0x03,0x00,0x0C,	// 195
+	0x00,0x00,0x00,0x0C,0xC2,0x03,0x38,0x02,0x38,0x02,0xC2,0x03,0x00,0x0C,	// 196
+	0x00,0x00,0x00,0x08,0x00,0x07,0xFE,0x02,0xE6,0x02,0x00,0x07,0x00,0x08,	// 197
+	0x00,0x0C,0x80,0x03,0x78,0x02,0x08,0x02,0xF8,0x0F,0x88,0x08,0x88,0x08,	// 198
+	0x00,0x00,0xE0,0x03,0x10,0x04,0x08,0x28,0x08,0x28,0x08,0x38,0x10,0x04,	// 199
+	0x00,0x00,0xF8,0x0F,0x89,0x08,0x8A,0x08,0x88,0x08,0x88,0x08,0x88,0x08,	// 200
+	0x00,0x00,0xF8,0x0F,0x88,0x08,0x8A,0x08,0x89,0x08,0x88,0x08,0x88,0x08,	// 201
+	0x00,0x00,0xF8,0x0F,0x8A,0x08,0x89,0x08,0x89,0x08,0x8A,0x08,0x88,0x08,	// 202
+	0x00,0x00,0xF8,0x0F,0x8A,0x08,0x88,0x08,0x8A,0x08,0x88,0x08,0x88,0x08,	// 203
+	0x00,0x00,0x08,0x08,0x09,0x08,0xFA,0x0F,0x08,0x08,0x08,0x08,	// 204
+	0x00,0x00,0x08,0x08,0x08,0x08,0xFA,0x0F,0x09,0x08,0x08,0x08,	// 205
+	0x00,0x00,0x08,0x08,0x0A,0x08,0xF9,0x0F,0x0A,0x08,0x08,0x08,	// 206
+	0x00,0x00,0x08,0x08,0x0A,0x08,0xF8,0x0F,0x0A,0x08,0x08,0x08,	// 207
+	0x80,0x00,0xF8,0x0F,0x88,0x08,0x88,0x08,0x08,0x08,0x10,0x04,0xE0,0x03,	// 208
+	0x00,0x00,0xF8,0x0F,0x1B,0x00,0xE1,0x00,0x82,0x03,0x03,0x0C,0xF8,0x0F,	// 209
+	0x00,0x00,0xE0,0x03,0x19,0x0C,0x0A,0x08,0x08,0x08,0x18,0x0C,0xE0,0x03,	// 210
+	0x00,0x00,0xE0,0x03,0x18,0x0C,0x0A,0x08,0x09,0x08,0x18,0x0C,0xE0,0x03,	// 211
+	0x00,0x00,0xE0,0x03,0x1A,0x0C,0x09,0x08,0x09,0x08,0x1A,0x0C,0xE0,0x03,	// 212
+	0x00,0x00,0xE0,0x03,0x1B,0x0C,0x09,0x08,0x0A,0x08,0x1B,0x0C,0xE0,0x03,	// 213
+	0x00,0x00,0xE0,0x03,0x1A,0x0C,0x08,0x08,0x08,0x08,0x1A,0x0C,0xE0,0x03,	// 214
+	0x00,0x00,0x20,0x02,0x40,0x01,0x80,0x00,0x40,0x01,0x20,0x02,	// 215
+	0x00,0x08,0xE0,0x07,0x18,0x0E,0x88,0x09,0x48,0x08,0x38,0x0C,0xF8,0x03,	// 216
+	0x00,0x00,0xF8,0x07,0x01,0x08,0x02,0x08,0x00,0x08,0x00,0x08,0xF8,0x07,	// 217
+	0x00,0x00,0xF8,0x07,0x00,0x08,0x02,0x08,0x01,0x08,0x00,0x08,0xF8,0x07,	// 218
+	0x00,0x00,0xF8,0x07,0x02,0x08,0x01,0x08,0x01,0x08,0x02,0x08,0xF8,0x07,	// 219
+	0x00,0x00,0xF8,0x07,0x02,0x08,0x00,0x08,0x00,0x08,0x02,0x08,0xF8,0x07,	// 220
+	0x08,0x00,0x10,0x00,0x60,0x00,0x82,0x0F,0x61,0x00,0x10,0x00,0x08,	// 221
+	0x00,0x00,0xF8,0x0F,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0xE0,	// 222
+	0x00,0x00,0xF8,0x0F,0xE4,0x00,0xA4,0x09,0x18,0x09,0x00,0x06,	// 223
+	0x00,0x00,0x40,0x06,0x20,0x09,0x24,0x09,0x28,0x09,0xC0,0x0F,	// 224
+	0x00,0x00,0x40,0x06,0x20,0x09,0x28,0x09,0x24,0x09,0xC0,0x0F,	// 225
+	0x00,0x00,0x40,0x06,0x28,0x09,0x24,0x09,0x24,0x09,0xC8,0x0F,	// 226
+	0x00,0x00,0x40,0x06,0x2C,0x09,0x24,0x09,0x28,0x09,0xCC,0x0F,	// 227
+	0x00,0x00,0x40,0x06,0x28,0x09,0x20,0x09,0x28,0x09,0xC0,0x0F,	// 228
+	0x00,0x00,0x40,0x06,0x26,0x09,0x29,0x09,0x29,0x09,0xC6,0x0F,	// 229
+	0x00,0x00,0x40,0x0F,0x20,0x09,0xC0,0x07,0x20,0x09,0xE0,0x09,	// 230
+	0x00,0x00,0xC0,0x07,0x60,0x0C,0x20,0x28,0x20,0x28,0x40,0x38,	// 231
+	0x00,0x00,0xC0,0x07,0x60,0x09,0x24,0x09,0x28,0x09,0xC0,0x05,	// 232
+	0x00,0x00,0xC0,0x07,0x60,0x09,0x28,0x09,0x24,0x09,0xC0,0x05,	// 233
+	0x00,0x00,0xC0,0x07,0x68,0x09,0x24,0x09,0x24,0x09,0xC8,0x05,	// 234
+	0x00,0x00,0xC0,0x07,0x68,0x09,0x20,0x09,0x28,0x09,0xC0,0x05,	// 235
+	0x00,0x00,0x20,0x08,0x20,0x08,0xE4,0x0F,0x08,0x08,0x00,0x08,	// 236
+	0x00,0x00,0x20,0x08,0x20,0x08,0xE8,0x0F,0x04,0x08,0x00,0x08,	// 237
+	0x00,0x00,0x28,0x08,0x24,0x08,0xE4,0x0F,0x08,0x08,0x00,0x08,	// 238
+	0x00,0x00,0x20,0x08,0x28,0x08,0xE0,0x0F,0x08,0x08,0x00,0x08,	// 239
+	0x00,0x00,0x80,0x07,0x54,0x08,0x58,0x08,0x68,0x08,0xC0,0x07,	// 240
+	0x00,0x00,0xE0,0x0F,0x4C,0x00,0x24,0x00,0x28,0x00,0xCC,0x0F,	// 241
+	0x00,0x00,0xC0,0x07,0x20,0x08,0x24,0x08,0x28,0x08,0xC0,0x07,	// 242
+	0x00,0x00,0xC0,0x07,0x20,0x08,0x28,0x08,0x24,0x08,0xC0,0x07,	// 243
+	0x00,0x00,0xC0,0x07,0x28,0x08,0x24,0x08,0x28,0x08,0xC0,0x07,	// 244
+	0x00,0x00,0xCC,0x07,0x24,0x08,0x2C,0x08,0x28,0x08,0xCC,0x07,	// 245
+	0x00,0x00,0xC0,0x07,0x28,0x08,0x20,0x08,0x28,0x08,0xC0,0x07,	// 246
+	0x00,0x00,0x00,0x01,0x00,0x01,0x40,0x05,0x00,0x01,0x00,0x01,	// 247
+	0x00,0x00,0xC0,0x0F,0x20,0x0A,0x20,0x09,0xA0,0x08,0xE0,0x07,	// 248
+	0x00,0x00,0xE0,0x07,0x00,0x08,0x04,0x08,0x08,0x08,0xE0,0x0F,	// 249
+	0x00,0x00,0xE0,0x07,0x00,0x08,0x08,0x08,0x04,0x08,0xE0,0x0F,	// 250
+	0x00,0x00,0xE0,0x07,0x08,0x08,0x04,0x08,0x08,0x08,0xE0,0x0F,	// 251
+	0x00,0x00,0xE0,0x07,0x08,0x08,0x00,0x08,0x08,0x08,0xE0,0x0F,	// 252
+	0x00,0x00,0x60,0x40,0x80,0x67,0x08,0x1C,0x84,0x03,0x60,	// 253
+	0x00,0x00,0xFC,0x7F,0x20,0x08,0x20,0x08,0x20,0x08,0xC0,0x07,	// 254
+	0x00,0x00,0x60,0x40,0x88,0x67,0x00,0x1C,0x88,0x03,0x60	// 255
+};
+
+// Created by http://oleddisplay.squix.ch/ Consider a donation
+// In case of problems make sure that you are using the font file with the correct version!
+const uint8_t DejaVu_Sans_Mono_16[] PROGMEM = {
+	0x0A, // Width: 10
+	0x13, // Height: 19
+	0x20, // First Char: 32
+	0xE0, // Numbers of Chars: 224
+
+	// Jump Table:
+	0xFF, 0xFF, 0x00, 0x0A,  // 32:65535
+	0x00, 0x00, 0x0E, 0x0A,  // 33:0
+	0x00, 0x0E, 0x13, 0x0A,  // 34:14
+	0x00, 0x21, 0x1C, 0x0A,  // 35:33
+	0x00, 0x3D, 0x1A, 0x0A,  // 36:61
+	0x00, 0x57, 0x1A, 0x0A,  // 37:87
+	0x00, 0x71, 0x1A, 0x0A,  // 38:113
+	0x00, 0x8B, 0x0D, 0x0A,  // 39:139
+	0x00, 0x98, 0x15, 0x0A,  // 40:152
+	0x00, 0xAD, 0x11, 0x0A,  // 41:173
+	0x00, 0xBE, 0x17, 0x0A,  // 42:190
+	0x00, 0xD5, 0x17, 0x0A,  // 43:213
+	0x00, 0xEC, 0x11, 0x0A,  // 44:236
+	0x00, 0xFD, 0x14, 0x0A,  // 45:253
+	0x01, 0x11, 0x11, 0x0A,  // 46:273
+	0x01, 0x22, 0x16, 0x0A,  // 47:290
+	0x01, 0x38, 0x1A, 0x0A,  // 48:312
+	0x01, 0x52, 0x17, 0x0A,  // 49:338
+	0x01, 0x69, 0x1A, 0x0A,  // 50:361
+	0x01, 0x83, 0x1A, 0x0A,  // 51:387
+	0x01, 0x9D, 0x1A, 0x0A,  // 52:413
+	0x01, 0xB7, 0x1A, 0x0A,  // 53:439
+	0x01, 0xD1, 0x1A, 0x0A,  // 54:465
+	0x01, 0xEB, 0x19, 0x0A,  // 55:491
+	0x02, 0x04, 0x1A, 0x0A,  // 56:516
+	0x02, 0x1E, 0x1A, 0x0A,  // 57:542
+	0x02, 0x38, 0x11, 0x0A,  // 58:568
+	0x02, 0x49, 0x11, 0x0A,  // 59:585
+	0x02, 0x5A, 0x1A, 0x0A,  // 60:602
+	0x02, 0x74, 0x1A, 0x0A,  // 61:628
+	0x02, 0x8E, 0x1A, 0x0A,  // 62:654
+	0x02, 0xA8, 0x16, 0x0A,  // 63:680
+	0x02, 0xBE, 0x1A, 0x0A,  // 64:702
+	0x02, 0xD8, 0x1A, 0x0A,  // 65:728
+	0x02, 0xF2, 0x1A, 0x0A,  // 66:754
+	0x03, 0x0C, 0x1A, 0x0A,  // 67:780
+	0x03, 0x26, 0x1A, 0x0A,  // 68:806
+	0x03, 0x40, 0x1A, 0x0A,  // 69:832
+	0x03, 0x5A, 0x19, 0x0A,  // 70:858
+	0x03, 0x73, 0x1A, 0x0A,  // 71:883
+	0x03, 0x8D, 0x1A, 0x0A,  // 72:909
+	0x03, 0xA7, 0x14, 0x0A,  // 73:935
+	0x03, 0xBB, 0x17, 0x0A,  // 74:955
+	0x03, 0xD2, 0x1A, 0x0A,  // 75:978
+	0x03, 0xEC, 0x1A, 0x0A,  // 76:1004
+	0x04, 0x06, 0x1A, 0x0A,  // 77:1030
+	0x04, 0x20, 0x1A, 0x0A,  // 78:1056
+	0x04, 0x3A, 0x1A, 0x0A,  // 79:1082
+	0x04, 0x54, 0x19, 0x0A,  // 80:1108
+	0x04, 0x6D, 0x1A, 0x0A,  // 81:1133
+	0x04, 0x87, 0x1D, 0x0A,  // 82:1159
+	0x04, 0xA4, 0x1A, 0x0A,  // 83:1188
+	0x04, 0xBE, 0x19, 0x0A,  // 84:1214
+	0x04, 0xD7, 0x1A, 0x0A,  // 85:1239
+	0x04, 0xF1, 0x19, 0x0A,  // 86:1265
+	0x05, 0x0A, 0x1C, 0x0A,  // 87:1290
+	0x05, 0x26, 0x1A, 0x0A,  // 88:1318
+	0x05, 0x40, 0x19, 0x0A,  // 89:1344
+	0x05, 0x59, 0x1A, 0x0A,  // 90:1369
+	0x05, 0x73, 0x15, 0x0A,  // 91:1395
+	0x05, 0x88, 0x17, 0x0A,  // 92:1416
+	0x05, 0x9F, 0x12, 0x0A,  // 93:1439
+	0x05, 0xB1, 0x1C, 0x0A,  // 94:1457
+	0x05, 0xCD, 0x1E, 0x0A,  // 95:1485
+	0x05, 0xEB, 0x10, 0x0A,  // 96:1515
+	0x05, 0xFB, 0x1A, 0x0A,  // 97:1531
+	0x06, 0x15, 0x1A, 0x0A,  // 98:1557
+	0x06, 0x2F, 0x17, 0x0A,  // 99:1583
+	0x06, 0x46, 0x1A, 0x0A,  // 100:1606
+	0x06, 0x60, 0x1A, 0x0A,  // 101:1632
+	0x06, 0x7A, 0x16, 0x0A,  // 102:1658
+	0x06, 0x90, 0x1A, 0x0A,  // 103:1680
+	0x06, 0xAA, 0x1A, 0x0A,  // 104:1706
+	0x06, 0xC4, 0x17, 0x0A,  // 105:1732
+	0x06, 0xDB, 0x12, 0x0A,  // 106:1755
+	0x06, 0xED, 0x1A, 0x0A,  // 107:1773
+	0x07, 0x07, 0x17, 0x0A,  // 108:1799
+	0x07, 0x1E, 0x17, 0x0A,  // 109:1822
+	0x07, 0x35, 0x1A, 0x0A,  // 110:1845
+	0x07, 0x4F, 0x1A, 0x0A,  // 111:1871
+	0x07, 0x69, 0x1A, 0x0A,  // 112:1897
+	0x07, 0x83, 0x1B, 0x0A,  // 113:1923
+	0x07, 0x9E, 0x19, 0x0A,  // 114:1950
+	0x07, 0xB7, 0x1A, 0x0A,  // 115:1975
+	0x07, 0xD1, 0x14, 0x0A,  // 116:2001
+	0x07, 0xE5, 0x1A, 0x0A,  // 117:2021
+	0x07, 0xFF, 0x19, 0x0A,  // 118:2047
+	0x08, 0x18, 0x1C, 0x0A,  // 119:2072
+	0x08, 0x34, 0x1A, 0x0A,  // 120:2100
+	0x08, 0x4E, 0x19, 0x0A,  // 121:2126
+	0x08, 0x67, 0x1A, 0x0A,  // 122:2151
+	0x08, 0x81, 0x15, 0x0A,  // 123:2177
+	0x08, 0x96, 0x0F, 0x0A,  // 124:2198
+	0x08, 0xA5, 0x14, 0x0A,  // 125:2213
+	0x08, 0xB9, 0x1A, 0x0A,  // 126:2233
+	0x08, 0xD3, 0x1B, 0x0A,  // 127:2259
+	0x08, 0xEE, 0x1B, 0x0A,  // 128:2286
+	0x09, 0x09, 0x1B, 0x0A,  // 129:2313
+	0x09, 0x24, 0x1B, 0x0A,  // 130:2340
+	0x09, 0x3F, 0x1B, 0x0A,  // 131:2367
+	0x09, 0x5A, 0x1B, 0x0A,  // 132:2394
+	0x09, 0x75, 0x1B, 0x0A,  // 133:2421
+	0x09, 0x90, 0x1B, 0x0A,  // 134:2448
+	0x09, 0xAB, 0x1B, 0x0A,  // 135:2475
+	0x09, 0xC6, 0x1B, 0x0A,  // 136:2502
+	0x09, 0xE1, 0x1B, 0x0A,  // 137:2529
+	0x09, 0xFC, 0x1B, 0x0A,  // 138:2556
+	0x0A, 0x17, 0x1B, 0x0A,  // 139:2583
+	0x0A, 0x32, 0x1B, 0x0A,  // 140:2610
+	0x0A, 0x4D, 0x1B, 0x0A,  // 141:2637
+	0x0A, 0x68, 0x1B, 0x0A,  // 142:2664
+	0x0A, 0x83, 0x1B, 0x0A,  // 143:2691
+	0x0A, 0x9E, 0x1B, 0x0A,  // 144:2718
+	0x0A, 0xB9, 0x1B, 0x0A,  // 145:2745
+	0x0A, 0xD4, 0x1B, 0x0A,  // 146:2772
+	0x0A, 0xEF, 0x1B, 0x0A,  // 147:2799
+	0x0B, 0x0A, 0x1B, 0x0A,  // 148:2826
+	0x0B, 0x25, 0x1B, 0x0A,  // 149:2853
+	0x0B, 0x40, 0x1B, 0x0A,  // 150:2880
+	0x0B, 0x5B, 0x1B, 0x0A,  // 151:2907
+	0x0B, 0x76, 0x1B, 0x0A,  // 152:2934
+	0x0B, 0x91, 0x1B, 0x0A,  // 153:2961
+	0x0B, 0xAC, 0x1B, 0x0A,  // 154:2988
+	0x0B, 0xC7, 0x1B, 0x0A,  // 155:3015
+	0x0B, 0xE2, 0x1B, 0x0A,  // 156:3042
+	0x0B, 0xFD, 0x1B, 0x0A,  // 157:3069
+	0x0C, 0x18, 0x1B, 0x0A,  // 158:3096
+	0x0C, 0x33, 0x1B, 0x0A,  // 159:3123
+	0xFF, 0xFF, 0x00, 0x0A,  // 160:65535
+	0x0C, 0x4E, 0x0F, 0x0A,  // 161:3150
+	0x0C, 0x5D, 0x17, 0x0A,  // 162:3165
+	0x0C, 0x74, 0x17, 0x0A,  // 163:3188
+	0x0C, 0x8B, 0x17, 0x0A,  // 164:3211
+	0x0C, 0xA2, 0x19, 0x0A,  // 165:3234
+	0x0C, 0xBB, 0x0F, 0x0A,  // 166:3259
+	0x0C, 0xCA, 0x1A, 0x0A,  // 167:3274
+	0x0C, 0xE4, 0x16, 0x0A,  // 168:3300
+	0x0C, 0xFA, 0x1D, 0x0A,  // 169:3322
+	0x0D, 0x17, 0x17, 0x0A,  // 170:3351
+	0x0D, 0x2E, 0x1A, 0x0A,  // 171:3374
+	0x0D, 0x48, 0x1A, 0x0A,  // 172:3400
+	0x0D, 0x62, 0x14, 0x0A,  // 173:3426
+	0x0D, 0x76, 0x1D, 0x0A,  // 174:3446
+	0x0D, 0x93, 0x13, 0x0A,  // 175:3475
+	0x0D, 0xA6, 0x13, 0x0A,  // 176:3494
+	0x0D, 0xB9, 0x17, 0x0A,  // 177:3513
+	0x0D, 0xD0, 0x14, 0x0A,  // 178:3536
+	0x0D, 0xE4, 0x17, 0x0A,  // 179:3556
+	0x0D, 0xFB, 0x16, 0x0A,  // 180:3579
+	0x0E, 0x11, 0x1D, 0x0A,  // 181:3601
+	0x0E, 0x2E, 0x1B, 0x0A,  // 182:3630
+	0x0E, 0x49, 0x11, 0x0A,  // 183:3657
+	0x0E, 0x5A, 0x12, 0x0A,  // 184:3674
+	0x0E, 0x6C, 0x14, 0x0A,  // 185:3692
+	0x0E, 0x80, 0x17, 0x0A,  // 186:3712
+	0x0E, 0x97, 0x1D, 0x0A,  // 187:3735
+	0x0E, 0xB4, 0x1A, 0x0A,  // 188:3764
+	0x0E, 0xCE, 0x1B, 0x0A,  // 189:3790
+	0x0E, 0xE9, 0x1A, 0x0A,  // 190:3817
+	0x0F, 0x03, 0x15, 0x0A,  // 191:3843
+	0x0F, 0x18, 0x1A, 0x0A,  // 192:3864
+	0x0F, 0x32, 0x1A, 0x0A,  // 193:3890
+	0x0F, 0x4C, 0x1A, 0x0A,  // 194:3916
+	0x0F, 0x66, 0x1A, 0x0A,  // 195:3942
+	0x0F, 0x80, 0x1A, 0x0A,  // 196:3968
+	0x0F, 0x9A, 0x1A, 0x0A,  // 197:3994
+	0x0F, 0xB4, 0x1A, 0x0A,  // 198:4020
+	0x0F, 0xCE, 0x1A, 0x0A,  // 199:4046
+	0x0F, 0xE8, 0x1A, 0x0A,  // 200:4072
+	0x10, 0x02, 0x1A, 0x0A,  // 201:4098
+	0x10, 0x1C, 0x1A, 0x0A,  // 202:4124
+	0x10, 0x36, 0x1A, 0x0A,  // 203:4150
+	0x10, 0x50, 0x14, 0x0A,  // 204:4176
+	0x10, 0x64, 0x14, 0x0A,  // 205:4196
+	0x10, 0x78, 0x14, 0x0A,  // 206:4216
+	0x10, 0x8C, 0x14, 0x0A,  // 207:4236
+	0x10, 0xA0, 0x1A, 0x0A,  // 208:4256
+	0x10, 0xBA, 0x1A, 0x0A,  // 209:4282
+	0x10, 0xD4, 0x1A, 0x0A,  // 210:4308
+	0x10, 0xEE, 0x1A, 0x0A,  // 211:4334
+	0x11, 0x08, 0x1A, 0x0A,  // 212:4360
+	0x11, 0x22, 0x1A, 0x0A,  // 213:4386
+	0x11, 0x3C, 0x1A, 0x0A,  // 214:4412
+	0x11, 0x56, 0x17, 0x0A,  // 215:4438
+	0x11, 0x6D, 0x1A, 0x0A,  // 216:4461
+	0x11, 0x87, 0x1A, 0x0A,  // 217:4487
+	0x11, 0xA1, 0x1A, 0x0A,  // 218:4513
+	0x11, 0xBB, 0x1A, 0x0A,  // 219:4539
+	0x11, 0xD5, 0x1A, 0x0A,  // 220:4565
+	0x11, 0xEF, 0x19, 0x0A,  // 221:4591
+	0x12, 0x08, 0x1A, 0x0A,  // 222:4616
+	0x12, 0x22, 0x1A, 0x0A,  // 223:4642
+	0x12, 0x3C, 0x1A, 0x0A,  // 224:4668
+	0x12, 0x56, 0x1A, 0x0A,  // 225:4694
+	0x12, 0x70, 0x1A, 0x0A,  // 226:4720
+	0x12, 0x8A, 0x1A, 0x0A,  // 227:4746
+	0x12, 0xA4, 0x1A, 0x0A,  // 228:4772
+	0x12, 0xBE, 0x1A, 0x0A,  // 229:4798
+	0x12, 0xD8, 0x1A, 0x0A,  // 230:4824
+	0x12, 0xF2, 0x17, 0x0A,  // 231:4850
+	0x13, 0x09, 0x1A, 0x0A,  // 232:4873
+	0x13, 0x23, 0x1A, 0x0A,  // 233:4899
+	0x13, 0x3D, 0x1A, 0x0A,  // 234:4925
+	0x13, 0x57, 0x1A, 0x0A,  // 235:4951
+	0x13, 0x71, 0x17, 0x0A,  // 236:4977
+	0x13, 0x88, 0x17, 0x0A,  // 237:5000
+	0x13, 0x9F, 0x17, 0x0A,  // 238:5023
+	0x13, 0xB6, 0x17, 0x0A,  // 239:5046
+	0x13, 0xCD, 0x1A, 0x0A,  // 240:5069
+	0x13, 0xE7, 0x1A, 0x0A,  // 241:5095
+	0x14, 0x01, 0x1A, 0x0A,  // 242:5121
+	0x14, 0x1B, 0x1A, 0x0A,  // 243:5147
+	0x14, 0x35, 0x1A, 0x0A,  // 244:5173
+	0x14, 0x4F, 0x1A, 0x0A,  // 245:5199
+	0x14, 0x69, 0x1A, 0x0A,  // 246:5225
+	0x14, 0x83, 0x1A, 0x0A,  // 247:5251
+	0x14, 0x9D, 0x1A, 0x0A,  // 248:5277
+	0x14, 0xB7, 0x1A, 0x0A,  // 249:5303
+	0x14, 0xD1, 0x1A, 0x0A,  // 250:5329
+	0x14, 0xEB, 0x1A, 0x0A,  // 251:5355
+	0x15, 0x05, 0x1A, 0x0A,  // 252:5381
+	0x15, 0x1F, 0x19, 0x0A,  // 253:5407
+	0x15, 0x38, 0x1A, 0x0A,  // 254:5432
+	0x15, 0x52, 0x19, 0x0A,  // 255:5458
+
+	// Font Data:
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x67,	// 33
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,	// 34
+	0x00,0x08,0x00,0x80,0x48,0x00,0x80,0x78,0x00,0x80,0x0F,0x00,0xF0,0x08,0x00,0x80,0x78,0x00,0x80,0x1F,0x00,0xF0,0x09,0x00,0x90,0x08,0x00,0x80,	// 35
+	0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x21,0x00,0x60,0x42,0x00,0x20,0x42,0x00,0xF8,0xFF,0x01,0x20,0x44,0x00,0x20,0x44,0x00,0x40,0x38,	// 36
+	0x70,0x00,0x00,0x88,0x04,0x00,0x88,0x04,0x00,0x88,0x02,0x00,0x70,0x3A,0x00,0x00,0x45,0x00,0x00,0x45,0x00,0x80,0x44,0x00,0x00,0x38,	// 37
+	0x00,0x00,0x00,0x00,0x1E,0x00,0x70,0x23,0x00,0x88,0x40,0x00,0x08,0x43,0x00,0x08,0x46,0x00,0x08,0x78,0x00,0x00,0x30,0x00,0x00,0x4E,	// 38
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,	// 39
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x70,0xE0,0x00,0x18,0x80,0x01,0x08,0x00,0x01,	// 40
+	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x01,0x18,0x80,0x01,0x70,0xE0,0x00,0x80,0x1F,	// 41
+	0x00,0x00,0x00,0x20,0x01,0x00,0x40,0x01,0x00,0xC0,0x00,0x00,0xF8,0x07,0x00,0xC0,0x00,0x00,0x40,0x01,0x00,0x20,0x01,	// 42
+	0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x80,0x3F,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,	// 43
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0xE0,0x01,0x00,0xE0,	// 44
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,	// 45
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x60,	// 46
+	0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x60,0x00,0x00,0x18,0x00,0x00,0x07,0x00,0xC0,0x00,0x00,0x30,0x00,0x00,0x08,	// 47
+	0x00,0x00,0x00,0xC0,0x0F,0x00,0x30,0x30,0x00,0x08,0x40,0x00,0x08,0x43,0x00,0x08,0x43,0x00,0x08,0x40,0x00,0x30,0x30,0x00,0xC0,0x0F,	// 48
+	0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x18,0x40,0x00,0x08,0x40,0x00,0xF8,0x7F,0x00,0x00,0x40,0x00,0x00,0x40,	// 49
+	0x00,0x00,0x00,0x30,0x40,0x00,0x18,0x60,0x00,0x08,0x70,0x00,0x08,0x48,0x00,0x08,0x44,0x00,0x08,0x42,0x00,0x10,0x41,0x00,0xE0,0x40,	// 50
+	0x00,0x00,0x00,0x10,0x20,0x00,0x08,0x40,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x90,0x22,0x00,0xE0,0x1C,	// 51
+	0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x0B,0x00,0xC0,0x08,0x00,0x70,0x08,0x00,0x18,0x08,0x00,0xF8,0x7F,0x00,0x00,0x08,0x00,0x00,0x08,	// 52
+	0x00,0x00,0x00,0x00,0x20,0x00,0xF8,0x41,0x00,0x88,0x40,0x00,0x88,0x40,0x00,0x88,0x40,0x00,0x88,0x40,0x00,0x08,0x21,0x00,0x00,0x1E,	// 53
+	0x00,0x00,0x00,0xC0,0x1F,0x00,0x30,0x21,0x00,0x98,0x40,0x00,0x88,0x40,0x00,0x88,0x40,0x00,0x88,0x40,0x00,0x10,0x21,0x00,0x00,0x1E,	// 54
+	0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x40,0x00,0x08,0x30,0x00,0x08,0x0E,0x00,0x88,0x01,0x00,0x68,0x00,0x00,0x18,	// 55
+	0x00,0x00,0x00,0xF0,0x1C,0x00,0x90,0x22,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x90,0x22,0x00,0xF0,0x1E,	// 56
+	0x00,0x00,0x00,0xE0,0x01,0x00,0x10,0x22,0x00,0x08,0x44,0x00,0x08,0x44,0x00,0x08,0x44,0x00,0x08,0x64,0x00,0x10,0x32,0x00,0xE0,0x0F,	// 57
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x61,0x00,0x80,0x61,	// 58
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0xE1,0x01,0x80,0xE1,	// 59
+	0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x0F,0x00,0x00,0x09,0x00,0x80,0x19,0x00,0x80,0x10,0x00,0x80,0x10,0x00,0xC0,0x30,	// 60
+	0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x09,0x00,0x00,0x09,0x00,0x00,0x09,0x00,0x00,0x09,0x00,0x00,0x09,0x00,0x00,0x09,0x00,0x00,0x09,	// 61
+	0x00,0x00,0x00,0xC0,0x30,0x00,0x80,0x10,0x00,0x80,0x10,0x00,0x80,0x19,0x00,0x00,0x09,0x00,0x00,0x0F,0x00,0x00,0x06,0x00,0x00,0x06,	// 62
+	0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x08,0x6E,0x00,0x08,0x01,0x00,0x98,0x01,0x00,0xF0,	// 63
+	0x00,0x00,0x00,0x00,0x3F,0x00,0xC0,0xC0,0x00,0x20,0x00,0x01,0x10,0x3F,0x02,0x90,0x61,0x02,0x90,0x40,0x02,0xB0,0x61,0x02,0xE0,0x7F,	// 64
+	0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x1E,0x00,0xE0,0x09,0x00,0x38,0x08,0x00,0x38,0x08,0x00,0xE0,0x09,0x00,0x00,0x1E,0x00,0x00,0x60,	// 65
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x90,0x22,0x00,0xF0,0x3E,	// 66
+	0x00,0x00,0x00,0xC0,0x0F,0x00,0x30,0x30,0x00,0x10,0x20,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x18,0x60,0x00,0x10,0x20,	// 67
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x10,0x20,0x00,0x30,0x30,0x00,0xC0,0x0F,	// 68
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,	// 69
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x08,0x01,0x00,0x08,0x01,0x00,0x08,0x01,0x00,0x08,0x01,0x00,0x08,0x01,0x00,0x08,0x01,0x00,0x08,	// 70
+	0x00,0x00,0x00,0xC0,0x0F,0x00,0x30,0x30,0x00,0x10,0x20,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x42,0x00,0x18,0x42,0x00,0x10,0x3E,	// 71
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0xF8,0x7F,	// 72
+	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0xF8,0x7F,0x00,0x08,0x40,0x00,0x08,0x40,	// 73
+	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x20,0x00,0xF8,0x1F,	// 74
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x01,0x00,0x80,0x00,0x00,0x40,0x03,0x00,0x20,0x04,0x00,0x10,0x18,0x00,0x08,0x20,0x00,0x00,0x40,	// 75
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,	// 76
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x38,0x00,0x00,0xE0,0x00,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0xE0,0x00,0x00,0x38,0x00,0x00,0xF8,0x7F,	// 77
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x18,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x06,0x00,0x00,0x18,0x00,0x00,0x60,0x00,0xF8,0x7F,	// 78
+	0x00,0x00,0x00,0xE0,0x1F,0x00,0x30,0x30,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x30,0x30,0x00,0xE0,0x1F,	// 79
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x10,0x01,0x00,0xE0,	// 80
+	0x00,0x00,0x00,0xE0,0x1F,0x00,0x30,0x30,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0xC0,0x00,0x30,0xF0,0x01,0xC0,0x1F,	// 81
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x10,0x05,0x00,0xE0,0x39,0x00,0x00,0x40,	// 82
+	0x00,0x00,0x00,0xE0,0x30,0x00,0x10,0x61,0x00,0x08,0x41,0x00,0x08,0x43,0x00,0x08,0x42,0x00,0x18,0x42,0x00,0x10,0x22,0x00,0x00,0x3C,	// 83
+	0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0xF8,0x7F,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,	// 84
+	0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x20,0x00,0xF8,0x1F,	// 85
+	0x00,0x00,0x00,0x18,0x00,0x00,0xE0,0x01,0x00,0x00,0x1E,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x1E,0x00,0xE0,0x01,0x00,0x18,	// 86
+	0x38,0x00,0x00,0xC0,0x1F,0x00,0x00,0x60,0x00,0x00,0x1C,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0x00,0x1C,0x00,0x00,0x60,0x00,0xC0,0x1F,0x00,0x38,	// 87
+	0x00,0x00,0x00,0x08,0x40,0x00,0x30,0x30,0x00,0xC0,0x0C,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0xC0,0x0C,0x00,0x30,0x30,0x00,0x08,0x40,	// 88
+	0x08,0x00,0x00,0x10,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x7E,0x00,0x80,0x01,0x00,0x60,0x00,0x00,0x10,0x00,0x00,0x08,	// 89
+	0x00,0x00,0x00,0x08,0x60,0x00,0x08,0x50,0x00,0x08,0x4C,0x00,0x08,0x46,0x00,0x88,0x41,0x00,0xC8,0x40,0x00,0x28,0x40,0x00,0x18,0x40,	// 90
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x01,0x08,0x00,0x01,0x08,0x00,0x01,	// 91
+	0x00,0x00,0x00,0x08,0x00,0x00,0x30,0x00,0x00,0xC0,0x00,0x00,0x00,0x07,0x00,0x00,0x18,0x00,0x00,0x60,0x00,0x00,0x80,	// 92
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x01,0x08,0x00,0x01,0xF8,0xFF,0x01,	// 93
+	0x00,0x00,0x00,0x40,0x00,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x30,0x00,0x00,0x60,0x00,0x00,0x40,	// 94
+	0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,	// 95
+	0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x0C,0x00,0x00,0x18,0x00,0x00,0x10,	// 96
+	0x00,0x00,0x00,0x00,0x3C,0x00,0x80,0x64,0x00,0x40,0x42,0x00,0x40,0x42,0x00,0x40,0x42,0x00,0x40,0x62,0x00,0xC0,0x32,0x00,0x80,0x7F,	// 97
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x80,0x20,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x80,0x20,0x00,0x00,0x1F,	// 98
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x20,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x80,0x20,	// 99
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x20,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x80,0x20,0x00,0xF8,0x7F,	// 100
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x24,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x80,0x44,0x00,0x00,0x27,	// 101
+	0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0xF0,0x7F,0x00,0x48,0x00,0x00,0x48,0x00,0x00,0x48,	// 102
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x20,0x01,0x40,0x40,0x02,0x40,0x40,0x02,0x40,0x40,0x02,0x40,0x40,0x02,0x80,0x20,0x01,0xC0,0xFF,	// 103
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0xC0,0x00,0x00,0x80,0x7F,	// 104
+	0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0xD8,0x7F,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,	// 105
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x02,0xD8,0xFF,0x01,	// 106
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x05,0x00,0x80,0x08,0x00,0x40,0x10,0x00,0x00,0x20,0x00,0x00,0x40,	// 107
+	0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0xF8,0x3F,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,	// 108
+	0x00,0x00,0x00,0xC0,0x7F,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0xC0,0x7F,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x80,0x7F,	// 109
+	0x00,0x00,0x00,0xC0,0x7F,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0xC0,0x00,0x00,0x80,0x7F,	// 110
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x20,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x80,0x20,0x00,0x00,0x1F,	// 111
+	0x00,0x00,0x00,0xC0,0xFF,0x03,0x80,0x20,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x80,0x20,0x00,0x00,0x1F,	// 112
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x20,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x80,0x20,0x00,0xC0,0xFF,0x03,	// 113
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x7F,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x80,	// 114
+	0x00,0x00,0x00,0x80,0x23,0x00,0x80,0x46,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x40,0x2C,0x00,0x80,0x38,	// 115
+	0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0xF0,0x3F,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,	// 116
+	0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x20,0x00,0xC0,0x7F,	// 117
+	0x00,0x00,0x00,0x40,0x00,0x00,0x80,0x03,0x00,0x00,0x1C,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x1C,0x00,0x80,0x03,0x00,0x40,	// 118
+	0xC0,0x00,0x00,0x00,0x1F,0x00,0x00,0x60,0x00,0x00,0x1C,0x00,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x18,0x00,0x00,0x60,0x00,0x00,0x1F,0x00,0xC0,	// 119
+	0x00,0x00,0x00,0x40,0x40,0x00,0xC0,0x60,0x00,0x00,0x11,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x11,0x00,0xC0,0x60,0x00,0x40,0x40,	// 120
+	0x00,0x00,0x00,0x40,0x00,0x00,0x80,0x03,0x02,0x00,0x0C,0x02,0x00,0x70,0x03,0x00,0xE0,0x00,0x00,0x1C,0x00,0x80,0x03,0x00,0x40,	// 121
+	0x00,0x00,0x00,0x40,0x60,0x00,0x40,0x50,0x00,0x40,0x48,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x40,0x42,0x00,0x40,0x41,0x00,0xC0,0x40,	// 122
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0xF0,0xFB,0x01,0x08,0x00,0x02,0x08,0x00,0x02,	// 123
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x07,	// 124
+	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x02,0x08,0x00,0x02,0xF0,0xFB,0x01,0x00,0x04,0x00,0x00,0x04,	// 125
+	0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x02,	// 126
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 127
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 128
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 129
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 130
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 131
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 132
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 133
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 134
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 135
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 136
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 137
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 138
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 139
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 140
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 141
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 142
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 143
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 144
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 145
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 146
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 147
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 148
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 149
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 150
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 151
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 152
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 153
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 154
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 155
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 156
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 157
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 158
+	0x00,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x02,0xF0,0xFF,0x03,	// 159
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFC,0x03,	// 161
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x30,0x00,0x40,0x60,0x00,0x40,0x40,0x00,0xF0,0xFF,0x01,0x40,0x40,0x00,0x80,0x20,	// 162
+	0x00,0x00,0x00,0x00,0x42,0x00,0x00,0x42,0x00,0xF0,0x7F,0x00,0x18,0x42,0x00,0x08,0x42,0x00,0x08,0x42,0x00,0x10,0x40,	// 163
+	0x00,0x00,0x00,0x40,0x10,0x00,0x80,0x0F,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x0F,0x00,0x40,0x10,	// 164
+	0x08,0x00,0x00,0x30,0x05,0x00,0x60,0x05,0x00,0x80,0x05,0x00,0x00,0x7E,0x00,0x80,0x05,0x00,0x60,0x05,0x00,0x30,0x05,0x00,0x08,	// 165
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xF3,0x03,	// 166
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0xF0,0x0C,0x01,0xC8,0x18,0x01,0x88,0x10,0x01,0x88,0x31,0x01,0x08,0xF1,0x00,0x00,0x0E,	// 167
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,	// 168
+	0x80,0x07,0x00,0x60,0x18,0x00,0xA0,0x17,0x00,0xD0,0x2C,0x00,0x50,0x28,0x00,0x50,0x28,0x00,0x50,0x28,0x00,0x20,0x10,0x00,0x60,0x18,0x00,0x80,0x07,	// 169
+	0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0x04,0x00,0x28,0x05,0x00,0x28,0x05,0x00,0x28,0x05,0x00,0xA8,0x04,0x00,0xF0,0x05,	// 170
+	0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x0A,0x00,0x00,0x1B,0x00,0x80,0x31,0x00,0x00,0x04,0x00,0x00,0x0A,0x00,0x00,0x1B,0x00,0x80,0x31,	// 171
+	0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x0F,	// 172
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,	// 173
+	0x80,0x07,0x00,0x60,0x18,0x00,0x20,0x10,0x00,0xD0,0x2F,0x00,0x50,0x21,0x00,0x50,0x23,0x00,0xD0,0x2C,0x00,0x20,0x10,0x00,0x60,0x18,0x00,0x80,0x07,	// 174
+	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,	// 175
+	0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x88,0x00,0x00,0x88,0x00,0x00,0x88,0x00,0x00,0x70,	// 176
+	0x00,0x00,0x00,0x00,0x41,0x00,0x00,0x41,0x00,0x00,0x41,0x00,0xE0,0x4F,0x00,0x00,0x41,0x00,0x00,0x41,0x00,0x00,0x41,	// 177
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x03,0x00,0x88,0x03,0x00,0xC8,0x02,0x00,0x70,0x02,	// 178
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x02,0x00,0x48,0x02,0x00,0x48,0x02,0x00,0x48,0x02,0x00,0xB0,0x01,	// 179
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x18,0x00,0x00,0x0C,0x00,0x00,0x04,	// 180
+	0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x20,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x20,0x00,0xC0,0x7F,0x00,0x00,0x40,	// 181
+	0x00,0x00,0x00,0xE0,0x00,0x00,0xF0,0x01,0x00,0xF8,0x03,0x00,0xF8,0x03,0x00,0xF8,0xFF,0x01,0x08,0x00,0x00,0x08,0x00,0x00,0xF8,0xFF,0x01,	// 182
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x03,	// 183
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x80,0x03,	// 184
+	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0xF8,0x03,0x00,0x00,0x02,0x00,0x00,0x02,	// 185
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x04,0x00,0x98,0x05,0x00,0x08,0x05,0x00,0x08,0x05,0x00,0x98,0x05,0x00,0xF0,0x04,	// 186
+	0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x31,0x00,0x00,0x1B,0x00,0x00,0x0A,0x00,0x00,0x04,0x00,0x80,0x31,0x00,0x00,0x1B,0x00,0x00,0x0A,0x00,0x00,0x04,	// 187
+	0x04,0x05,0x00,0x04,0x05,0x00,0xFC,0x03,0x00,0x00,0xC3,0x00,0x00,0xB3,0x00,0x00,0x8E,0x00,0x00,0xFE,0x01,0x00,0x81,0x00,0x00,0x01,	// 188
+	0x04,0x05,0x00,0x04,0x05,0x00,0xFC,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x86,0x01,0x00,0xC6,0x01,0x00,0x65,0x01,0x00,0x39,0x01,	// 189
+	0x00,0x04,0x00,0x04,0x05,0x00,0x24,0x03,0x00,0x24,0xC3,0x00,0x24,0xB3,0x00,0xD8,0x8E,0x00,0x00,0xFE,0x01,0x00,0x81,0x00,0x00,0x01,	// 190
+	0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x30,0x03,0x00,0x10,0x02,0xC0,0x0E,0x02,0x00,0x00,0x02,0x00,0x00,0x01,	// 191
+	0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x1E,0x00,0xE1,0x09,0x00,0x3B,0x08,0x00,0x3A,0x08,0x00,0xE0,0x09,0x00,0x00,0x1E,0x00,0x00,0x60,	// 192
+	0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x1E,0x00,0xE0,0x09,0x00,0x3A,0x08,0x00,0x3B,0x08,0x00,0xE1,0x09,0x00,0x00,0x1E,0x00,0x00,0x60,	// 193
+	0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x1E,0x00,0xE2,0x09,0x00,0x39,0x08,0x00,0x39,0x08,0x00,0xE2,0x09,0x00,0x00,0x1E,0x00,0x00,0x60,	// 194
+	0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x1E,0x00,0xE3,0x09,0x00,0x39,0x08,0x00,0x3A,0x08,0x00,0xE3,0x09,0x00,0x00,0x1E,0x00,0x00,0x60,	// 195
+	0x00,0x00,0x00,0x00,0x60,0x00,0x03,0x1E,0x00,0xE3,0x09,0x00,0x38,0x08,0x00,0x38,0x08,0x00,0xE3,0x09,0x00,0x03,0x1E,0x00,0x00,0x60,	// 196
+	0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x1E,0x00,0xC6,0x09,0x00,0x39,0x08,0x00,0x39,0x08,0x00,0xC6,0x09,0x00,0x00,0x1E,0x00,0x00,0x60,	// 197
+	0x00,0x60,0x00,0x00,0x1E,0x00,0xC0,0x0B,0x00,0x38,0x08,0x00,0x08,0x08,0x00,0xF8,0x7F,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,	// 198
+	0x00,0x00,0x00,0xC0,0x0F,0x00,0x30,0x30,0x00,0x10,0x20,0x00,0x08,0x40,0x02,0x08,0x40,0x02,0x08,0xC0,0x03,0x18,0x60,0x00,0x10,0x20,	// 199
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x08,0x41,0x00,0x09,0x41,0x00,0x0B,0x41,0x00,0x0A,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,	// 200
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x0A,0x41,0x00,0x0B,0x41,0x00,0x09,0x41,0x00,0x08,0x41,0x00,0x08,0x41,	// 201
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x0A,0x41,0x00,0x0B,0x41,0x00,0x09,0x41,0x00,0x0B,0x41,0x00,0x0A,0x41,0x00,0x08,0x41,0x00,0x08,0x41,	// 202
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x08,0x41,0x00,0x0B,0x41,0x00,0x0B,0x41,0x00,0x08,0x41,0x00,0x0B,0x41,0x00,0x0B,0x41,0x00,0x08,0x41,	// 203
+	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x00,0x09,0x40,0x00,0xFB,0x7F,0x00,0x0A,0x40,0x00,0x08,0x40,	// 204
+	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0xFA,0x7F,0x00,0x0B,0x40,0x00,0x09,0x40,	// 205
+	0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x40,0x00,0x0B,0x40,0x00,0xF9,0x7F,0x00,0x0B,0x40,0x00,0x0A,0x40,	// 206
+	0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x40,0x00,0x0B,0x40,0x00,0xF8,0x7F,0x00,0x0B,0x40,0x00,0x0B,0x40,	// 207
+	0x00,0x01,0x00,0xF8,0x7F,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x10,0x20,0x00,0x30,0x30,0x00,0xC0,0x0F,	// 208
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x18,0x00,0x00,0x63,0x00,0x00,0x81,0x01,0x00,0x02,0x06,0x00,0x03,0x18,0x00,0x00,0x60,0x00,0xF8,0x7F,	// 209
+	0x00,0x00,0x00,0xE0,0x1F,0x00,0x30,0x30,0x00,0x09,0x40,0x00,0x0B,0x40,0x00,0x0A,0x40,0x00,0x08,0x40,0x00,0x30,0x30,0x00,0xE0,0x1F,	// 210
+	0x00,0x00,0x00,0xE0,0x1F,0x00,0x30,0x30,0x00,0x08,0x40,0x00,0x0A,0x40,0x00,0x0B,0x40,0x00,0x09,0x40,0x00,0x30,0x30,0x00,0xE0,0x1F,	// 211
+	0x00,0x00,0x00,0xE0,0x1F,0x00,0x30,0x30,0x00,0x0A,0x40,0x00,0x09,0x40,0x00,0x09,0x40,0x00,0x0A,0x40,0x00,0x30,0x30,0x00,0xE0,0x1F,	// 212
+	0x00,0x00,0x00,0xE0,0x1F,0x00,0x30,0x30,0x00,0x0B,0x40,0x00,0x09,0x40,0x00,0x0A,0x40,0x00,0x0B,0x40,0x00,0x30,0x30,0x00,0xE0,0x1F,	// 213
+	0x00,0x00,0x00,0xE0,0x1F,0x00,0x33,0x30,0x00,0x0B,0x40,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x0B,0x40,0x00,0x33,0x30,0x00,0xE0,0x1F,	// 214
+	0x00,0x00,0x00,0x40,0x10,0x00,0x80,0x08,0x00,0x00,0x05,0x00,0x00,0x02,0x00,0x00,0x05,0x00,0x80,0x08,0x00,0x40,0x10,	// 215
+	0x00,0x40,0x00,0xC0,0x3F,0x00,0x30,0x78,0x00,0x08,0x44,0x00,0x08,0x42,0x00,0x88,0x41,0x00,0xC8,0x40,0x00,0x78,0x30,0x00,0xF8,0x0F,	// 216
+	0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x20,0x00,0x01,0x40,0x00,0x03,0x40,0x00,0x02,0x40,0x00,0x00,0x40,0x00,0x00,0x20,0x00,0xF8,0x1F,	// 217
+	0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x02,0x40,0x00,0x03,0x40,0x00,0x01,0x40,0x00,0x00,0x20,0x00,0xF8,0x1F,	// 218
+	0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x20,0x00,0x02,0x40,0x00,0x01,0x40,0x00,0x01,0x40,0x00,0x02,0x40,0x00,0x00,0x20,0x00,0xF8,0x1F,	// 219
+	0x00,0x00,0x00,0xF8,0x1F,0x00,0x03,0x20,0x00,0x03,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x03,0x40,0x00,0x03,0x20,0x00,0xF8,0x1F,	// 220
+	0x08,0x00,0x00,0x10,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x02,0x7E,0x00,0x83,0x01,0x00,0x61,0x00,0x00,0x10,0x00,0x00,0x08,	// 221
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x20,0x08,0x00,0x20,0x08,0x00,0x20,0x08,0x00,0x20,0x08,0x00,0x20,0x08,0x00,0x40,0x04,0x00,0xC0,0x07,	// 222
+	0x00,0x00,0x00,0xF0,0x7F,0x00,0x18,0x00,0x00,0x08,0x40,0x00,0x88,0x43,0x00,0x48,0x46,0x00,0x58,0x44,0x00,0x30,0x4C,0x00,0x00,0x38,	// 223
+	0x00,0x00,0x00,0x00,0x3C,0x00,0x84,0x64,0x00,0x4C,0x42,0x00,0x58,0x42,0x00,0x50,0x42,0x00,0x40,0x62,0x00,0xC0,0x32,0x00,0x80,0x7F,	// 224
+	0x00,0x00,0x00,0x00,0x3C,0x00,0x80,0x64,0x00,0x40,0x42,0x00,0x50,0x42,0x00,0x58,0x42,0x00,0x4C,0x62,0x00,0xC4,0x32,0x00,0x80,0x7F,	// 225
+	0x00,0x00,0x00,0x00,0x3C,0x00,0x90,0x64,0x00,0x48,0x42,0x00,0x44,0x42,0x00,0x48,0x42,0x00,0x50,0x62,0x00,0xC0,0x32,0x00,0x80,0x7F,	// 226
+	0x00,0x00,0x00,0x00,0x3C,0x00,0x98,0x64,0x00,0x48,0x42,0x00,0x58,0x42,0x00,0x50,0x42,0x00,0x58,0x62,0x00,0xC0,0x32,0x00,0x80,0x7F,	// 227
+	0x00,0x00,0x00,0x00,0x3C,0x00,0x80,0x64,0x00,0x58,0x42,0x00,0x58,0x42,0x00,0x40,0x42,0x00,0x58,0x62,0x00,0xD8,0x32,0x00,0x80,0x7F,	// 228
+	0x00,0x00,0x00,0x00,0x3C,0x00,0x80,0x64,0x00,0x4C,0x42,0x00,0x52,0x42,0x00,0x52,0x42,0x00,0x4C,0x62,0x00,0xC0,0x32,0x00,0x80,0x7F,	// 229
+	0x00,0x00,0x00,0x00,0x38,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x80,0x3F,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x80,0x27,	// 230
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x20,0x00,0x40,0x40,0x00,0x40,0x40,0x02,0x40,0x40,0x02,0x40,0xC0,0x03,0x80,0x20,	// 231
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x84,0x24,0x00,0x4C,0x44,0x00,0x58,0x44,0x00,0x50,0x44,0x00,0x40,0x44,0x00,0x80,0x44,0x00,0x00,0x27,	// 232
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x24,0x00,0x40,0x44,0x00,0x50,0x44,0x00,0x58,0x44,0x00,0x4C,0x44,0x00,0x84,0x44,0x00,0x00,0x27,	// 233
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x90,0x24,0x00,0x48,0x44,0x00,0x44,0x44,0x00,0x48,0x44,0x00,0x50,0x44,0x00,0x80,0x44,0x00,0x00,0x27,	// 234
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x24,0x00,0x58,0x44,0x00,0x58,0x44,0x00,0x40,0x44,0x00,0x58,0x44,0x00,0x98,0x44,0x00,0x00,0x27,	// 235
+	0x00,0x00,0x00,0x00,0x40,0x00,0x44,0x40,0x00,0x4C,0x40,0x00,0xD8,0x7F,0x00,0x10,0x40,0x00,0x00,0x40,0x00,0x00,0x40,	// 236
+	0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0xD0,0x7F,0x00,0x18,0x40,0x00,0x0C,0x40,0x00,0x04,0x40,	// 237
+	0x00,0x00,0x00,0x00,0x40,0x00,0x50,0x40,0x00,0x48,0x40,0x00,0xC4,0x7F,0x00,0x08,0x40,0x00,0x10,0x40,0x00,0x00,0x40,	// 238
+	0x00,0x00,0x00,0x00,0x40,0x00,0x58,0x40,0x00,0x58,0x40,0x00,0xC0,0x7F,0x00,0x18,0x40,0x00,0x18,0x40,0x00,0x00,0x40,	// 239
+	0x00,0x00,0x00,0x00,0x1F,0x00,0xA0,0x20,0x00,0x58,0x40,0x00,0x58,0x40,0x00,0x50,0x40,0x00,0x70,0x40,0x00,0xC8,0x20,0x00,0x00,0x1F,	// 240
+	0x00,0x00,0x00,0xC0,0x7F,0x00,0x98,0x00,0x00,0x48,0x00,0x00,0x58,0x00,0x00,0x50,0x00,0x00,0x58,0x00,0x00,0xC0,0x00,0x00,0x80,0x7F,	// 241
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x84,0x20,0x00,0x4C,0x40,0x00,0x58,0x40,0x00,0x50,0x40,0x00,0x40,0x40,0x00,0x80,0x20,0x00,0x00,0x1F,	// 242
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x20,0x00,0x40,0x40,0x00,0x50,0x40,0x00,0x58,0x40,0x00,0x4C,0x40,0x00,0x84,0x20,0x00,0x00,0x1F,	// 243
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x20,0x00,0x50,0x40,0x00,0x4C,0x40,0x00,0x4C,0x40,0x00,0x50,0x40,0x00,0x80,0x20,0x00,0x00,0x1F,	// 244
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x20,0x00,0x58,0x40,0x00,0x48,0x40,0x00,0x50,0x40,0x00,0x58,0x40,0x00,0x80,0x20,0x00,0x00,0x1F,	// 245
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x98,0x20,0x00,0x58,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x58,0x40,0x00,0x98,0x20,0x00,0x00,0x1F,	// 246
+	0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x80,0x35,0x00,0x80,0x35,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,	// 247
+	0x00,0x00,0x00,0x00,0x7F,0x00,0x80,0x70,0x00,0x40,0x58,0x00,0x40,0x4C,0x00,0x40,0x46,0x00,0x40,0x43,0x00,0xC0,0x21,0x00,0xC0,0x1F,	// 248
+	0x00,0x00,0x00,0xC0,0x3F,0x00,0x04,0x60,0x00,0x0C,0x40,0x00,0x18,0x40,0x00,0x10,0x40,0x00,0x00,0x40,0x00,0x00,0x20,0x00,0xC0,0x7F,	// 249
+	0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x10,0x40,0x00,0x18,0x40,0x00,0x0C,0x40,0x00,0x04,0x20,0x00,0xC0,0x7F,	// 250
+	0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x60,0x00,0x10,0x40,0x00,0x0C,0x40,0x00,0x0C,0x40,0x00,0x10,0x40,0x00,0x00,0x20,0x00,0xC0,0x7F,	// 251
+	0x00,0x00,0x00,0xC0,0x3F,0x00,0x18,0x60,0x00,0x18,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x18,0x40,0x00,0x18,0x20,0x00,0xC0,0x7F,	// 252
+	0x00,0x00,0x00,0x40,0x00,0x00,0x80,0x03,0x02,0x00,0x0C,0x02,0x10,0x70,0x03,0x18,0xE0,0x00,0x0C,0x1C,0x00,0x84,0x03,0x00,0x40,	// 253
+	0x00,0x00,0x00,0xF8,0xFF,0x03,0x80,0x20,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x80,0x20,0x00,0x00,0x1F,	// 254
+	0x00,0x00,0x00,0x40,0x00,0x00,0x80,0x03,0x02,0x18,0x0C,0x02,0x18,0x70,0x03,0x00,0xE0,0x00,0x18,0x1C,0x00,0x98,0x03,0x00,0x40	// 255
+};
+// Created by http://oleddisplay.squix.ch/ Consider a donation
+// In case of problems make sure that you are using the font file with the correct version!
+const uint8_t Lato_Hairline_12[] PROGMEM = {
+	0x0C, // Width: 12
+	0x0F, // Height: 15
+	0x20, // First Char: 32
+	0xE0, // Numbers of Chars: 224
+
+	// Jump Table:
+	0xFF, 0xFF, 0x00, 0x03,  // 32:65535
+	0x00, 0x00, 0x04, 0x03,  // 33:0
+	0x00, 0x04, 0x05, 0x04,  // 34:4
+	0x00, 0x09, 0x0C, 0x07,  // 35:9
+	0x00, 0x15, 0x0C, 0x07,  // 36:21
+	0x00, 0x21, 0x10, 0x09,  // 37:33
+	0x00, 0x31, 0x10, 0x08,  // 38:49
+	0x00, 0x41, 0x03, 0x02,  // 39:65
+	0x00, 0x44, 0x06, 0x03,  // 40:68
+	0x00, 0x4A, 0x04, 0x03,  // 41:74
+	0x00, 0x4E, 0x07, 0x05,  // 42:78
+	0x00, 0x55, 0x0C, 0x07,  // 43:85
+	0x00, 0x61, 0x04, 0x03,  // 44:97
+	0x00, 0x65, 0x08, 0x04,  // 45:101
+	0x00, 0x6D, 0x04, 0x03,  // 46:109
+	0x00, 0x71, 0x09, 0x05,  // 47:113
+	0x00, 0x7A, 0x0C, 0x07,  // 48:122
+	0x00, 0x86, 0x0C, 0x07,  // 49:134
+	0x00, 0x92, 0x0C, 0x07,  // 50:146
+	0x00, 0x9E, 0x0C, 0x07,  // 51:158
+	0x00, 0xAA, 0x0E, 0x07,  // 52:170
+	0x00, 0xB8, 0x0C, 0x07,  // 53:184
+	0x00, 0xC4, 0x0C, 0x07,  // 54:196
+	0x00, 0xD0, 0x0B, 0x07,  // 55:208
+	0x00, 0xDB, 0x0C, 0x07,  // 56:219
+	0x00, 0xE7, 0x0B, 0x07,  // 57:231
+	0x00, 0xF2, 0x04, 0x03,  // 58:242
+	0x00, 0xF6, 0x04, 0x03,  // 59:246
+	0x00, 0xFA, 0x0A, 0x07,  // 60:250
+	0x01, 0x04, 0x0C, 0x07,  // 61:260
+	0x01, 0x10, 0x0C, 0x07,  // 62:272
+	0x01, 0x1C, 0x07, 0x05,  // 63:284
+	0x01, 0x23, 0x12, 0x0A,  // 64:291
+	0x01, 0x35, 0x0E, 0x08,  // 65:309
+	0x01, 0x43, 0x0E, 0x07,  // 66:323
+	0x01, 0x51, 0x10, 0x08,  // 67:337
+	0x01, 0x61, 0x10, 0x09,  // 68:353
+	0x01, 0x71, 0x0C, 0x07,  // 69:369
+	0x01, 0x7D, 0x0B, 0x07,  // 70:381
+	0x01, 0x88, 0x10, 0x09,  // 71:392
+	0x01, 0x98, 0x10, 0x09,  // 72:408
+	0x01, 0xA8, 0x04, 0x03,  // 73:424
+	0x01, 0xAC, 0x08, 0x05,  // 74:428
+	0x01, 0xB4, 0x0E, 0x07,  // 75:436
+	0x01, 0xC2, 0x0C, 0x06,  // 76:450
+	0x01, 0xCE, 0x12, 0x0B,  // 77:462
+	0x01, 0xE0, 0x10, 0x09,  // 78:480
+	0x01, 0xF0, 0x12, 0x09,  // 79:496
+	0x02, 0x02, 0x0B, 0x07,  // 80:514
+	0x02, 0x0D, 0x12, 0x09,  // 81:525
+	0x02, 0x1F, 0x0E, 0x07,  // 82:543
+	0x02, 0x2D, 0x0C, 0x06,  // 83:557
+	0x02, 0x39, 0x0D, 0x07,  // 84:569
+	0x02, 0x46, 0x0E, 0x09,  // 85:582
+	0x02, 0x54, 0x0D, 0x08,  // 86:596
+	0x02, 0x61, 0x17, 0x0C,  // 87:609
+	0x02, 0x78, 0x0E, 0x07,  // 88:632
+	0x02, 0x86, 0x0D, 0x07,  // 89:646
+	0x02, 0x93, 0x0E, 0x07,  // 90:659
+	0x02, 0xA1, 0x06, 0x03,  // 91:673
+	0x02, 0xA7, 0x0A, 0x05,  // 92:679
+	0x02, 0xB1, 0x04, 0x03,  // 93:689
+	0x02, 0xB5, 0x0B, 0x07,  // 94:693
+	0x02, 0xC0, 0x0A, 0x05,  // 95:704
+	0x02, 0xCA, 0x05, 0x05,  // 96:714
+	0x02, 0xCF, 0x0A, 0x06,  // 97:719
+	0x02, 0xD9, 0x0C, 0x07,  // 98:729
+	0x02, 0xE5, 0x0A, 0x06,  // 99:741
+	0x02, 0xEF, 0x0A, 0x07,  // 100:751
+	0x02, 0xF9, 0x0C, 0x06,  // 101:761
+	0x03, 0x05, 0x07, 0x04,  // 102:773
+	0x03, 0x0C, 0x0C, 0x06,  // 103:780
+	0x03, 0x18, 0x0A, 0x07,  // 104:792
+	0x03, 0x22, 0x04, 0x03,  // 105:802
+	0x03, 0x26, 0x04, 0x03,  // 106:806
+	0x03, 0x2A, 0x0A, 0x05,  // 107:810
+	0x03, 0x34, 0x04, 0x03,  // 108:820
+	0x03, 0x38, 0x10, 0x09,  // 109:824
+	0x03, 0x48, 0x0A, 0x07,  // 110:840
+	0x03, 0x52, 0x0C, 0x07,  // 111:850
+	0x03, 0x5E, 0x0C, 0x07,  // 112:862
+	0x03, 0x6A, 0x0A, 0x07,  // 113:874
+	0x03, 0x74, 0x07, 0x04,  // 114:884
+	0x03, 0x7B, 0x08, 0x05,  // 115:891
+	0x03, 0x83, 0x08, 0x04,  // 116:899
+	0x03, 0x8B, 0x0A, 0x07,  // 117:907
+	0x03, 0x95, 0x0B, 0x06,  // 118:917
+	0x03, 0xA0, 0x11, 0x09,  // 119:928
+	0x03, 0xB1, 0x0A, 0x05,  // 120:945
+	0x03, 0xBB, 0x0B, 0x06,  // 121:955
+	0x03, 0xC6, 0x0A, 0x05,  // 122:966
+	0x03, 0xD0, 0x06, 0x03,  // 123:976
+	0x03, 0xD6, 0x04, 0x03,  // 124:982
+	0x03, 0xDA, 0x06, 0x03,  // 125:986
+	0x03, 0xE0, 0x0B, 0x07,  // 126:992
+	0x03, 0xEB, 0x0C, 0x06,  // 127:1003
+	0x03, 0xF7, 0x0C, 0x06,  // 128:1015
+	0x04, 0x03, 0x0C, 0x06,  // 129:1027
+	0x04, 0x0F, 0x0C, 0x06,  // 130:1039
+	0x04, 0x1B, 0x0C, 0x06,  // 131:1051
+	0x04, 0x27, 0x0C, 0x06,  // 132:1063
+	0x04, 0x33, 0x0C, 0x06,  // 133:1075
+	0x04, 0x3F, 0x0C, 0x06,  // 134:1087
+	0x04, 0x4B, 0x0C, 0x06,  // 135:1099
+	0x04, 0x57, 0x0C, 0x06,  // 136:1111
+	0x04, 0x63, 0x0C, 0x06,  // 137:1123
+	0x04, 0x6F, 0x0C, 0x06,  // 138:1135
+	0x04, 0x7B, 0x0C, 0x06,  // 139:1147
+	0x04, 0x87, 0x0C, 0x06,  // 140:1159
+	0x04, 0x93, 0x0C, 0x06,  // 141:1171
+	0x04, 0x9F, 0x0C, 0x06,  // 142:1183
+	0x04, 0xAB, 0x0C, 0x06,  // 143:1195
+	0x04, 0xB7, 0x0C, 0x06,  // 144:1207
+	0x04, 0xC3, 0x0C, 0x06,  // 145:1219
+	0x04, 0xCF, 0x0C, 0x06,  // 146:1231
+	0x04, 0xDB, 0x0C, 0x06,  // 147:1243
+	0x04, 0xE7, 0x0C, 0x06,  // 148:1255
+	0x04, 0xF3, 0x0C, 0x06,  // 149:1267
+	0x04, 0xFF, 0x0C, 0x06,  // 150:1279
+	0x05, 0x0B, 0x0C, 0x06,  // 151:1291
+	0x05, 0x17, 0x0C, 0x06,  // 152:1303
+	0x05, 0x23, 0x0C, 0x06,  // 153:1315
+	0x05, 0x2F, 0x0C, 0x06,  // 154:1327
+	0x05, 0x3B, 0x0C, 0x06,  // 155:1339
+	0x05, 0x47, 0x0C, 0x06,  // 156:1351
+	0x05, 0x53, 0x0C, 0x06,  // 157:1363
+	0x05, 0x5F, 0x0C, 0x06,  // 158:1375
+	0x05, 0x6B, 0x0C, 0x06,  // 159:1387
+	0xFF, 0xFF, 0x00, 0x03,  // 160:65535
+	0x05, 0x77, 0x04, 0x03,  // 161:1399
+	0x05, 0x7B, 0x0C, 0x07,  // 162:1403
+	0x05, 0x87, 0x0E, 0x07,  // 163:1415
+	0x05, 0x95, 0x0C, 0x07,  // 164:1429
+	0x05, 0xA1, 0x0C, 0x07,  // 165:1441
+	0x05, 0xAD, 0x04, 0x03,  // 166:1453
+	0x05, 0xB1, 0x0A, 0x06,  // 167:1457
+	0x05, 0xBB, 0x07, 0x05,  // 168:1467
+	0x05, 0xC2, 0x12, 0x0A,  // 169:1474
+	0x05, 0xD4, 0x05, 0x04,  // 170:1492
+	0x05, 0xD9, 0x08, 0x04,  // 171:1497
+	0x05, 0xE1, 0x0C, 0x07,  // 172:1505
+	0x05, 0xED, 0x08, 0x04,  // 173:1517
+	0x05, 0xF5, 0x12, 0x0A,  // 174:1525
+	0x06, 0x07, 0x07, 0x05,  // 175:1543
+	0x06, 0x0E, 0x07, 0x05,  // 176:1550
+	0x06, 0x15, 0x0C, 0x07,  // 177:1557
+	0x06, 0x21, 0x05, 0x04,  // 178:1569
+	0x06, 0x26, 0x05, 0x04,  // 179:1574
+	0x06, 0x2B, 0x05, 0x05,  // 180:1579
+	0x06, 0x30, 0x0E, 0x08,  // 181:1584
+	0x06, 0x3E, 0x0D, 0x07,  // 182:1598
+	0x06, 0x4B, 0x04, 0x03,  // 183:1611
+	0x06, 0x4F, 0x06, 0x05,  // 184:1615
+	0x06, 0x55, 0x05, 0x04,  // 185:1621
+	0x06, 0x5A, 0x07, 0x05,  // 186:1626
+	0x06, 0x61, 0x08, 0x04,  // 187:1633
+	0x06, 0x69, 0x10, 0x09,  // 188:1641
+	0x06, 0x79, 0x10, 0x08,  // 189:1657
+	0x06, 0x89, 0x10, 0x09,  // 190:1673
+	0x06, 0x99, 0x08, 0x05,  // 191:1689
+	0x06, 0xA1, 0x0E, 0x08,  // 192:1697
+	0x06, 0xAF, 0x0E, 0x08,  // 193:1711
+	0x06, 0xBD, 0x0E, 0x08,  // 194:1725
+	0x06, 0xCB, 0x0E, 0x08,  // 195:1739
+	0x06, 0xD9, 0x0E, 0x08,  // 196:1753
+	0x06, 0xE7, 0x0E, 0x08,  // 197:1767
+	0x06, 0xF5, 0x14, 0x0B,  // 198:1781
+	0x07, 0x09, 0x10, 0x08,  // 199:1801
+	0x07, 0x19, 0x0C, 0x07,  // 200:1817
+	0x07, 0x25, 0x0C, 0x07,  // 201:1829
+	0x07, 0x31, 0x0C, 0x07,  // 202:1841
+	0x07, 0x3D, 0x0C, 0x07,  // 203:1853
+	0x07, 0x49, 0x04, 0x03,  // 204:1865
+	0x07, 0x4D, 0x05, 0x03,  // 205:1869
+	0x07, 0x52, 0x05, 0x03,  // 206:1874
+	0x07, 0x57, 0x05, 0x03,  // 207:1879
+	0x07, 0x5C, 0x10, 0x09,  // 208:1884
+	0x07, 0x6C, 0x10, 0x09,  // 209:1900
+	0x07, 0x7C, 0x12, 0x09,  // 210:1916
+	0x07, 0x8E, 0x12, 0x09,  // 211:1934
+	0x07, 0xA0, 0x12, 0x09,  // 212:1952
+	0x07, 0xB2, 0x12, 0x09,  // 213:1970
+	0x07, 0xC4, 0x12, 0x09,  // 214:1988
+	0x07, 0xD6, 0x0C, 0x07,  // 215:2006
+	0x07, 0xE2, 0x12, 0x09,  // 216:2018
+	0x07, 0xF4, 0x0E, 0x09,  // 217:2036
+	0x08, 0x02, 0x0E, 0x09,  // 218:2050
+	0x08, 0x10, 0x0E, 0x09,  // 219:2064
+	0x08, 0x1E, 0x0E, 0x09,  // 220:2078
+	0x08, 0x2C, 0x0D, 0x07,  // 221:2092
+	0x08, 0x39, 0x0C, 0x07,  // 222:2105
+	0x08, 0x45, 0x0C, 0x06,  // 223:2117
+	0x08, 0x51, 0x0A, 0x06,  // 224:2129
+	0x08, 0x5B, 0x0A, 0x06,  // 225:2139
+	0x08, 0x65, 0x0A, 0x06,  // 226:2149
+	0x08, 0x6F, 0x0A, 0x06,  // 227:2159
+	0x08, 0x79, 0x0A, 0x06,  // 228:2169
+	0x08, 0x83, 0x0A, 0x06,  // 229:2179
+	0x08, 0x8D, 0x12, 0x0A,  // 230:2189
+	0x08, 0x9F, 0x0A, 0x06,  // 231:2207
+	0x08, 0xA9, 0x0C, 0x06,  // 232:2217
+	0x08, 0xB5, 0x0C, 0x06,  // 233:2229
+	0x08, 0xC1, 0x0C, 0x06,  // 234:2241
+	0x08, 0xCD, 0x0C, 0x06,  // 235:2253
+	0x08, 0xD9, 0x04, 0x03,  // 236:2265
+	0x08, 0xDD, 0x04, 0x03,  // 237:2269
+	0x08, 0xE1, 0x05, 0x03,  // 238:2273
+	0x08, 0xE6, 0x04, 0x03,  // 239:2278
+	0x08, 0xEA, 0x0C, 0x07,  // 240:2282
+	0x08, 0xF6, 0x0A, 0x07,  // 241:2294
+	0x09, 0x00, 0x0C, 0x07,  // 242:2304
+	0x09, 0x0C, 0x0C, 0x07,  // 243:2316
+	0x09, 0x18, 0x0C, 0x07,  // 244:2328
+	0x09, 0x24, 0x0C, 0x07,  // 245:2340
+	0x09, 0x30, 0x0C, 0x07,  // 246:2352
+	0x09, 0x3C, 0x0C, 0x07,  // 247:2364
+	0x09, 0x48, 0x0C, 0x07,  // 248:2376
+	0x09, 0x54, 0x0A, 0x07,  // 249:2388
+	0x09, 0x5E, 0x0A, 0x07,  // 250:2398
+	0x09, 0x68, 0x0A, 0x07,  // 251:2408
+	0x09, 0x72, 0x0A, 0x07,  // 252:2418
+	0x09, 0x7C, 0x0B, 0x06,  // 253:2428
+	0x09, 0x87, 0x0C, 0x07,  // 254:2439
+	0x09, 0x93, 0x0B, 0x06,  // 255:2451
+
+	// Font Data:
+	0x00,0x00,0xF0,0x0B,	// 33
+	0x00,0x00,0x70,0x00,0x70,	// 34
+	0x00,0x00,0x40,0x0E,0xE0,0x03,0x50,0x0A,0xC0,0x07,0x30,0x02,	// 35
+	0x00,0x00,0x60,0x08,0x90,0x08,0xFC,0x1F,0x10,0x09,0x10,0x07,	// 36
+	0x00,0x00,0x70,0x08,0x90,0x04,0x70,0x02,0x80,0x01,0x40,0x0F,0xA0,0x08,0x10,0x0F,	// 37
+	0x00,0x00,0x00,0x0F,0xF0,0x08,0x10,0x09,0x10,0x09,0x10,0x0A,0x00,0x07,0x00,0x08,	// 38
+	0x00,0x00,0x70,	// 39
+	0x00,0x00,0xF0,0x1F,0x08,0x10,	// 40
+	0x08,0x10,0xF0,0x1F,	// 41
+	0x00,0x00,0x18,0x00,0x38,0x00,0x18,	// 42
+	0x00,0x00,0x00,0x01,0x00,0x01,0xE0,0x07,0x00,0x01,0x00,0x01,	// 43
+	0x00,0x00,0x00,0x18,	// 44
+	0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,	// 45
+	0x00,0x00,0x00,0x08,	// 46
+	0x00,0x00,0x00,0x0E,0xC0,0x01,0x30,0x00,0x08,	// 47
+	0x00,0x00,0xE0,0x0F,0x10,0x08,0x10,0x08,0x10,0x08,0xE0,0x07,	// 48 0
+	0x00,0x00,0x40,0x00,0x20,0x08,0xF0,0x0F,0x00,0x08,0x00,0x00,	// 49 1
+	//0x00,0x00,0x40,0x00,0x20,0x08,0xF0,0x0F,0x00,0x08,0x00,0x08,	// 49 1
+	0x00,0x00,0x20,0x08,0x10,0x0C,0x10,0x0A,0x10,0x09,0xE0,0x08,	// 50 2
+	//0x00,0x00,0x20,0x08,0x10,0x0C,0x10,0x0A,0x10,0x09,0xF0,0x08,	// 50 2
+	0x00,0x00,0x30,0x0C,0x10,0x08,0x90,0x08,0x90,0x08,0x70,0x07,	// 51 3
+	0x00,0x02,0x80,0x03,0x40,0x02,0x20,0x02,0xF0,0x0F,0x00,0x02,0x00,0x02,	// 52 4
+	0x00,0x00,0x60,0x08,0x50,0x08,0x50,0x08,0x50,0x08,0x90,0x07,	// 53 5
+	0x00,0x00,0x80,0x0F,0xC0,0x08,0xA0,0x08,0x90,0x08,0x00,0x0F,	// 54 6
+	0x00,0x00,0x10,0x00,0x10,0x0C,0x10,0x03,0xD0,0x00,0x30,	// 55 7
+	0x00,0x00,0x70,0x0F,0x90,0x08,0x90,0x08,0x90,0x08,0x70,0x0F,	// 56 8
+	//0x00,0x00,0xF0,0x00,0x10,0x09,0x10,0x05,0x10,0x03,0xE0,	// 57 9
+	0x00,0x00,0xE0,0x00,0x10,0x09,0x10,0x05,0x10,0x03,0xE0,	// 57 9
+	0x00,0x00,0x40,0x08,	// 58
+	0x00,0x00,0x40,0x18,	// 59
+	0x00,0x00,0x00,0x01,0x80,0x01,0x40,0x02,0x40,0x02,	// 60
+	0x00,0x00,0x40,0x01,0x40,0x01,0x40,0x01,0x40,0x01,0x40,0x01,	// 61
+	0x00,0x00,0x40,0x02,0x40,0x02,0x40,0x02,0x80,0x01,0x00,0x01,	// 62
+	0x00,0x00,0x10,0x00,0x90,0x09,0x70,	// 63
+	0x00,0x00,0xC0,0x0F,0x20,0x10,0x90,0x23,0x50,0x24,0x50,0x22,0x90,0x25,0x20,0x24,0xE0,0x13,	// 64
+	0x00,0x08,0x00,0x07,0xC0,0x02,0x30,0x02,0x60,0x02,0x80,0x03,0x00,0x0C,	// 65
+	0x00,0x00,0xF0,0x0F,0x90,0x08,0x90,0x08,0x90,0x08,0xD0,0x08,0x20,0x07,	// 66
+	0x00,0x00,0xE0,0x07,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,	// 67
+	0x00,0x00,0xF0,0x0F,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0xE0,0x07,	// 68
+	0x00,0x00,0xF0,0x0F,0x90,0x08,0x90,0x08,0x90,0x08,0x90,0x08,	// 69
+	0x00,0x00,0xF0,0x0F,0x90,0x00,0x90,0x00,0x90,0x00,0x90,	// 70
+	0x00,0x00,0xE0,0x07,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x09,0x10,0x0F,	// 71
+	0x00,0x00,0xF0,0x0F,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xF0,0x0F,	// 72
+	0x00,0x00,0xF0,0x0F,	// 73
+	0x00,0x08,0x00,0x08,0x00,0x08,0xF0,0x07,	// 74
+	0x00,0x00,0xF0,0x0F,0x80,0x00,0x40,0x01,0x20,0x02,0x20,0x04,0x10,0x08,	// 75
+	0x00,0x00,0xF0,0x0F,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,	// 76
+	0x00,0x00,0xF0,0x0F,0x20,0x00,0xC0,0x00,0x00,0x03,0x00,0x02,0x00,0x01,0xC0,0x00,0xF0,0x0F,	// 77
+	0x00,0x00,0xF0,0x0F,0x20,0x00,0xC0,0x00,0x00,0x01,0x00,0x02,0x00,0x04,0xF0,0x0F,	// 78
+	0x00,0x00,0xE0,0x07,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x20,0x04,0xC0,0x03,	// 79
+	0x00,0x00,0xF0,0x0F,0x10,0x01,0x10,0x01,0x10,0x01,0xF0,	// 80
+	0x00,0x00,0xE0,0x07,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x20,0x14,0xC0,0x23,	// 81
+	0x00,0x00,0xF0,0x0F,0x90,0x00,0x90,0x00,0x90,0x03,0x70,0x04,0x00,0x08,	// 82
+	0x00,0x00,0x70,0x08,0x90,0x08,0x90,0x08,0x10,0x09,0x00,0x06,	// 83
+	0x10,0x00,0x10,0x00,0x10,0x00,0xF0,0x0F,0x10,0x00,0x10,0x00,0x10,	// 84
+	0x00,0x00,0xF0,0x07,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0xF0,0x07,	// 85
+	0x30,0x00,0xC0,0x00,0x00,0x03,0x00,0x0C,0x00,0x06,0x80,0x01,0x70,	// 86
+	0x30,0x00,0xC0,0x01,0x00,0x0E,0x00,0x04,0x80,0x03,0x70,0x00,0x60,0x00,0x80,0x01,0x00,0x0E,0x00,0x02,0xC0,0x01,0x30,	// 87
+	0x10,0x08,0x20,0x04,0x40,0x02,0x80,0x01,0x40,0x02,0x20,0x04,0x10,0x08,	// 88
+	0x10,0x00,0x60,0x00,0x80,0x00,0x00,0x0F,0xC0,0x00,0x20,0x00,0x10,	// 89
+	0x00,0x00,0x10,0x0C,0x10,0x0A,0x90,0x09,0x50,0x08,0x30,0x08,0x10,0x08,	// 90
+	0x00,0x00,0xF8,0x3F,0x08,0x20,	// 91
+	0x00,0x00,0x38,0x00,0xC0,0x01,0x00,0x06,0x00,0x08,	// 92
+	0x00,0x00,0xF8,0x3F,	// 93
+	0x00,0x00,0x80,0x00,0x60,0x00,0x10,0x00,0x60,0x00,0x80,	// 94
+	0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,	// 95
+	0x00,0x00,0x10,0x00,0x10,	// 96
+	0x00,0x00,0x40,0x0E,0x40,0x09,0x40,0x09,0xC0,0x0F,	// 97
+	0x00,0x00,0xF8,0x0F,0x40,0x08,0x40,0x08,0x40,0x08,0x80,0x07,	// 98
+	0x00,0x00,0xC0,0x0F,0x40,0x08,0x40,0x08,0x40,0x08,	// 99
+	0x00,0x00,0xC0,0x0F,0x40,0x08,0x40,0x08,0xF8,0x0F,	// 100
+	0x00,0x00,0xC0,0x0F,0x40,0x09,0x40,0x09,0x40,0x09,0x80,0x01,	// 101
+	0x40,0x00,0xF0,0x0F,0x50,0x00,0x50,	// 102
+	0x00,0x00,0xC0,0x35,0x40,0x2A,0x40,0x2A,0xC0,0x29,0x40,0x10,	// 103
+	0x00,0x00,0xF8,0x0F,0x40,0x00,0x40,0x00,0xC0,0x0F,	// 104
+	0x00,0x00,0xD0,0x0F,	// 105
+	0x00,0x20,0xD0,0x3F,	// 106
+	0x00,0x00,0xF8,0x0F,0x80,0x02,0x80,0x04,0x40,0x08,	// 107
+	0x00,0x00,0xF8,0x0F,	// 108
+	0x00,0x00,0xC0,0x0F,0x40,0x00,0x40,0x00,0xC0,0x0F,0x40,0x00,0x40,0x00,0xC0,0x0F,	// 109
+	0x00,0x00,0xC0,0x0F,0x40,0x00,0x40,0x00,0xC0,0x0F,	// 110
+	0x00,0x00,0x80,0x07,0x40,0x08,0x40,0x08,0x40,0x08,0x80,0x07,	// 111 o
+	//0x00,0x00,0xC0,0x07,0x40,0x08,0x40,0x08,0x40,0x08,0x80,0x07,	// 111 o
+	0x00,0x00,0xC0,0x3F,0x40,0x08,0x40,0x08,0x40,0x08,0x80,0x07,	// 112
+	0x00,0x00,0xC0,0x0F,0x40,0x08,0x40,0x08,0xC0,0x3F,	// 113
+	0x00,0x00,0xC0,0x0F,0x40,0x00,0x40,	// 114
+	0x00,0x00,0xC0,0x09,0x40,0x09,0x40,0x0E,	// 115
+	0x40,0x00,0xF0,0x0F,0x40,0x08,0x40,0x08,	// 116
+	0x00,0x00,0xC0,0x0F,0x00,0x08,0x00,0x08,0xC0,0x0F,	// 117
+	0x40,0x00,0x80,0x03,0x00,0x0C,0x00,0x06,0x80,0x01,0x40,	// 118
+	0xC0,0x00,0x00,0x07,0x00,0x0C,0x80,0x03,0xC0,0x00,0x00,0x07,0x00,0x0C,0x80,0x03,0x40,	// 119
+	0x40,0x08,0x80,0x04,0x00,0x03,0x80,0x04,0x40,0x08,	// 120
+	0x40,0x00,0x80,0x03,0x00,0x3C,0x00,0x06,0x80,0x01,0x40,	// 121
+	0x00,0x08,0x40,0x0C,0x40,0x0B,0xC0,0x08,0x40,0x08,	// 122
+	0x00,0x00,0xF0,0x1F,0x08,0x20,	// 123
+	0x00,0x00,0xF8,0x3F,	// 124
+	0x00,0x00,0xC8,0x26,0x30,0x19,	// 125
+	0x00,0x00,0x00,0x01,0x80,0x00,0x00,0x01,0x00,0x01,0x80,	// 126
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 127
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 128
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 129
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 130
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 131
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 132
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 133
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 134
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 135
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 136
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 137
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 138
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 139
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 140
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 141
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 142
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 143
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 144
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 145
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 146
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 147
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 148
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 149
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 150
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 151
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 152
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 153
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 154
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 155
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 156
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 157
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 158
+	0xF0,0x0F,0x10,0x08,0x10,0x0D,0x90,0x08,0x70,0x08,0xF0,0x0F,	// 159
+	0x00,0x00,0x40,0x3E,	// 161
+	0x00,0x00,0x80,0x07,0x40,0x08,0xC0,0x1F,0x30,0x08,0x40,0x08,	// 162
+	0x00,0x01,0xE0,0x0F,0x10,0x09,0x10,0x09,0x10,0x09,0x10,0x08,0x00,0x08,	// 163
+	0x00,0x00,0xC0,0x03,0x40,0x02,0x40,0x02,0x40,0x02,0xC0,0x03,	// 164
+	0x00,0x00,0x30,0x03,0xC0,0x03,0x00,0x0F,0xC0,0x03,0x30,0x03,	// 165
+	0x00,0x00,0xF8,0x3E,	// 166
+	0x00,0x00,0xF0,0x23,0x50,0x22,0x90,0x24,0x10,0x1B,	// 167
+	0x00,0x00,0x10,0x00,0x00,0x00,0x10,	// 168
+	0x00,0x00,0xE0,0x07,0x90,0x09,0x50,0x0A,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x10,0x08,0xE0,0x07,	// 169
+	0x00,0x00,0xD0,0x00,0x70,	// 170
+	0x00,0x00,0x80,0x07,0x00,0x03,0x80,0x04,	// 171
+	0x00,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x03,	// 172
+	0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,	// 173
+	0x00,0x00,0xE0,0x07,0x10,0x08,0x50,0x0B,0xB0,0x08,0xB0,0x09,0x50,0x0A,0x10,0x08,0xE0,0x07,	// 174
+	0x00,0x00,0x10,0x00,0x10,0x00,0x10,	// 175
+	0x00,0x00,0x70,0x00,0x90,0x00,0x70,	// 176
+	0x00,0x00,0x80,0x08,0x80,0x08,0xE0,0x0B,0x80,0x08,0x80,0x08,	// 177
+	0x00,0x00,0x68,0x00,0x5C,	// 178
+	0x00,0x00,0x48,0x00,0x3C,	// 179
+	0x00,0x00,0x00,0x00,0x10,	// 180
+	0x00,0x00,0xC0,0x3F,0x00,0x08,0x00,0x08,0x00,0x08,0xC0,0x0F,0x00,0x08,	// 181
+	0x20,0x00,0xF0,0x00,0xF0,0x00,0x10,0x3F,0x10,0x00,0xF0,0x3F,0x10,	// 182
+	0x00,0x00,0x00,0x01,	// 183
+	0x00,0x00,0x00,0x00,0x00,0x30,	// 184
+	0x00,0x00,0x44,0x00,0x78,	// 185
+	0x00,0x00,0x70,0x00,0x90,0x00,0x70,	// 186
+	0x00,0x00,0x80,0x06,0x80,0x05,0x00,0x02,	// 187
+	0x00,0x00,0xF0,0x00,0x80,0x0C,0x00,0x02,0x80,0x01,0x60,0x06,0x10,0x05,0x00,0x0E,	// 188
+	0x00,0x00,0xF0,0x08,0x80,0x04,0x00,0x03,0xC0,0x00,0x20,0x09,0x90,0x0C,0x00,0x0B,	// 189
+	0x00,0x00,0x90,0x00,0xB0,0x08,0x50,0x06,0x80,0x01,0x60,0x06,0x10,0x05,0x00,0x0E,	// 190
+	0x00,0x00,0x00,0x3C,0x40,0x22,0x00,0x20,	// 191
+	0x00,0x08,0x00,0x07,0xC2,0x02,0x32,0x02,0x64,0x02,0x80,0x03,0x00,0x0C,	// 192
+	0x00,0x08,0x00,0x07,0xC0,0x02,0x34,0x02,0x62,0x02,0x82,0x03,0x00,0x0C,	// 193
+	0x00,0x08,0x00,0x07,0xC4,0x02,0x32,0x02,0x62,0x02,0x84,0x03,0x00,0x0C,	// 194
+	0x00,0x08,0x00,0x07,0xC4,0x02,0x32,0x02,0x64,0x02,0x82,0x03,0x00,0x0C,	// 195
+	0x00,0x08,0x00,0x07,0xC2,0x02,0x30,0x02,0x62,0x02,0x80,0x03,0x00,0x0C,	// 196
+	0x00,0x08,0x00,0x07,0xC0,0x02,0x36,0x02,0x64,0x02,0x80,0x03,0x00,0x0C,	// 197
+	0x00,0x08,0x00,0x04,0x00,0x03,0xC0,0x02,0x30,0x02,0xD0,0x07,0x90,0x08,0x90,0x08,0x90,0x08,0x90,0x08,	// 198
+	0x00,0x00,0xE0,0x07,0x10,0x08,0x10,0x08,0x10,0x30,0x10,0x28,0x10,0x08,0x10,0x08,	// 199
+	0x00,0x00,0xF0,0x0F,0x92,0x08,0x92,0x08,0x94,0x08,0x90,0x08,	// 200
+	0x00,0x00,0xF0,0x0F,0x90,0x08,0x94,0x08,0x92,0x08,0x92,0x08,	// 201
+	0x00,0x00,0xF0,0x0F,0x94,0x08,0x92,0x08,0x92,0x08,0x94,0x08,	// 202
+	0x00,0x00,0xF0,0x0F,0x92,0x08,0x90,0x08,0x92,0x08,0x90,0x08,	// 203
+	0x02,0x00,0xF4,0x0F,	// 204
+	0x00,0x00,0xF4,0x0F,0x02,	// 205
+	0x04,0x00,0xF2,0x0F,0x04,	// 206
+	0x02,0x00,0xF0,0x0F,0x02,	// 207
+	0x80,0x00,0xF0,0x0F,0x90,0x08,0x90,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0xE0,0x07,	// 208
+	0x00,0x00,0xF0,0x0F,0x20,0x00,0xC6,0x00,0x02,0x01,0x04,0x02,0x02,0x04,0xF0,0x0F,	// 209
+	0x00,0x00,0xE0,0x07,0x10,0x08,0x12,0x08,0x12,0x08,0x14,0x08,0x10,0x08,0x20,0x04,0xC0,0x03,	// 210
+	0x00,0x00,0xE0,0x07,0x10,0x08,0x10,0x08,0x14,0x08,0x12,0x08,0x10,0x08,0x20,0x04,0xC0,0x03,	// 211
+	0x00,0x00,0xE0,0x07,0x10,0x08,0x14,0x08,0x12,0x08,0x12,0x08,0x14,0x08,0x20,0x04,0xC0,0x03,	// 212
+	0x00,0x00,0xE0,0x07,0x10,0x08,0x14,0x08,0x12,0x08,0x14,0x08,0x12,0x08,0x20,0x04,0xC0,0x03,	// 213
+	0x00,0x00,0xE0,0x07,0x10,0x08,0x12,0x08,0x10,0x08,0x12,0x08,0x10,0x08,0x20,0x04,0xC0,0x03,	// 214
+	0x00,0x00,0x40,0x02,0x40,0x01,0x80,0x00,0x40,0x01,0x40,0x02,	// 215
+	0x00,0x00,0xE0,0x0F,0x10,0x0C,0x10,0x0A,0x10,0x09,0x90,0x08,0x70,0x08,0x38,0x04,0xC0,0x03,	// 216
+	0x00,0x00,0xF0,0x07,0x00,0x08,0x02,0x08,0x04,0x08,0x00,0x08,0xF0,0x07,	// 217
+	0x00,0x00,0xF0,0x07,0x00,0x08,0x04,0x08,0x04,0x08,0x02,0x08,0xF0,0x07,	// 218
+	0x00,0x00,0xF0,0x07,0x04,0x08,0x02,0x08,0x02,0x08,0x04,0x08,0xF0,0x07,	// 219
+	0x00,0x00,0xF0,0x07,0x00,0x08,0x02,0x08,0x00,0x08,0x02,0x08,0xF0,0x07,	// 220
+	0x10,0x00,0x60,0x00,0x80,0x00,0x04,0x0F,0xC2,0x00,0x20,0x00,0x10,	// 221
+	0x00,0x00,0xF0,0x0F,0x20,0x04,0x20,0x04,0x20,0x04,0xC0,0x03,	// 222
+	0x00,0x00,0xE0,0x0F,0x10,0x08,0x90,0x09,0x50,0x0A,0x20,0x0E,	// 223
+	0x00,0x00,0x40,0x0E,0x50,0x09,0x40,0x09,0xC0,0x0F,	// 224
+	0x00,0x00,0x40,0x0E,0x60,0x09,0x50,0x09,0xC0,0x0F,	// 225
+	0x00,0x00,0x60,0x0E,0x50,0x09,0x50,0x09,0xC0,0x0F,	// 226
+	0x00,0x00,0x50,0x0E,0x50,0x09,0x50,0x09,0xC0,0x0F,	// 227
+	0x00,0x00,0x50,0x0E,0x40,0x09,0x50,0x09,0xC0,0x0F,	// 228
+	0x00,0x00,0x40,0x0E,0x58,0x09,0x48,0x09,0xC0,0x0F,	// 229
+	0x00,0x00,0x40,0x0E,0x40,0x09,0x40,0x09,0xC0,0x07,0x40,0x09,0x40,0x09,0x40,0x09,0xC0,0x09,	// 230
+	0x00,0x00,0xC0,0x0F,0x40,0x28,0x40,0x30,0x40,0x28,	// 231
+	0x00,0x00,0xC0,0x0F,0x50,0x09,0x50,0x09,0x40,0x09,0x80,0x01,	// 232
+	0x00,0x00,0xC0,0x0F,0x40,0x09,0x50,0x09,0x40,0x09,0x80,0x01,	// 233
+	0x00,0x00,0xC0,0x0F,0x50,0x09,0x50,0x09,0x60,0x09,0x80,0x01,	// 234
+	0x00,0x00,0xC0,0x0F,0x50,0x09,0x40,0x09,0x50,0x09,0x80,0x01,	// 235
+	0x10,0x00,0xE0,0x0F,	// 236
+	0x00,0x00,0xD0,0x0F,	// 237
+	0x10,0x00,0xD0,0x0F,0x20,	// 238
+	0x10,0x00,0xD0,0x0F,	// 239
+	0x00,0x00,0x80,0x0F,0x50,0x08,0x70,0x08,0x70,0x08,0xC0,0x07,	// 240
+	0x00,0x00,0xD0,0x0F,0x50,0x00,0x50,0x00,0xD0,0x0F,	// 241
+	0x00,0x00,0xC0,0x0F,0x50,0x08,0x50,0x08,0x40,0x08,0x80,0x07,	// 242
+	0x00,0x00,0xC0,0x0F,0x40,0x08,0x50,0x08,0x40,0x08,0x80,0x07,	// 243
+	0x00,0x00,0xC0,0x0F,0x50,0x08,0x50,0x08,0x60,0x08,0x80,0x07,	// 244
+	0x00,0x00,0xC0,0x0F,0x50,0x08,0x50,0x08,0x50,0x08,0x80,0x07,	// 245
+	0x00,0x00,0xC0,0x0F,0x50,0x08,0x40,0x08,0x50,0x08,0x80,0x07,	// 246
+	0x00,0x00,0x00,0x01,0x00,0x01,0x40,0x05,0x00,0x01,0x00,0x01,	// 247
+	0x00,0x00,0xC0,0x0F,0x40,0x0C,0x40,0x0B,0xC0,0x08,0xC0,0x07,	// 248
+	0x00,0x00,0xC0,0x0F,0x10,0x08,0x10,0x08,0xC0,0x0F,	// 249
+	0x00,0x00,0xC0,0x0F,0x00,0x08,0x10,0x08,0xC0,0x0F,	// 250
+	0x00,0x00,0xC0,0x0F,0x10,0x08,0x10,0x08,0xE0,0x0F,	// 251
+	0x00,0x00,0xC0,0x0F,0x10,0x08,0x00,0x08,0xD0,0x0F,	// 252
+	0x40,0x00,0x80,0x03,0x00,0x3C,0x10,0x06,0x80,0x01,0x40,	// 253
+	0x00,0x00,0xF8,0x3F,0x40,0x08,0x40,0x08,0x40,0x08,0x80,0x07,	// 254
+	0x40,0x00,0x80,0x03,0x10,0x3C,0x00,0x06,0x90,0x01,0x40	// 255
+};
+
+
+// Created by http://oleddisplay.squix.ch/ Consider a donation
+// In case of problems make sure that you are using the font file with the correct version!
+const uint8_t Lato_Hairline_17[] PROGMEM = {
+	0x11, // Width: 17
+	0x15, // Height: 21
+	0x20, // First Char: 32
+	0xE0, // Numbers of Chars: 224
+
+	// Jump Table:
+	0xFF, 0xFF, 0x00, 0x05,  // 32:65535
+	0x00, 0x00, 0x09, 0x04,  // 33:0
+	0x00, 0x09, 0x0A, 0x05,  // 34:9
+	0x00, 0x13, 0x1A, 0x0A,  // 35:19
+	0x00, 0x2D, 0x17, 0x0A,  // 36:45
+	0x00, 0x44, 0x23, 0x0D,  // 37:68
+	0x00, 0x67, 0x21, 0x0C,  // 38:103
+	0x00, 0x88, 0x04, 0x03,  // 39:136
+	0x00, 0x8C, 0x0C, 0x04,  // 40:140
+	0x00, 0x98, 0x09, 0x04,  // 41:152
+	0x00, 0xA1, 0x10, 0x07,  // 42:161
+	0x00, 0xB1, 0x1A, 0x0A,  // 43:177
+	0x00, 0xCB, 0x06, 0x04,  // 44:203
+	0x00, 0xD1, 0x0E, 0x06,  // 45:209
+	0x00, 0xDF, 0x09, 0x04,  // 46:223
+	0x00, 0xE8, 0x10, 0x07,  // 47:232
+	0x00, 0xF8, 0x1A, 0x0A,  // 48:248
+	0x01, 0x12, 0x18, 0x0A,  // 49:274
+	0x01, 0x2A, 0x1B, 0x0A,  // 50:298
+	0x01, 0x45, 0x1A, 0x0A,  // 51:325
+	0x01, 0x5F, 0x1A, 0x0A,  // 52:351
+	0x01, 0x79, 0x17, 0x0A,  // 53:377
+	0x01, 0x90, 0x1A, 0x0A,  // 54:400
+	0x01, 0xAA, 0x19, 0x0A,  // 55:426
+	0x01, 0xC3, 0x1A, 0x0A,  // 56:451
+	0x01, 0xDD, 0x17, 0x0A,  // 57:477
+	0x01, 0xF4, 0x09, 0x04,  // 58:500
+	0x01, 0xFD, 0x09, 0x04,  // 59:509
+	0x02, 0x06, 0x17, 0x0A,  // 60:518
+	0x02, 0x1D, 0x17, 0x0A,  // 61:541
+	0x02, 0x34, 0x17, 0x0A,  // 62:564
+	0x02, 0x4B, 0x11, 0x07,  // 63:587
+	0x02, 0x5C, 0x26, 0x0E,  // 64:604
+	0x02, 0x82, 0x1E, 0x0B,  // 65:642
+	0x02, 0xA0, 0x1A, 0x0B,  // 66:672
+	0x02, 0xBA, 0x20, 0x0C,  // 67:698
+	0x02, 0xDA, 0x23, 0x0D,  // 68:730
+	0x02, 0xFD, 0x1B, 0x0A,  // 69:765
+	0x03, 0x18, 0x19, 0x0A,  // 70:792
+	0x03, 0x31, 0x20, 0x0D,  // 71:817
+	0x03, 0x51, 0x21, 0x0D,  // 72:849
+	0x03, 0x72, 0x09, 0x04,  // 73:882
+	0x03, 0x7B, 0x0E, 0x07,  // 74:891
+	0x03, 0x89, 0x1E, 0x0A,  // 75:905
+	0x03, 0xA7, 0x18, 0x09,  // 76:935
+	0x03, 0xBF, 0x27, 0x0F,  // 77:959
+	0x03, 0xE6, 0x21, 0x0D,  // 78:998
+	0x04, 0x07, 0x23, 0x0D,  // 79:1031
+	0x04, 0x2A, 0x1A, 0x0A,  // 80:1066
+	0x04, 0x44, 0x27, 0x0D,  // 81:1092
+	0x04, 0x6B, 0x1E, 0x0A,  // 82:1131
+	0x04, 0x89, 0x17, 0x09,  // 83:1161
+	0x04, 0xA0, 0x19, 0x0A,  // 84:1184
+	0x04, 0xB9, 0x1D, 0x0C,  // 85:1209
+	0x04, 0xD6, 0x1C, 0x0B,  // 86:1238
+	0x04, 0xF2, 0x2F, 0x11,  // 87:1266
+	0x05, 0x21, 0x1E, 0x0A,  // 88:1313
+	0x05, 0x3F, 0x19, 0x0A,  // 89:1343
+	0x05, 0x58, 0x1B, 0x0A,  // 90:1368
+	0x05, 0x73, 0x0C, 0x05,  // 91:1395
+	0x05, 0x7F, 0x12, 0x07,  // 92:1407
+	0x05, 0x91, 0x09, 0x05,  // 93:1425
+	0x05, 0x9A, 0x17, 0x0A,  // 94:1434
+	0x05, 0xB1, 0x15, 0x08,  // 95:1457
+	0x05, 0xC6, 0x0A, 0x07,  // 96:1478
+	0x05, 0xD0, 0x15, 0x08,  // 97:1488
+	0x05, 0xE5, 0x17, 0x09,  // 98:1509
+	0x05, 0xFC, 0x15, 0x08,  // 99:1532
+	0x06, 0x11, 0x18, 0x09,  // 100:1553
+	0x06, 0x29, 0x17, 0x09,  // 101:1577
+	0x06, 0x40, 0x0E, 0x06,  // 102:1600
+	0x06, 0x4E, 0x18, 0x09,  // 103:1614
+	0x06, 0x66, 0x18, 0x09,  // 104:1638
+	0x06, 0x7E, 0x06, 0x04,  // 105:1662
+	0x06, 0x84, 0x06, 0x04,  // 106:1668
+	0x06, 0x8A, 0x15, 0x08,  // 107:1674
+	0x06, 0x9F, 0x06, 0x04,  // 108:1695
+	0x06, 0xA5, 0x24, 0x0D,  // 109:1701
+	0x06, 0xC9, 0x18, 0x09,  // 110:1737
+	0x06, 0xE1, 0x17, 0x09,  // 111:1761
+	0x06, 0xF8, 0x17, 0x09,  // 112:1784
+	0x07, 0x0F, 0x18, 0x09,  // 113:1807
+	0x07, 0x27, 0x11, 0x06,  // 114:1831
+	0x07, 0x38, 0x12, 0x07,  // 115:1848
+	0x07, 0x4A, 0x0F, 0x06,  // 116:1866
+	0x07, 0x59, 0x18, 0x09,  // 117:1881
+	0x07, 0x71, 0x17, 0x08,  // 118:1905
+	0x07, 0x88, 0x23, 0x0D,  // 119:1928
+	0x07, 0xAB, 0x15, 0x08,  // 120:1963
+	0x07, 0xC0, 0x17, 0x08,  // 121:1984
+	0x07, 0xD7, 0x15, 0x07,  // 122:2007
+	0x07, 0xEC, 0x0C, 0x05,  // 123:2028
+	0x07, 0xF8, 0x06, 0x04,  // 124:2040
+	0x07, 0xFE, 0x0C, 0x05,  // 125:2046
+	0x08, 0x0A, 0x1A, 0x0A,  // 126:2058
+	0x08, 0x24, 0x18, 0x08,  // 127:2084
+	0x08, 0x3C, 0x18, 0x08,  // 128:2108
+	0x08, 0x54, 0x18, 0x08,  // 129:2132
+	0x08, 0x6C, 0x18, 0x08,  // 130:2156
+	0x08, 0x84, 0x18, 0x08,  // 131:2180
+	0x08, 0x9C, 0x18, 0x08,  // 132:2204
+	0x08, 0xB4, 0x18, 0x08,  // 133:2228
+	0x08, 0xCC, 0x18, 0x08,  // 134:2252
+	0x08, 0xE4, 0x18, 0x08,  // 135:2276
+	0x08, 0xFC, 0x18, 0x08,  // 136:2300
+	0x09, 0x14, 0x18, 0x08,  // 137:2324
+	0x09, 0x2C, 0x18, 0x08,  // 138:2348
+	0x09, 0x44, 0x18, 0x08,  // 139:2372
+	0x09, 0x5C, 0x18, 0x08,  // 140:2396
+	0x09, 0x74, 0x18, 0x08,  // 141:2420
+	0x09, 0x8C, 0x18, 0x08,  // 142:2444
+	0x09, 0xA4, 0x18, 0x08,  // 143:2468
+	0x09, 0xBC, 0x18, 0x08,  // 144:2492
+	0x09, 0xD4, 0x18, 0x08,  // 145:2516
+	0x09, 0xEC, 0x18, 0x08,  // 146:2540
+	0x0A, 0x04, 0x18, 0x08,  // 147:2564
+	0x0A, 0x1C, 0x18, 0x08,  // 148:2588
+	0x0A, 0x34, 0x18, 0x08,  // 149:2612
+	0x0A, 0x4C, 0x18, 0x08,  // 150:2636
+	0x0A, 0x64, 0x18, 0x08,  // 151:2660
+	0x0A, 0x7C, 0x18, 0x08,  // 152:2684
+	0x0A, 0x94, 0x18, 0x08,  // 153:2708
+	0x0A, 0xAC, 0x18, 0x08,  // 154:2732
+	0x0A, 0xC4, 0x18, 0x08,  // 155:2756
+	0x0A, 0xDC, 0x18, 0x08,  // 156:2780
+	0x0A, 0xF4, 0x18, 0x08,  // 157:2804
+	0x0B, 0x0C, 0x18, 0x08,  // 158:2828
+	0x0B, 0x24, 0x18, 0x08,  // 159:2852
+	0xFF, 0xFF, 0x00, 0x05,  // 160:65535
+	0x0B, 0x3C, 0x06, 0x04,  // 161:2876
+	0x0B, 0x42, 0x18, 0x0A,  // 162:2882
+	0x0B, 0x5A, 0x1B, 0x0A,  // 163:2906
+	0x0B, 0x75, 0x17, 0x0A,  // 164:2933
+	0x0B, 0x8C, 0x19, 0x0A,  // 165:2956
+	0x0B, 0xA5, 0x06, 0x04,  // 166:2981
+	0x0B, 0xAB, 0x15, 0x08,  // 167:2987
+	0x0B, 0xC0, 0x0D, 0x07,  // 168:3008
+	0x0B, 0xCD, 0x26, 0x0E,  // 169:3021
+	0x0B, 0xF3, 0x0E, 0x06,  // 170:3059
+	0x0C, 0x01, 0x0E, 0x06,  // 171:3073
+	0x0C, 0x0F, 0x17, 0x0A,  // 172:3087
+	0x0C, 0x26, 0x0E, 0x06,  // 173:3110
+	0x0C, 0x34, 0x26, 0x0E,  // 174:3124
+	0x0C, 0x5A, 0x10, 0x07,  // 175:3162
+	0x0C, 0x6A, 0x10, 0x07,  // 176:3178
+	0x0C, 0x7A, 0x1B, 0x0A,  // 177:3194
+	0x0C, 0x95, 0x0E, 0x06,  // 178:3221
+	0x0C, 0xA3, 0x0D, 0x06,  // 179:3235
+	0x0C, 0xB0, 0x0D, 0x07,  // 180:3248
+	0x0C, 0xBD, 0x1E, 0x0B,  // 181:3261
+	0x0C, 0xDB, 0x1C, 0x0B,  // 182:3291
+	0x0C, 0xF7, 0x05, 0x04,  // 183:3319
+	0x0C, 0xFC, 0x0F, 0x07,  // 184:3324
+	0x0D, 0x0B, 0x0E, 0x06,  // 185:3339
+	0x0D, 0x19, 0x11, 0x07,  // 186:3353
+	0x0D, 0x2A, 0x0E, 0x06,  // 187:3370
+	0x0D, 0x38, 0x21, 0x0C,  // 188:3384
+	0x0D, 0x59, 0x21, 0x0C,  // 189:3417
+	0x0D, 0x7A, 0x23, 0x0C,  // 190:3450
+	0x0D, 0x9D, 0x12, 0x07,  // 191:3485
+	0x0D, 0xAF, 0x1E, 0x0B,  // 192:3503
+	0x0D, 0xCD, 0x1E, 0x0B,  // 193:3533
+	0x0D, 0xEB, 0x1E, 0x0B,  // 194:3563
+	0x0E, 0x09, 0x1E, 0x0B,  // 195:3593
+	0x0E, 0x27, 0x1E, 0x0B,  // 196:3623
+	0x0E, 0x45, 0x1E, 0x0B,  // 197:3653
+	0x0E, 0x63, 0x2D, 0x10,  // 198:3683
+	0x0E, 0x90, 0x20, 0x0C,  // 199:3728
+	0x0E, 0xB0, 0x1B, 0x0A,  // 200:3760
+	0x0E, 0xCB, 0x1B, 0x0A,  // 201:3787
+	0x0E, 0xE6, 0x1B, 0x0A,  // 202:3814
+	0x0F, 0x01, 0x1B, 0x0A,  // 203:3841
+	0x0F, 0x1C, 0x09, 0x04,  // 204:3868
+	0x0F, 0x25, 0x0A, 0x04,  // 205:3877
+	0x0F, 0x2F, 0x0A, 0x04,  // 206:3887
+	0x0F, 0x39, 0x0A, 0x04,  // 207:3897
+	0x0F, 0x43, 0x23, 0x0D,  // 208:3907
+	0x0F, 0x66, 0x21, 0x0D,  // 209:3942
+	0x0F, 0x87, 0x23, 0x0D,  // 210:3975
+	0x0F, 0xAA, 0x23, 0x0D,  // 211:4010
+	0x0F, 0xCD, 0x23, 0x0D,  // 212:4045
+	0x0F, 0xF0, 0x23, 0x0D,  // 213:4080
+	0x10, 0x13, 0x23, 0x0D,  // 214:4115
+	0x10, 0x36, 0x17, 0x0A,  // 215:4150
+	0x10, 0x4D, 0x23, 0x0D,  // 216:4173
+	0x10, 0x70, 0x1D, 0x0C,  // 217:4208
+	0x10, 0x8D, 0x1D, 0x0C,  // 218:4237
+	0x10, 0xAA, 0x1D, 0x0C,  // 219:4266
+	0x10, 0xC7, 0x1D, 0x0C,  // 220:4295
+	0x10, 0xE4, 0x19, 0x0A,  // 221:4324
+	0x10, 0xFD, 0x1A, 0x0A,  // 222:4349
+	0x11, 0x17, 0x18, 0x09,  // 223:4375
+	0x11, 0x2F, 0x15, 0x08,  // 224:4399
+	0x11, 0x44, 0x15, 0x08,  // 225:4420
+	0x11, 0x59, 0x15, 0x08,  // 226:4441
+	0x11, 0x6E, 0x15, 0x08,  // 227:4462
+	0x11, 0x83, 0x15, 0x08,  // 228:4483
+	0x11, 0x98, 0x15, 0x08,  // 229:4504
+	0x11, 0xAD, 0x26, 0x0E,  // 230:4525
+	0x11, 0xD3, 0x15, 0x08,  // 231:4563
+	0x11, 0xE8, 0x17, 0x09,  // 232:4584
+	0x11, 0xFF, 0x17, 0x09,  // 233:4607
+	0x12, 0x16, 0x17, 0x09,  // 234:4630
+	0x12, 0x2D, 0x17, 0x09,  // 235:4653
+	0x12, 0x44, 0x06, 0x04,  // 236:4676
+	0x12, 0x4A, 0x07, 0x04,  // 237:4682
+	0x12, 0x51, 0x0A, 0x04,  // 238:4689
+	0x12, 0x5B, 0x07, 0x04,  // 239:4699
+	0x12, 0x62, 0x17, 0x09,  // 240:4706
+	0x12, 0x79, 0x18, 0x09,  // 241:4729
+	0x12, 0x91, 0x17, 0x09,  // 242:4753
+	0x12, 0xA8, 0x17, 0x09,  // 243:4776
+	0x12, 0xBF, 0x17, 0x09,  // 244:4799
+	0x12, 0xD6, 0x17, 0x09,  // 245:4822
+	0x12, 0xED, 0x17, 0x09,  // 246:4845
+	0x13, 0x04, 0x1A, 0x0A,  // 247:4868
+	0x13, 0x1E, 0x17, 0x09,  // 248:4894
+	0x13, 0x35, 0x18, 0x09,  // 249:4917
+	0x13, 0x4D, 0x18, 0x09,  // 250:4941
+	0x13, 0x65, 0x18, 0x09,  // 251:4965
+	0x13, 0x7D, 0x18, 0x09,  // 252:4989
+	0x13, 0x95, 0x17, 0x08,  // 253:5013
+	0x13, 0xAC, 0x17, 0x09,  // 254:5036
+	0x13, 0xC3, 0x17, 0x08,  // 255:5059
+
+	// Font Data:
+	0x00,0x00,0x00,0x00,0x00,0x01,0xF0,0x0F,0x01,	// 33
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0xF0,	// 34
+	0x00,0x00,0x00,0x00,0x11,0x00,0x00,0xF1,0x01,0x80,0x1F,0x00,0x70,0x11,0x00,0x00,0xF1,0x01,0x80,0x1F,0x00,0x70,0x11,0x00,0x00,0x01,	// 35
+	0x00,0x00,0x00,0x00,0x80,0x00,0xE0,0x01,0x01,0x10,0x02,0x01,0x10,0xFC,0x07,0xFC,0x07,0x01,0x10,0x04,0x01,0x10,0xF8,	// 36
+	0x00,0x00,0x00,0xE0,0x03,0x00,0x10,0x04,0x01,0x10,0xC4,0x00,0x10,0x24,0x00,0xE0,0x1B,0x00,0x00,0x04,0x00,0x00,0xFB,0x00,0x80,0x04,0x01,0x60,0x04,0x01,0x10,0x04,0x01,0x00,0xF8,	// 37
+	0x00,0x00,0x00,0x00,0xF8,0x00,0xC0,0x04,0x01,0x20,0x03,0x01,0x10,0x04,0x01,0x10,0x08,0x01,0x10,0x10,0x01,0x20,0xA0,0x00,0x00,0x40,0x00,0x00,0xB8,0x00,0x00,0x00,0x01,	// 38
+	0x00,0x00,0x00,0xF0,	// 39
+	0x00,0x00,0x00,0x80,0xFF,0x00,0x70,0x00,0x03,0x08,0x00,0x04,	// 40
+	0x00,0x00,0x00,0x38,0x00,0x06,0xC0,0xFF,0x01,	// 41
+	0x00,0x00,0x00,0xA0,0x00,0x00,0xA0,0x00,0x00,0xF0,0x01,0x00,0xA0,0x00,0x00,0xA0,	// 42
+	0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0xC0,0x7F,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,	// 43
+	0x00,0x00,0x00,0x00,0x00,0x07,	// 44
+	0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,	// 45
+	0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,	// 46
+	0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x70,0x00,0x00,0x0C,0x00,0x80,0x03,0x00,0x70,	// 47
+	0x00,0x00,0x00,0xC0,0x7F,0x00,0x20,0x80,0x00,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x20,0x80,0x00,0xC0,0x7F,	// 48
+	0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x01,0x20,0x00,0x01,0x10,0x00,0x01,0xF0,0xFF,0x01,0x00,0x00,0x01,0x00,0x00,0x01,	// 49
+	0x00,0x00,0x00,0x40,0x00,0x01,0x20,0x80,0x01,0x10,0x40,0x01,0x10,0x20,0x01,0x10,0x10,0x01,0x10,0x0C,0x01,0x20,0x02,0x01,0xC0,0x01,0x01,	// 50
+	0x00,0x00,0x00,0x40,0xC0,0x00,0x20,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x20,0x8B,0x00,0xC0,0x70,	// 51
+	0x00,0x20,0x00,0x00,0x38,0x00,0x00,0x24,0x00,0x00,0x22,0x00,0x80,0x21,0x00,0x40,0x20,0x00,0xF0,0xFF,0x01,0x00,0x20,0x00,0x00,0x20,	// 52
+	0x00,0x00,0x00,0x00,0x00,0x01,0xF0,0x03,0x01,0x10,0x02,0x01,0x10,0x02,0x01,0x10,0x02,0x01,0x10,0x02,0x01,0x10,0xFC,	// 53
+	0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x86,0x00,0x00,0x03,0x01,0xC0,0x02,0x01,0x20,0x02,0x01,0x10,0x02,0x01,0x00,0x84,0x00,0x00,0x78,	// 54
+	0x00,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x80,0x01,0x10,0x70,0x00,0x10,0x0C,0x00,0x10,0x03,0x00,0xD0,0x00,0x00,0x30,	// 55
+	0x00,0x00,0x00,0xC0,0xF1,0x00,0x20,0x0A,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x20,0x0B,0x01,0xC0,0xF0,	// 56
+	0x00,0x00,0x00,0xC0,0x03,0x00,0x20,0x04,0x00,0x10,0x08,0x01,0x10,0xC8,0x00,0x10,0x28,0x00,0x10,0x18,0x00,0xE0,0x07,	// 57
+	0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x01,0x01,	// 58
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x07,	// 59
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x0A,0x00,0x00,0x12,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,	// 60
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x12,0x00,0x00,0x12,0x00,0x00,0x12,0x00,0x00,0x12,0x00,0x00,0x12,	// 61
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x11,0x00,0x00,0x12,0x00,0x00,0x0C,0x00,0x00,0x0C,	// 62
+	0x00,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x1C,0x01,0x10,0x02,0x00,0xE0,0x01,	// 63
+	0x00,0x00,0x00,0x00,0x7F,0x00,0x80,0x80,0x01,0x40,0x00,0x02,0x20,0x38,0x02,0x10,0x46,0x04,0x10,0x41,0x04,0x10,0x41,0x04,0x10,0x39,0x04,0x10,0x46,0x04,0x20,0x40,0x02,0x40,0x20,0x02,0x80,0x1F,	// 64
+	0x00,0x00,0x01,0x00,0xE0,0x00,0x00,0x1C,0x00,0x00,0x13,0x00,0xE0,0x10,0x00,0x30,0x10,0x00,0xC0,0x10,0x00,0x00,0x17,0x00,0x00,0x18,0x00,0x00,0xE0,0x01,	// 65
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x06,0x01,0xE0,0xF9,	// 66
+	0x00,0x00,0x00,0x80,0x3F,0x00,0x40,0x40,0x00,0x20,0x80,0x00,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x20,0x80,	// 67
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x20,0x80,0x00,0x40,0x40,0x00,0x80,0x3F,	// 68
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x00,0x01,	// 69
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x10,0x04,0x00,0x10,0x04,0x00,0x10,0x04,0x00,0x10,0x04,0x00,0x10,0x04,0x00,0x10,	// 70
+	0x00,0x00,0x00,0x80,0x3F,0x00,0x40,0x40,0x00,0x20,0x80,0x00,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x08,0x01,0x10,0x08,0x01,0x20,0xF8,	// 71
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0xF0,0xFF,0x01,	// 72
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,	// 73
+	0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0xF0,0xFF,	// 74
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x04,0x00,0x00,0x0A,0x00,0x00,0x11,0x00,0x80,0x20,0x00,0x40,0x40,0x00,0x20,0x80,0x00,0x10,0x00,0x01,	// 75
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,	// 76
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x80,0x00,0x00,0x00,0x03,0x00,0x00,0x0C,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x0C,0x00,0x00,0x03,0x00,0xC0,0x00,0x00,0xF0,0xFF,0x01,	// 77
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x40,0x00,0x00,0x80,0x00,0x00,0x00,0x03,0x00,0x00,0x04,0x00,0x00,0x18,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0xF0,0xFF,0x01,	// 78
+	0x00,0x00,0x00,0x80,0x3F,0x00,0x40,0x40,0x00,0x20,0x80,0x00,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x20,0x80,0x00,0xC0,0x7F,	// 79
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x10,0x08,0x00,0x10,0x08,0x00,0x10,0x08,0x00,0x10,0x08,0x00,0x20,0x04,0x00,0xC0,0x03,	// 80
+	0x00,0x00,0x00,0x80,0x3F,0x00,0x40,0x40,0x00,0x20,0x80,0x00,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x20,0x80,0x02,0xC0,0x73,0x04,0x00,0x0C,0x08,	// 81
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x10,0x04,0x00,0x10,0x04,0x00,0x10,0x0C,0x00,0x10,0x34,0x00,0x10,0x42,0x00,0xE0,0x81,0x00,0x00,0x00,0x01,	// 82
+	0x00,0x00,0x00,0xC0,0x81,0x00,0x20,0x02,0x01,0x10,0x02,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x20,0xF8,	// 83
+	0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0xF0,0xFF,0x01,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,	// 84
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x80,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0xF0,0xFF,	// 85
+	0x10,0x00,0x00,0xE0,0x00,0x00,0x00,0x07,0x00,0x00,0x18,0x00,0x00,0xE0,0x00,0x00,0x80,0x01,0x00,0x60,0x00,0x00,0x1C,0x00,0x00,0x03,0x00,0xF0,	// 86
+	0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x0E,0x00,0x00,0xF0,0x00,0x00,0x80,0x01,0x00,0x70,0x00,0x00,0x0E,0x00,0xC0,0x01,0x00,0x30,0x00,0x00,0xC0,0x01,0x00,0x00,0x0E,0x00,0x00,0x70,0x00,0x00,0x80,0x01,0x00,0x70,0x00,0x00,0x0E,0x00,0xF0,0x01,	// 87
+	0x00,0x00,0x00,0x30,0x80,0x01,0x40,0x60,0x00,0x80,0x11,0x00,0x00,0x0A,0x00,0x00,0x0E,0x00,0x80,0x11,0x00,0x40,0x60,0x00,0x20,0x80,0x00,0x10,0x00,0x01,	// 88
+	0x10,0x00,0x00,0x60,0x00,0x00,0x80,0x00,0x00,0x00,0x03,0x00,0x00,0xFC,0x01,0x00,0x04,0x00,0x00,0x03,0x00,0xC0,0x00,0x00,0x30,	// 89
+	0x00,0x00,0x00,0x10,0x80,0x01,0x10,0x40,0x01,0x10,0x30,0x01,0x10,0x08,0x01,0x10,0x06,0x01,0x90,0x01,0x01,0x50,0x00,0x01,0x30,0x00,0x01,	// 90
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x08,0x00,0x08,	// 91
+	0x00,0x00,0x00,0x70,0x00,0x00,0x80,0x01,0x00,0x00,0x0E,0x00,0x00,0x30,0x00,0x00,0xC0,0x01,	// 92
+	0x00,0x00,0x00,0x08,0x00,0x08,0xF8,0xFF,0x0F,	// 93
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0xC0,0x00,0x00,0x30,0x00,0x00,0x20,0x00,0x00,0xC0,0x00,0x00,0x00,0x03,	// 94
+	0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,	// 95
+	0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x20,	// 96
+	0x00,0x00,0x00,0x00,0xE2,0x01,0x00,0x21,0x01,0x00,0x11,0x01,0x00,0x11,0x01,0x00,0x11,0x01,0x00,0xFE,0x01,	// 97
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0xFE,	// 98
+	0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,	// 99
+	0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0xF0,0xFF,0x01,	// 100
+	0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x09,0x01,0x00,0x09,0x01,0x00,0x09,0x01,0x00,0x09,0x01,0x00,0x09,0x01,0x00,0x8E,	// 101
+	0x00,0x00,0x00,0x00,0x01,0x00,0xF0,0xFF,0x01,0x10,0x01,0x00,0x10,0x01,	// 102
+	0x00,0x00,0x00,0x00,0x5E,0x07,0x00,0xA1,0x08,0x00,0xA1,0x08,0x00,0xA1,0x08,0x00,0xA1,0x08,0x00,0x9F,0x08,0x00,0x01,0x07,	// 103
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0xFE,0x01,	// 104
+	0x00,0x00,0x00,0x10,0xFF,0x01,	// 105
+	0x00,0x00,0x08,0x10,0xFF,0x0F,	// 106
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x28,0x00,0x00,0x44,0x00,0x00,0x82,0x00,0x00,0x01,0x01,	// 107
+	0x00,0x00,0x00,0xF0,0xFF,0x01,	// 108
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0xFE,0x01,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0xFE,0x01,	// 109
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0xFE,0x01,	// 110
+	0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0xFE,	// 111
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0xFE,	// 112
+	0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0xFF,0x0F,	// 113
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,	// 114
+	0x00,0x00,0x00,0x00,0x0E,0x01,0x00,0x09,0x01,0x00,0x11,0x01,0x00,0x11,0x01,0x00,0xE1,0x01,	// 115
+	0x00,0x00,0x00,0x00,0x01,0x00,0xF0,0xFF,0x01,0x00,0x01,0x01,0x00,0x01,0x01,	// 116
+	0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0xFF,0x01,	// 117
+	0x00,0x01,0x00,0x00,0x0E,0x00,0x00,0x30,0x00,0x00,0xC0,0x01,0x00,0x80,0x00,0x00,0x70,0x00,0x00,0x0C,0x00,0x00,0x03,	// 118
+	0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x80,0x01,0x00,0x70,0x00,0x00,0x0E,0x00,0x00,0x03,0x00,0x00,0x1C,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0x38,0x00,0x00,0x07,	// 119
+	0x00,0x00,0x00,0x00,0x83,0x01,0x00,0x44,0x00,0x00,0x38,0x00,0x00,0x28,0x00,0x00,0xC6,0x00,0x00,0x01,0x01,	// 120
+	0x00,0x01,0x00,0x00,0x06,0x00,0x00,0x38,0x08,0x00,0xC0,0x06,0x00,0x80,0x01,0x00,0x70,0x00,0x00,0x0C,0x00,0x00,0x03,	// 121
+	0x00,0x00,0x00,0x00,0x81,0x01,0x00,0x41,0x01,0x00,0x31,0x01,0x00,0x09,0x01,0x00,0x07,0x01,0x00,0x01,0x01,	// 122
+	0x00,0x00,0x00,0xE0,0x88,0x03,0x10,0x77,0x04,0x08,0x00,0x08,	// 123
+	0x00,0x00,0x00,0xF8,0xFF,0x0F,	// 124
+	0x00,0x00,0x00,0x08,0x00,0x08,0x90,0xF7,0x04,0x60,0x08,0x03,	// 125
+	0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x08,	// 126
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 127
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 128
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 129
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 130
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 131
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 132
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 133
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 134
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 135
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 136
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 137
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 138
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 139
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 140
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 141
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 142
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 143
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 144
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 145
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 146
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 147
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 148
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 149
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 150
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 151
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 152
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 153
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 154
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 155
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 156
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 157
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 158
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x4C,0x01,0x50,0x03,0x01,0x90,0x00,0x01,0xF0,0xFF,0x01,	// 159
+	0x00,0x00,0x00,0x00,0xF1,0x0F,	// 161
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x01,0x01,0x00,0x01,0x01,0xE0,0xFF,0x07,0x00,0x01,0x01,0x00,0x01,0x01,	// 162
+	0x00,0x00,0x00,0x00,0x08,0x01,0xC0,0xFF,0x01,0x20,0x08,0x01,0x10,0x08,0x01,0x10,0x08,0x01,0x10,0x08,0x01,0x10,0x00,0x01,0x20,0x00,0x01,	// 163
+	0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x80,0x3E,	// 164
+	0x00,0x00,0x00,0x30,0x00,0x00,0xC0,0x18,0x00,0x00,0x1B,0x00,0x00,0xFC,0x01,0x00,0x1E,0x00,0x80,0x19,0x00,0x60,0x18,0x00,0x10,	// 165
+	0x00,0x00,0x00,0xF8,0xE3,0x0F,	// 166
+	0x00,0x00,0x00,0x60,0x0F,0x01,0x90,0x08,0x02,0x10,0x11,0x02,0x10,0x11,0x02,0x10,0x22,0x02,0x10,0xDC,0x01,	// 167
+	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,	// 168
+	0x00,0x00,0x00,0x80,0x3F,0x00,0x40,0x40,0x00,0x20,0x8E,0x00,0x90,0x31,0x01,0x50,0x40,0x01,0x50,0x40,0x01,0x50,0x40,0x01,0x50,0x40,0x01,0x90,0x20,0x01,0x20,0x80,0x00,0x40,0x40,0x00,0x80,0x3F,	// 169
+	0x00,0x00,0x00,0x90,0x01,0x00,0x50,0x02,0x00,0x50,0x02,0x00,0xF0,0x01,	// 170
+	0x00,0x00,0x00,0x00,0x38,0x00,0x00,0xC6,0x00,0x00,0x38,0x00,0x00,0xC6,	// 171
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x1C,	// 172
+	0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,	// 173
+	0x00,0x00,0x00,0x80,0x3F,0x00,0x40,0x40,0x00,0x20,0x80,0x00,0x10,0x00,0x01,0xD0,0x7F,0x01,0x50,0x04,0x01,0x50,0x0C,0x01,0x50,0x14,0x01,0x90,0x23,0x01,0x20,0xC0,0x00,0x40,0x40,0x00,0x80,0x3F,	// 174
+	0x00,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,	// 175
+	0x00,0x00,0x00,0xE0,0x00,0x00,0x10,0x01,0x00,0x10,0x01,0x00,0x10,0x01,0x00,0xE0,	// 176
+	0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x08,0x01,0x00,0x08,0x01,0x80,0x7F,0x01,0x00,0x08,0x01,0x00,0x08,0x01,0x00,0x08,0x01,0x00,0x08,0x01,	// 177
+	0x00,0x00,0x00,0x88,0x01,0x00,0x44,0x01,0x00,0x24,0x01,0x00,0x18,0x01,	// 178
+	0x00,0x00,0x00,0x88,0x00,0x00,0x04,0x01,0x00,0x24,0x01,0x00,0xD8,	// 179
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x10,	// 180
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0xFF,0x00,0x00,0x00,0x01,0x00,0x00,0x01,	// 181
+	0x00,0x00,0x00,0xE0,0x01,0x00,0xF0,0x03,0x00,0xF0,0x03,0x00,0xF0,0xFF,0x03,0x10,0x00,0x00,0x10,0x00,0x00,0xF0,0xFF,0x03,0x10,0x00,0x00,0x10,	// 182
+	0x00,0x00,0x00,0x00,0x08,	// 183
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x0A,0x00,0x00,0x0C,	// 184
+	0x00,0x00,0x00,0x08,0x00,0x00,0x04,0x01,0x00,0xF8,0x01,0x00,0x00,0x01,	// 185
+	0x00,0x00,0x00,0xE0,0x01,0x00,0x10,0x02,0x00,0x10,0x02,0x00,0x10,0x02,0x00,0xE0,0x01,	// 186
+	0x00,0x00,0x00,0x00,0x82,0x00,0x00,0x6C,0x00,0x00,0xD2,0x00,0x00,0x3C,	// 187
+	0x00,0x00,0x00,0x20,0x04,0x00,0xF0,0x07,0x01,0x00,0x84,0x00,0x00,0x60,0x00,0x00,0x18,0x00,0x00,0x06,0x00,0x80,0xC1,0x00,0x60,0xB0,0x00,0x10,0x88,0x00,0x00,0xF0,0x01,	// 188
+	0x00,0x00,0x00,0x20,0x04,0x00,0xF0,0x07,0x01,0x00,0xC4,0x00,0x00,0x30,0x00,0x00,0x0C,0x00,0x00,0x03,0x00,0xC0,0x08,0x01,0x30,0x84,0x01,0x00,0x44,0x01,0x00,0x38,0x01,	// 189
+	0x00,0x00,0x00,0x30,0x02,0x00,0x10,0x04,0x00,0x90,0x84,0x01,0x70,0x63,0x00,0x00,0x18,0x00,0x00,0x06,0x00,0x80,0xC1,0x00,0x60,0xA0,0x00,0x10,0x98,0x00,0x00,0xE0,0x01,0x00,0x80,	// 190
+	0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x40,0x08,0x00,0x71,0x08,0x00,0x00,0x08,0x00,0x00,0x08,	// 191
+	0x00,0x00,0x01,0x00,0xE0,0x00,0x00,0x1C,0x00,0x01,0x13,0x00,0xE2,0x10,0x00,0x34,0x10,0x00,0xC0,0x10,0x00,0x00,0x17,0x00,0x00,0x18,0x00,0x00,0xE0,0x01,	// 192
+	0x00,0x00,0x01,0x00,0xE0,0x00,0x00,0x1C,0x00,0x00,0x13,0x00,0xE0,0x10,0x00,0x34,0x10,0x00,0xC2,0x10,0x00,0x01,0x17,0x00,0x00,0x18,0x00,0x00,0xE0,0x01,	// 193
+	0x00,0x00,0x01,0x00,0xE0,0x00,0x00,0x1C,0x00,0x04,0x13,0x00,0xE2,0x10,0x00,0x31,0x10,0x00,0xC6,0x10,0x00,0x00,0x17,0x00,0x00,0x18,0x00,0x00,0xE0,0x01,	// 194
+	0x00,0x00,0x01,0x00,0xE0,0x00,0x00,0x1C,0x00,0x04,0x13,0x00,0xE2,0x10,0x00,0x34,0x10,0x00,0xC4,0x10,0x00,0x02,0x17,0x00,0x00,0x18,0x00,0x00,0xE0,0x01,	// 195
+	0x00,0x00,0x01,0x00,0xE0,0x00,0x00,0x1C,0x00,0x02,0x13,0x00,0xE0,0x10,0x00,0x30,0x10,0x00,0xC2,0x10,0x00,0x00,0x17,0x00,0x00,0x18,0x00,0x00,0xE0,0x01,	// 196
+	0x00,0x00,0x01,0x00,0xE0,0x00,0x00,0x1C,0x00,0x00,0x13,0x00,0xE6,0x10,0x00,0x39,0x10,0x00,0xC6,0x10,0x00,0x00,0x17,0x00,0x00,0x18,0x00,0x00,0xE0,0x01,	// 197
+	0x00,0x00,0x01,0x00,0xC0,0x00,0x00,0x20,0x00,0x00,0x1C,0x00,0x00,0x13,0x00,0x80,0x10,0x00,0x60,0x10,0x00,0xD0,0x13,0x00,0x10,0xEC,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x00,0x01,	// 198
+	0x00,0x00,0x00,0x80,0x3F,0x00,0x40,0x40,0x00,0x20,0x80,0x00,0x10,0x00,0x01,0x10,0x00,0x09,0x10,0x00,0x0A,0x10,0x00,0x0D,0x10,0x00,0x01,0x10,0x00,0x01,0x20,0x80,	// 199
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x11,0x04,0x01,0x12,0x04,0x01,0x14,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x00,0x01,	// 200
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x14,0x04,0x01,0x12,0x04,0x01,0x11,0x04,0x01,0x10,0x00,0x01,	// 201
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x14,0x04,0x01,0x16,0x04,0x01,0x11,0x04,0x01,0x12,0x04,0x01,0x14,0x04,0x01,0x10,0x00,0x01,	// 202
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x12,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x12,0x04,0x01,0x10,0x00,0x01,	// 203
+	0x01,0x00,0x00,0x02,0x00,0x00,0xF4,0xFF,0x01,	// 204
+	0x00,0x00,0x00,0x04,0x00,0x00,0xF4,0xFF,0x01,0x02,	// 205
+	0x04,0x00,0x00,0x02,0x00,0x00,0xF3,0xFF,0x01,0x04,	// 206
+	0x02,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x02,	// 207
+	0x00,0x04,0x00,0x00,0x04,0x00,0xF0,0xFF,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x20,0x80,0x00,0x40,0x40,0x00,0x80,0x3F,	// 208
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x40,0x00,0x00,0x84,0x00,0x00,0x02,0x03,0x00,0x02,0x04,0x00,0x04,0x18,0x00,0x02,0x20,0x00,0x00,0x40,0x00,0xF0,0xFF,0x01,	// 209
+	0x00,0x00,0x00,0x80,0x3F,0x00,0x40,0x40,0x00,0x20,0x80,0x00,0x11,0x00,0x01,0x12,0x00,0x01,0x14,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x20,0x80,0x00,0xC0,0x7F,	// 210
+	0x00,0x00,0x00,0x80,0x3F,0x00,0x40,0x40,0x00,0x20,0x80,0x00,0x10,0x00,0x01,0x10,0x00,0x01,0x14,0x00,0x01,0x12,0x00,0x01,0x11,0x00,0x01,0x10,0x00,0x01,0x20,0x80,0x00,0xC0,0x7F,	// 211
+	0x00,0x00,0x00,0x80,0x3F,0x00,0x40,0x40,0x00,0x20,0x80,0x00,0x10,0x00,0x01,0x16,0x00,0x01,0x11,0x00,0x01,0x12,0x00,0x01,0x14,0x00,0x01,0x10,0x00,0x01,0x20,0x80,0x00,0xC0,0x7F,	// 212
+	0x00,0x00,0x00,0x80,0x3F,0x00,0x40,0x40,0x00,0x20,0x80,0x00,0x14,0x00,0x01,0x12,0x00,0x01,0x12,0x00,0x01,0x14,0x00,0x01,0x12,0x00,0x01,0x10,0x00,0x01,0x20,0x80,0x00,0xC0,0x7F,	// 213
+	0x00,0x00,0x00,0x80,0x3F,0x00,0x40,0x40,0x00,0x20,0x80,0x00,0x10,0x00,0x01,0x12,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x12,0x00,0x01,0x10,0x00,0x01,0x20,0x80,0x00,0xC0,0x7F,	// 214
+	0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x61,0x00,0x00,0x12,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x12,0x00,0x80,0x61,	// 215
+	0x00,0x00,0x00,0x80,0x3F,0x02,0x40,0x40,0x01,0x20,0xC0,0x00,0x10,0x20,0x01,0x10,0x10,0x01,0x10,0x0C,0x01,0x10,0x02,0x01,0x90,0x01,0x01,0x50,0x00,0x01,0x60,0x80,0x00,0x90,0x7F,	// 216
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x80,0x00,0x01,0x00,0x01,0x02,0x00,0x01,0x04,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0xF0,0xFF,	// 217
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x80,0x00,0x00,0x00,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x02,0x00,0x01,0x01,0x00,0x01,0xF0,0xFF,	// 218
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x80,0x00,0x04,0x00,0x01,0x02,0x00,0x01,0x03,0x00,0x01,0x04,0x00,0x01,0x00,0x00,0x01,0xF0,0xFF,	// 219
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x80,0x00,0x02,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x02,0x00,0x01,0x00,0x00,0x01,0xF0,0xFF,	// 220
+	0x10,0x00,0x00,0x60,0x00,0x00,0x80,0x00,0x00,0x00,0x03,0x00,0x04,0xFC,0x01,0x02,0x04,0x00,0x01,0x03,0x00,0xC1,0x00,0x00,0x30,	// 221
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x80,0x40,0x00,0x80,0x40,0x00,0x80,0x40,0x00,0x80,0x40,0x00,0x00,0x21,0x00,0x00,0x1E,	// 222
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x01,0x10,0x00,0x01,0x10,0x04,0x01,0x10,0x0A,0x01,0x10,0x11,0x01,0xE0,0xF0,0x01,	// 223
+	0x00,0x00,0x00,0x00,0xE2,0x01,0x00,0x21,0x01,0x30,0x11,0x01,0x40,0x11,0x01,0x00,0x11,0x01,0x00,0xFE,0x01,	// 224
+	0x00,0x00,0x00,0x00,0xE2,0x01,0x00,0x21,0x01,0x40,0x11,0x01,0x30,0x11,0x01,0x00,0x11,0x01,0x00,0xFE,0x01,	// 225
+	0x00,0x00,0x00,0x00,0xE2,0x01,0x20,0x21,0x01,0x10,0x11,0x01,0x10,0x11,0x01,0x20,0x11,0x01,0x00,0xFE,0x01,	// 226
+	0x00,0x00,0x00,0x00,0xE2,0x01,0x30,0x21,0x01,0x10,0x11,0x01,0x20,0x11,0x01,0x10,0x11,0x01,0x00,0xFE,0x01,	// 227
+	0x00,0x00,0x00,0x00,0xE2,0x01,0x20,0x21,0x01,0x00,0x11,0x01,0x00,0x11,0x01,0x20,0x11,0x01,0x00,0xFE,0x01,	// 228
+	0x00,0x00,0x00,0x00,0xE2,0x01,0x20,0x21,0x01,0x50,0x11,0x01,0x50,0x11,0x01,0x20,0x11,0x01,0x00,0xFE,0x01,	// 229
+	0x00,0x00,0x00,0x00,0xE2,0x01,0x00,0x11,0x01,0x00,0x09,0x01,0x00,0x09,0x01,0x00,0x89,0x00,0x00,0x7E,0x00,0x00,0x89,0x00,0x00,0x09,0x01,0x00,0x09,0x01,0x00,0x09,0x01,0x00,0x09,0x01,0x00,0x0E,	// 230
+	0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x01,0x01,0x00,0x01,0x09,0x00,0x01,0x0A,0x00,0x01,0x0D,0x00,0x01,0x01,	// 231
+	0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x09,0x01,0x10,0x09,0x01,0x20,0x09,0x01,0x00,0x09,0x01,0x00,0x09,0x01,0x00,0x8E,	// 232
+	0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x09,0x01,0x00,0x09,0x01,0x20,0x09,0x01,0x10,0x09,0x01,0x00,0x09,0x01,0x00,0x8E,	// 233
+	0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x09,0x01,0x20,0x09,0x01,0x10,0x09,0x01,0x20,0x09,0x01,0x40,0x09,0x01,0x00,0x8E,	// 234
+	0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x09,0x01,0x20,0x09,0x01,0x00,0x09,0x01,0x00,0x09,0x01,0x20,0x09,0x01,0x00,0x8E,	// 235
+	0x10,0x00,0x00,0x30,0xFF,0x01,	// 236
+	0x00,0x00,0x00,0x20,0xFF,0x01,0x10,	// 237
+	0x20,0x00,0x00,0x10,0xFF,0x01,0x20,0x00,0x00,0x40,	// 238
+	0x20,0x00,0x00,0x00,0xFF,0x01,0x20,	// 239
+	0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x02,0x01,0x10,0x01,0x01,0x50,0x01,0x01,0x20,0x01,0x01,0x50,0x02,0x01,0x80,0xFF,	// 240
+	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xFF,0x01,0x10,0x01,0x00,0x10,0x01,0x00,0x20,0x01,0x00,0x10,0x01,0x00,0x00,0xFE,0x01,	// 241
+	0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x01,0x01,0x10,0x01,0x01,0x20,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0xFE,	// 242
+	0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x01,0x01,0x00,0x01,0x01,0x20,0x01,0x01,0x10,0x01,0x01,0x00,0x01,0x01,0x00,0xFE,	// 243
+	0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x01,0x01,0x20,0x01,0x01,0x10,0x01,0x01,0x20,0x01,0x01,0x40,0x01,0x01,0x00,0xFE,	// 244
+	0x00,0x00,0x00,0x00,0xFE,0x00,0x20,0x01,0x01,0x10,0x01,0x01,0x10,0x01,0x01,0x20,0x01,0x01,0x10,0x01,0x01,0x00,0xFE,	// 245
+	0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x01,0x01,0x20,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x20,0x01,0x01,0x00,0xFE,	// 246
+	0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x49,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,	// 247
+	0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x81,0x01,0x00,0x41,0x01,0x00,0x31,0x01,0x00,0x09,0x01,0x00,0x05,0x01,0x00,0xFF,	// 248
+	0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x01,0x10,0x00,0x01,0x20,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0xFF,0x01,	// 249
+	0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x20,0x00,0x01,0x10,0x00,0x01,0x00,0x00,0x01,0x00,0xFF,0x01,	// 250
+	0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x01,0x20,0x00,0x01,0x10,0x00,0x01,0x20,0x00,0x01,0x40,0x00,0x01,0x00,0xFF,0x01,	// 251
+	0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x01,0x20,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x20,0x00,0x01,0x00,0xFF,0x01,	// 252
+	0x00,0x01,0x00,0x00,0x06,0x00,0x00,0x38,0x08,0x00,0xC0,0x06,0x20,0x80,0x01,0x10,0x70,0x00,0x00,0x0C,0x00,0x00,0x03,	// 253
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x0F,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0x01,0x01,0x00,0xFE,	// 254
+	0x00,0x01,0x00,0x00,0x06,0x00,0x00,0x38,0x08,0x20,0xC0,0x06,0x00,0x80,0x01,0x20,0x70,0x00,0x00,0x0C,0x00,0x00,0x03	// 255
+};
+
+
+// Created by http://oleddisplay.squix.ch/ Consider a donation
+// In case of problems make sure that you are using the font file with the correct version!
+const uint8_t Lato_Hairline_18[] PROGMEM = {
+	0x12, // Width: 18
+	0x16, // Height: 22
+	0x20, // First Char: 32
+	0xE0, // Numbers of Chars: 224
+
+	// Jump Table:
+	0xFF, 0xFF, 0x00, 0x05,  // 32:65535
+	0x00, 0x00, 0x09, 0x04,  // 33:0
+	0x00, 0x09, 0x0B, 0x06,  // 34:9
+	0x00, 0x14, 0x1D, 0x0A,  // 35:20
+	0x00, 0x31, 0x1B, 0x0A,  // 36:49
+	0x00, 0x4C, 0x27, 0x0E,  // 37:76
+	0x00, 0x73, 0x24, 0x0C,  // 38:115
+	0x00, 0x97, 0x05, 0x03,  // 39:151
+	0x00, 0x9C, 0x0C, 0x05,  // 40:156
+	0x00, 0xA8, 0x09, 0x05,  // 41:168
+	0x00, 0xB1, 0x11, 0x08,  // 42:177
+	0x00, 0xC2, 0x1A, 0x0A,  // 43:194
+	0x00, 0xDC, 0x09, 0x04,  // 44:220
+	0x00, 0xE5, 0x0E, 0x07,  // 45:229
+	0x00, 0xF3, 0x09, 0x04,  // 46:243
+	0x00, 0xFC, 0x13, 0x08,  // 47:252
+	0x01, 0x0F, 0x1D, 0x0A,  // 48:271
+	0x01, 0x2C, 0x1B, 0x0A,  // 49:300
+	0x01, 0x47, 0x1B, 0x0A,  // 50:327
+	0x01, 0x62, 0x1B, 0x0A,  // 51:354
+	0x01, 0x7D, 0x1D, 0x0A,  // 52:381
+	0x01, 0x9A, 0x1A, 0x0A,  // 53:410
+	0x01, 0xB4, 0x1B, 0x0A,  // 54:436
+	0x01, 0xCF, 0x1C, 0x0A,  // 55:463
+	0x01, 0xEB, 0x1B, 0x0A,  // 56:491
+	0x02, 0x06, 0x1A, 0x0A,  // 57:518
+	0x02, 0x20, 0x09, 0x04,  // 58:544
+	0x02, 0x29, 0x09, 0x04,  // 59:553
+	0x02, 0x32, 0x17, 0x0A,  // 60:562
+	0x02, 0x49, 0x1A, 0x0A,  // 61:585
+	0x02, 0x63, 0x1A, 0x0A,  // 62:611
+	0x02, 0x7D, 0x14, 0x08,  // 63:637
+	0x02, 0x91, 0x29, 0x0F,  // 64:657
+	0x02, 0xBA, 0x21, 0x0B,  // 65:698
+	0x02, 0xDB, 0x1E, 0x0B,  // 66:731
+	0x02, 0xF9, 0x24, 0x0C,  // 67:761
+	0x03, 0x1D, 0x23, 0x0E,  // 68:797
+	0x03, 0x40, 0x1B, 0x0A,  // 69:832
+	0x03, 0x5B, 0x1A, 0x0A,  // 70:859
+	0x03, 0x75, 0x24, 0x0D,  // 71:885
+	0x03, 0x99, 0x21, 0x0D,  // 72:921
+	0x03, 0xBA, 0x09, 0x04,  // 73:954
+	0x03, 0xC3, 0x0F, 0x07,  // 74:963
+	0x03, 0xD2, 0x21, 0x0B,  // 75:978
+	0x03, 0xF3, 0x1B, 0x09,  // 76:1011
+	0x04, 0x0E, 0x2A, 0x10,  // 77:1038
+	0x04, 0x38, 0x21, 0x0D,  // 78:1080
+	0x04, 0x59, 0x26, 0x0E,  // 79:1113
+	0x04, 0x7F, 0x1A, 0x0A,  // 80:1151
+	0x04, 0x99, 0x27, 0x0E,  // 81:1177
+	0x04, 0xC0, 0x1E, 0x0B,  // 82:1216
+	0x04, 0xDE, 0x18, 0x0A,  // 83:1246
+	0x04, 0xF6, 0x1C, 0x0A,  // 84:1270
+	0x05, 0x12, 0x20, 0x0D,  // 85:1298
+	0x05, 0x32, 0x1F, 0x0B,  // 86:1330
+	0x05, 0x51, 0x32, 0x12,  // 87:1361
+	0x05, 0x83, 0x1E, 0x0B,  // 88:1411
+	0x05, 0xA1, 0x1C, 0x0A,  // 89:1441
+	0x05, 0xBD, 0x1E, 0x0B,  // 90:1469
+	0x05, 0xDB, 0x0C, 0x05,  // 91:1499
+	0x05, 0xE7, 0x15, 0x08,  // 92:1511
+	0x05, 0xFC, 0x09, 0x05,  // 93:1532
+	0x06, 0x05, 0x1A, 0x0A,  // 94:1541
+	0x06, 0x1F, 0x18, 0x08,  // 95:1567
+	0x06, 0x37, 0x0A, 0x07,  // 96:1591
+	0x06, 0x41, 0x15, 0x09,  // 97:1601
+	0x06, 0x56, 0x1A, 0x0A,  // 98:1622
+	0x06, 0x70, 0x18, 0x08,  // 99:1648
+	0x06, 0x88, 0x18, 0x0A,  // 100:1672
+	0x06, 0xA0, 0x18, 0x09,  // 101:1696
+	0x06, 0xB8, 0x10, 0x06,  // 102:1720
+	0x06, 0xC8, 0x18, 0x09,  // 103:1736
+	0x06, 0xE0, 0x18, 0x0A,  // 104:1760
+	0x06, 0xF8, 0x06, 0x04,  // 105:1784
+	0x06, 0xFE, 0x06, 0x04,  // 106:1790
+	0x07, 0x04, 0x18, 0x08,  // 107:1796
+	0x07, 0x1C, 0x06, 0x04,  // 108:1820
+	0x07, 0x22, 0x27, 0x0E,  // 109:1826
+	0x07, 0x49, 0x18, 0x0A,  // 110:1865
+	0x07, 0x61, 0x1A, 0x0A,  // 111:1889
+	0x07, 0x7B, 0x1A, 0x0A,  // 112:1915
+	0x07, 0x95, 0x18, 0x0A,  // 113:1941
+	0x07, 0xAD, 0x11, 0x06,  // 114:1965
+	0x07, 0xBE, 0x15, 0x08,  // 115:1982
+	0x07, 0xD3, 0x12, 0x06,  // 116:2003
+	0x07, 0xE5, 0x18, 0x0A,  // 117:2021
+	0x07, 0xFD, 0x17, 0x09,  // 118:2045
+	0x08, 0x14, 0x26, 0x0D,  // 119:2068
+	0x08, 0x3A, 0x15, 0x08,  // 120:2106
+	0x08, 0x4F, 0x17, 0x09,  // 121:2127
+	0x08, 0x66, 0x15, 0x08,  // 122:2150
+	0x08, 0x7B, 0x0C, 0x05,  // 123:2171
+	0x08, 0x87, 0x09, 0x04,  // 124:2183
+	0x08, 0x90, 0x0C, 0x05,  // 125:2192
+	0x08, 0x9C, 0x1A, 0x0A,  // 126:2204
+	0x08, 0xB6, 0x18, 0x09,  // 127:2230
+	0x08, 0xCE, 0x18, 0x09,  // 128:2254
+	0x08, 0xE6, 0x18, 0x09,  // 129:2278
+	0x08, 0xFE, 0x18, 0x09,  // 130:2302
+	0x09, 0x16, 0x18, 0x09,  // 131:2326
+	0x09, 0x2E, 0x18, 0x09,  // 132:2350
+	0x09, 0x46, 0x18, 0x09,  // 133:2374
+	0x09, 0x5E, 0x18, 0x09,  // 134:2398
+	0x09, 0x76, 0x18, 0x09,  // 135:2422
+	0x09, 0x8E, 0x18, 0x09,  // 136:2446
+	0x09, 0xA6, 0x18, 0x09,  // 137:2470
+	0x09, 0xBE, 0x18, 0x09,  // 138:2494
+	0x09, 0xD6, 0x18, 0x09,  // 139:2518
+	0x09, 0xEE, 0x18, 0x09,  // 140:2542
+	0x0A, 0x06, 0x18, 0x09,  // 141:2566
+	0x0A, 0x1E, 0x18, 0x09,  // 142:2590
+	0x0A, 0x36, 0x18, 0x09,  // 143:2614
+	0x0A, 0x4E, 0x18, 0x09,  // 144:2638
+	0x0A, 0x66, 0x18, 0x09,  // 145:2662
+	0x0A, 0x7E, 0x18, 0x09,  // 146:2686
+	0x0A, 0x96, 0x18, 0x09,  // 147:2710
+	0x0A, 0xAE, 0x18, 0x09,  // 148:2734
+	0x0A, 0xC6, 0x18, 0x09,  // 149:2758
+	0x0A, 0xDE, 0x18, 0x09,  // 150:2782
+	0x0A, 0xF6, 0x18, 0x09,  // 151:2806
+	0x0B, 0x0E, 0x18, 0x09,  // 152:2830
+	0x0B, 0x26, 0x18, 0x09,  // 153:2854
+	0x0B, 0x3E, 0x18, 0x09,  // 154:2878
+	0x0B, 0x56, 0x18, 0x09,  // 155:2902
+	0x0B, 0x6E, 0x18, 0x09,  // 156:2926
+	0x0B, 0x86, 0x18, 0x09,  // 157:2950
+	0x0B, 0x9E, 0x18, 0x09,  // 158:2974
+	0x0B, 0xB6, 0x18, 0x09,  // 159:2998
+	0xFF, 0xFF, 0x00, 0x05,  // 160:65535
+	0x0B, 0xCE, 0x06, 0x04,  // 161:3022
+	0x0B, 0xD4, 0x1B, 0x0A,  // 162:3028
+	0x0B, 0xEF, 0x1E, 0x0A,  // 163:3055
+	0x0C, 0x0D, 0x1A, 0x0A,  // 164:3085
+	0x0C, 0x27, 0x1A, 0x0A,  // 165:3111
+	0x0C, 0x41, 0x09, 0x04,  // 166:3137
+	0x0C, 0x4A, 0x15, 0x09,  // 167:3146
+	0x0C, 0x5F, 0x10, 0x07,  // 168:3167
+	0x0C, 0x6F, 0x29, 0x0F,  // 169:3183
+	0x0C, 0x98, 0x0E, 0x07,  // 170:3224
+	0x0C, 0xA6, 0x0F, 0x07,  // 171:3238
+	0x0C, 0xB5, 0x1A, 0x0A,  // 172:3253
+	0x0C, 0xCF, 0x0E, 0x07,  // 173:3279
+	0x0C, 0xDD, 0x29, 0x0F,  // 174:3293
+	0x0D, 0x06, 0x10, 0x07,  // 175:3334
+	0x0D, 0x16, 0x11, 0x07,  // 176:3350
+	0x0D, 0x27, 0x1B, 0x0A,  // 177:3367
+	0x0D, 0x42, 0x0E, 0x06,  // 178:3394
+	0x0D, 0x50, 0x0E, 0x06,  // 179:3408
+	0x0D, 0x5E, 0x0D, 0x07,  // 180:3422
+	0x0D, 0x6B, 0x21, 0x0B,  // 181:3435
+	0x0D, 0x8C, 0x1F, 0x0B,  // 182:3468
+	0x0D, 0xAB, 0x08, 0x04,  // 183:3499
+	0x0D, 0xB3, 0x0F, 0x07,  // 184:3507
+	0x0D, 0xC2, 0x0E, 0x06,  // 185:3522
+	0x0D, 0xD0, 0x11, 0x07,  // 186:3536
+	0x0D, 0xE1, 0x11, 0x07,  // 187:3553
+	0x0D, 0xF2, 0x24, 0x0D,  // 188:3570
+	0x0E, 0x16, 0x24, 0x0D,  // 189:3606
+	0x0E, 0x3A, 0x24, 0x0D,  // 190:3642
+	0x0E, 0x5E, 0x12, 0x07,  // 191:3678
+	0x0E, 0x70, 0x21, 0x0B,  // 192:3696
+	0x0E, 0x91, 0x21, 0x0B,  // 193:3729
+	0x0E, 0xB2, 0x21, 0x0B,  // 194:3762
+	0x0E, 0xD3, 0x21, 0x0B,  // 195:3795
+	0x0E, 0xF4, 0x21, 0x0B,  // 196:3828
+	0x0F, 0x15, 0x21, 0x0B,  // 197:3861
+	0x0F, 0x36, 0x30, 0x11,  // 198:3894
+	0x0F, 0x66, 0x24, 0x0C,  // 199:3942
+	0x0F, 0x8A, 0x1B, 0x0A,  // 200:3978
+	0x0F, 0xA5, 0x1B, 0x0A,  // 201:4005
+	0x0F, 0xC0, 0x1B, 0x0A,  // 202:4032
+	0x0F, 0xDB, 0x1B, 0x0A,  // 203:4059
+	0x0F, 0xF6, 0x09, 0x04,  // 204:4086
+	0x0F, 0xFF, 0x0A, 0x04,  // 205:4095
+	0x10, 0x09, 0x0A, 0x04,  // 206:4105
+	0x10, 0x13, 0x0A, 0x04,  // 207:4115
+	0x10, 0x1D, 0x26, 0x0E,  // 208:4125
+	0x10, 0x43, 0x21, 0x0D,  // 209:4163
+	0x10, 0x64, 0x26, 0x0E,  // 210:4196
+	0x10, 0x8A, 0x26, 0x0E,  // 211:4234
+	0x10, 0xB0, 0x26, 0x0E,  // 212:4272
+	0x10, 0xD6, 0x26, 0x0E,  // 213:4310
+	0x10, 0xFC, 0x26, 0x0E,  // 214:4348
+	0x11, 0x22, 0x1A, 0x0A,  // 215:4386
+	0x11, 0x3C, 0x26, 0x0E,  // 216:4412
+	0x11, 0x62, 0x20, 0x0D,  // 217:4450
+	0x11, 0x82, 0x20, 0x0D,  // 218:4482
+	0x11, 0xA2, 0x20, 0x0D,  // 219:4514
+	0x11, 0xC2, 0x20, 0x0D,  // 220:4546
+	0x11, 0xE2, 0x1C, 0x0A,  // 221:4578
+	0x11, 0xFE, 0x1A, 0x0A,  // 222:4606
+	0x12, 0x18, 0x1B, 0x0A,  // 223:4632
+	0x12, 0x33, 0x15, 0x09,  // 224:4659
+	0x12, 0x48, 0x15, 0x09,  // 225:4680
+	0x12, 0x5D, 0x15, 0x09,  // 226:4701
+	0x12, 0x72, 0x15, 0x09,  // 227:4722
+	0x12, 0x87, 0x15, 0x09,  // 228:4743
+	0x12, 0x9C, 0x15, 0x09,  // 229:4764
+	0x12, 0xB1, 0x27, 0x0E,  // 230:4785
+	0x12, 0xD8, 0x18, 0x08,  // 231:4824
+	0x12, 0xF0, 0x18, 0x09,  // 232:4848
+	0x13, 0x08, 0x18, 0x09,  // 233:4872
+	0x13, 0x20, 0x18, 0x09,  // 234:4896
+	0x13, 0x38, 0x18, 0x09,  // 235:4920
+	0x13, 0x50, 0x07, 0x04,  // 236:4944
+	0x13, 0x57, 0x07, 0x04,  // 237:4951
+	0x13, 0x5E, 0x0A, 0x04,  // 238:4958
+	0x13, 0x68, 0x07, 0x04,  // 239:4968
+	0x13, 0x6F, 0x1A, 0x0A,  // 240:4975
+	0x13, 0x89, 0x18, 0x0A,  // 241:5001
+	0x13, 0xA1, 0x1A, 0x0A,  // 242:5025
+	0x13, 0xBB, 0x1A, 0x0A,  // 243:5051
+	0x13, 0xD5, 0x1A, 0x0A,  // 244:5077
+	0x13, 0xEF, 0x1A, 0x0A,  // 245:5103
+	0x14, 0x09, 0x1A, 0x0A,  // 246:5129
+	0x14, 0x23, 0x1A, 0x0A,  // 247:5155
+	0x14, 0x3D, 0x1A, 0x0A,  // 248:5181
+	0x14, 0x57, 0x18, 0x0A,  // 249:5207
+	0x14, 0x6F, 0x18, 0x0A,  // 250:5231
+	0x14, 0x87, 0x18, 0x0A,  // 251:5255
+	0x14, 0x9F, 0x18, 0x0A,  // 252:5279
+	0x14, 0xB7, 0x17, 0x09,  // 253:5303
+	0x14, 0xCE, 0x1A, 0x0A,  // 254:5326
+	0x14, 0xE8, 0x17, 0x09,  // 255:5352
+
+	// Font Data:
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x1F,0x02,	// 33
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0xE0,0x01,	// 34
+	0x00,0x00,0x00,0x00,0x22,0x00,0x00,0xE2,0x03,0x00,0x3E,0x00,0xE0,0x21,0x00,0x00,0xA2,0x03,0x00,0x7E,0x00,0xC0,0x23,0x00,0x20,0x22,0x00,0x00,0x02,	// 35
+	0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x03,0x01,0x20,0x04,0x02,0x20,0x04,0x02,0xF8,0xFF,0x0F,0x20,0x08,0x02,0x20,0x10,0x02,0x00,0xF0,0x01,	// 36
+	0x00,0x00,0x00,0xC0,0x07,0x00,0x20,0x08,0x02,0x20,0x08,0x01,0x20,0xC8,0x00,0xC0,0x27,0x00,0x00,0x18,0x00,0x00,0xE4,0x00,0x00,0x13,0x03,0x80,0x08,0x02,0x60,0x08,0x02,0x00,0x08,0x02,0x00,0xF0,0x01,	// 37
+	0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x10,0x02,0xC0,0x0B,0x02,0x20,0x04,0x02,0x20,0x08,0x02,0x20,0x10,0x02,0x20,0x20,0x02,0x40,0x40,0x01,0x00,0xC0,0x00,0x00,0x30,0x01,0x00,0x00,0x02,	// 38
+	0x00,0x00,0x00,0xE0,0x01,	// 39
+	0x00,0x00,0x00,0x00,0xFF,0x01,0xC0,0x00,0x06,0x30,0x00,0x08,	// 40
+	0x00,0x00,0x00,0x70,0x00,0x0C,0x80,0xFF,0x03,	// 41
+	0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x01,0x00,0xE0,0x03,0x00,0x80,0x00,0x00,0x40,0x01,	// 42
+	0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x80,0xFF,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,	// 43
+	0x00,0x00,0x00,0x00,0x00,0x0A,0x00,0x00,0x04,	// 44
+	0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,	// 45
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,	// 46
+	0x00,0x00,0x00,0x00,0x00,0x03,0x00,0xC0,0x00,0x00,0x38,0x00,0x00,0x06,0x00,0x80,0x01,0x00,0x60,	// 47
+	0x00,0x00,0x00,0x80,0xFF,0x00,0x40,0x00,0x01,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0xC0,0x80,0x01,0x00,0x7F,	// 48
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x80,0x00,0x02,0x40,0x00,0x02,0xE0,0xFF,0x03,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,	// 49
+	0x00,0x00,0x00,0x80,0x00,0x02,0x40,0x00,0x03,0x20,0x80,0x02,0x20,0x40,0x02,0x20,0x20,0x02,0x20,0x10,0x02,0x20,0x08,0x02,0xC0,0x07,0x02,	// 50
+	0x00,0x00,0x00,0x80,0x80,0x01,0x40,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x14,0x02,0xC0,0xF3,0x01,	// 51
+	0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x58,0x00,0x00,0x44,0x00,0x00,0x43,0x00,0x80,0x40,0x00,0x60,0x40,0x00,0x80,0xFF,0x03,0x00,0x40,0x00,0x00,0x40,	// 52
+	0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x07,0x02,0x20,0x04,0x02,0x20,0x04,0x02,0x20,0x04,0x02,0x20,0x04,0x02,0x20,0x08,0x01,0x20,0xF0,	// 53
+	0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x0C,0x01,0x00,0x0A,0x02,0x00,0x05,0x02,0xC0,0x04,0x02,0x20,0x04,0x02,0x00,0x08,0x02,0x00,0xF8,0x01,	// 54
+	0x00,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x03,0x20,0xC0,0x00,0x20,0x30,0x00,0x20,0x0C,0x00,0x20,0x03,0x00,0xE0,0x00,0x00,0x20,	// 55
+	0x00,0x00,0x00,0x80,0xE1,0x01,0x40,0x16,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x14,0x02,0xC0,0xF3,0x01,	// 56
+	0x00,0x00,0x00,0x80,0x07,0x00,0x40,0x08,0x00,0x20,0x10,0x02,0x20,0x10,0x01,0x20,0xD0,0x00,0x20,0x30,0x00,0x20,0x18,0x00,0xC0,0x07,	// 57
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,	// 58
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x0E,	// 59
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x42,0x00,0x00,0x42,	// 60
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x24,	// 61
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x00,0x00,0x42,0x00,0x00,0x42,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x18,0x00,0x00,0x10,	// 62
+	0x00,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x38,0x02,0x20,0x04,0x00,0x20,0x02,0x00,0xC0,0x01,	// 63
+	0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x02,0x02,0x00,0x01,0x04,0x80,0xE0,0x08,0x40,0x10,0x11,0x40,0x08,0x11,0x40,0x04,0x11,0x40,0x84,0x10,0x40,0x7C,0x11,0x80,0x00,0x11,0x80,0x00,0x09,0x00,0x81,0x08,0x00,0x7E,	// 64
+	0x00,0x00,0x02,0x00,0xC0,0x01,0x00,0x30,0x00,0x00,0x2E,0x00,0x80,0x21,0x00,0x60,0x20,0x00,0x80,0x20,0x00,0x00,0x27,0x00,0x00,0x38,0x00,0x00,0xC0,0x00,0x00,0x00,0x03,	// 65
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x40,0x16,0x02,0x80,0xE1,0x01,	// 66
+	0x00,0x00,0x00,0x00,0x7F,0x00,0x80,0x80,0x00,0x40,0x00,0x01,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x40,0x00,0x01,0x40,0x00,0x01,	// 67
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x40,0x00,0x01,0x80,0xFF,	// 68
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x00,0x02,	// 69
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x20,0x08,0x00,0x20,0x08,0x00,0x20,0x08,0x00,0x20,0x08,0x00,0x20,0x08,0x00,0x20,0x08,	// 70
+	0x00,0x00,0x00,0x00,0x7F,0x00,0x80,0x80,0x00,0x40,0x00,0x01,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x10,0x02,0x20,0x10,0x02,0x40,0xF0,0x01,	// 71
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0xE0,0xFF,0x03,	// 72
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,	// 73
+	0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0xE0,0xFF,0x01,	// 74
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x08,0x00,0x00,0x14,0x00,0x00,0x22,0x00,0x00,0x41,0x00,0x80,0x80,0x00,0x40,0x00,0x01,0x20,0x00,0x01,0x00,0x00,0x02,	// 75
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,	// 76
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x80,0x00,0x00,0x00,0x03,0x00,0x00,0x0C,0x00,0x00,0x30,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x30,0x00,0x00,0x0C,0x00,0x00,0x03,0x00,0x80,0x00,0x00,0xE0,0xFF,0x03,	// 77
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x80,0x00,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x0C,0x00,0x00,0x10,0x00,0x00,0x60,0x00,0x00,0x80,0x00,0xE0,0xFF,0x03,	// 78
+	0x00,0x00,0x00,0x00,0x7F,0x00,0x80,0x80,0x00,0x40,0x00,0x01,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x40,0x00,0x01,0x80,0x80,0x00,0x00,0x7F,	// 79
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x20,0x10,0x00,0x20,0x10,0x00,0x20,0x10,0x00,0x20,0x10,0x00,0x20,0x08,0x00,0xC0,0x07,	// 80
+	0x00,0x00,0x00,0x00,0x7F,0x00,0x80,0x80,0x00,0x40,0x00,0x01,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x40,0x00,0x05,0x80,0x80,0x08,0x00,0x7F,0x10,	// 81
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x20,0x08,0x00,0x20,0x08,0x00,0x20,0x18,0x00,0x20,0x28,0x00,0x20,0x44,0x00,0xC0,0x83,0x01,0x00,0x00,0x02,	// 82
+	0x00,0x00,0x00,0x80,0x01,0x01,0x40,0x02,0x02,0x20,0x04,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0xF0,0x01,	// 83
+	0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0xE0,0xFF,0x03,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,	// 84
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x01,0xE0,0xFF,	// 85
+	0x20,0x00,0x00,0xC0,0x01,0x00,0x00,0x06,0x00,0x00,0x38,0x00,0x00,0xC0,0x00,0x00,0x00,0x03,0x00,0x80,0x00,0x00,0x70,0x00,0x00,0x0C,0x00,0x80,0x03,0x00,0x60,	// 86
+	0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x1E,0x00,0x00,0xE0,0x00,0x00,0x00,0x03,0x00,0xC0,0x00,0x00,0x38,0x00,0x00,0x07,0x00,0xE0,0x00,0x00,0xC0,0x00,0x00,0x00,0x07,0x00,0x00,0x38,0x00,0x00,0xC0,0x01,0x00,0x00,0x03,0x00,0xE0,0x00,0x00,0x1E,0x00,0xE0,0x01,	// 87
+	0x00,0x00,0x00,0x60,0x00,0x03,0x80,0x80,0x00,0x00,0x61,0x00,0x00,0x16,0x00,0x00,0x0C,0x00,0x00,0x32,0x00,0x00,0x41,0x00,0xC0,0x80,0x00,0x20,0x00,0x03,	// 88
+	0x20,0x00,0x00,0x40,0x00,0x00,0x80,0x01,0x00,0x00,0x06,0x00,0x00,0x08,0x00,0x00,0xF8,0x03,0x00,0x04,0x00,0x00,0x03,0x00,0xC0,0x00,0x00,0x20,	// 89
+	0x00,0x00,0x00,0x20,0x00,0x03,0x20,0x80,0x02,0x20,0x60,0x02,0x20,0x10,0x02,0x20,0x08,0x02,0x20,0x06,0x02,0x20,0x01,0x02,0xE0,0x00,0x02,0x20,0x00,0x02,	// 90
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x10,0x00,0x10,	// 91
+	0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x03,0x00,0x00,0x0C,0x00,0x00,0x70,0x00,0x00,0x80,0x01,0x00,0x00,0x02,	// 92
+	0x00,0x00,0x00,0x10,0x00,0x10,0xF0,0xFF,0x1F,	// 93
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x01,0x00,0x40,0x00,0x00,0x60,0x00,0x00,0x80,0x00,0x00,0x00,0x03,0x00,0x00,0x04,	// 94
+	0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,	// 95
+	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x40,	// 96
+	0x00,0x00,0x00,0x00,0xC4,0x03,0x00,0x42,0x02,0x00,0x22,0x02,0x00,0x22,0x02,0x00,0x22,0x02,0x00,0xFC,0x03,	// 97
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x04,0x01,0x00,0xF8,	// 98
+	0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x04,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x00,0x01,	// 99
+	0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x04,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0xE0,0xFF,0x03,	// 100
+	0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x12,0x01,0x00,0x12,0x02,0x00,0x12,0x02,0x00,0x12,0x02,0x00,0x12,0x02,0x00,0x1C,0x02,	// 101
+	0x00,0x00,0x00,0x00,0x02,0x00,0xC0,0xFF,0x03,0x20,0x02,0x00,0x20,0x02,0x00,0x20,	// 102
+	0x00,0x00,0x00,0x00,0x9C,0x0E,0x00,0x62,0x11,0x00,0x42,0x11,0x00,0x42,0x11,0x00,0x42,0x11,0x00,0x22,0x11,0x00,0x1E,0x0E,	// 103
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0xFC,0x03,	// 104
+	0x00,0x00,0x00,0x20,0xFE,0x03,	// 105
+	0x00,0x00,0x10,0x20,0xFE,0x1F,	// 106
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x50,0x00,0x00,0x88,0x00,0x00,0x04,0x01,0x00,0x02,0x01,0x00,0x00,0x02,	// 107
+	0x00,0x00,0x00,0xE0,0xFF,0x03,	// 108
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0xFC,0x03,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0xFC,0x03,	// 109
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0xFC,0x03,	// 110
+	0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x04,0x01,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x04,0x01,0x00,0xF8,	// 111
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x04,0x01,0x00,0xF8,	// 112
+	0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x04,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0xFE,0x1F,	// 113
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,	// 114
+	0x00,0x00,0x00,0x00,0x1C,0x02,0x00,0x12,0x02,0x00,0x22,0x02,0x00,0x22,0x02,0x00,0x22,0x02,0x00,0xC0,0x01,	// 115
+	0x00,0x00,0x00,0x00,0x02,0x00,0xE0,0xFF,0x03,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x00,0x02,	// 116
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0xFE,0x03,	// 117
+	0x00,0x02,0x00,0x00,0x0C,0x00,0x00,0x70,0x00,0x00,0x80,0x01,0x00,0x00,0x02,0x00,0xC0,0x01,0x00,0x30,0x00,0x00,0x0E,	// 118
+	0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0xE0,0x00,0x00,0x00,0x03,0x00,0xC0,0x00,0x00,0x38,0x00,0x00,0x06,0x00,0x00,0x18,0x00,0x00,0xE0,0x00,0x00,0x00,0x03,0x00,0xC0,0x00,0x00,0x38,0x00,0x00,0x06,	// 119
+	0x00,0x00,0x00,0x00,0x06,0x03,0x00,0x88,0x00,0x00,0x50,0x00,0x00,0x70,0x00,0x00,0x88,0x00,0x00,0x06,0x03,	// 120
+	0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x30,0x00,0x00,0xC0,0x19,0x00,0x00,0x07,0x00,0xC0,0x00,0x00,0x30,0x00,0x00,0x0E,	// 121
+	0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x82,0x02,0x00,0x62,0x02,0x00,0x12,0x02,0x00,0x0A,0x02,0x00,0x06,0x02,	// 122
+	0x00,0x00,0x00,0xC0,0x10,0x06,0x20,0xEF,0x09,0x10,0x00,0x10,	// 123
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x1F,	// 124
+	0x00,0x00,0x00,0x10,0x00,0x10,0x10,0xEE,0x10,0xE0,0x11,0x0F,	// 125
+	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x10,	// 126
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 127
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 128
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 129
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 130
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 131
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 132
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 133
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 134
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 135
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 136
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 137
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 138
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 139
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 140
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 141
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 142
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 143
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 144
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 145
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 146
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 147
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 148
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 149
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 150
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 151
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 152
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 153
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 154
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 155
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 156
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 157
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 158
+	0xE0,0xFF,0x03,0x20,0x00,0x02,0xA0,0x00,0x02,0xA0,0x00,0x02,0xA0,0x98,0x02,0xA0,0x04,0x02,0x20,0x03,0x02,0xE0,0xFF,0x03,	// 159
+	0x00,0x00,0x00,0x00,0xE2,0x1F,	// 161
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0xFE,0x0F,0xC0,0x01,0x02,0x00,0x02,0x02,0x00,0x02,0x02,	// 162
+	0x00,0x00,0x00,0x00,0x10,0x02,0x80,0xFF,0x03,0x40,0x10,0x02,0x20,0x10,0x02,0x20,0x10,0x02,0x20,0x10,0x02,0x20,0x00,0x02,0x40,0x00,0x02,0x00,0x00,0x02,	// 163
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x22,0x00,0x00,0x42,0x00,0x00,0x42,0x00,0x00,0x42,0x00,0x00,0x26,0x00,0x00,0x59,	// 164
+	0x00,0x00,0x00,0x20,0x00,0x00,0xC0,0x30,0x00,0x00,0x33,0x00,0x00,0x3C,0x00,0x00,0xF8,0x03,0x00,0x36,0x00,0x80,0x31,0x00,0x60,0x30,	// 165
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xC7,0x1F,	// 166
+	0x00,0x00,0x00,0x80,0x0C,0x02,0x60,0x13,0x04,0x20,0x22,0x04,0x20,0x22,0x04,0x20,0x42,0x04,0x20,0xFC,0x03,	// 167
+	0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,	// 168
+	0x00,0x00,0x00,0x00,0x3E,0x00,0x80,0xC1,0x00,0x40,0x08,0x01,0x20,0x36,0x02,0x20,0x41,0x02,0xA0,0x80,0x02,0xA0,0x80,0x02,0xA0,0x80,0x02,0xA0,0x80,0x02,0x20,0x41,0x02,0x40,0x00,0x01,0x80,0x80,0x00,0x00,0x7F,	// 169
+	0x00,0x00,0x00,0x00,0x03,0x00,0xA0,0x04,0x00,0xA0,0x04,0x00,0xE0,0x03,	// 170
+	0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x88,0x00,0x00,0x74,0x01,0x00,0x8C,0x01,	// 171
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x38,	// 172
+	0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,	// 173
+	0x00,0x00,0x00,0x00,0x3E,0x00,0x80,0xC1,0x00,0x40,0x00,0x01,0x20,0x00,0x02,0xA0,0xFF,0x02,0xA0,0x08,0x02,0xA0,0x08,0x02,0xA0,0x38,0x02,0x20,0x47,0x02,0x20,0x80,0x02,0x40,0x00,0x01,0x80,0x80,0x00,0x00,0x7F,	// 174
+	0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,	// 175
+	0x00,0x00,0x00,0xC0,0x01,0x00,0x20,0x02,0x00,0x20,0x02,0x00,0x20,0x02,0x00,0xE0,0x01,	// 176
+	0x00,0x00,0x00,0x00,0x10,0x02,0x00,0x10,0x02,0x00,0x10,0x02,0x00,0x10,0x02,0x00,0xFF,0x02,0x00,0x10,0x02,0x00,0x10,0x02,0x00,0x10,0x02,	// 177
+	0x00,0x00,0x00,0x10,0x02,0x00,0x08,0x03,0x00,0x88,0x02,0x00,0x70,0x02,	// 178
+	0x00,0x00,0x00,0x10,0x01,0x00,0x08,0x02,0x00,0x48,0x02,0x00,0xB0,0x01,	// 179
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x20,	// 180
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x01,0x00,0xFE,0x03,0x00,0x00,0x02,0x00,0x00,0x02,	// 181
+	0x00,0x00,0x00,0xC0,0x03,0x00,0xE0,0x07,0x00,0xE0,0x07,0x00,0xE0,0xFF,0x07,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0xE0,0xFF,0x07,0x20,0x00,0x00,0x20,	// 182
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,	// 183
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x14,0x00,0x00,0x18,	// 184
+	0x00,0x00,0x00,0x10,0x00,0x00,0x08,0x02,0x00,0xF0,0x03,0x00,0x00,0x02,	// 185
+	0x00,0x00,0x00,0xC0,0x03,0x00,0x20,0x04,0x00,0x20,0x04,0x00,0x20,0x04,0x00,0xE0,0x03,	// 186
+	0x00,0x00,0x00,0x00,0x04,0x01,0x00,0xD8,0x00,0x00,0x24,0x01,0x00,0xD8,0x00,0x00,0x20,	// 187
+	0x00,0x00,0x00,0x40,0x08,0x00,0xE0,0x0F,0x00,0x00,0x08,0x03,0x00,0xC0,0x00,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x06,0x01,0x80,0xC1,0x01,0x60,0x20,0x01,0x00,0xF0,0x03,0x00,0x00,0x01,	// 188
+	0x00,0x00,0x00,0x40,0x08,0x00,0xE0,0x0F,0x02,0x00,0x88,0x01,0x00,0x68,0x00,0x00,0x10,0x00,0x00,0x0C,0x00,0x00,0x03,0x00,0xC0,0x10,0x02,0x20,0x08,0x03,0x00,0xC8,0x02,0x00,0x30,0x02,	// 189
+	0x00,0x00,0x00,0x40,0x04,0x00,0x20,0x08,0x00,0x20,0x09,0x02,0xE0,0x86,0x01,0x00,0x60,0x00,0x00,0x18,0x00,0x00,0x06,0x00,0x80,0xC1,0x01,0x40,0x20,0x01,0x20,0xF0,0x03,0x00,0x00,0x01,	// 190
+	0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x80,0x10,0x00,0x82,0x10,0x00,0x62,0x10,0x00,0x00,0x10,	// 191
+	0x00,0x00,0x02,0x00,0xC0,0x01,0x00,0x30,0x00,0x02,0x2E,0x00,0x84,0x21,0x00,0x68,0x20,0x00,0x90,0x20,0x00,0x00,0x27,0x00,0x00,0x38,0x00,0x00,0xC0,0x00,0x00,0x00,0x03,	// 192
+	0x00,0x00,0x02,0x00,0xC0,0x01,0x00,0x30,0x00,0x00,0x2E,0x00,0x80,0x21,0x00,0x68,0x20,0x00,0x84,0x20,0x00,0x02,0x27,0x00,0x02,0x38,0x00,0x00,0xC0,0x00,0x00,0x00,0x03,	// 193
+	0x00,0x00,0x02,0x00,0xC0,0x01,0x00,0x30,0x00,0x00,0x2E,0x00,0x8C,0x21,0x00,0x62,0x20,0x00,0x84,0x20,0x00,0x08,0x27,0x00,0x00,0x38,0x00,0x00,0xC0,0x00,0x00,0x00,0x03,	// 194
+	0x00,0x00,0x02,0x00,0xC0,0x01,0x00,0x30,0x00,0x08,0x2E,0x00,0x84,0x21,0x00,0x64,0x20,0x00,0x88,0x20,0x00,0x04,0x27,0x00,0x00,0x38,0x00,0x00,0xC0,0x00,0x00,0x00,0x03,	// 195
+	0x00,0x00,0x02,0x00,0xC0,0x01,0x00,0x30,0x00,0x00,0x2E,0x00,0x84,0x21,0x00,0x60,0x20,0x00,0x80,0x20,0x00,0x04,0x27,0x00,0x00,0x38,0x00,0x00,0xC0,0x00,0x00,0x00,0x03,	// 196
+	0x00,0x00,0x02,0x00,0xC0,0x01,0x00,0x30,0x00,0x00,0x2E,0x00,0x8C,0x21,0x00,0x72,0x20,0x00,0x8C,0x20,0x00,0x00,0x27,0x00,0x00,0x38,0x00,0x00,0xC0,0x00,0x00,0x00,0x03,	// 197
+	0x00,0x00,0x02,0x00,0x80,0x01,0x00,0x40,0x00,0x00,0x38,0x00,0x00,0x24,0x00,0x00,0x23,0x00,0xC0,0x20,0x00,0xE0,0x20,0x00,0x20,0xFF,0x00,0x20,0x08,0x03,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x00,0x02,	// 198
+	0x00,0x00,0x00,0x00,0x7F,0x00,0x80,0x80,0x00,0x40,0x00,0x01,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x14,0x20,0x00,0x1A,0x20,0x00,0x1A,0x20,0x00,0x02,0x40,0x00,0x01,0x40,0x00,0x01,	// 199
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x22,0x08,0x02,0x24,0x08,0x02,0x28,0x08,0x02,0x28,0x08,0x02,0x20,0x08,0x02,0x20,0x00,0x02,	// 200
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x20,0x08,0x02,0x20,0x08,0x02,0x28,0x08,0x02,0x24,0x08,0x02,0x24,0x08,0x02,0x22,0x00,0x02,	// 201
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x20,0x08,0x02,0x28,0x08,0x02,0x26,0x08,0x02,0x24,0x08,0x02,0x28,0x08,0x02,0x20,0x00,0x02,	// 202
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x20,0x08,0x02,0x24,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x24,0x08,0x02,0x20,0x00,0x02,	// 203
+	0x02,0x00,0x00,0x04,0x00,0x00,0xE8,0xFF,0x03,	// 204
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0xFF,0x03,0x04,	// 205
+	0x08,0x00,0x00,0x04,0x00,0x00,0xE6,0xFF,0x03,0x08,	// 206
+	0x04,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x04,	// 207
+	0x00,0x08,0x00,0x00,0x08,0x00,0xE0,0xFF,0x03,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x40,0x00,0x01,0x80,0xC1,0x00,0x00,0x3E,	// 208
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x80,0x00,0x00,0x08,0x01,0x00,0x04,0x02,0x00,0x04,0x0C,0x00,0x08,0x10,0x00,0x08,0x60,0x00,0x04,0x80,0x00,0xE0,0xFF,0x03,	// 209
+	0x00,0x00,0x00,0x00,0x7F,0x00,0x80,0x80,0x00,0x40,0x00,0x01,0x20,0x00,0x02,0x22,0x00,0x02,0x24,0x00,0x02,0x28,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x40,0x00,0x01,0x80,0x80,0x00,0x00,0x7F,	// 210
+	0x00,0x00,0x00,0x00,0x7F,0x00,0x80,0x80,0x00,0x40,0x00,0x01,0x20,0x00,0x02,0x20,0x00,0x02,0x28,0x00,0x02,0x28,0x00,0x02,0x24,0x00,0x02,0x22,0x00,0x02,0x40,0x00,0x01,0x80,0x80,0x00,0x00,0x7F,	// 211
+	0x00,0x00,0x00,0x00,0x7F,0x00,0x80,0x80,0x00,0x40,0x00,0x01,0x20,0x00,0x02,0x28,0x00,0x02,0x24,0x00,0x02,0x26,0x00,0x02,0x28,0x00,0x02,0x20,0x00,0x02,0x40,0x00,0x01,0x80,0x80,0x00,0x00,0x7F,	// 212
+	0x00,0x00,0x00,0x00,0x7F,0x00,0x80,0x80,0x00,0x40,0x00,0x01,0x28,0x00,0x02,0x24,0x00,0x02,0x24,0x00,0x02,0x28,0x00,0x02,0x28,0x00,0x02,0x24,0x00,0x02,0x40,0x00,0x01,0x80,0x80,0x00,0x00,0x7F,	// 213
+	0x00,0x00,0x00,0x00,0x7F,0x00,0x80,0x80,0x00,0x40,0x00,0x01,0x20,0x00,0x02,0x24,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x24,0x00,0x02,0x20,0x00,0x02,0x40,0x00,0x01,0x80,0x80,0x00,0x00,0x7F,	// 214
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0x00,0x24,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x24,0x00,0x00,0x42,0x00,0x00,0x81,	// 215
+	0x00,0x00,0x00,0x00,0x7F,0x00,0x80,0x80,0x06,0x40,0x00,0x01,0x20,0xC0,0x02,0x20,0x20,0x02,0x20,0x10,0x02,0x20,0x0C,0x02,0x20,0x02,0x02,0x20,0x01,0x02,0xC0,0x00,0x01,0xA0,0x80,0x00,0x00,0x7F,	// 216
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x01,0x02,0x00,0x02,0x04,0x00,0x02,0x08,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x01,0xE0,0xFF,	// 217
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x02,0x08,0x00,0x02,0x04,0x00,0x02,0x02,0x00,0x02,0x00,0x00,0x01,0xE0,0xFF,	// 218
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x01,0x08,0x00,0x02,0x04,0x00,0x02,0x02,0x00,0x02,0x04,0x00,0x02,0x08,0x00,0x02,0x00,0x00,0x01,0xE0,0xFF,	// 219
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x01,0x04,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x04,0x00,0x02,0x00,0x00,0x01,0xE0,0xFF,	// 220
+	0x20,0x00,0x00,0x40,0x00,0x00,0x80,0x01,0x00,0x00,0x06,0x00,0x08,0x08,0x00,0x08,0xF8,0x03,0x04,0x04,0x00,0x02,0x03,0x00,0xC0,0x00,0x00,0x20,	// 221
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x81,0x00,0x00,0x81,0x00,0x00,0x81,0x00,0x00,0x81,0x00,0x00,0x42,0x00,0x00,0x3E,	// 222
+	0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x03,0x20,0x00,0x02,0x20,0x08,0x02,0x20,0x14,0x02,0x20,0x22,0x02,0x40,0x21,0x02,0x80,0xC0,0x01,	// 223
+	0x00,0x00,0x00,0x00,0xC4,0x03,0x00,0x42,0x02,0x20,0x22,0x02,0x40,0x22,0x02,0x00,0x22,0x02,0x00,0xFC,0x03,	// 224
+	0x00,0x00,0x00,0x00,0xC4,0x03,0x00,0x42,0x02,0x00,0x22,0x02,0x40,0x22,0x02,0x20,0x22,0x02,0x00,0xFC,0x03,	// 225
+	0x00,0x00,0x00,0x00,0xC4,0x03,0x40,0x42,0x02,0x20,0x22,0x02,0x20,0x22,0x02,0x40,0x22,0x02,0x00,0xFC,0x03,	// 226
+	0x00,0x00,0x00,0x00,0xC4,0x03,0x60,0x42,0x02,0x20,0x22,0x02,0x40,0x22,0x02,0x40,0x22,0x02,0x20,0xFC,0x03,	// 227
+	0x00,0x00,0x00,0x00,0xC4,0x03,0x40,0x42,0x02,0x00,0x22,0x02,0x00,0x22,0x02,0x40,0x22,0x02,0x00,0xFC,0x03,	// 228
+	0x00,0x00,0x00,0x00,0xC4,0x03,0x40,0x42,0x02,0xA0,0x22,0x02,0xA0,0x22,0x02,0x60,0x22,0x02,0x00,0xFC,0x03,	// 229
+	0x00,0x00,0x00,0x00,0xC4,0x03,0x00,0x22,0x02,0x00,0x12,0x02,0x00,0x12,0x02,0x00,0x12,0x02,0x00,0xFC,0x01,0x00,0x14,0x01,0x00,0x12,0x02,0x00,0x12,0x02,0x00,0x12,0x02,0x00,0x12,0x02,0x00,0x1C,0x02,	// 230
+	0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x04,0x02,0x00,0x02,0x12,0x00,0x02,0x14,0x00,0x02,0x1A,0x00,0x02,0x1A,0x00,0x00,0x01,	// 231
+	0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x12,0x01,0x00,0x12,0x02,0x60,0x12,0x02,0x80,0x12,0x02,0x00,0x12,0x02,0x00,0x1C,0x02,	// 232
+	0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x12,0x01,0x00,0x12,0x02,0x80,0x12,0x02,0x60,0x12,0x02,0x00,0x12,0x02,0x00,0x1C,0x02,	// 233
+	0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x12,0x01,0x40,0x12,0x02,0x20,0x12,0x02,0x20,0x12,0x02,0x40,0x12,0x02,0x00,0x1C,0x02,	// 234
+	0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x12,0x01,0x40,0x12,0x02,0x00,0x12,0x02,0x00,0x12,0x02,0x40,0x12,0x02,0x00,0x1C,0x02,	// 235
+	0x00,0x00,0x00,0x60,0xFE,0x03,0x80,	// 236
+	0x00,0x00,0x00,0x80,0xFE,0x03,0x60,	// 237
+	0x40,0x00,0x00,0x20,0xFE,0x03,0x20,0x00,0x00,0x40,	// 238
+	0x40,0x00,0x00,0x00,0xFE,0x03,0x40,	// 239
+	0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x04,0x01,0x20,0x02,0x02,0x20,0x02,0x02,0xC0,0x02,0x02,0x60,0x02,0x02,0x80,0x05,0x01,0x00,0xFE,	// 240
+	0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xFE,0x03,0x20,0x02,0x00,0x20,0x02,0x00,0x40,0x02,0x00,0x20,0x02,0x00,0x00,0xFC,0x03,	// 241
+	0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x04,0x01,0x00,0x02,0x02,0x60,0x02,0x02,0x80,0x02,0x02,0x00,0x02,0x02,0x00,0x04,0x01,0x00,0xF8,	// 242
+	0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x04,0x01,0x00,0x02,0x02,0x80,0x02,0x02,0x60,0x02,0x02,0x00,0x02,0x02,0x00,0x04,0x01,0x00,0xF8,	// 243
+	0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x04,0x01,0x40,0x02,0x02,0x20,0x02,0x02,0x20,0x02,0x02,0x40,0x02,0x02,0x00,0x04,0x01,0x00,0xF8,	// 244
+	0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x04,0x01,0x60,0x02,0x02,0x20,0x02,0x02,0x40,0x02,0x02,0x60,0x02,0x02,0x00,0x04,0x01,0x00,0xF8,	// 245
+	0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x04,0x01,0x40,0x02,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x40,0x02,0x02,0x00,0x04,0x01,0x00,0xF8,	// 246
+	0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x92,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,	// 247
+	0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x04,0x03,0x00,0x82,0x02,0x00,0x42,0x02,0x00,0x32,0x02,0x00,0x0A,0x02,0x00,0x04,0x01,0x00,0xFA,	// 248
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x02,0x60,0x00,0x02,0x80,0x00,0x02,0x00,0x00,0x02,0x00,0xFE,0x03,	// 249
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x02,0x80,0x00,0x02,0x60,0x00,0x02,0x00,0x00,0x02,0x00,0xFE,0x03,	// 250
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x40,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x40,0x00,0x02,0x00,0xFE,0x03,	// 251
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x40,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x40,0x00,0x02,0x00,0xFE,0x03,	// 252
+	0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x30,0x00,0x00,0xC0,0x19,0x40,0x00,0x07,0x20,0xC0,0x00,0x00,0x30,0x00,0x00,0x0E,	// 253
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x1F,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x02,0x02,0x00,0x04,0x01,0x00,0xF8,	// 254
+	0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x30,0x00,0x40,0xC0,0x19,0x00,0x00,0x07,0x00,0xC0,0x00,0x40,0x30,0x00,0x00,0x0E	// 255
+};
+// Created by http://oleddisplay.squix.ch/ Consider a donation
+// In case of problems make sure that you are using the font file with the correct version!
+const uint8_t Lato_Hairline_38[] PROGMEM = {
+	0x26, // Width: 38
+	0x2F, // Height: 47
+	0x20, // First Char: 32
+	0xE0, // Numbers of Chars: 224
+
+	// Jump Table:
+	0xFF, 0xFF, 0x00, 0x0B,  // 32:65535
+	0xFF, 0xFF, 0x23, 0x09,  // 33:65535
+	0xFF, 0xFF, 0x33, 0x0C,  // 34:65535
+	0xFF, 0xFF, 0x75, 0x16,  // 35:65535
+	0xFF, 0xFF, 0x71, 0x16,  // 36:65535
+	0xFF, 0xFF, 0xA1, 0x1D,  // 37:65535
+	0xFF, 0xFF, 0x95, 0x1A,  // 38:65535
+	0xFF, 0xFF, 0x15, 0x07,  // 39:65535
+	0xFF, 0xFF, 0x30, 0x0A,  // 40:65535
+	0xFF, 0xFF, 0x29, 0x0A,  // 41:65535
+	0xFF, 0xFF, 0x4B, 0x10,  // 42:65535
+	0xFF, 0xFF, 0x76, 0x16,  // 43:65535
+	0xFF, 0xFF, 0x1E, 0x08,  // 44:65535
+	0xFF, 0xFF, 0x40, 0x0E,  // 45:65535
+	0xFF, 0xFF, 0x23, 0x09,  // 46:65535
+	0xFF, 0xFF, 0x50, 0x10,  // 47:65535
+	0xFF, 0xFF, 0x76, 0x16,  // 48:65535
+	0xFF, 0xFF, 0x71, 0x16,  // 49:65535
+	0xFF, 0xFF, 0x71, 0x16,  // 50:65535
+	0xFF, 0xFF, 0x71, 0x16,  // 51:65535
+	0xFF, 0xFF, 0x7C, 0x16,  // 52:65535
+	0xFF, 0xFF, 0x70, 0x16,  // 53:65535
+	0xFF, 0xFF, 0x71, 0x16,  // 54:65535
+	0xFF, 0xFF, 0x74, 0x16,  // 55:65535
+	0xFF, 0xFF, 0x71, 0x16,  // 56:65535
+	0xFF, 0xFF, 0x6F, 0x16,  // 57:65535
+	0xFF, 0xFF, 0x23, 0x09,  // 58:65535
+	0xFF, 0xFF, 0x23, 0x09,  // 59:65535
+	0xFF, 0xFF, 0x64, 0x16,  // 60:65535
+	0xFF, 0xFF, 0x70, 0x16,  // 61:65535
+	0xFF, 0xFF, 0x70, 0x16,  // 62:65535
+	0xFF, 0xFF, 0x51, 0x10,  // 63:65535
+	0xFF, 0xFF, 0xAC, 0x1F,  // 64:65535
+	0xFF, 0xFF, 0x89, 0x18,  // 65:65535
+	0xFF, 0xFF, 0x7D, 0x18,  // 66:65535
+	0xFF, 0xFF, 0x8F, 0x1A,  // 67:65535
+	0xFF, 0xFF, 0x9A, 0x1D,  // 68:65535
+	0xFF, 0xFF, 0x77, 0x16,  // 69:65535
+	0xFF, 0xFF, 0x74, 0x15,  // 70:65535
+	0xFF, 0xFF, 0x95, 0x1C,  // 71:65535
+	0xFF, 0xFF, 0x8F, 0x1C,  // 72:65535
+	0xFF, 0xFF, 0x1D, 0x09,  // 73:65535
+	0xFF, 0xFF, 0x41, 0x0F,  // 74:65535
+	0xFF, 0xFF, 0x89, 0x17,  // 75:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 76:65535
+	0xFF, 0xFF, 0xAD, 0x22,  // 77:65535
+	0xFF, 0xFF, 0x8F, 0x1C,  // 78:65535
+	0xFF, 0xFF, 0xA0, 0x1E,  // 79:65535
+	0xFF, 0xFF, 0x6F, 0x15,  // 80:65535
+	0xFF, 0xFF, 0xA8, 0x1E,  // 81:65535
+	0xFF, 0xFF, 0x83, 0x16,  // 82:65535
+	0xFF, 0xFF, 0x6B, 0x14,  // 83:65535
+	0xFF, 0xFF, 0x7A, 0x16,  // 84:65535
+	0xFF, 0xFF, 0x89, 0x1B,  // 85:65535
+	0xFF, 0xFF, 0x86, 0x18,  // 86:65535
+	0xFF, 0xFF, 0xDA, 0x26,  // 87:65535
+	0xFF, 0xFF, 0x83, 0x17,  // 88:65535
+	0xFF, 0xFF, 0x7A, 0x16,  // 89:65535
+	0xFF, 0xFF, 0x7D, 0x17,  // 90:65535
+	0xFF, 0xFF, 0x36, 0x0B,  // 91:65535
+	0xFF, 0xFF, 0x53, 0x10,  // 92:65535
+	0xFF, 0xFF, 0x2A, 0x0B,  // 93:65535
+	0xFF, 0xFF, 0x69, 0x16,  // 94:65535
+	0xFF, 0xFF, 0x60, 0x11,  // 95:65535
+	0xFF, 0xFF, 0x32, 0x0F,  // 96:65535
+	0xFF, 0xFF, 0x59, 0x12,  // 97:65535
+	0xFF, 0xFF, 0x6B, 0x15,  // 98:65535
+	0xFF, 0xFF, 0x5F, 0x12,  // 99:65535
+	0xFF, 0xFF, 0x65, 0x15,  // 100:65535
+	0xFF, 0xFF, 0x6A, 0x14,  // 101:65535
+	0xFF, 0xFF, 0x45, 0x0D,  // 102:65535
+	0xFF, 0xFF, 0x6C, 0x13,  // 103:65535
+	0xFF, 0xFF, 0x65, 0x15,  // 104:65535
+	0xFF, 0xFF, 0x1A, 0x08,  // 105:65535
+	0xFF, 0xFF, 0x1A, 0x08,  // 106:65535
+	0xFF, 0xFF, 0x5F, 0x11,  // 107:65535
+	0xFF, 0xFF, 0x17, 0x08,  // 108:65535
+	0xFF, 0xFF, 0xA1, 0x1E,  // 109:65535
+	0xFF, 0xFF, 0x65, 0x15,  // 110:65535
+	0xFF, 0xFF, 0x70, 0x15,  // 111:65535
+	0xFF, 0xFF, 0x6B, 0x15,  // 112:65535
+	0xFF, 0xFF, 0x66, 0x15,  // 113:65535
+	0xFF, 0xFF, 0x45, 0x0D,  // 114:65535
+	0xFF, 0xFF, 0x53, 0x10,  // 115:65535
+	0xFF, 0xFF, 0x47, 0x0C,  // 116:65535
+	0xFF, 0xFF, 0x65, 0x15,  // 117:65535
+	0xFF, 0xFF, 0x69, 0x13,  // 118:65535
+	0xFF, 0xFF, 0x9F, 0x1C,  // 119:65535
+	0xFF, 0xFF, 0x5F, 0x11,  // 120:65535
+	0xFF, 0xFF, 0x69, 0x13,  // 121:65535
+	0xFF, 0xFF, 0x59, 0x11,  // 122:65535
+	0xFF, 0xFF, 0x36, 0x0B,  // 123:65535
+	0xFF, 0xFF, 0x1E, 0x09,  // 124:65535
+	0xFF, 0xFF, 0x34, 0x0B,  // 125:65535
+	0xFF, 0xFF, 0x70, 0x16,  // 126:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 127:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 128:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 129:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 130:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 131:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 132:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 133:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 134:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 135:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 136:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 137:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 138:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 139:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 140:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 141:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 142:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 143:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 144:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 145:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 146:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 147:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 148:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 149:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 150:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 151:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 152:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 153:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 154:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 155:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 156:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 157:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 158:65535
+	0xFF, 0xFF, 0x6B, 0x13,  // 159:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 160:65535
+	0xFF, 0xFF, 0x1E, 0x08,  // 161:65535
+	0xFF, 0xFF, 0x71, 0x16,  // 162:65535
+	0xFF, 0xFF, 0x7D, 0x16,  // 163:65535
+	0xFF, 0xFF, 0x71, 0x16,  // 164:65535
+	0xFF, 0xFF, 0x74, 0x16,  // 165:65535
+	0xFF, 0xFF, 0x1E, 0x09,  // 166:65535
+	0xFF, 0xFF, 0x5E, 0x12,  // 167:65535
+	0xFF, 0xFF, 0x44, 0x0F,  // 168:65535
+	0xFF, 0xFF, 0xB2, 0x20,  // 169:65535
+	0xFF, 0xFF, 0x3F, 0x0E,  // 170:65535
+	0xFF, 0xFF, 0x41, 0x0E,  // 171:65535
+	0xFF, 0xFF, 0x70, 0x16,  // 172:65535
+	0xFF, 0xFF, 0x40, 0x0E,  // 173:65535
+	0xFF, 0xFF, 0xB2, 0x20,  // 174:65535
+	0xFF, 0xFF, 0x4A, 0x0F,  // 175:65535
+	0xFF, 0xFF, 0x4B, 0x10,  // 176:65535
+	0xFF, 0xFF, 0x77, 0x16,  // 177:65535
+	0xFF, 0xFF, 0x39, 0x0D,  // 178:65535
+	0xFF, 0xFF, 0x39, 0x0D,  // 179:65535
+	0xFF, 0xFF, 0x3E, 0x0F,  // 180:65535
+	0xFF, 0xFF, 0x83, 0x18,  // 181:65535
+	0xFF, 0xFF, 0x80, 0x18,  // 182:65535
+	0xFF, 0xFF, 0x1C, 0x09,  // 183:65535
+	0xFF, 0xFF, 0x42, 0x0F,  // 184:65535
+	0xFF, 0xFF, 0x39, 0x0D,  // 185:65535
+	0xFF, 0xFF, 0x4B, 0x0F,  // 186:65535
+	0xFF, 0xFF, 0x46, 0x0E,  // 187:65535
+	0xFF, 0xFF, 0x95, 0x1B,  // 188:65535
+	0xFF, 0xFF, 0x95, 0x1B,  // 189:65535
+	0xFF, 0xFF, 0x9B, 0x1C,  // 190:65535
+	0xFF, 0xFF, 0x54, 0x0F,  // 191:65535
+	0xFF, 0xFF, 0x89, 0x18,  // 192:65535
+	0xFF, 0xFF, 0x89, 0x18,  // 193:65535
+	0xFF, 0xFF, 0x89, 0x18,  // 194:65535
+	0xFF, 0xFF, 0x89, 0x18,  // 195:65535
+	0xFF, 0xFF, 0x89, 0x18,  // 196:65535
+	0xFF, 0xFF, 0x89, 0x18,  // 197:65535
+	0xFF, 0xFF, 0xC5, 0x23,  // 198:65535
+	0xFF, 0xFF, 0x8F, 0x1A,  // 199:65535
+	0xFF, 0xFF, 0x77, 0x16,  // 200:65535
+	0xFF, 0xFF, 0x77, 0x16,  // 201:65535
+	0xFF, 0xFF, 0x77, 0x16,  // 202:65535
+	0xFF, 0xFF, 0x77, 0x16,  // 203:65535
+	0xFF, 0xFF, 0x20, 0x09,  // 204:65535
+	0xFF, 0xFF, 0x31, 0x09,  // 205:65535
+	0xFF, 0xFF, 0x32, 0x09,  // 206:65535
+	0xFF, 0xFF, 0x31, 0x09,  // 207:65535
+	0xFF, 0xFF, 0x9A, 0x1D,  // 208:65535
+	0xFF, 0xFF, 0x8F, 0x1C,  // 209:65535
+	0xFF, 0xFF, 0xA0, 0x1E,  // 210:65535
+	0xFF, 0xFF, 0xA0, 0x1E,  // 211:65535
+	0xFF, 0xFF, 0xA0, 0x1E,  // 212:65535
+	0xFF, 0xFF, 0xA0, 0x1E,  // 213:65535
+	0xFF, 0xFF, 0xA0, 0x1E,  // 214:65535
+	0xFF, 0xFF, 0x71, 0x16,  // 215:65535
+	0xFF, 0xFF, 0xA0, 0x1E,  // 216:65535
+	0xFF, 0xFF, 0x89, 0x1B,  // 217:65535
+	0xFF, 0xFF, 0x89, 0x1B,  // 218:65535
+	0xFF, 0xFF, 0x89, 0x1B,  // 219:65535
+	0xFF, 0xFF, 0x89, 0x1B,  // 220:65535
+	0xFF, 0xFF, 0x7A, 0x16,  // 221:65535
+	0xFF, 0xFF, 0x70, 0x15,  // 222:65535
+	0xFF, 0xFF, 0x6B, 0x14,  // 223:65535
+	0xFF, 0xFF, 0x59, 0x12,  // 224:65535
+	0xFF, 0xFF, 0x59, 0x12,  // 225:65535
+	0xFF, 0xFF, 0x59, 0x12,  // 226:65535
+	0xFF, 0xFF, 0x59, 0x12,  // 227:65535
+	0xFF, 0xFF, 0x59, 0x12,  // 228:65535
+	0xFF, 0xFF, 0x59, 0x12,  // 229:65535
+	0xFF, 0xFF, 0xA7, 0x1E,  // 230:65535
+	0xFF, 0xFF, 0x5F, 0x12,  // 231:65535
+	0xFF, 0xFF, 0x6A, 0x14,  // 232:65535
+	0xFF, 0xFF, 0x6A, 0x14,  // 233:65535
+	0xFF, 0xFF, 0x6A, 0x14,  // 234:65535
+	0xFF, 0xFF, 0x6A, 0x14,  // 235:65535
+	0xFF, 0xFF, 0x1A, 0x08,  // 236:65535
+	0xFF, 0xFF, 0x26, 0x08,  // 237:65535
+	0xFF, 0xFF, 0x2C, 0x08,  // 238:65535
+	0xFF, 0xFF, 0x26, 0x08,  // 239:65535
+	0xFF, 0xFF, 0x6B, 0x15,  // 240:65535
+	0xFF, 0xFF, 0x65, 0x15,  // 241:65535
+	0xFF, 0xFF, 0x70, 0x15,  // 242:65535
+	0xFF, 0xFF, 0x70, 0x15,  // 243:65535
+	0xFF, 0xFF, 0x70, 0x15,  // 244:65535
+	0xFF, 0xFF, 0x70, 0x15,  // 245:65535
+	0xFF, 0xFF, 0x70, 0x15,  // 246:65535
+	0xFF, 0xFF, 0x76, 0x16,  // 247:65535
+	0xFF, 0xFF, 0x70, 0x15,  // 248:65535
+	0xFF, 0xFF, 0x65, 0x15,  // 249:65535
+	0xFF, 0xFF, 0x65, 0x15,  // 250:65535
+	0xFF, 0xFF, 0x65, 0x15,  // 251:65535
+	0xFF, 0xFF, 0x65, 0x15,  // 252:65535
+	0xFF, 0xFF, 0x69, 0x13,  // 253:65535
+	0xFF, 0xFF, 0x6B, 0x15,  // 254:65535
+	0xFF, 0xFF, 0x69, 0x13  // 255:65535
+
+	// Font Data:
+};
+const uint16_t Lato_Hairline_38_offsets[] PROGMEM = {
+	0,	// 32
+	0,	// 33
+	11,	// 34
+	22,	// 35
+	79,	// 36
+	143,	// 37
+	227,	// 38
+	302,	// 39
+	307,	// 40
+	328,	// 41
+	345,	// 42
+	372,	// 43
+	407,	// 44
+	415,	// 45
+	431,	// 46
+	439,	// 47
+	463,	// 48
+	516,	// 49
+	555,	// 50
+	612,	// 51
+	673,	// 52
+	721,	// 53
+	779,	// 54
+	832,	// 55
+	878,	// 56
+	949,	// 57
+	1000,	// 58
+	1011,	// 59
+	1024,	// 60
+	1061,	// 61
+	1107,	// 62
+	1146,	// 63
+	1178,	// 64
+	1284,	// 65
+	1337,	// 66
+	1409,	// 67
+	1470,	// 68
+	1537,	// 69
+	1599,	// 70
+	1646,	// 71
+	1716,	// 72
+	1760,	// 73
+	1768,	// 74
+	1790,	// 75
+	1844,	// 76
+	1875,	// 77
+	1931,	// 78
+	1975,	// 79
+	2045,	// 80
+	2091,	// 81
+	2166,	// 82
+	2224,	// 83
+	2283,	// 84
+	2322,	// 85
+	2364,	// 86
+	2406,	// 87
+	2477,	// 88
+	2535,	// 89
+	2574,	// 90
+	2640,	// 91
+	2660,	// 92
+	2685,	// 93
+	2704,	// 94
+	2734,	// 95
+	2761,	// 96
+	2772,	// 97
+	2822,	// 98
+	2865,	// 99
+	2905,	// 100
+	2951,	// 101
+	3009,	// 102
+	3039,	// 103
+	3113,	// 104
+	3141,	// 105
+	3150,	// 106
+	3163,	// 107
+	3193,	// 108
+	3200,	// 109
+	3248,	// 110
+	3276,	// 111
+	3324,	// 112
+	3367,	// 113
+	3413,	// 114
+	3431,	// 115
+	3477,	// 116
+	3506,	// 117
+	3537,	// 118
+	3570,	// 119
+	3622,	// 120
+	3659,	// 121
+	3695,	// 122
+	3740,	// 123
+	3766,	// 124
+	3775,	// 125
+	3801,	// 126
+	3831,	// 127
+	3890,	// 128
+	3949,	// 129
+	4008,	// 130
+	4067,	// 131
+	4126,	// 132
+	4185,	// 133
+	4244,	// 134
+	4303,	// 135
+	4362,	// 136
+	4421,	// 137
+	4480,	// 138
+	4539,	// 139
+	4598,	// 140
+	4657,	// 141
+	4716,	// 142
+	4775,	// 143
+	4834,	// 144
+	4893,	// 145
+	4952,	// 146
+	5011,	// 147
+	5070,	// 148
+	5129,	// 149
+	5188,	// 150
+	5247,	// 151
+	5306,	// 152
+	5365,	// 153
+	5424,	// 154
+	5483,	// 155
+	5542,	// 156
+	5601,	// 157
+	5660,	// 158
+	5719,	// 159
+	5778,	// 160
+	5778,	// 161
+	5788,	// 162
+	5836,	// 163
+	5899,	// 164
+	5946,	// 165
+	5996,	// 166
+	6005,	// 167
+	6066,	// 168
+	6080,	// 169
+	6179,	// 170
+	6203,	// 171
+	6227,	// 172
+	6257,	// 173
+	6273,	// 174
+	6371,	// 175
+	6391,	// 176
+	6421,	// 177
+	6473,	// 178
+	6498,	// 179
+	6524,	// 180
+	6537,	// 181
+	6577,	// 182
+	6628,	// 183
+	6634,	// 184
+	6650,	// 185
+	6670,	// 186
+	6700,	// 187
+	6724,	// 188
+	6787,	// 189
+	6853,	// 190
+	6925,	// 191
+	6958,	// 192
+	7017,	// 193
+	7076,	// 194
+	7139,	// 195
+	7202,	// 196
+	7259,	// 197
+	7318,	// 198
+	7416,	// 199
+	7483,	// 200
+	7550,	// 201
+	7618,	// 202
+	7688,	// 203
+	7754,	// 204
+	7769,	// 205
+	7786,	// 206
+	7807,	// 207
+	7822,	// 208
+	7900,	// 209
+	7955,	// 210
+	8031,	// 211
+	8107,	// 212
+	8185,	// 213
+	8265,	// 214
+	8339,	// 215
+	8384,	// 216
+	8470,	// 217
+	8519,	// 218
+	8568,	// 219
+	8620,	// 220
+	8666,	// 221
+	8712,	// 222
+	8758,	// 223
+	8812,	// 224
+	8866,	// 225
+	8920,	// 226
+	8979,	// 227
+	9039,	// 228
+	9093,	// 229
+	9149,	// 230
+	9247,	// 231
+	9293,	// 232
+	9355,	// 233
+	9418,	// 234
+	9485,	// 235
+	9548,	// 236
+	9559,	// 237
+	9571,	// 238
+	9588,	// 239
+	9600,	// 240
+	9655,	// 241
+	9692,	// 242
+	9744,	// 243
+	9797,	// 244
+	9854,	// 245
+	9911,	// 246
+	9963,	// 247
+	10000,	// 248
+	10055,	// 249
+	10091,	// 250
+	10127,	// 251
+	10167,	// 252
+	10203,	// 253
+	10243,	// 254
+	10286	// 255
+};
+const uint8_t Lato_Hairline_38_packed[] PROGMEM = {
+	0x00,0x00,0x40,0x1E,0x04,0x10,0xF8,0xFF,0x1F,0x30,0x30,0x00,0x00,0x18,0x00,0x00,
+	0x00,0x06,0xF8,0x0F,0xF8,0x0F,0x00,0x80,0x30,0x1C,0xC7,0x30,0x8C,0xE3,0x70,0x1C,
+	0xC3,0x30,0x8E,0xC3,0x10,0x20,0x10,0x20,0x10,0x20,0x30,0x10,0x20,0x0F,0x10,0xF8,
+	0x90,0x27,0x7C,0x20,0xE0,0x13,0x20,0x18,0x10,0x20,0x10,0x20,0x30,0x10,0xA0,0x0F,
+	0x10,0x78,0xD0,0x27,0x3E,0x20,0xE0,0x11,0x20,0x18,0x10,0x20,0x10,0x20,0x10,0x00,
+	0x00,0x40,0x96,0x65,0x59,0x96,0xE5,0x7F,0x9A,0xA6,0x69,0x9A,0x86,0x01,0x04,0x80,
+	0x0F,0x08,0x40,0x10,0x10,0x20,0x20,0x20,0x10,0x40,0x20,0x08,0x40,0x20,0x08,0x80,
+	0x20,0x08,0x80,0xC0,0xFF,0x07,0x80,0xFF,0x7F,0x3F,0x20,0x08,0x01,0x20,0x08,0x01,
+	0x20,0x08,0x01,0x20,0x10,0x02,0x10,0x10,0x04,0x08,0x20,0x08,0x06,0xF0,0x01,0x00,
+	0x60,0x18,0x86,0x65,0x59,0x96,0xE3,0x38,0x0E,0x82,0x10,0x1C,0xC7,0x71,0x9A,0xA6,
+	0x69,0x18,0x86,0x01,0xC0,0x1F,0x30,0x20,0x10,0x40,0x08,0x80,0x30,0x08,0x80,0x08,
+	0x08,0x80,0x04,0x08,0x80,0x03,0x08,0x80,0x80,0x10,0x40,0x60,0x20,0x30,0x10,0xC0,
+	0x0F,0x0C,0x02,0x01,0xC0,0x20,0xF0,0x07,0x18,0x0C,0x08,0x04,0x02,0x10,0x03,0x01,
+	0x20,0x80,0x01,0x20,0x40,0x01,0x20,0x30,0x01,0x20,0x08,0x01,0x20,0x02,0x10,0x0C,
+	0x08,0xF0,0x07,0x00,0x80,0x61,0x18,0xE6,0x79,0x96,0xA5,0x69,0x9A,0xA6,0x69,0x9A,
+	0x86,0x41,0x18,0x06,0x41,0x10,0xE0,0x03,0x18,0x04,0x04,0x08,0x02,0x10,0xC0,0x0F,
+	0x01,0x20,0x20,0x10,0x01,0x20,0x10,0xE0,0x20,0x08,0x80,0x20,0x08,0x01,0x20,0x08,
+	0x01,0x20,0x08,0x02,0x20,0x08,0x04,0x20,0x08,0x08,0x10,0x10,0x10,0x10,0x10,0x20,
+	0x08,0xE0,0x40,0x04,0x80,0x02,0x01,0xE0,0x02,0x1C,0x04,0x08,0x10,0x20,0x00,0x00,
+	0x18,0xF8,0x0F,0x00,0xC0,0x70,0x96,0x24,0x8B,0xE0,0x7F,0x1E,0x80,0x07,0x80,0x01,
+	0x18,0x70,0x60,0x08,0x80,0x01,0x06,0x06,0x00,0x20,0x4A,0x12,0xC5,0x01,0x0E,0x07,
+	0x10,0xC0,0xE0,0x30,0x07,0x0E,0xF8,0xFF,0x01,0x00,0x00,0x18,0x86,0x21,0x08,0x86,
+	0x60,0x18,0x06,0x10,0x02,0x10,0x01,0x20,0x01,0xA0,0x40,0xFE,0x0F,0xA0,0x20,0x01,
+	0x10,0x01,0x10,0x02,0x00,0x80,0x20,0x08,0x82,0x20,0x08,0x82,0x70,0x08,0x82,0x20,
+	0x08,0x82,0x20,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xFF,0xFF,0x03,0x01,
+	0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0xC0,0x30,0x30,0x02,0xF0,0x01,0x00,
+	0x00,0x20,0x08,0x82,0x20,0x08,0x82,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x00,
+	0x00,0x40,0x10,0x04,0x30,0x30,0x10,0x00,0x00,0x41,0x10,0x86,0x20,0x0C,0x41,0x10,
+	0x82,0xE0,0x18,0x06,0xC0,0x01,0x30,0x0E,0x80,0x01,0x60,0x1C,0x03,0xC0,0x38,0x00,
+	0xC0,0x58,0x92,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x49,0x92,0x64,0x31,0xFE,0xFF,
+	0x80,0x01,0x03,0x40,0x04,0x20,0x08,0x10,0x10,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
+	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x10,0x20,0x08,0x40,0x04,0x80,
+	0x01,0x03,0xFE,0xFF,0x00,0x00,0x00,0x00,0x45,0x49,0x92,0x24,0x49,0x1E,0x04,0x41,
+	0x10,0x04,0x01,0x02,0x20,0x01,0x20,0x80,0x20,0x40,0x20,0x20,0x20,0x10,0x20,0x08,
+	0x20,0xF0,0xFF,0xFF,0x3F,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x50,0x92,0x24,
+	0x49,0x9A,0xA6,0x69,0x9A,0xA6,0x69,0x96,0x45,0x01,0x03,0x30,0xC0,0x28,0x20,0x24,
+	0x10,0x22,0x10,0x21,0x08,0x80,0x20,0x08,0x40,0x20,0x08,0x20,0x20,0x08,0x10,0x20,
+	0x08,0x08,0x20,0x08,0x04,0x20,0x08,0x02,0x20,0x10,0x01,0x20,0x20,0xC0,0x20,0xC0,
+	0x30,0x20,0x0F,0x20,0x00,0x80,0x50,0x92,0x24,0x49,0x92,0x64,0x59,0x96,0xE5,0x79,
+	0x9E,0xC7,0x01,0x80,0x03,0x03,0xC0,0x0C,0x20,0x10,0x10,0x10,0x10,0x20,0x08,0x20,
+	0x08,0x20,0x08,0x80,0x20,0x08,0x80,0x20,0x08,0x80,0x20,0x08,0x80,0x20,0x08,0x40,
+	0x01,0x20,0x10,0x40,0x01,0x10,0x20,0x20,0x02,0x08,0xC0,0x18,0x04,0x04,0x07,0xF8,
+	0x03,0x00,0x82,0x20,0x08,0xC3,0x30,0x0C,0xC3,0x28,0x8A,0xE2,0x21,0x08,0x82,0x20,
+	0x08,0x30,0x28,0x24,0x23,0x80,0x20,0x40,0x20,0x30,0x20,0x08,0x20,0x04,0x20,0x03,
+	0x20,0x80,0x20,0x40,0x20,0x20,0x20,0xF8,0xFF,0xFF,0x3F,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x00,0x00,0x40,0x94,0x65,0x59,0x96,0x65,0x59,0x96,0x65,0x59,0x9E,0x86,0x10,
+	0x60,0x10,0x80,0x5F,0x10,0x78,0x20,0x20,0x08,0x20,0x20,0x08,0x20,0x20,0x08,0x20,
+	0x20,0x08,0x20,0x20,0x08,0x20,0x20,0x08,0x20,0x20,0x08,0x40,0x20,0x08,0x40,0x10,
+	0x08,0x80,0x08,0x08,0x80,0x01,0x04,0x08,0x06,0x03,0xF8,0x00,0x00,0x60,0x18,0xC7,
+	0x51,0x14,0x45,0x59,0x96,0x65,0x51,0x18,0x86,0x01,0xF8,0x03,0x07,0x04,0x80,0x01,
+	0x08,0x60,0x01,0x10,0x90,0x20,0x88,0x20,0x46,0x20,0x41,0x20,0x80,0x40,0x20,0x60,
+	0x40,0x20,0x10,0x40,0x20,0x08,0x40,0x20,0x80,0x10,0x01,0x10,0x03,0x0C,0xFC,0x03,
+	0x00,0x00,0x08,0x82,0x20,0x49,0x92,0xA6,0x28,0x8A,0x63,0x18,0x86,0x21,0x08,0x08,
+	0x08,0x08,0x08,0x20,0x08,0x18,0x08,0x06,0x08,0x80,0x01,0x08,0x60,0x08,0x18,0x08,
+	0x06,0x08,0x80,0x01,0x08,0x60,0x08,0x18,0x08,0x06,0x88,0x01,0x68,0x18,0x00,0x00,
+	0x70,0x9E,0xE7,0x79,0x96,0x65,0x59,0x96,0xE5,0x79,0x9E,0xC7,0x01,0x07,0xF8,0x07,
+	0xC0,0x18,0x04,0x08,0x20,0x20,0x02,0x10,0x10,0x40,0x01,0x10,0x08,0x40,0x01,0x20,
+	0x08,0x80,0x20,0x08,0x80,0x20,0x08,0x80,0x20,0x08,0x80,0x20,0x08,0x80,0x20,0x08,
+	0x80,0x20,0x08,0x40,0x01,0x20,0x10,0x40,0x01,0x10,0x20,0x20,0x02,0x10,0xC0,0x18,
+	0x04,0x08,0x07,0xF8,0x07,0x00,0x00,0x18,0x86,0xA2,0x68,0x9A,0xA6,0x69,0x8A,0xA2,
+	0x28,0x8E,0x41,0x80,0x7F,0x40,0x80,0x20,0x01,0x10,0x02,0x08,0x02,0x20,0x08,0x04,
+	0x10,0x08,0x04,0x0C,0x08,0x04,0x02,0x08,0x04,0x01,0x08,0xC4,0x08,0x22,0x10,0x1A,
+	0x10,0x05,0x20,0x80,0x03,0xC0,0x40,0x3F,0x00,0x00,0x50,0x14,0x05,0x30,0x30,0x30,
+	0x30,0x10,0x10,0x00,0x00,0xD0,0x34,0x05,0x10,0x10,0x02,0x30,0x30,0x03,0x30,0xF0,
+	0x00,0x00,0x00,0x08,0xC2,0x30,0x0C,0xC3,0x30,0x0C,0xC3,0x30,0x0C,0x02,0x05,0x80,
+	0x04,0x80,0x08,0x40,0x08,0x40,0x10,0x20,0x10,0x20,0x20,0x10,0x20,0x10,0x40,0x08,
+	0x40,0x08,0x80,0x04,0x80,0x00,0x00,0x30,0x0C,0xC3,0x30,0x0C,0xC3,0x30,0x0C,0xC3,
+	0x30,0x0C,0xC3,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,
+	0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,
+	0x08,0x20,0x08,0x00,0x00,0x00,0x00,0xC3,0x30,0x0C,0xC3,0x30,0x0C,0xC3,0x30,0x08,
+	0x82,0x04,0x80,0x08,0x80,0x08,0x40,0x10,0x40,0x10,0x20,0x20,0x20,0x20,0x10,0x40,
+	0x10,0x40,0x08,0x80,0x08,0x80,0x04,0x05,0x02,0x02,0x00,0x20,0x08,0x82,0x20,0x69,
+	0x86,0x61,0x18,0x86,0x01,0x20,0x10,0x08,0x08,0x08,0x30,0x08,0x1F,0x30,0x08,0x80,
+	0x08,0x40,0x08,0x20,0x10,0x20,0x20,0x18,0xC0,0x07,0x00,0x00,0x70,0x14,0x45,0x51,
+	0xA4,0xAA,0xEB,0xBA,0x6D,0xDB,0xB6,0xED,0xFA,0xBE,0x2D,0xCB,0x34,0x4D,0x31,0x0C,
+	0xC0,0xFF,0x07,0x30,0x08,0x0C,0x30,0x02,0x40,0x01,0x80,0x01,0x01,0x80,0x40,0x01,
+	0x40,0xBC,0x01,0x02,0x40,0x02,0x02,0x02,0x40,0x01,0x04,0x02,0x20,0x80,0x04,0x04,
+	0x20,0x40,0x04,0x04,0x20,0x40,0x04,0x04,0x20,0x20,0x02,0x04,0x20,0x20,0x01,0x04,
+	0x20,0x20,0x80,0x04,0x20,0x20,0x78,0x03,0x04,0x40,0x20,0x07,0x04,0x04,0x40,0xC0,
+	0x04,0x04,0x40,0x04,0x02,0x80,0x04,0x02,0x01,0x04,0x02,0x01,0x02,0x01,0x06,0x81,
+	0x18,0xC0,0xE0,0x3F,0x00,0x04,0x61,0x08,0x82,0x30,0x0C,0xA3,0x28,0x8A,0xC2,0x30,
+	0x0C,0x83,0x20,0x18,0x04,0x01,0x30,0x0E,0x80,0x01,0x60,0x1C,0x13,0xE0,0x10,0x18,
+	0x10,0x07,0x10,0xC0,0x10,0x30,0x10,0x18,0x10,0xE0,0x10,0x03,0x10,0x1C,0x10,0x60,
+	0x10,0x80,0x11,0x1E,0x20,0xC0,0x01,0x06,0x38,0x00,0x00,0x00,0x9E,0xA6,0x69,0x9A,
+	0xA6,0x69,0x9A,0xA6,0x79,0x9E,0xE7,0x79,0x18,0xF8,0xFF,0xFF,0x3F,0x08,0x01,0x20,
+	0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,
+	0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x80,0x01,0x20,0x10,
+	0x80,0x02,0x20,0x10,0x40,0x02,0x10,0x60,0x30,0x04,0x10,0x80,0x0F,0x08,0x0C,0xF0,
+	0x03,0x00,0x00,0x30,0x9C,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x49,
+	0x92,0x24,0x49,0xFC,0x7F,0x03,0x80,0x01,0x80,0x02,0x40,0x04,0x20,0x08,0x20,0x10,
+	0x10,0x10,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,
+	0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x10,0x10,0x10,0x20,0x08,0x40,0x04,0x00,0x00,
+	0x00,0x9E,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x59,
+	0x0C,0x03,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,
+	0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,
+	0x08,0x20,0x10,0x10,0x10,0x10,0x20,0x08,0x40,0x04,0x80,0x01,0x03,0x06,0xC0,0xF8,
+	0x3F,0x00,0x00,0x00,0x9E,0xA6,0x69,0x9A,0xA6,0x69,0x9A,0xA6,0x69,0x9A,0x26,0x49,
+	0xF8,0xFF,0xFF,0x3F,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,
+	0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,
+	0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x20,0x08,0x20,0x00,
+	0x00,0x00,0x9E,0xA2,0x28,0x8A,0xA2,0x28,0x8A,0xA2,0x28,0x8A,0x22,0x08,0xF8,0xFF,
+	0xFF,0x3F,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,
+	0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x08,0x00,0x00,
+	0x30,0x9C,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x69,0x9A,0xA6,0x69,
+	0x1A,0xFC,0x7F,0x03,0x80,0x01,0x80,0x02,0x40,0x04,0x20,0x08,0x20,0x08,0x10,0x10,
+	0x10,0x10,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,
+	0x08,0x20,0x08,0x04,0x20,0x08,0x04,0x20,0x10,0x04,0x10,0x10,0x04,0x10,0x20,0x04,
+	0x10,0x40,0xFC,0x0F,0x00,0x00,0x00,0x1E,0x82,0x20,0x08,0x82,0x20,0x08,0x82,0x20,
+	0x08,0x82,0x20,0x08,0x82,0x78,0xF8,0xFF,0xFF,0x3F,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xF8,0xFF,0xFF,0x3F,
+	0x00,0x00,0x00,0x1E,0xF8,0xFF,0xFF,0x3F,0x00,0x04,0x41,0x10,0x04,0x41,0x10,0xE4,
+	0x01,0x20,0x20,0x20,0x20,0x20,0x20,0x10,0x10,0x0C,0xF8,0xFF,0xFF,0x03,0x00,0x00,
+	0x00,0x1E,0x82,0x20,0x0C,0xC3,0x30,0x0C,0xC3,0x30,0x92,0x24,0x49,0x92,0x04,0x01,
+	0xF8,0xFF,0xFF,0x3F,0x01,0x01,0x01,0x80,0x02,0x40,0x02,0x20,0x04,0x10,0x08,0x08,
+	0x10,0x04,0x20,0x02,0x40,0x01,0x80,0x80,0x01,0x40,0x02,0x20,0x04,0x20,0x08,0x10,
+	0x10,0x08,0x20,0x20,0x00,0x00,0x00,0x1E,0x04,0x41,0x10,0x04,0x41,0x10,0x04,0x41,
+	0x10,0x04,0xF8,0xFF,0xFF,0x3F,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x00,0x00,0x00,0x9E,0x20,0x18,0x04,0x41,0x10,0x08,0x82,0x20,0x08,
+	0x86,0x20,0x08,0x42,0x10,0x04,0x61,0x08,0x1E,0xF8,0xFF,0xFF,0x3F,0x20,0x40,0x80,
+	0x01,0x06,0x18,0x20,0xC0,0x03,0x04,0x18,0x60,0x80,0x80,0x01,0x60,0x10,0x0C,0x03,
+	0xC0,0x30,0x08,0x06,0x80,0x01,0x60,0xF8,0xFF,0xFF,0x3F,0x00,0x00,0x00,0x9E,0x20,
+	0x08,0x04,0x41,0x10,0x04,0x81,0x20,0x08,0x82,0x20,0x10,0x04,0x79,0xF8,0xFF,0xFF,
+	0x3F,0x10,0x60,0x80,0x01,0x06,0x08,0x30,0x40,0x80,0x03,0x04,0x08,0x30,0x40,0x80,
+	0x03,0x04,0x18,0xF8,0xFF,0xFF,0x3F,0x00,0x00,0x30,0x9C,0x24,0x49,0x92,0x24,0x49,
+	0x92,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x49,0x16,0xC3,0xFC,0x7F,0x03,0x80,0x01,
+	0x80,0x02,0x40,0x04,0x20,0x08,0x10,0x10,0x10,0x10,0x08,0x20,0x08,0x20,0x08,0x20,
+	0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x10,0x10,
+	0x20,0x10,0x20,0x08,0x40,0x04,0x80,0x01,0x03,0x06,0xC0,0xF8,0x3F,0x00,0x00,0x00,
+	0x9E,0xA2,0x28,0x8A,0xA2,0x28,0x8A,0xA2,0x28,0x8A,0x61,0xF8,0xFF,0xFF,0x3F,0x08,
+	0x04,0x08,0x04,0x08,0x04,0x08,0x04,0x08,0x04,0x08,0x04,0x08,0x04,0x08,0x04,0x08,
+	0x04,0x08,0x02,0x10,0x02,0x10,0x01,0x20,0x80,0xC0,0x7F,0x00,0x00,0x30,0x9C,0x24,
+	0x49,0x92,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x49,0x36,0xCB,0x82,
+	0xFC,0x7F,0x03,0x80,0x01,0x80,0x02,0x40,0x04,0x20,0x08,0x10,0x10,0x10,0x10,0x08,
+	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
+	0x20,0x10,0x20,0x10,0x10,0x20,0x30,0x20,0x48,0x40,0x84,0x80,0x01,0x03,0x01,0x06,
+	0xC0,0x02,0xF8,0x3F,0x04,0x08,0x00,0x00,0x00,0x9E,0xA2,0x28,0x8A,0xA2,0x28,0x8A,
+	0xE2,0x38,0x9E,0x65,0x41,0x10,0x04,0xF8,0xFF,0xFF,0x3F,0x08,0x01,0x08,0x01,0x08,
+	0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x07,0x08,0x09,0x08,0x11,0x08,0x80,0x20,
+	0x10,0x80,0x40,0x10,0x40,0x80,0x01,0x20,0x20,0x02,0xC0,0x1F,0x04,0x08,0x30,0x20,
+	0x00,0x00,0x59,0x96,0x65,0x59,0x96,0x65,0x69,0x9A,0xA6,0x69,0x1A,0x06,0x04,0x80,
+	0x0F,0x08,0x40,0x10,0x10,0x20,0x20,0x20,0x10,0x40,0x20,0x08,0x40,0x20,0x08,0x80,
+	0x20,0x08,0x80,0x20,0x08,0x80,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x10,
+	0x10,0x02,0x10,0x10,0x04,0x08,0x20,0x08,0x06,0xF0,0x01,0x80,0x20,0x08,0x82,0x20,
+	0x08,0x82,0xE0,0x09,0x82,0x20,0x08,0x82,0x20,0x08,0x02,0x08,0x08,0x08,0x08,0x08,
+	0x08,0x08,0x08,0x08,0xF8,0xFF,0xFF,0x3F,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,
+	0x08,0x08,0x00,0x00,0x00,0x0E,0x04,0x41,0x10,0x04,0x41,0x10,0x04,0x41,0x10,0x04,
+	0x41,0x10,0xE4,0x01,0xF8,0xFF,0xFF,0x03,0x04,0x08,0x10,0x10,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x10,0x08,0x04,0x02,0xF8,0xFF,0xFF,0x01,0x80,0x20,0x10,0x04,
+	0xC1,0x20,0x08,0x06,0x41,0x10,0x84,0x21,0x08,0x42,0x10,0x84,0x20,0x18,0xE0,0x03,
+	0x1C,0x60,0x80,0x03,0x0C,0x30,0xC0,0x01,0x06,0x18,0x30,0x0E,0x80,0x01,0x70,0x0C,
+	0x03,0xE0,0x18,0x07,0xC0,0x38,0x80,0x20,0x10,0x04,0x83,0x20,0x10,0x04,0x41,0x08,
+	0xC2,0x10,0x84,0x21,0x08,0x06,0x41,0x30,0x08,0x82,0x41,0x10,0x84,0x20,0x0C,0x41,
+	0x08,0x02,0x18,0xE0,0x07,0x78,0x80,0x03,0x1C,0xE0,0x07,0x38,0x1C,0x03,0xE0,0x1C,
+	0x80,0x03,0x70,0x0E,0xC0,0x01,0x38,0x30,0xC0,0x01,0x0E,0x70,0x80,0x03,0x1C,0x60,
+	0x80,0x03,0x0C,0x38,0x07,0xE0,0x1C,0x80,0x03,0x78,0x07,0xE0,0x18,0x00,0x24,0x49,
+	0x92,0xC5,0x30,0x0C,0xC3,0x30,0x0C,0xC3,0x30,0x8C,0x24,0x49,0x12,0x04,0x20,0x18,
+	0x10,0x20,0x0C,0x40,0x02,0x80,0x01,0x01,0x02,0xC0,0x0C,0x20,0x10,0x10,0x20,0x0C,
+	0xC0,0x02,0x80,0x01,0x40,0x02,0x20,0x0C,0x18,0x10,0x04,0x60,0x03,0x80,0x80,0x01,
+	0x40,0x06,0x30,0x08,0x08,0x10,0x20,0x80,0x20,0x08,0x04,0x41,0x10,0x04,0x82,0x21,
+	0x0C,0x41,0x10,0x84,0x21,0x08,0x02,0x18,0x20,0xC0,0x01,0x06,0x18,0x20,0xC0,0x01,
+	0xFE,0x3F,0x02,0x80,0x01,0x40,0x30,0x0C,0x02,0x80,0x01,0x40,0x30,0x08,0x00,0x20,
+	0x49,0x92,0xA4,0x69,0x9A,0xA6,0x79,0x96,0x65,0x59,0x96,0x24,0x49,0x12,0x08,0x30,
+	0x08,0x28,0x08,0x26,0x08,0x21,0x08,0xC0,0x20,0x08,0x20,0x20,0x08,0x10,0x20,0x08,
+	0x0C,0x20,0x08,0x02,0x20,0x08,0x80,0x01,0x20,0x08,0x40,0x20,0x08,0x20,0x20,0x08,
+	0x18,0x20,0x08,0x04,0x20,0x08,0x03,0x20,0x88,0x20,0x48,0x20,0x38,0x20,0x08,0x20,
+	0x00,0x00,0x00,0xBE,0x28,0x8A,0x22,0xFE,0xFF,0xFF,0xFF,0x07,0x02,0x04,0x02,0x04,
+	0x02,0x04,0x02,0x04,0x00,0x20,0x08,0x04,0x41,0x30,0x08,0x82,0x41,0x10,0x04,0x38,
+	0xC0,0x03,0x1C,0x60,0x80,0x03,0x0C,0x30,0xC0,0x01,0x06,0x18,0xE0,0x00,0x20,0x8A,
+	0xA2,0xE8,0x03,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0x04,0xFE,0xFF,0xFF,0xFF,0x07,
+	0x00,0x00,0x00,0x04,0x41,0x10,0x86,0x20,0x08,0x82,0x41,0x10,0x04,0x01,0x40,0x30,
+	0x0C,0x02,0x80,0x01,0x60,0x10,0x18,0x60,0x80,0x01,0x02,0x0C,0x30,0x40,0x00,0x08,
+	0x82,0x20,0x08,0x82,0x20,0x08,0x82,0x20,0x08,0x82,0x04,0x04,0x04,0x04,0x04,0x04,
+	0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x00,0x00,0x00,0x80,0x20,0x08,0x02,
+	0x08,0x10,0x60,0x80,0x00,0x80,0x71,0x1C,0xC7,0x71,0x1C,0xC7,0x71,0x1C,0xC7,0x01,
+	0x80,0x0F,0x20,0x40,0x10,0x10,0x40,0x20,0x10,0x20,0x20,0x08,0x20,0x20,0x08,0x20,
+	0x20,0x08,0x10,0x20,0x08,0x10,0x20,0x08,0x10,0x20,0x08,0x10,0x10,0x10,0x10,0x08,
+	0x60,0x10,0x08,0x80,0xFF,0x3F,0x00,0x00,0x00,0x14,0x45,0x51,0x14,0x45,0x51,0x14,
+	0x45,0x51,0x14,0x07,0x40,0x08,0x20,0x10,0x10,0x10,0x10,0x20,0x08,0x20,0x08,0x20,
+	0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x10,0x10,0x08,0x60,0x04,0x80,0xFF,
+	0x03,0x00,0x80,0x70,0x14,0x45,0x51,0x14,0x45,0x51,0x14,0x45,0x51,0xFE,0x80,0x01,
+	0x07,0x60,0x08,0x10,0x10,0x10,0x10,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
+	0x20,0x08,0x20,0x08,0x20,0x10,0x10,0x10,0x08,0x00,0x80,0x71,0x14,0x45,0x51,0x14,
+	0x45,0x51,0x14,0x45,0x51,0x1E,0xFE,0x01,0x80,0x01,0x06,0x60,0x08,0x10,0x10,0x10,
+	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x10,0x10,
+	0x10,0x20,0x08,0xF8,0xFF,0xFF,0x3F,0x00,0x80,0x70,0x1C,0xC7,0x71,0x1C,0xC7,0x71,
+	0x1C,0xC7,0x71,0x1C,0x02,0xFE,0xC0,0x05,0x03,0x20,0x04,0x0C,0x10,0x04,0x10,0x10,
+	0x04,0x10,0x08,0x04,0x20,0x08,0x04,0x20,0x08,0x04,0x20,0x08,0x04,0x20,0x08,0x04,
+	0x20,0x08,0x04,0x20,0x08,0x04,0x20,0x10,0x04,0x20,0x20,0x04,0x10,0xC0,0x04,0x08,
+	0x07,0x00,0x41,0x10,0x9E,0x61,0x18,0x86,0x61,0x18,0x10,0x10,0x10,0x80,0xFF,0xFF,
+	0x3F,0x60,0x10,0x10,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x00,
+	0x00,0xF3,0x3C,0xCF,0xF3,0x3C,0xCF,0xF3,0x3C,0xCF,0xF3,0x34,0x0D,0xE0,0x07,0xC0,
+	0x0F,0x13,0x08,0x20,0xD0,0x14,0x08,0x10,0x20,0x08,0x10,0x08,0x40,0x08,0x10,0x08,
+	0x40,0x08,0x10,0x08,0x40,0x08,0x10,0x08,0x40,0x08,0x10,0x08,0x40,0x08,0x10,0x08,
+	0x40,0x08,0x10,0x08,0x20,0x08,0x10,0x10,0x20,0x08,0x10,0x70,0x18,0x08,0x08,0x90,
+	0x07,0x10,0x04,0x10,0x20,0x02,0x10,0xC0,0x01,0x00,0x00,0x00,0x04,0x41,0x10,0x04,
+	0x41,0x10,0x04,0x41,0x10,0x1C,0x40,0x20,0x10,0x10,0x08,0x08,0x08,0x08,0x08,0x08,
+	0x10,0x10,0xE0,0xFF,0x3F,0x00,0x00,0x78,0x02,0x18,0xF8,0xFF,0x3F,0x18,0x20,0x08,
+	0xFA,0x02,0x10,0x10,0x10,0x18,0xF8,0xFF,0xFF,0x0F,0x18,0x00,0x00,0x00,0x08,0x82,
+	0x20,0x08,0x42,0x51,0x14,0x45,0x51,0x08,0x08,0x14,0x22,0x41,0x81,0x80,0x01,0x40,
+	0x02,0x20,0x04,0x10,0x08,0x08,0x10,0x08,0x20,0x00,0x00,0x78,0xF8,0xFF,0xFF,0x3F,
+	0x00,0x00,0x00,0x04,0x41,0x10,0x04,0x41,0x10,0x04,0x41,0x70,0x04,0x41,0x10,0x04,
+	0x41,0x10,0x04,0xC1,0x01,0x40,0x20,0x10,0x08,0x08,0x08,0x08,0x08,0x08,0x30,0x40,
+	0xC0,0xFF,0x3F,0x20,0x10,0x08,0x08,0x08,0x08,0x08,0x08,0x10,0x60,0x80,0xFF,0x3F,
+	0x00,0x00,0x00,0x04,0x41,0x10,0x04,0x41,0x10,0x04,0x41,0x10,0x1C,0x40,0x20,0x10,
+	0x10,0x08,0x08,0x08,0x08,0x08,0x08,0x10,0x10,0xE0,0xFF,0x3F,0x00,0x80,0x70,0x14,
+	0x45,0x51,0x14,0x45,0x51,0x14,0x45,0x51,0x14,0x87,0xFE,0x80,0x01,0x07,0x60,0x08,
+	0x10,0x10,0x10,0x10,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,
+	0x08,0x20,0x10,0x10,0x10,0x10,0x60,0x0C,0x80,0x01,0x03,0xFE,0x00,0x00,0x00,0x14,
+	0x45,0x51,0x14,0x45,0x51,0x14,0x45,0x51,0x14,0x07,0x40,0x08,0x20,0x10,0x10,0x10,
+	0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x10,
+	0x10,0x08,0x60,0x04,0x80,0xFF,0x03,0x00,0x80,0x71,0x14,0x45,0x51,0x14,0x45,0x51,
+	0x14,0x45,0x51,0x3C,0xFE,0x01,0x80,0x01,0x06,0x60,0x08,0x10,0x10,0x10,0x20,0x08,
+	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x10,0x10,0x10,0x20,
+	0x08,0xF8,0xFF,0xFF,0x1F,0x00,0x00,0x00,0x0C,0x41,0x10,0x04,0x41,0x10,0xC0,0x01,
+	0x20,0x10,0x08,0x08,0x08,0x08,0x08,0x00,0xC0,0x71,0x1C,0xC7,0x71,0x1C,0xC7,0x71,
+	0x1C,0x06,0xC0,0x01,0x08,0x20,0x02,0x10,0x10,0x04,0x20,0x08,0x08,0x20,0x08,0x08,
+	0x20,0x08,0x08,0x20,0x08,0x10,0x20,0x08,0x10,0x20,0x08,0x10,0x20,0x08,0x20,0x10,
+	0x10,0x40,0x08,0x80,0x07,0x00,0x41,0x10,0x1E,0x45,0x51,0x14,0x45,0x41,0x10,0x10,
+	0x10,0xF0,0xFF,0xFF,0x0F,0x10,0x10,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
+	0x20,0x10,0x00,0x00,0x70,0x10,0x04,0x41,0x10,0x04,0x41,0x10,0x04,0x41,0x1C,0xF8,
+	0xFF,0x03,0x0C,0x10,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x10,0x08,0x0C,0xF8,0xFF,
+	0x3F,0x00,0x41,0x30,0x08,0x82,0x40,0x10,0x04,0x61,0x08,0x82,0x10,0x04,0x01,0x18,
+	0x60,0x80,0x01,0x0E,0x30,0xC0,0x07,0x18,0x30,0x0C,0x80,0x03,0x60,0x18,0x07,0xC0,
+	0x30,0x08,0x00,0x41,0x20,0x08,0x06,0x41,0x10,0x86,0x20,0x0C,0x41,0x10,0x08,0x82,
+	0x41,0x10,0x84,0x21,0x08,0x43,0x18,0xE0,0x07,0x38,0xC0,0x01,0x0E,0x30,0x0C,0x80,
+	0x03,0x70,0x0C,0x80,0x03,0x70,0x18,0xE0,0x07,0x38,0xC0,0x01,0x0E,0x30,0x0C,0x80,
+	0x03,0x70,0x0E,0xC0,0x01,0x38,0x00,0x45,0x51,0x14,0x86,0x20,0x08,0x82,0x70,0x14,
+	0x45,0x41,0x08,0x20,0x18,0x10,0x20,0x0C,0xC0,0x02,0x01,0x01,0xC2,0x2C,0x10,0x2C,
+	0xC2,0x80,0x01,0x01,0x40,0x06,0x20,0x08,0x18,0x10,0x20,0x00,0x41,0x30,0x08,0x82,
+	0xC2,0x30,0x04,0x61,0x08,0x82,0x10,0x04,0x01,0x18,0x60,0x80,0x01,0x0E,0x30,0xC0,
+	0x18,0x07,0x06,0xD8,0x01,0x30,0x0C,0x80,0x03,0x60,0x18,0x07,0xC0,0x30,0x08,0x00,
+	0x44,0x51,0x14,0xC5,0x71,0x1C,0xC7,0x71,0x14,0x45,0x01,0x20,0x08,0x30,0x08,0x2C,
+	0x08,0x22,0x08,0x21,0x08,0xC0,0x20,0x08,0x20,0x20,0x08,0x18,0x20,0x08,0x04,0x20,
+	0x08,0x02,0x20,0x88,0x01,0x20,0x48,0x20,0x28,0x20,0x18,0x20,0x00,0x80,0x68,0xBE,
+	0x2B,0x8A,0x22,0x04,0x40,0x04,0x60,0xB8,0x1F,0x0B,0x9F,0x01,0x04,0xE0,0xF0,0x02,
+	0x02,0x04,0x02,0x04,0x02,0x04,0x00,0x00,0x00,0x3E,0xFE,0xFF,0xFF,0xFF,0x1F,0x00,
+	0x20,0x8A,0xA2,0xEB,0x6B,0x08,0x02,0x04,0x02,0x04,0x02,0x04,0x04,0xE0,0xF1,0x02,
+	0xB8,0x1F,0x0A,0x9F,0x01,0x40,0x04,0x60,0x04,0x00,0x00,0x20,0x08,0x82,0x20,0x08,
+	0x82,0x20,0x08,0x82,0x20,0x08,0x82,0x38,0x04,0x02,0x02,0x02,0x02,0x04,0x04,0x08,
+	0x08,0x10,0x10,0x10,0x10,0x08,0x06,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,
+	0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
+	0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,
+	0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,
+	0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,
+	0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,
+	0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,
+	0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,
+	0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,
+	0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,
+	0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,
+	0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,
+	0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,
+	0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,
+	0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,
+	0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,
+	0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,
+	0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,
+	0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,
+	0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,
+	0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,
+	0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,
+	0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,
+	0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,
+	0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,
+	0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,
+	0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,
+	0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,
+	0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,
+	0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,
+	0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,
+	0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,
+	0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,
+	0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,
+	0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,
+	0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,
+	0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,
+	0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,
+	0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,
+	0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,
+	0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,
+	0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,
+	0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,
+	0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,
+	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,
+	0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,
+	0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,
+	0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,
+	0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,
+	0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,
+	0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,
+	0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,
+	0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,
+	0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,
+	0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,
+	0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,
+	0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,
+	0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,
+	0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,
+	0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,
+	0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
+	0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,
+	0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,
+	0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,
+	0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,
+	0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,
+	0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,
+	0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,
+	0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,
+	0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,
+	0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,
+	0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,
+	0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,
+	0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,
+	0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,
+	0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,
+	0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,
+	0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,
+	0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,
+	0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,
+	0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,
+	0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,
+	0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,
+	0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,
+	0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,
+	0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,
+	0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,
+	0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,
+	0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,
+	0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,
+	0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,
+	0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,
+	0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,
+	0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,
+	0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,
+	0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,
+	0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,
+	0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,
+	0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,
+	0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,
+	0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,
+	0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,
+	0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,
+	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,
+	0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,
+	0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,
+	0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,
+	0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,
+	0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,
+	0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,
+	0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,
+	0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,
+	0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,
+	0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,
+	0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,
+	0x25,0x49,0x9A,0x66,0x59,0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,
+	0x08,0x20,0x08,0x20,0x08,0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,
+	0x22,0x48,0x80,0x20,0x88,0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,
+	0x20,0x08,0x20,0xF8,0xFF,0xFF,0x3F,0x80,0x27,0x49,0x92,0x25,0x49,0x9A,0x66,0x59,
+	0x96,0x25,0x49,0x92,0x07,0xF8,0xFF,0xFF,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
+	0x01,0x20,0x88,0x20,0x88,0x20,0x48,0x0E,0x23,0x48,0x01,0x22,0x48,0x80,0x20,0x88,
+	0x40,0x20,0x08,0x21,0x20,0x08,0x1E,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0xF8,0xFF,
+	0xFF,0x3F,0x00,0x00,0x30,0x3C,0x18,0x40,0x18,0xB0,0xFF,0x1F,0x00,0x00,0x00,0x1C,
+	0x45,0x51,0x14,0x45,0xD1,0x1E,0x45,0x51,0x14,0x05,0x01,0x80,0xFF,0x03,0x40,0x04,
+	0x20,0x08,0x10,0x10,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x07,0xC0,0xFF,0xFF,
+	0xFF,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x10,0x10,0x10,0x08,0x00,0x82,0x61,0x18,
+	0xA7,0x69,0x9A,0xA6,0x69,0x9A,0xA6,0x49,0x92,0x24,0x41,0x10,0x02,0x02,0x20,0x02,
+	0x30,0x02,0x28,0xFF,0xFF,0x27,0xC0,0x02,0x20,0x20,0x02,0x20,0x10,0x02,0x20,0x08,
+	0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,
+	0x20,0x08,0x20,0x10,0x20,0x20,0x20,0x40,0x20,0x20,0x20,0x00,0x00,0x50,0x0C,0xC3,
+	0x30,0x0C,0xC3,0x30,0x0C,0xC3,0x30,0x0C,0x43,0x01,0x04,0x01,0x04,0x83,0xC8,0x5C,
+	0x30,0x20,0x10,0x40,0x08,0x40,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x40,
+	0x10,0x40,0x30,0x20,0xC8,0x58,0x04,0x87,0x04,0x01,0x00,0x20,0x28,0x8A,0xC3,0x30,
+	0x0C,0x83,0x60,0x0C,0xC3,0x30,0x8E,0xA2,0x08,0x08,0x10,0x24,0x60,0x24,0x80,0x01,
+	0x24,0x06,0x24,0x18,0x24,0x60,0x24,0x80,0x25,0x26,0xFE,0x3F,0x80,0x25,0x60,0x24,
+	0x18,0x24,0x06,0x24,0x80,0x01,0x24,0x40,0x24,0x30,0x24,0x08,0x00,0x00,0x00,0x3E,
+	0xFE,0xFF,0xC0,0xFF,0x1F,0x00,0xC0,0x70,0x9E,0xE7,0xBA,0xAE,0xEB,0x7A,0x9E,0xA7,
+	0x21,0x80,0x03,0x60,0x04,0x40,0xE0,0x13,0x08,0x80,0x10,0x14,0x10,0x80,0x08,0x08,
+	0x10,0x01,0x08,0x10,0x20,0x01,0x08,0x10,0x20,0x01,0x08,0x10,0x40,0x01,0x08,0x20,
+	0x40,0x01,0x08,0x20,0x80,0x80,0x08,0x40,0x80,0x80,0x10,0x80,0x40,0x41,0x10,0x21,
+	0x3E,0x1E,0x00,0x00,0x08,0x82,0x00,0x00,0x00,0x20,0x08,0x20,0x60,0x20,0x60,0x60,
+	0x00,0x00,0x30,0x0C,0x25,0x49,0x9E,0xE7,0x79,0x9E,0x65,0x59,0x96,0x65,0x59,0x9E,
+	0xA7,0x49,0x92,0x44,0x31,0x0C,0x03,0xF8,0x3F,0x06,0xC0,0x01,0x01,0x80,0x02,0x40,
+	0x04,0x20,0xE0,0x0F,0x08,0x10,0x18,0x30,0x10,0x10,0x04,0x40,0x10,0x10,0x02,0x80,
+	0x10,0x08,0x02,0x80,0x20,0x08,0x01,0x21,0x08,0x01,0x21,0x08,0x01,0x21,0x08,0x01,
+	0x21,0x08,0x01,0x21,0x08,0x01,0x21,0x08,0x01,0x21,0x08,0x02,0x80,0x20,0x10,0x02,
+	0x80,0x10,0x10,0x40,0x10,0x20,0x08,0x40,0x04,0x80,0x02,0x01,0x01,0x02,0x80,0x1C,
+	0x70,0xE0,0x0F,0x00,0x00,0x18,0x86,0x61,0x18,0x86,0x61,0x10,0x1C,0x10,0x22,0x08,
+	0x22,0x08,0x21,0x08,0x21,0x08,0x11,0x10,0x11,0xE0,0x3F,0x00,0x80,0x20,0x08,0xC5,
+	0x21,0x08,0x47,0x01,0x10,0x6C,0x83,0x80,0x03,0x60,0x10,0x04,0x2C,0xC2,0x80,0x01,
+	0x01,0x60,0x06,0x00,0x00,0x20,0x08,0x82,0x20,0x08,0x82,0x20,0x08,0x82,0x20,0x08,
+	0x82,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+	0x7E,0x00,0x00,0x20,0x08,0x82,0x20,0x08,0x82,0x04,0x04,0x04,0x04,0x04,0x04,0x04,
+	0x04,0x00,0x00,0x30,0x0C,0x25,0x49,0x92,0x24,0x79,0x9E,0xE7,0x79,0x9E,0xE7,0x79,
+	0x9E,0x26,0x49,0x92,0x44,0x31,0x0C,0x03,0xF8,0x3F,0x06,0xC0,0x01,0x01,0x80,0x02,
+	0x40,0x04,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0xFE,0xFE,0x11,0x08,0x01,0x01,0x20,
+	0x08,0x01,0x01,0x20,0x08,0x01,0x01,0x20,0x08,0x01,0x01,0x20,0x08,0x01,0x03,0x20,
+	0x08,0x01,0x05,0x20,0x08,0x81,0x18,0x20,0x08,0x82,0x20,0x20,0x08,0x7C,0x40,0x20,
+	0x10,0x80,0x10,0x10,0x11,0x20,0x08,0x40,0x04,0x80,0x02,0x01,0x01,0x02,0x80,0x1C,
+	0x70,0xE0,0x0F,0x00,0x00,0x08,0x82,0x20,0x08,0x82,0x20,0x08,0x02,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x18,0x86,0x61,0x18,0x86,0x61,0x18,
+	0x06,0xE0,0x0F,0x10,0x10,0x08,0x10,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
+	0x10,0x10,0x08,0xE0,0x07,0x00,0x80,0x61,0x18,0x86,0x61,0x18,0xC6,0x61,0x18,0x86,
+	0x61,0x18,0x86,0x61,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,
+	0x02,0x10,0x02,0x10,0xFE,0xFF,0x13,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,
+	0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x00,0x60,0x18,0x45,0x51,0x1C,0x86,
+	0x01,0x04,0x10,0x03,0x18,0x80,0x14,0x80,0x12,0x80,0x11,0x80,0x80,0x10,0x61,0x10,
+	0x1F,0x10,0x00,0x60,0x18,0x45,0x71,0x1C,0x86,0x01,0x06,0x06,0x01,0x08,0x80,0x10,
+	0x80,0x10,0x80,0x20,0x10,0x80,0x20,0x10,0x51,0x08,0xCF,0x07,0x00,0x00,0x00,0x00,
+	0x20,0x08,0x82,0x20,0x80,0x40,0x20,0x18,0x08,0x00,0x00,0x00,0x3C,0x04,0x41,0x10,
+	0x04,0x41,0x10,0x04,0x41,0x10,0x07,0x41,0x10,0x04,0xF8,0xFF,0xFF,0x1F,0x08,0x10,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x10,0x08,0x04,0xF8,0xFF,0x0F,0x10,0x20,0x20,
+	0x20,0x00,0x60,0x18,0x86,0x61,0x18,0x86,0xA1,0x0B,0x82,0x20,0x08,0x82,0x2F,0x08,
+	0x82,0xC0,0x0F,0xE0,0x3F,0xF0,0x3F,0xF0,0x7F,0xF8,0x7F,0xF8,0x7F,0xF8,0x7F,0xF8,
+	0xFF,0x08,0xFF,0xFF,0x01,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0xFF,0xFF,0xFF,0x01,
+	0x08,0x08,0x08,0x08,0x00,0x00,0x20,0x08,0x0C,0x0C,0x00,0x00,0x00,0x00,0x08,0xC2,
+	0x20,0x08,0x02,0x10,0x10,0xC0,0x11,0x11,0x12,0x0E,0x00,0x00,0x18,0x86,0x71,0x10,
+	0x04,0x01,0x04,0x10,0x02,0x10,0x01,0x10,0x80,0xFF,0x1F,0x10,0x10,0x10,0x00,0x00,
+	0x18,0x86,0x61,0x18,0x86,0x61,0x18,0x06,0xE0,0x1F,0x10,0x20,0x08,0x40,0x08,0x40,
+	0x08,0x40,0x08,0x40,0x08,0x40,0x08,0x20,0x30,0x10,0xC0,0x0F,0x00,0x00,0x50,0x1C,
+	0x82,0x70,0x14,0x82,0x20,0x60,0x04,0x80,0x01,0x03,0xC2,0x2C,0x60,0x10,0x04,0x80,
+	0x03,0x83,0x64,0x18,0x00,0x20,0x28,0x8A,0xE2,0x61,0x18,0x86,0x20,0x08,0x42,0x10,
+	0x14,0xE7,0x69,0x1A,0x86,0x41,0x10,0x40,0x20,0x01,0x10,0x01,0x08,0x01,0xF0,0xFF,
+	0x01,0x30,0x01,0x08,0x01,0x06,0x80,0x01,0x60,0x18,0x04,0x03,0xC0,0x30,0x0C,0x03,
+	0x02,0x80,0x02,0x80,0x01,0x60,0x02,0x60,0x10,0x02,0x18,0x08,0x02,0x04,0x02,0xFE,
+	0x3F,0x02,0x02,0x00,0x20,0x28,0x8A,0xE6,0x61,0x18,0x82,0x20,0x08,0x41,0x10,0x9C,
+	0xA7,0x69,0x1A,0x86,0x61,0x18,0x40,0x20,0x01,0x10,0x01,0x08,0x01,0x20,0xF0,0xFF,
+	0x01,0x18,0x01,0x06,0x81,0x01,0x61,0x10,0x0C,0x03,0xC0,0x30,0x08,0x06,0x08,0x20,
+	0x80,0x01,0x04,0x30,0x60,0x02,0x28,0x18,0x01,0x24,0x08,0x01,0x22,0x01,0x21,0x81,
+	0x20,0x66,0x20,0x18,0x20,0x00,0x40,0x18,0x8A,0xE2,0x79,0x96,0xE5,0x20,0x08,0xC2,
+	0x10,0x14,0xC7,0x69,0x9A,0x86,0x41,0x10,0x04,0x60,0x30,0x80,0x08,0x01,0x08,0x01,
+	0x08,0x02,0x01,0x20,0x08,0x02,0x01,0x10,0x08,0x82,0x0C,0xB0,0xC5,0x03,0x40,0x38,
+	0xC0,0x20,0x18,0x06,0x80,0x01,0x60,0x10,0x03,0x0C,0x80,0x02,0x03,0x40,0x02,0xC0,
+	0x30,0x02,0x30,0x08,0x02,0x08,0x04,0x02,0xFE,0x3F,0x02,0x02,0x02,0x00,0x00,0xC3,
+	0x30,0x0C,0xD3,0x2C,0x09,0x82,0x20,0x08,0xF0,0x03,0x08,0x0C,0x04,0x08,0x02,0x10,
+	0x02,0x10,0x10,0x01,0x10,0x18,0xF8,0x10,0x10,0x10,0x10,0x08,0x08,0x04,0x00,0x04,
+	0x61,0x08,0x82,0x34,0x4D,0xB3,0x2C,0x8B,0xC2,0x30,0x0C,0x83,0x20,0x18,0x04,0x01,
+	0x30,0x0E,0x80,0x01,0x60,0x1C,0x13,0x08,0xE0,0x10,0x08,0x18,0x10,0x10,0x07,0x10,
+	0x20,0xC0,0x10,0x40,0x30,0x10,0x80,0x18,0x10,0xE1,0x10,0x03,0x10,0x1C,0x10,0x60,
+	0x10,0x80,0x11,0x1E,0x20,0xC0,0x01,0x06,0x38,0x00,0x04,0x61,0x08,0x82,0x30,0x0C,
+	0xA3,0x2C,0xCB,0xD2,0x34,0x0D,0x83,0x20,0x18,0x04,0x01,0x30,0x0E,0x80,0x01,0x60,
+	0x1C,0x13,0xE0,0x10,0x18,0x10,0x07,0x10,0xC1,0x10,0x80,0x30,0x10,0x40,0x18,0x10,
+	0x40,0xE0,0x10,0x20,0x03,0x10,0x10,0x1C,0x10,0x08,0x60,0x10,0x80,0x11,0x1E,0x20,
+	0xC0,0x01,0x06,0x38,0x00,0x04,0x61,0x08,0x82,0x38,0x4D,0xB3,0x2C,0xCB,0xD2,0x34,
+	0x0E,0x83,0x20,0x18,0x04,0x01,0x30,0x0E,0x80,0x01,0x60,0x1C,0x13,0x01,0xE0,0x10,
+	0x80,0x18,0x10,0x40,0x07,0x10,0x20,0xC0,0x10,0x10,0x30,0x10,0x18,0x18,0x10,0x20,
+	0xE0,0x10,0x40,0x03,0x10,0x80,0x1C,0x10,0x01,0x60,0x10,0x80,0x11,0x1E,0x20,0xC0,
+	0x01,0x06,0x38,0x00,0x04,0x61,0x08,0x82,0x3C,0x4D,0xB3,0x2C,0x8B,0xE2,0x38,0x0D,
+	0x83,0x20,0x18,0x04,0x01,0x30,0x0E,0x80,0x01,0x60,0x1C,0x13,0x80,0x01,0xE0,0x10,
+	0x40,0x18,0x10,0x20,0x07,0x10,0x20,0xC0,0x10,0x40,0x30,0x10,0x80,0x18,0x10,0xE1,
+	0x10,0x01,0x03,0x10,0x01,0x1C,0x10,0xE0,0x60,0x10,0x80,0x11,0x1E,0x20,0xC0,0x01,
+	0x06,0x38,0x00,0x04,0x61,0x08,0x82,0x30,0x4D,0xA3,0x28,0x8A,0xC2,0x34,0x0D,0x83,
+	0x20,0x18,0x04,0x01,0x30,0x0E,0x80,0x01,0x60,0x1C,0x13,0xE0,0x10,0x60,0x18,0x10,
+	0x40,0x07,0x10,0xC0,0x10,0x30,0x10,0x18,0x10,0xE0,0x10,0x03,0x10,0x60,0x1C,0x10,
+	0x40,0x60,0x10,0x80,0x11,0x1E,0x20,0xC0,0x01,0x06,0x38,0x00,0x04,0x61,0x08,0x82,
+	0x30,0x4C,0xB3,0x2C,0xCB,0xD2,0x30,0x0C,0x83,0x20,0x18,0x04,0x01,0x30,0x0E,0x80,
+	0x01,0x60,0x1C,0x13,0xE0,0x10,0x18,0x10,0xE0,0x07,0x10,0x90,0xC0,0x10,0x08,0x31,
+	0x10,0x08,0x19,0x10,0x08,0xE1,0x10,0xF0,0x03,0x10,0x1C,0x10,0x60,0x10,0x80,0x11,
+	0x1E,0x20,0xC0,0x01,0x06,0x38,0x10,0x04,0x41,0x08,0x82,0x20,0x0C,0xC3,0x30,0x8C,
+	0xA2,0x28,0x8E,0xA3,0x69,0x9A,0xA6,0x69,0x9A,0xA6,0x69,0x9A,0xA6,0x49,0x12,0x20,
+	0x30,0x0C,0x03,0xC0,0x20,0x18,0x16,0x80,0x11,0x40,0x10,0x30,0x10,0x0C,0x10,0x03,
+	0x10,0x80,0x10,0x60,0x10,0x18,0x10,0xF8,0x03,0x10,0x08,0xFC,0x12,0x08,0xFD,0x03,
+	0x08,0x01,0x3C,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,
+	0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,
+	0x20,0x08,0x01,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x30,0x9C,0x24,0x49,0x92,0x24,
+	0x49,0x92,0x2C,0xCB,0xB2,0x2C,0x4B,0x92,0x24,0x49,0xFC,0x7F,0x03,0x80,0x01,0x80,
+	0x02,0x40,0x04,0x20,0x08,0x20,0x10,0x10,0x10,0x10,0x20,0x08,0x20,0x08,0x20,0x08,
+	0x20,0x10,0x08,0xC0,0x10,0x08,0x20,0x11,0x08,0x20,0x11,0x08,0x20,0x0A,0x08,0x20,
+	0x04,0x08,0x20,0x10,0x10,0x10,0x10,0x20,0x08,0x40,0x04,0x00,0x00,0x00,0x9E,0xA6,
+	0x69,0xDB,0xB6,0x6D,0x9B,0xA6,0x69,0x9A,0x26,0x49,0xF8,0xFF,0xFF,0x3F,0x08,0x01,
+	0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x08,0x01,0x20,0x10,0x08,0x01,0x20,0x20,
+	0x08,0x01,0x20,0x40,0x08,0x01,0x20,0x80,0x08,0x01,0x20,0x09,0x01,0x20,0x08,0x01,
+	0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x20,0x08,0x20,0x00,0x00,
+	0x00,0x9E,0xA6,0x69,0x9A,0xA6,0x69,0xDB,0xB6,0x6D,0xDB,0x26,0x49,0xF8,0xFF,0xFF,
+	0x3F,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,
+	0x09,0x01,0x20,0x09,0x01,0x20,0x80,0x08,0x01,0x20,0x40,0x08,0x01,0x20,0x20,0x08,
+	0x01,0x20,0x10,0x08,0x01,0x20,0x08,0x08,0x01,0x20,0x08,0x08,0x01,0x20,0x08,0x20,
+	0x08,0x20,0x00,0x00,0x00,0x9E,0xA6,0x69,0xDB,0xB6,0x6D,0xDB,0xB6,0x6D,0x9A,0x26,
+	0x49,0xF8,0xFF,0xFF,0x3F,0x08,0x01,0x20,0x08,0x01,0x20,0x09,0x01,0x20,0x80,0x08,
+	0x01,0x20,0x40,0x08,0x01,0x20,0x20,0x08,0x01,0x20,0x10,0x08,0x01,0x20,0x08,0x08,
+	0x01,0x20,0x30,0x08,0x01,0x20,0x40,0x08,0x01,0x20,0x80,0x08,0x01,0x20,0x09,0x01,
+	0x20,0x08,0x01,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x9E,0xA6,0x69,0xDB,0xA6,
+	0x69,0x9A,0xA6,0x6D,0x9B,0x26,0x49,0xF8,0xFF,0xFF,0x3F,0x08,0x01,0x20,0x08,0x01,
+	0x20,0x08,0x01,0x20,0x60,0x08,0x01,0x20,0x60,0x08,0x01,0x20,0x08,0x01,0x20,0x08,
+	0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x60,0x08,0x01,0x20,0x60,
+	0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x20,0x08,0x20,0x41,0x10,0x04,0xDF,0x08,0x08,
+	0x10,0x20,0x40,0xF8,0xFF,0xFF,0x3F,0x80,0x01,0x00,0x00,0x08,0x5F,0x10,0x04,0x01,
+	0x01,0x80,0xF8,0xFF,0xFF,0x3F,0x40,0x20,0x10,0x08,0x42,0x10,0x04,0x5F,0x10,0x04,
+	0x03,0x01,0x80,0x40,0x30,0x08,0xF8,0xFF,0xFF,0x3F,0x10,0x20,0x40,0x80,0x01,0x41,
+	0x00,0x00,0x1E,0x00,0x04,0x01,0x60,0x60,0xF8,0xFF,0xFF,0x3F,0x60,0x60,0x08,0x82,
+	0x20,0x9E,0xA6,0x69,0x9A,0xA6,0x69,0x92,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x49,
+	0x1C,0x03,0x01,0x01,0x01,0x01,0xF8,0xFF,0xFF,0x3F,0x08,0x01,0x20,0x08,0x01,0x20,
+	0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,0x01,0x20,0x08,
+	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x10,0x10,
+	0x10,0x20,0x08,0x40,0x04,0x80,0x02,0x03,0x80,0x01,0xFC,0x7F,0x00,0x00,0x00,0x9E,
+	0x20,0x08,0x04,0x71,0x14,0x45,0x91,0x24,0x8A,0x92,0x24,0x10,0x04,0x79,0xF8,0xFF,
+	0xFF,0x3F,0x10,0x60,0x80,0x01,0x06,0xC0,0x01,0x08,0x20,0x30,0x20,0x40,0x20,0x80,
+	0x40,0x03,0x80,0x04,0x01,0x08,0x01,0x30,0x80,0x40,0x60,0x80,0x03,0x04,0x18,0xF8,
+	0xFF,0xFF,0x3F,0x00,0x00,0x30,0x9C,0x24,0x49,0x92,0x34,0x4D,0xD3,0x34,0x4D,0x92,
+	0x24,0x49,0x92,0x24,0x49,0x16,0xC3,0xFC,0x7F,0x03,0x80,0x01,0x80,0x02,0x40,0x04,
+	0x20,0x08,0x10,0x10,0x10,0x10,0x08,0x08,0x20,0x08,0x08,0x20,0x10,0x08,0x20,0x20,
+	0x08,0x20,0x40,0x08,0x20,0x80,0x08,0x20,0x09,0x20,0x08,0x20,0x08,0x20,0x10,0x20,
+	0x10,0x10,0x20,0x10,0x20,0x08,0x40,0x04,0x80,0x01,0x03,0x06,0xC0,0xF8,0x3F,0x00,
+	0x00,0x30,0x9C,0x24,0x49,0x92,0x24,0x49,0x92,0x34,0x4D,0xD3,0x34,0x4D,0x92,0x24,
+	0x49,0x16,0xC3,0xFC,0x7F,0x03,0x80,0x01,0x80,0x02,0x40,0x04,0x20,0x08,0x10,0x10,
+	0x10,0x10,0x08,0x20,0x08,0x20,0x08,0x20,0x09,0x20,0x80,0x08,0x20,0x40,0x08,0x20,
+	0x20,0x08,0x20,0x10,0x08,0x20,0x10,0x08,0x20,0x08,0x10,0x20,0x10,0x10,0x20,0x10,
+	0x20,0x08,0x40,0x04,0x80,0x01,0x03,0x06,0xC0,0xF8,0x3F,0x00,0x00,0x30,0x9C,0x24,
+	0x49,0x92,0x24,0x4D,0xD3,0x34,0x4D,0xD3,0x34,0x49,0x92,0x24,0x49,0x16,0xC3,0xFC,
+	0x7F,0x03,0x80,0x01,0x80,0x02,0x40,0x04,0x20,0x08,0x10,0x10,0x10,0x10,0x09,0x20,
+	0x80,0x08,0x20,0x40,0x08,0x20,0x20,0x08,0x20,0x18,0x08,0x20,0x10,0x08,0x20,0x20,
+	0x08,0x20,0x40,0x08,0x20,0x80,0x08,0x20,0x11,0x20,0x10,0x10,0x20,0x10,0x20,0x08,
+	0x40,0x04,0x80,0x01,0x03,0x06,0xC0,0xF8,0x3F,0x00,0x00,0x30,0x9C,0x24,0x49,0x92,
+	0x34,0x4D,0xD3,0x34,0x4D,0xD3,0x34,0x4D,0x92,0x24,0x49,0x16,0xC3,0xFC,0x7F,0x03,
+	0x80,0x01,0x80,0x02,0x40,0x04,0x20,0x08,0x10,0x10,0x10,0x10,0xC0,0x08,0x20,0x20,
+	0x08,0x20,0x20,0x08,0x20,0x20,0x08,0x20,0x40,0x08,0x20,0x40,0x08,0x20,0x80,0x08,
+	0x20,0x80,0x08,0x20,0x80,0x08,0x20,0x60,0x10,0x20,0x10,0x10,0x20,0x10,0x20,0x08,
+	0x40,0x04,0x80,0x01,0x03,0x06,0xC0,0xF8,0x3F,0x00,0x00,0x30,0x9C,0x24,0x49,0x92,
+	0x34,0x4D,0x92,0x24,0x49,0xD2,0x34,0x49,0x92,0x24,0x49,0x16,0xC3,0xFC,0x7F,0x03,
+	0x80,0x01,0x80,0x02,0x40,0x04,0x20,0x08,0x10,0x10,0x10,0x10,0x20,0x08,0x20,0x60,
+	0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x20,0x08,0x20,0x60,
+	0x08,0x20,0x10,0x20,0x10,0x10,0x20,0x10,0x20,0x08,0x40,0x04,0x80,0x01,0x03,0x06,
+	0xC0,0xF8,0x3F,0x00,0x00,0x50,0x0C,0xC3,0x30,0x0C,0x83,0x20,0x0C,0xC3,0x30,0x0C,
+	0x43,0x01,0x04,0x01,0x04,0x80,0x08,0x40,0x10,0x20,0x20,0x10,0x40,0x08,0x80,0x04,
+	0x03,0x03,0x80,0x04,0x40,0x08,0x20,0x10,0x10,0x20,0x08,0x40,0x04,0x80,0x04,0x01,
+	0x00,0x00,0x70,0x9C,0x24,0x49,0x92,0xA6,0x69,0x9A,0xA6,0x79,0x96,0x65,0x59,0x96,
+	0x25,0x49,0x96,0xC3,0xFC,0x7F,0x40,0x03,0x80,0x41,0x80,0x32,0x40,0x0C,0x20,0x0C,
+	0x10,0x12,0x10,0x80,0x11,0x08,0x40,0x20,0x08,0x20,0x20,0x08,0x18,0x20,0x08,0x04,
+	0x20,0x08,0x02,0x20,0x08,0x80,0x01,0x20,0x08,0x40,0x20,0x08,0x20,0x20,0x08,0x18,
+	0x20,0x10,0x04,0x20,0x10,0x02,0x10,0xA0,0x01,0x10,0x40,0x08,0x60,0x04,0x98,0x01,
+	0x03,0x04,0x06,0xC0,0xF8,0x3F,0x00,0x00,0x00,0x0E,0x04,0x41,0x50,0x14,0x45,0x51,
+	0x14,0x49,0x10,0x04,0x41,0x10,0xE4,0x01,0xF8,0xFF,0xFF,0x03,0x04,0x08,0x10,0x04,
+	0x10,0x08,0x20,0x10,0x20,0x20,0x20,0x40,0x20,0x80,0x20,0x01,0x20,0x20,0x20,0x10,
+	0x08,0x04,0x02,0xF8,0xFF,0xFF,0x01,0x00,0x00,0x00,0x0E,0x04,0x41,0x10,0x04,0x41,
+	0x52,0x14,0x45,0x51,0x14,0x41,0x10,0xE4,0x01,0xF8,0xFF,0xFF,0x03,0x04,0x08,0x10,
+	0x10,0x20,0x20,0x01,0x20,0x80,0x20,0x40,0x20,0x20,0x20,0x10,0x20,0x08,0x20,0x04,
+	0x10,0x08,0x04,0x02,0xF8,0xFF,0xFF,0x01,0x00,0x00,0x00,0x0E,0x04,0x41,0x90,0x14,
+	0x45,0x51,0x14,0x45,0x51,0x24,0x41,0x10,0xE4,0x01,0xF8,0xFF,0xFF,0x03,0x04,0x08,
+	0x10,0x01,0x10,0x80,0x20,0x40,0x20,0x30,0x20,0x08,0x20,0x10,0x20,0x20,0x20,0x40,
+	0x20,0x80,0x20,0x01,0x10,0x08,0x04,0x02,0xF8,0xFF,0xFF,0x01,0x00,0x00,0x00,0x0E,
+	0x04,0x41,0x50,0x14,0x41,0x10,0x04,0x41,0x51,0x04,0x41,0x10,0xE4,0x01,0xF8,0xFF,
+	0xFF,0x03,0x04,0x08,0x10,0x60,0x10,0x60,0x20,0x20,0x20,0x20,0x20,0x20,0x60,0x20,
+	0x60,0x20,0x10,0x08,0x04,0x02,0xF8,0xFF,0xFF,0x01,0x80,0x20,0x08,0x04,0x41,0x10,
+	0x84,0x92,0x25,0x4D,0x51,0x14,0x84,0x21,0x08,0x02,0x18,0x20,0xC0,0x01,0x06,0x18,
+	0x20,0xC0,0x01,0x01,0x80,0xFE,0x3F,0x40,0x02,0x20,0x80,0x01,0x10,0x40,0x08,0x30,
+	0x08,0x0C,0x02,0x80,0x01,0x40,0x30,0x08,0x00,0x00,0x00,0x1E,0x45,0x51,0x14,0x45,
+	0x51,0x14,0xC5,0x30,0x0C,0xC3,0xF8,0xFF,0xFF,0x3F,0x02,0x01,0x02,0x01,0x02,0x01,
+	0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x04,0x80,0x04,0x80,
+	0x08,0x40,0x18,0x20,0xE0,0x1F,0x00,0x00,0x00,0x86,0x20,0x48,0x92,0xE4,0x79,0x9E,
+	0xE7,0x79,0x1E,0x06,0xC0,0x03,0x20,0x10,0x08,0x10,0x08,0x10,0x08,0x20,0x08,0x80,
+	0x03,0x20,0x08,0x40,0x04,0x20,0x08,0x20,0x08,0x20,0x08,0x10,0x08,0x20,0x10,0x10,
+	0x10,0x20,0x10,0x08,0x10,0x20,0xE0,0x07,0x20,0x10,0xE0,0x0F,0x00,0x80,0x71,0x1C,
+	0xE7,0x79,0x9E,0xC7,0x71,0x1C,0xC7,0x01,0x80,0x0F,0x20,0x40,0x10,0x10,0x40,0x20,
+	0x10,0x20,0x20,0x08,0x08,0x20,0x20,0x10,0x08,0x20,0x20,0x20,0x08,0x10,0x20,0xC0,
+	0x08,0x10,0x20,0x08,0x10,0x20,0x08,0x10,0x10,0x10,0x10,0x08,0x60,0x10,0x08,0x80,
+	0xFF,0x3F,0x00,0x80,0x71,0x1C,0xC7,0x71,0x9E,0xE7,0x79,0x1C,0xC7,0x01,0x80,0x0F,
+	0x20,0x40,0x10,0x10,0x40,0x20,0x10,0x20,0x20,0x08,0x20,0x20,0x08,0x20,0x20,0xC0,
+	0x08,0x10,0x20,0x20,0x08,0x10,0x20,0x10,0x08,0x10,0x20,0x08,0x08,0x10,0x10,0x10,
+	0x10,0x08,0x60,0x10,0x08,0x80,0xFF,0x3F,0x00,0x80,0x71,0x9E,0xE7,0x79,0x9E,0xE7,
+	0x79,0x1E,0xC7,0x01,0x80,0x0F,0x20,0x40,0x10,0x80,0x10,0x40,0x20,0x40,0x10,0x20,
+	0x20,0x20,0x08,0x20,0x20,0x10,0x08,0x20,0x20,0x08,0x08,0x10,0x20,0x08,0x08,0x10,
+	0x20,0x30,0x08,0x10,0x20,0x40,0x08,0x10,0x10,0x80,0x10,0x10,0x08,0x60,0x10,0x08,
+	0x80,0xFF,0x3F,0x00,0x80,0x71,0x9E,0xE7,0x79,0x9E,0xE7,0x79,0x9E,0xC7,0x01,0x80,
+	0x0F,0x20,0x40,0x10,0x40,0x10,0x40,0x20,0x20,0x10,0x20,0x20,0x10,0x08,0x20,0x20,
+	0x10,0x08,0x20,0x20,0x20,0x08,0x10,0x20,0x20,0x08,0x10,0x20,0x40,0x08,0x10,0x20,
+	0x40,0x08,0x10,0x10,0x20,0x10,0x10,0x08,0x10,0x60,0x10,0x08,0x80,0xFF,0x3F,0x00,
+	0x80,0x71,0x9C,0xE7,0x71,0x1C,0xC7,0x79,0x1E,0xC7,0x01,0x80,0x0F,0x20,0x40,0x10,
+	0x10,0x40,0x20,0x30,0x10,0x20,0x20,0x30,0x08,0x20,0x20,0x08,0x20,0x20,0x08,0x10,
+	0x20,0x08,0x10,0x20,0x08,0x10,0x20,0x30,0x08,0x10,0x10,0x30,0x10,0x10,0x08,0x60,
+	0x10,0x08,0x80,0xFF,0x3F,0x00,0x80,0x71,0x1C,0xE7,0x79,0x9E,0xE7,0x79,0x1C,0xC7,
+	0x01,0x80,0x0F,0x20,0x40,0x10,0x10,0x40,0x20,0x10,0x20,0x20,0x70,0x08,0x20,0x20,
+	0x88,0x08,0x20,0x20,0x88,0x08,0x10,0x20,0x88,0x08,0x10,0x20,0x48,0x08,0x10,0x20,
+	0x70,0x08,0x10,0x10,0x10,0x10,0x08,0x60,0x10,0x08,0x80,0xFF,0x3F,0x00,0x80,0x71,
+	0x1C,0xC7,0x71,0x1C,0xC7,0x71,0x1C,0xC7,0x71,0x1C,0xC7,0x71,0x1C,0xC7,0x71,0x1C,
+	0xC7,0x71,0x80,0x0F,0x20,0x40,0x10,0x10,0x20,0x20,0x10,0x10,0x20,0x08,0x10,0x20,
+	0x08,0x10,0x20,0x08,0x10,0x20,0x08,0x08,0x20,0x08,0x08,0x20,0x08,0x08,0x10,0x10,
+	0x08,0x08,0x60,0x08,0x06,0x80,0xFF,0x01,0xC0,0x08,0x06,0x20,0x08,0x08,0x10,0x08,
+	0x10,0x08,0x08,0x20,0x08,0x08,0x20,0x08,0x08,0x20,0x08,0x08,0x20,0x08,0x08,0x20,
+	0x08,0x08,0x20,0x08,0x08,0x20,0x10,0x08,0x10,0x60,0x08,0x10,0x80,0x0F,0x08,0x00,
+	0x80,0x70,0x14,0x45,0x51,0x34,0x4D,0xD3,0x34,0x4D,0x51,0xFE,0x80,0x01,0x07,0x60,
+	0x08,0x10,0x10,0x10,0x10,0x08,0x20,0x08,0x20,0x10,0x08,0xA0,0x10,0x08,0x40,0x11,
+	0x08,0x20,0x11,0x08,0x20,0x11,0x08,0x20,0x0E,0x10,0x10,0x10,0x08,0x00,0x80,0x70,
+	0x1C,0xC7,0x71,0x9E,0xE7,0x79,0x1C,0xC7,0x71,0x1C,0x02,0xFE,0xC0,0x05,0x03,0x20,
+	0x04,0x0C,0x10,0x04,0x10,0x10,0x04,0x10,0x08,0x04,0x20,0x08,0x08,0x04,0x20,0x30,
+	0x08,0x04,0x20,0x40,0x08,0x04,0x20,0x80,0x08,0x04,0x20,0x08,0x04,0x20,0x08,0x04,
+	0x20,0x10,0x04,0x10,0x20,0x04,0x10,0xC0,0x04,0x08,0x07,0x00,0x80,0x70,0x1C,0xC7,
+	0x71,0x9C,0xE7,0x79,0x9E,0xC7,0x71,0x1C,0x02,0xFE,0xC0,0x05,0x03,0x20,0x04,0x0C,
+	0x10,0x04,0x10,0x10,0x04,0x10,0x08,0x04,0x20,0x08,0x04,0x20,0x80,0x08,0x04,0x20,
+	0x40,0x08,0x04,0x20,0x30,0x08,0x04,0x20,0x08,0x08,0x04,0x20,0x08,0x08,0x04,0x20,
+	0x10,0x04,0x10,0x20,0x04,0x10,0xC0,0x04,0x08,0x07,0x00,0x80,0x70,0x1C,0xE7,0x79,
+	0x9E,0xE7,0x79,0x9E,0xE7,0x71,0x1C,0x02,0xFE,0xC0,0x05,0x03,0x20,0x04,0x0C,0x10,
+	0x04,0x10,0x80,0x10,0x04,0x10,0x40,0x08,0x04,0x20,0x20,0x08,0x04,0x20,0x10,0x08,
+	0x04,0x20,0x08,0x08,0x04,0x20,0x10,0x08,0x04,0x20,0x20,0x08,0x04,0x20,0x40,0x08,
+	0x04,0x20,0x80,0x10,0x04,0x10,0x20,0x04,0x10,0xC0,0x04,0x08,0x07,0x00,0x80,0x70,
+	0x1C,0xE7,0x79,0x1C,0xC7,0x71,0x9E,0xE7,0x71,0x1C,0x02,0xFE,0xC0,0x05,0x03,0x20,
+	0x04,0x0C,0x10,0x04,0x10,0x30,0x10,0x04,0x10,0x30,0x08,0x04,0x20,0x08,0x04,0x20,
+	0x08,0x04,0x20,0x08,0x04,0x20,0x08,0x04,0x20,0x20,0x08,0x04,0x20,0x30,0x08,0x04,
+	0x20,0x20,0x10,0x04,0x10,0x20,0x04,0x10,0xC0,0x04,0x08,0x07,0x80,0x20,0x78,0x02,
+	0x08,0x10,0x20,0xF8,0xFF,0x3F,0xC0,0x00,0x00,0x78,0x82,0x20,0xC0,0xF8,0xFF,0x3F,
+	0x20,0x10,0x08,0x82,0x20,0x78,0x82,0x20,0x08,0x40,0x20,0x10,0x08,0xF8,0xFF,0x3F,
+	0x08,0x10,0x20,0x40,0x80,0x20,0x70,0x80,0x20,0x60,0x20,0xF8,0xFF,0x3F,0x60,0x60,
+	0x00,0x80,0x60,0x14,0x65,0x59,0x96,0x65,0x59,0x96,0x65,0x51,0x14,0x07,0xFC,0x03,
+	0x03,0x80,0x0C,0x40,0x10,0x08,0x20,0x10,0x10,0x10,0x20,0x10,0x10,0x20,0x10,0x10,
+	0x20,0x20,0x11,0x20,0xA0,0x10,0x20,0x40,0x10,0x20,0x60,0x20,0x20,0x98,0x20,0x10,
+	0x43,0x08,0x8C,0x06,0xF0,0xFF,0x01,0x00,0x00,0x00,0x04,0x61,0x18,0x86,0x61,0x18,
+	0x86,0x61,0x10,0x1C,0x40,0x20,0x60,0x10,0x10,0x10,0x10,0x08,0x10,0x08,0x20,0x08,
+	0x40,0x08,0x40,0x08,0x40,0x08,0x30,0x10,0x10,0xE0,0xFF,0x3F,0x00,0x80,0x70,0x14,
+	0x45,0x51,0x96,0x65,0x59,0x14,0x45,0x51,0x14,0x87,0xFE,0x80,0x01,0x07,0x60,0x08,
+	0x10,0x10,0x10,0x10,0x08,0x20,0x08,0x08,0x20,0x30,0x08,0x20,0x40,0x08,0x20,0x80,
+	0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x10,0x10,0x10,0x60,0x0C,0x80,0x01,0x03,0xFE,
+	0x00,0x80,0x70,0x14,0x45,0x51,0x94,0x65,0x59,0x96,0x45,0x51,0x14,0x87,0xFE,0x80,
+	0x01,0x07,0x60,0x08,0x10,0x10,0x10,0x10,0x08,0x20,0x08,0x20,0x80,0x08,0x20,0x40,
+	0x08,0x20,0x20,0x08,0x20,0x18,0x08,0x20,0x08,0x08,0x20,0x10,0x10,0x10,0x10,0x60,
+	0x0C,0x80,0x01,0x03,0xFE,0x00,0x80,0x70,0x14,0x65,0x59,0x96,0x65,0x59,0x96,0x65,
+	0x51,0x14,0x87,0xFE,0x80,0x01,0x07,0x60,0x08,0x10,0x10,0x80,0x10,0x10,0x40,0x08,
+	0x20,0x20,0x08,0x20,0x10,0x08,0x20,0x08,0x08,0x20,0x10,0x08,0x20,0x20,0x08,0x20,
+	0x40,0x08,0x20,0x80,0x10,0x10,0x10,0x10,0x60,0x0C,0x80,0x01,0x03,0xFE,0x00,0x80,
+	0x70,0x14,0x65,0x59,0x96,0x65,0x59,0x96,0x65,0x51,0x14,0x87,0xFE,0x80,0x01,0x07,
+	0x60,0x08,0x10,0x10,0x60,0x10,0x10,0x10,0x08,0x20,0x10,0x08,0x20,0x10,0x08,0x20,
+	0x20,0x08,0x20,0x40,0x08,0x20,0x40,0x08,0x20,0x40,0x08,0x20,0x30,0x10,0x10,0x10,
+	0x10,0x60,0x0C,0x80,0x01,0x03,0xFE,0x00,0x80,0x70,0x14,0x65,0x59,0x14,0x45,0x51,
+	0x94,0x65,0x51,0x14,0x87,0xFE,0x80,0x01,0x07,0x60,0x08,0x10,0x10,0x30,0x10,0x10,
+	0x30,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x30,0x08,0x20,
+	0x20,0x10,0x10,0x10,0x10,0x60,0x0C,0x80,0x01,0x03,0xFE,0x00,0x80,0x20,0x08,0x82,
+	0x20,0x08,0xC2,0x71,0x08,0x82,0x20,0x08,0x82,0x20,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x01,0x01,0x06,0x81,0x01,0x06,0x81,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x00,0x80,0x70,0x14,0x45,0x51,0x1C,0xC7,0x71,0x1C,0x47,0x51,0x14,0xC7,0xFE,0x80,
+	0x01,0x47,0x60,0x38,0x10,0x18,0x10,0x14,0x08,0x23,0x08,0x80,0x20,0x08,0x40,0x20,
+	0x08,0x30,0x20,0x08,0x08,0x20,0x08,0x04,0x20,0x08,0x03,0x20,0x90,0x10,0x60,0x10,
+	0x70,0x0C,0x88,0x01,0x03,0x04,0xFE,0x00,0x00,0x70,0x10,0x04,0x49,0x92,0x24,0x49,
+	0x10,0x04,0x41,0x1C,0xF8,0xFF,0x03,0x0C,0x10,0x20,0x08,0x20,0x08,0x20,0x30,0x20,
+	0x40,0x20,0x80,0x20,0x20,0x10,0x08,0x0C,0xF8,0xFF,0x3F,0x00,0x00,0x70,0x10,0x04,
+	0x41,0x90,0x24,0x49,0x92,0x04,0x41,0x1C,0xF8,0xFF,0x03,0x0C,0x10,0x20,0x20,0x20,
+	0x80,0x20,0x40,0x20,0x30,0x20,0x08,0x20,0x08,0x10,0x08,0x0C,0xF8,0xFF,0x3F,0x00,
+	0x00,0x70,0x10,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x41,0x1C,0xF8,0xFF,0x03,0x0C,
+	0x10,0x80,0x20,0x40,0x20,0x20,0x20,0x10,0x20,0x08,0x20,0x10,0x20,0x20,0x20,0x40,
+	0x10,0x80,0x08,0x0C,0xF8,0xFF,0x3F,0x00,0x00,0x70,0x10,0x24,0x49,0x10,0x04,0x41,
+	0x92,0x24,0x41,0x1C,0xF8,0xFF,0x03,0x0C,0x10,0x30,0x20,0x30,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x30,0x10,0x20,0x08,0x0C,0xF8,0xFF,0x3F,0x00,0x41,0x30,0x08,0x82,
+	0xC2,0xB0,0x24,0x69,0x0A,0x82,0x10,0x04,0x01,0x18,0x60,0x80,0x01,0x0E,0x30,0xC0,
+	0x18,0x07,0x06,0xD8,0x01,0xC0,0x30,0x20,0x0C,0x10,0x80,0x03,0x08,0x60,0x18,0x07,
+	0xC0,0x30,0x08,0x00,0x00,0x00,0x14,0x45,0x51,0x14,0x45,0x51,0x14,0x45,0x51,0x14,
+	0x07,0x40,0x08,0x20,0x10,0x10,0x10,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
+	0x20,0x08,0x20,0x08,0x20,0x10,0x10,0x10,0x08,0x60,0x04,0x80,0xFF,0x03,0x00,0x41,
+	0x30,0x08,0xA2,0xCA,0x30,0x04,0x61,0x8A,0x82,0x10,0x04,0x01,0x18,0x60,0x80,0x01,
+	0x0E,0x30,0x60,0xC0,0x18,0x60,0x07,0x06,0xD8,0x01,0x30,0x0C,0x80,0x03,0x60,0x60,
+	0x60,0x18,0x07,0xC0,0x30,0x08
+};
+const CompressedFont Lato_Hairline_38_Compressed = {Lato_Hairline_38, Lato_Hairline_38_offsets, Lato_Hairline_38_packed};
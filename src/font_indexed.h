@@ -0,0 +1,2830 @@
+/**************************************************************************
+ * font_indexed.h
+ *
+ * GENERATED by tools/font_index.py out of font.h - do not edit!
+ * The fonts of font.h in the indexed format (see IndexedFont in Watch.h)
+ * Use: Watch.indexFont(&Lato_Hairline_38_Indexed);
+**************************************************************************/
+
+
+const uint32_t DejaVu_Sans_Mono_12_glyphs[] PROGMEM = {
+	0x07000000,	// 32
+	0x07080000,	// 33
+	0x07090002,	// 34
+	0x070D0005,	// 35
+	0x070C0009,	// 36
+	0x070E000C,	// 37
+	0x070E0010,	// 38
+	0x07070014,	// 39
+	0x070C0016,	// 40
+	0x070A0019,	// 41
+	0x070B001C,	// 42
+	0x070E001F,	// 43
+	0x07080023,	// 44
+	0x070A0025,	// 45
+	0x07080028,	// 46
+	0x070D002A,	// 47
+	0x070E002E,	// 48
+	0x070C0032,	// 49
+	0x070E0035,	// 50
+	0x070E0039,	// 51
+	0x070E003D,	// 52
+	0x070E0041,	// 53
+	0x070E0045,	// 54
+	0x070D0049,	// 55
+	0x070E004D,	// 56
+	0x070E0051,	// 57
+	0x07080055,	// 58
+	0x07080057,	// 59
+	0x070E0059,	// 60
+	0x070E005D,	// 61
+	0x070E0061,	// 62
+	0x070D0065,	// 63
+	0x070E0069,	// 64
+	0x070E006D,	// 65
+	0x070E0071,	// 66
+	0x070E0075,	// 67
+	0x070E0079,	// 68
+	0x070E007D,	// 69
+	0x070D0081,	// 70
+	0x070E0085,	// 71
+	0x070E0089,	// 72
+	0x070C008D,	// 73
+	0x070C0090,	// 74
+	0x070E0093,	// 75
+	0x070E0097,	// 76
+	0x070E009B,	// 77
+	0x070E009F,	// 78
+	0x070E00A3,	// 79
+	0x070D00A7,	// 80
+	0x070E00AB,	// 81
+	0x070E00AF,	// 82
+	0x070E00B3,	// 83
+	0x070D00B7,	// 84
+	0x070E00BB,	// 85
+	0x070D00BF,	// 86
+	0x070E00C3,	// 87
+	0x070E00C7,	// 88
+	0x070D00CB,	// 89
+	0x070E00CF,	// 90
+	0x070A00D3,	// 91
+	0x070E00D6,	// 92
+	0x070800DA,	// 93
+	0x070B00DC,	// 94
+	0x070E00DF,	// 95
+	0x070900E3,	// 96
+	0x070C00E6,	// 97
+	0x070C00E9,	// 98
+	0x070C00EC,	// 99
+	0x070C00EF,	// 100
+	0x070C00F2,	// 101
+	0x070B00F5,	// 102
+	0x070C00F8,	// 103
+	0x070C00FB,	// 104
+	0x070C00FE,	// 105
+	0x070A0101,	// 106
+	0x070C0104,	// 107
+	0x070C0107,	// 108
+	0x070C010A,	// 109
+	0x070C010D,	// 110
+	0x070C0110,	// 111
+	0x070C0113,	// 112
+	0x070C0116,	// 113
+	0x070D0119,	// 114
+	0x070C011D,	// 115
+	0x070C0120,	// 116
+	0x070C0123,	// 117
+	0x070B0126,	// 118
+	0x070D0129,	// 119
+	0x070C012D,	// 120
+	0x070B0130,	// 121
+	0x070C0133,	// 122
+	0x070C0136,	// 123
+	0x07080139,	// 124
+	0x070B013B,	// 125
+	0x070E013E,	// 126
+	0x070E0142,	// 127
+	0x070E0146,	// 128
+	0x070E014A,	// 129
+	0x070E014E,	// 130
+	0x070E0152,	// 131
+	0x070E0156,	// 132
+	0x070E015A,	// 133
+	0x070E015E,	// 134
+	0x070E0162,	// 135
+	0x070E0166,	// 136
+	0x070E016A,	// 137
+	0x070E016E,	// 138
+	0x070E0172,	// 139
+	0x070E0176,	// 140
+	0x070E017A,	// 141
+	0x070E017E,	// 142
+	0x070E0182,	// 143
+	0x070E0186,	// 144
+	0x070E018A,	// 145
+	0x070E018E,	// 146
+	0x070E0192,	// 147
+	0x070E0196,	// 148
+	0x070E019A,	// 149
+	0x070E019E,	// 150
+	0x070E01A2,	// 151
+	0x070E01A6,	// 152
+	0x070E01AA,	// 153
+	0x070E01AE,	// 154
+	0x070E01B2,	// 155
+	0x070E01B6,	// 156
+	0x070E01BA,	// 157
+	0x070E01BE,	// 158
+	0x070E01C2,	// 159
+	0x07000000,	// 160
+	0x070801C6,	// 161
+	0x070C01C8,	// 162
+	0x070C01CB,	// 163
+	0x070E01CE,	// 164
+	0x070D01D2,	// 165
+	0x070801D6,	// 166
+	0x070C01D8,	// 167
+	0x070901DB,	// 168
+	0x070E01DE,	// 169
+	0x070A01E2,	// 170
+	0x070E01E5,	// 171
+	0x070E01E9,	// 172
+	0x070A01ED,	// 173
+	0x070E01F0,	// 174
+	0x070B01F4,	// 175
+	0x070B01F7,	// 176
+	0x070E01FA,	// 177
+	0x070901FE,	// 178
+	0x070B0201,	// 179
+	0x07090204,	// 180
+	0x070E0207,	// 181
+	0x070E020B,	// 182
+	0x0708020F,	// 183
+	0x070A0211,	// 184
+	0x07090214,	// 185
+	0x070A0217,	// 186
+	0x070E021A,	// 187
+	0x070E021E,	// 188
+	0x070C0222,	// 189
+	0x070E0225,	// 190
+	0x070A0229,	// 191
+	0x070E022C,	// 192
+	0x070E0230,	// 193
+	0x070E0234,	// 194
+	0x070E0238,	// 195
+	0x070E023C,	// 196
+	0x070E0240,	// 197
+	0x070E0244,	// 198
+	0x070E0248,	// 199
+	0x070E024C,	// 200
+	0x070E0250,	// 201
+	0x070E0254,	// 202
+	0x070E0258,	// 203
+	0x070C025C,	// 204
+	0x070C025F,	// 205
+	0x070C0262,	// 206
+	0x070C0265,	// 207
+	0x070E0268,	// 208
+	0x070E026C,	// 209
+	0x070E0270,	// 210
+	0x070E0274,	// 211
+	0x070E0278,	// 212
+	0x070E027C,	// 213
+	0x070E0280,	// 214
+	0x070C0284,	// 215
+	0x070E0287,	// 216
+	0x070E028B,	// 217
+	0x070E028F,	// 218
+	0x070E0293,	// 219
+	0x070E0297,	// 220
+	0x070D029B,	// 221
+	0x070D029F,	// 222
+	0x070C02A3,	// 223
+	0x070C02A6,	// 224
+	0x070C02A9,	// 225
+	0x070C02AC,	// 226
+	0x070C02AF,	// 227
+	0x070C02B2,	// 228
+	0x070C02B5,	// 229
+	0x070C02B8,	// 230
+	0x070C02BB,	// 231
+	0x070C02BE,	// 232
+	0x070C02C1,	// 233
+	0x070C02C4,	// 234
+	0x070C02C7,	// 235
+	0x070C02CA,	// 236
+	0x070C02CD,	// 237
+	0x070C02D0,	// 238
+	0x070C02D3,	// 239
+	0x070C02D6,	// 240
+	0x070C02D9,	// 241
+	0x070C02DC,	// 242
+	0x070C02DF,	// 243
+	0x070C02E2,	// 244
+	0x070C02E5,	// 245
+	0x070C02E8,	// 246
+	0x070C02EB,	// 247
+	0x070C02EE,	// 248
+	0x070C02F1,	// 249
+	0x070C02F4,	// 250
+	0x070C02F7,	// 251
+	0x070C02FA,	// 252
+	0x070B02FD,	// 253
+	0x070C0300,	// 254
+	0x070B0303	// 255
+};
+const uint32_t DejaVu_Sans_Mono_12_data[] PROGMEM = {
+	0x00000000,0x0DF80000,0x00000000,0x00000038,0x00000038,0x0E400200,0x0A5003E0,0x027007C0,
+	0x00000040,0x04E00000,0x3FF80890,0x07200910,0x01480030,0x06B00148,0x09400980,0x00000600,
+	0x07000000,0x08C80CF0,0x06080B08,0x00000B00,0x00000000,0x00380000,0x00000000,0x03E00000,
+	0x10041C1C,0x00000000,0x1C1C1004,0x000003E0,0x00900000,0x01F80060,0x00900060,0x01000100,
+	0x0FE00100,0x01000100,0x00000100,0x00000000,0x0C001000,0x00000000,0x01000100,0x00000100,
+	0x00000000,0x0C000000,0x10000000,0x03000C00,0x003000C0,0x00000008,0x03E00000,0x08080C18,
+	0x0C180888,0x000003E0,0x08080000,0x0FF80808,0x08000800,0x08100000,0x0A080C08,0x08880908,
+	0x00000870,0x04100000,0x08880808,0x08880888,0x00000770,0x03000000,0x026002C0,0x0FF80218,
+	0x00000200,0x04780000,0x08480848,0x0CC80848,0x00000780,0x03E00000,0x08480C90,0x0CC80848,
+	0x00000790,0x00080000,0x06080808,0x00780188,0x00000018,0x07700000,0x08880888,0x08880888,
+	0x00000770,0x04F00000,0x09080918,0x04980908,0x000003E0,0x00000000,0x0CC00000,0x00000000,
+	0x0CC01000,0x01800000,0x02400180,0x02400240,0x00000420,0x02800000,0x02800280,0x02800280,
+	0x00000280,0x04200000,0x02400240,0x01800240,0x00000180,0x00000000,0x0D880010,0x004800C8,
+	0x00000030,0x0FC00000,0x23101820,0x24B02490,0x000007E0,0x0C000000,0x023803C0,0x03C00238,
+	0x00000C00,0x0FF80000,0x08880888,0x08880888,0x00000770,0x03E00000,0x08080410,0x08080808,
+	0x00000410,0x0FF80000,0x08080808,0x04100808,0x000003E0,0x0FF80000,0x08880888,0x08880888,
+	0x00000888,0x0FF80000,0x00880088,0x00880088,0x00000088,0x03E00000,0x08080410,0x08880808,
+	0x00000790,0x0FF80000,0x00800080,0x00800080,0x00000FF8,0x08080000,0x0FF80808,0x08080808,
+	0x04000000,0x08080800,0x07F80808,0x0FF80000,0x00C00080,0x06100320,0x00000808,0x0FF80000,
+	0x08000800,0x08000800,0x00000800,0x0FF80000,0x01C00030,0x003001C0,0x00000FF8,0x0FF80000,
+	0x00E00018,0x0C000380,0x00000FF8,0x03E00000,0x08080C18,0x0C180808,0x000003E0,0x0FF80000,
+	0x00880088,0x00880088,0x00000070,0x03E00000,0x08080C18,0x3C180808,0x000007E0,0x0FF80000,
+	0x00880088,0x01880088,0x00000670,0x04700000,0x088808C8,0x08880888,0x00000710,0x00080008,
+	0x0FF80008,0x00080008,0x00000008,0x07F80000,0x08000800,0x08000800,0x000007F8,0x00180000,
+	0x0E0001E0,0x01E00E00,0x00000018,0x0E0001F8,0x003003C0,0x0E0003C0,0x000001F8,0x08080000,
+	0x01C00630,0x063001C0,0x00000808,0x00100008,0x0F800060,0x00100060,0x00000008,0x0C080000,
+	0x09880E08,0x083808C8,0x00000818,0x00000000,0x1FFC0000,0x00001004,0x00080000,0x00C00030,
+	0x0C000300,0x00001000,0x00000000,0x1FFC1004,0x00100020,0x00080008,0x00200010,0x40004000,
+	0x40004000,0x40004000,0x00004000,0x00000000,0x00040000,0x00000008,0x06400000,0x09200920,
+	0x0FC00920,0x0FFC0000,0x08200820,0x07C00820,0x07C00000,0x08200C60,0x08400820,0x07C00000,
+	0x08200820,0x0FFC0820,0x07C00000,0x09200960,0x05C00920,0x00200000,0x0FF80020,0x00240024,
+	0x07C00000,0x48202820,0x3FE04820,0x0FFC0000,0x00200040,0x0FC00020,0x08200000,0x0FE40820,
+	0x08000800,0x00000000,0x40204020,0x00003FE4,0x0FFC0000,0x02800100,0x08200440,0x00040000,
+	0x07FC0004,0x08000800,0x0FE00000,0x0FE00020,0x0FE00020,0x0FE00000,0x00200040,0x0FC00020,
+	0x07C00000,0x08200820,0x07C00820,0x7FE00000,0x08200820,0x07C00820,0x07C00000,0x08200820,
+	0x7FE00820,0x00000000,0x00600FE0,0x00200020,0x00000040,0x04C00000,0x09200920,0x06400920,
+	0x00200000,0x0FF80020,0x08200820,0x07E00000,0x08000800,0x0FE00800,0x00600000,0x0C000380,
+	0x00600380,0x03800060,0x01800E00,0x03800E00,0x00000060,0x08200000,0x010006C0,0x082006C0,
+	0x40600000,0x1C006780,0x00600380,0x0C200000,0x09200A20,0x086008A0,0x00800000,0x1F7C0080,
+	0x10041004,0x00000000,0x3FFC0000,0x10040000,0x1F7C1004,0x00800080,0x00800000,0x00800080,
+	0x01000100,0x00000100,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x7FF00000,0x40104010,
+	0x40104010,0x00007FF0,0x7FF00000,0x40104010,0x40104010,0x00007FF0,0x00000000,0x3F600000,
+	0x07C00000,0x3FF80820,0x04400820,0x08800000,0x08880FF0,0x08080888,0x04200000,0x024003C0,
+	0x03C00240,0x00000420,0x01500008,0x0F800160,0x01500160,0x00000008,0x00000000,0x3CF00000,
+	0x11F00000,0x12481328,0x0F8814C8,0x00000000,0x00000008,0x00000008,0x022001C0,0x055005D0,
+	0x02200550,0x000001C0,0x02E80000,0x02A802A8,0x000002F0,0x01000000,0x04400280,0x02800100,
+	0x00000440,0x00800000,0x00800080,0x00800080,0x00000380,0x00000000,0x01000100,0x00000100,
+	0x022001C0,0x05D005D0,0x022005D0,0x000001C0,0x00000000,0x00080008,0x00080008,0x00000000,
+	0x00480030,0x00300048,0x08800880,0x0BE00880,0x08800880,0x00000880,0x00000000,0x00E80088,
+	0x000000B8,0x00000000,0x00A80088,0x00D800A8,0x00000000,0x00080000,0x00000004,0x7FE00000,
+	0x08000800,0x0FE00800,0x00000800,0x00700000,0x00F800F8,0x00081FF8,0x00001FF8,0x00000000,
+	0x01800000,0x00000000,0x20002000,0x00003000,0x00000000,0x00F80088,0x00000080,0x02700000,
+	0x02880288,0x00000270,0x04400000,0x01000280,0x02800440,0x00000100,0x037C0244,0x0D000140,
+	0x1F800B80,0x00000800,0x037C0244,0x11000140,0x17801D80,0x03440200,0x0D540154,0x1F800BEC,
+	0x00000800,0x4C003800,0x43604400,0x00002000,0x0C000000,0x023A03C1,0x03C00238,0x00000C00,
+	0x0C000000,0x023A03C0,0x03C00239,0x00000C00,0x0C000000,0x023903C2,0x03C20239,0x00000C00,
+	0x0C000000,0x023903C3,0x03C3023A,0x00000C00,0x0C000000,0x023803C2,0x03C20238,0x00000C00,
+	0x08000000,0x02FE0700,0x070002E6,0x00000800,0x03800C00,0x02080278,0x08880FF8,0x00000888,
+	0x03E00000,0x28080410,0x38082808,0x00000410,0x0FF80000,0x088A0889,0x08880888,0x00000888,
+	0x0FF80000,0x088A0888,0x08880889,0x00000888,0x0FF80000,0x0889088A,0x088A0889,0x00000888,
+	0x0FF80000,0x0888088A,0x0888088A,0x00000888,0x08080000,0x0FFA0809,0x08080808,0x08080000,
+	0x0FFA0808,0x08080809,0x08080000,0x0FF9080A,0x0808080A,0x08080000,0x0FF8080A,0x0808080A,
+	0x0FF80080,0x08880888,0x04100808,0x000003E0,0x0FF80000,0x00E1001B,0x0C030382,0x00000FF8,
+	0x03E00000,0x080A0C19,0x0C180808,0x000003E0,0x03E00000,0x080A0C18,0x0C180809,0x000003E0,
+	0x03E00000,0x08090C1A,0x0C1A0809,0x000003E0,0x03E00000,0x08090C1B,0x0C1B080A,0x000003E0,
+	0x03E00000,0x08080C1A,0x0C1A0808,0x000003E0,0x02200000,0x00800140,0x02200140,0x07E00800,
+	0x09880E18,0x0C380848,0x000003F8,0x07F80000,0x08020801,0x08000800,0x000007F8,0x07F80000,
+	0x08020800,0x08000801,0x000007F8,0x07F80000,0x08010802,0x08020801,0x000007F8,0x07F80000,
+	0x08000802,0x08020800,0x000007F8,0x00100008,0x0F820060,0x00100061,0x00000008,0x0FF80000,
+	0x01100110,0x01100110,0x000000E0,0x0FF80000,0x09A400E4,0x06000918,0x06400000,0x09240920,
+	0x0FC00928,0x06400000,0x09280920,0x0FC00924,0x06400000,0x09240928,0x0FC80924,0x06400000,
+	0x0924092C,0x0FCC0928,0x06400000,0x09200928,0x0FC00928,0x06400000,0x09290926,0x0FC60929,
+	0x0F400000,0x07C00920,0x09E00920,0x07C00000,0x28200C60,0x38402820,0x07C00000,0x09240960,
+	0x05C00928,0x07C00000,0x09280960,0x05C00924,0x07C00000,0x09240968,0x05C80924,0x07C00000,
+	0x09200968,0x05C00928,0x08200000,0x0FE40820,0x08000808,0x08200000,0x0FE80820,0x08000804,
+	0x08280000,0x0FE40824,0x08000808,0x08200000,0x0FE00828,0x08000808,0x07800000,0x08580854,
+	0x07C00868,0x0FE00000,0x0024004C,0x0FCC0028,0x07C00000,0x08240820,0x07C00828,0x07C00000,
+	0x08280820,0x07C00824,0x07C00000,0x08240828,0x07C00828,0x07CC0000,0x082C0824,0x07CC0828,
+	0x07C00000,0x08200828,0x07C00828,0x01000000,0x05400100,0x01000100,0x0FC00000,0x09200A20,
+	0x07E008A0,0x07E00000,0x08040800,0x0FE00808,0x07E00000,0x08080800,0x0FE00804,0x07E00000,
+	0x08040808,0x0FE00808,0x07E00000,0x08000808,0x0FE00808,0x40600000,0x1C086780,0x00600384,
+	0x7FFC0000,0x08200820,0x07C00820,0x40600000,0x1C006788,0x00600388
+};
+const IndexedFont DejaVu_Sans_Mono_12_Indexed = {DejaVu_Sans_Mono_12, DejaVu_Sans_Mono_12_glyphs, DejaVu_Sans_Mono_12_data, 32, 224, 15};
+
+const uint32_t DejaVu_Sans_Mono_16_glyphs[] PROGMEM = {
+	0x0A000000,	// 32
+	0x0A0E0000,	// 33
+	0x0A130004,	// 34
+	0x0A1C0009,	// 35
+	0x0A1A0010,	// 36
+	0x0A1A0017,	// 37
+	0x0A1A001E,	// 38
+	0x0A0D0025,	// 39
+	0x0A150029,	// 40
+	0x0A11002F,	// 41
+	0x0A170034,	// 42
+	0x0A17003A,	// 43
+	0x0A110040,	// 44
+	0x0A140045,	// 45
+	0x0A11004A,	// 46
+	0x0A16004F,	// 47
+	0x0A1A0055,	// 48
+	0x0A17005C,	// 49
+	0x0A1A0062,	// 50
+	0x0A1A0069,	// 51
+	0x0A1A0070,	// 52
+	0x0A1A0077,	// 53
+	0x0A1A007E,	// 54
+	0x0A190085,	// 55
+	0x0A1A008C,	// 56
+	0x0A1A0093,	// 57
+	0x0A11009A,	// 58
+	0x0A11009F,	// 59
+	0x0A1A00A4,	// 60
+	0x0A1A00AB,	// 61
+	0x0A1A00B2,	// 62
+	0x0A1600B9,	// 63
+	0x0A1A00BF,	// 64
+	0x0A1A00C6,	// 65
+	0x0A1A00CD,	// 66
+	0x0A1A00D4,	// 67
+	0x0A1A00DB,	// 68
+	0x0A1A00E2,	// 69
+	0x0A1900E9,	// 70
+	0x0A1A00F0,	// 71
+	0x0A1A00F7,	// 72
+	0x0A1400FE,	// 73
+	0x0A170103,	// 74
+	0x0A1A0109,	// 75
+	0x0A1A0110,	// 76
+	0x0A1A0117,	// 77
+	0x0A1A011E,	// 78
+	0x0A1A0125,	// 79
+	0x0A19012C,	// 80
+	0x0A1A0133,	// 81
+	0x0A1D013A,	// 82
+	0x0A1A0142,	// 83
+	0x0A190149,	// 84
+	0x0A1A0150,	// 85
+	0x0A190157,	// 86
+	0x0A1C015E,	// 87
+	0x0A1A0165,	// 88
+	0x0A19016C,	// 89
+	0x0A1A0173,	// 90
+	0x0A15017A,	// 91
+	0x0A170180,	// 92
+	0x0A120186,	// 93
+	0x0A1C018B,	// 94
+	0x0A1E0192,	// 95
+	0x0A10019A,	// 96
+	0x0A1A019E,	// 97
+	0x0A1A01A5,	// 98
+	0x0A1701AC,	// 99
+	0x0A1A01B2,	// 100
+	0x0A1A01B9,	// 101
+	0x0A1601C0,	// 102
+	0x0A1A01C6,	// 103
+	0x0A1A01CD,	// 104
+	0x0A1701D4,	// 105
+	0x0A1201DA,	// 106
+	0x0A1A01DF,	// 107
+	0x0A1701E6,	// 108
+	0x0A1701EC,	// 109
+	0x0A1A01F2,	// 110
+	0x0A1A01F9,	// 111
+	0x0A1A0200,	// 112
+	0x0A1B0207,	// 113
+	0x0A19020E,	// 114
+	0x0A1A0215,	// 115
+	0x0A14021C,	// 116
+	0x0A1A0221,	// 117
+	0x0A190228,	// 118
+	0x0A1C022F,	// 119
+	0x0A1A0236,	// 120
+	0x0A19023D,	// 121
+	0x0A1A0244,	// 122
+	0x0A15024B,	// 123
+	0x0A0F0251,	// 124
+	0x0A140255,	// 125
+	0x0A1A025A,	// 126
+	0x0A1B0261,	// 127
+	0x0A1B0268,	// 128
+	0x0A1B026F,	// 129
+	0x0A1B0276,	// 130
+	0x0A1B027D,	// 131
+	0x0A1B0284,	// 132
+	0x0A1B028B,	// 133
+	0x0A1B0292,	// 134
+	0x0A1B0299,	// 135
+	0x0A1B02A0,	// 136
+	0x0A1B02A7,	// 137
+	0x0A1B02AE,	// 138
+	0x0A1B02B5,	// 139
+	0x0A1B02BC,	// 140
+	0x0A1B02C3,	// 141
+	0x0A1B02CA,	// 142
+	0x0A1B02D1,	// 143
+	0x0A1B02D8,	// 144
+	0x0A1B02DF,	// 145
+	0x0A1B02E6,	// 146
+	0x0A1B02ED,	// 147
+	0x0A1B02F4,	// 148
+	0x0A1B02FB,	// 149
+	0x0A1B0302,	// 150
+	0x0A1B0309,	// 151
+	0x0A1B0310,	// 152
+	0x0A1B0317,	// 153
+	0x0A1B031E,	// 154
+	0x0A1B0325,	// 155
+	0x0A1B032C,	// 156
+	0x0A1B0333,	// 157
+	0x0A1B033A,	// 158
+	0x0A1B0341,	// 159
+	0x0A000000,	// 160
+	0x0A0F0348,	// 161
+	0x0A17034C,	// 162
+	0x0A170352,	// 163
+	0x0A170358,	// 164
+	0x0A19035E,	// 165
+	0x0A0F0365,	// 166
+	0x0A1A0369,	// 167
+	0x0A160370,	// 168
+	0x0A1D0376,	// 169
+	0x0A17037E,	// 170
+	0x0A1A0384,	// 171
+	0x0A1A038B,	// 172
+	0x0A140392,	// 173
+	0x0A1D0397,	// 174
+	0x0A13039F,	// 175
+	0x0A1303A4,	// 176
+	0x0A1703A9,	// 177
+	0x0A1403AF,	// 178
+	0x0A1703B4,	// 179
+	0x0A1603BA,	// 180
+	0x0A1D03C0,	// 181
+	0x0A1B03C8,	// 182
+	0x0A1103CF,	// 183
+	0x0A1203D4,	// 184
+	0x0A1403D9,	// 185
+	0x0A1703DE,	// 186
+	0x0A1D03E4,	// 187
+	0x0A1A03EC,	// 188
+	0x0A1B03F3,	// 189
+	0x0A1A03FA,	// 190
+	0x0A150401,	// 191
+	0x0A1A0407,	// 192
+	0x0A1A040E,	// 193
+	0x0A1A0415,	// 194
+	0x0A1A041C,	// 195
+	0x0A1A0423,	// 196
+	0x0A1A042A,	// 197
+	0x0A1A0431,	// 198
+	0x0A1A0438,	// 199
+	0x0A1A043F,	// 200
+	0x0A1A0446,	// 201
+	0x0A1A044D,	// 202
+	0x0A1A0454,	// 203
+	0x0A14045B,	// 204
+	0x0A140460,	// 205
+	0x0A140465,	// 206
+	0x0A14046A,	// 207
+	0x0A1A046F,	// 208
+	0x0A1A0476,	// 209
+	0x0A1A047D,	// 210
+	0x0A1A0484,	// 211
+	0x0A1A048B,	// 212
+	0x0A1A0492,	// 213
+	0x0A1A0499,	// 214
+	0x0A1704A0,	// 215
+	0x0A1A04A6,	// 216
+	0x0A1A04AD,	// 217
+	0x0A1A04B4,	// 218
+	0x0A1A04BB,	// 219
+	0x0A1A04C2,	// 220
+	0x0A1904C9,	// 221
+	0x0A1A04D0,	// 222
+	0x0A1A04D7,	// 223
+	0x0A1A04DE,	// 224
+	0x0A1A04E5,	// 225
+	0x0A1A04EC,	// 226
+	0x0A1A04F3,	// 227
+	0x0A1A04FA,	// 228
+	0x0A1A0501,	// 229
+	0x0A1A0508,	// 230
+	0x0A17050F,	// 231
+	0x0A1A0515,	// 232
+	0x0A1A051C,	// 233
+	0x0A1A0523,	// 234
+	0x0A1A052A,	// 235
+	0x0A170531,	// 236
+	0x0A170537,	// 237
+	0x0A17053D,	// 238
+	0x0A170543,	// 239
+	0x0A1A0549,	// 240
+	0x0A1A0550,	// 241
+	0x0A1A0557,	// 242
+	0x0A1A055E,	// 243
+	0x0A1A0565,	// 244
+	0x0A1A056C,	// 245
+	0x0A1A0573,	// 246
+	0x0A1A057A,	// 247
+	0x0A1A0581,	// 248
+	0x0A1A0588,	// 249
+	0x0A1A058F,	// 250
+	0x0A1A0596,	// 251
+	0x0A1A059D,	// 252
+	0x0A1905A4,	// 253
+	0x0A1A05AB,	// 254
+	0x0A1905B2	// 255
+};
+const uint32_t DejaVu_Sans_Mono_16_data[] PROGMEM = {
+	0x00000000,0x00000000,0x00000000,0x000067F8,0x00000000,0x00000000,0x00007800,0x00000000,
+	0x00780000,0x80000800,0x78800048,0x000F8000,0x800008F0,0x1F800078,0x0009F000,0x80000890,
+	0x00000000,0x21C00000,0x00426000,0xF8004220,0x442001FF,0x00442000,0x00003840,0x88000070,
+	0x04880004,0x00028800,0x00003A70,0x45000045,0x00448000,0x00003800,0x00000000,0x2370001E,
+	0x00408800,0x08004308,0x78080046,0x00300000,0x00004E00,0x00000000,0x00000000,0x00000000,
+	0x00000078,0x00000000,0x00000000,0x001F8000,0x1800E070,0x00080180,0x00000001,0x00000000,
+	0x00080000,0x01801801,0x8000E070,0x0000001F,0x20000000,0x01400001,0x0000C000,0xC00007F8,
+	0x01400000,0x00012000,0x00000000,0x04000004,0x00040000,0x00003F80,0x04000004,0x00040000,
+	0x00000000,0x00000000,0x03000000,0x0001E000,0x000000E0,0x00000000,0x00000000,0x00040000,
+	0x00000400,0x04000004,0x00000000,0x00000000,0x00000000,0x00006000,0x00000060,0x00000000,
+	0x60000080,0x00180000,0xC0000700,0x00300000,0x00000800,0xC0000000,0x3030000F,0x00400800,
+	0x08004308,0x40080043,0x00303000,0x00000FC0,0x00000000,0x00100000,0x00401800,0xF8004008,
+	0x4000007F,0x00400000,0x30000000,0x60180040,0x00700800,0x08004808,0x42080044,0x00411000,
+	0x000040E0,0x10000000,0x40080020,0x00410800,0x08004108,0x41080041,0x00229000,0x00001CE0,
+	0x00000000,0x0B00000C,0x0008C000,0x18000870,0x7FF80008,0x00080000,0x00000800,0x00000000,
+	0x41F80020,0x00408800,0x88004088,0x40880040,0x00210800,0x00001E00,0xC0000000,0x2130001F,
+	0x00409800,0x88004088,0x40880040,0x00211000,0x00001E00,0x08000000,0x00080000,0x00400800,
+	0x08003008,0x0188000E,0x00006800,0x00000018,0xF0000000,0x2290001C,0x00410800,0x08004108,
+	0x41080041,0x00229000,0x00001EF0,0xE0000000,0x22100001,0x00440800,0x08004408,0x64080044,
+	0x00321000,0x00000FE0,0x00000000,0x00000000,0x00000000,0x80006180,0x00000061,0x00000000,
+	0x00000000,0x03000000,0x8001E180,0x000000E1,0x00000000,0x06000006,0x000F0000,0x80000900,
+	0x10800019,0x00108000,0x000030C0,0x00000000,0x09000009,0x00090000,0x00000900,0x09000009,
+	0x00090000,0x00000900,0xC0000000,0x10800030,0x00108000,0x00001980,0x0F000009,0x00060000,
+	0x00000600,0x00000000,0x00100000,0x00000800,0x08006E08,0x01980001,0x0000F000,0x00000000,
+	0xC0C0003F,0x01002000,0x90023F10,0x40900261,0x0261B002,0x00007FE0,0x00000000,0x1E000060,
+	0x0009E000,0x38000838,0x09E00008,0x001E0000,0x00006000,0xF8000000,0x4108007F,0x00410800,
+	0x08004108,0x41080041,0x00229000,0x00003EF0,0xC0000000,0x3030000F,0x00201000,0x08004008,
+	0x40080040,0x00601800,0x00002010,0xF8000000,0x4008007F,0x00400800,0x08004008,0x20100040,
+	0x00303000,0x00000FC0,0xF8000000,0x4108007F,0x00410800,0x08004108,0x41080041,0x00410800,
+	0x00004108,0xF8000000,0x0108007F,0x00010800,0x08000108,0x01080001,0x00010800,0x00000008,
+	0xC0000000,0x3030000F,0x00201000,0x08004008,0x42080040,0x00421800,0x00003E10,0xF8000000,
+	0x0100007F,0x00010000,0x00000100,0x01000001,0x00010000,0x00007FF8,0x00000000,0x40080000,
+	0x00400800,0x08007FF8,0x40080040,0x00000000,0x60000020,0x00400000,0x08004008,0x20080040,
+	0x001FF800,0xF8000000,0x0100007F,0x00008000,0x20000340,0x18100004,0x00200800,0x00004000,
+	0xF8000000,0x4000007F,0x00400000,0x00004000,0x40000040,0x00400000,0x00004000,0xF8000000,
+	0x0038007F,0x0000E000,0x00000700,0x00E00007,0x00003800,0x00007FF8,0xF8000000,0x0018007F,
+	0x00006000,0x00000180,0x18000006,0x00600000,0x00007FF8,0xE0000000,0x3030001F,0x00400800,
+	0x08004008,0x40080040,0x00303000,0x00001FE0,0xF8000000,0x0208007F,0x00020800,0x08000208,
+	0x02080002,0x00011000,0x000000E0,0xE0000000,0x3030001F,0x00400800,0x08004008,0xC0080040,
+	0x01F03000,0x00001FC0,0xF8000000,0x0208007F,0x00020800,0x08000208,0x02080002,0x00051000,
+	0x000039E0,0x00000040,0xE0000000,0x61100030,0x00410800,0x08004308,0x42180042,0x00221000,
+	0x00003C00,0x08000008,0x00080000,0x00000800,0x08007FF8,0x00080000,0x00000800,0x00000008,
+	0xF8000000,0x2000001F,0x00400000,0x00004000,0x40000040,0x00200000,0x00001FF8,0x18000000,
+	0x01E00000,0x001E0000,0x00007000,0x1E000070,0x0001E000,0x00000018,0xC0000038,0x6000001F,
+	0x001C0000,0xC00003C0,0x1C000003,0x00600000,0x38001FC0,0x08000000,0x30300040,0x000CC000,
+	0x00000300,0x0CC00003,0x00303000,0x00004008,0x10000008,0x00600000,0x00018000,0x80007E00,
+	0x00600001,0x00001000,0x00000008,0x08000000,0x50080060,0x004C0800,0x88004608,0x40C80041,
+	0x00402800,0x00004018,0x00000000,0x00000000,0x00000000,0x0801FFF8,0x00080100,0x00000001,
+	0x08000000,0x00300000,0x0000C000,0x00000700,0x60000018,0x00800000,0x00000000,0x00000000,
+	0x01000800,0xF8010008,0x000001FF,0x40000000,0x00600000,0x00003000,0x08000018,0x00180000,
+	0x00003000,0x40000060,0x00040000,0x00000400,0x04000004,0x00040000,0x00000400,0x04000004,
+	0x00040000,0x00000400,0x00000000,0x00040000,0x00000C00,0x10000018,0x00000000,0x6480003C,
+	0x00424000,0x40004240,0x62400042,0x0032C000,0x00007F80,0xF8000000,0x2080007F,0x00404000,
+	0x40004040,0x40400040,0x00208000,0x00001F00,0x00000000,0x2080001F,0x00404000,0x40004040,
+	0x40400040,0x00208000,0x00000000,0x2080001F,0x00404000,0x40004040,0x40400040,0x00208000,
+	0x00007FF8,0x00000000,0x2480001F,0x00444000,0x40004440,0x44400044,0x00448000,0x00002700,
+	0x00000000,0x00400000,0x00004000,0x48007FF0,0x00480000,0x00004800,0x00000000,0x2080001F,
+	0x02404001,0x40024040,0x40400240,0x01208002,0x0000FFC0,0xF8000000,0x0080007F,0x00004000,
+	0x40000040,0x00400000,0x0000C000,0x00007F80,0x00000000,0x40400040,0x00404000,0x00007FD8,
+	0x40000040,0x00400000,0x00000000,0x00000000,0x02004002,0xD8020040,0x000001FF,0xF8000000,
+	0x0400007F,0x00020000,0x80000500,0x10400008,0x00200000,0x00004000,0x08000000,0x00080000,
+	0x00000800,0x00003FF8,0x40000040,0x00400000,0xC0000000,0x0040007F,0x00004000,0x40007FC0,
+	0x00400000,0x007F8000,0xC0000000,0x0080007F,0x00004000,0x40000040,0x00400000,0x0000C000,
+	0x00007F80,0x00000000,0x2080001F,0x00404000,0x40004040,0x40400040,0x00208000,0x00001F00,
+	0xC0000000,0x208003FF,0x00404000,0x40004040,0x40400040,0x00208000,0x00001F00,0x00000000,
+	0x2080001F,0x00404000,0x40004040,0x40400040,0x00208000,0x0003FFC0,0x00000000,0x00000000,
+	0x007FC000,0x40000080,0x00400000,0x00004000,0x00000080,0x80000000,0x46800023,0x00444000,
+	0x40004440,0x44400044,0x002C4000,0x00003880,0x40000000,0x00400000,0x003FF000,0x40004040,
+	0x40400040,0xC0000000,0x6000003F,0x00400000,0x00004000,0x40000040,0x00200000,0x00007FC0,
+	0x40000000,0x03800000,0x001C0000,0x00006000,0x1C000060,0x00038000,0x00000040,0x000000C0,
+	0x6000001F,0x001C0000,0x00000300,0x18000007,0x00600000,0xC0001F00,0x40000000,0x60C00040,
+	0x00110000,0x00000E00,0x1100000E,0x0060C000,0x00004040,0x40000000,0x03800000,0x020C0002,
+	0x00037000,0x1C0000E0,0x00038000,0x00000040,0x40000000,0x50400060,0x00484000,0x40004440,
+	0x42400044,0x00414000,0x000040C0,0x00000000,0x04000000,0x00040000,0x0801FBF0,0x00080200,
+	0x00000002,0x00000000,0x00000000,0x00000000,0x0007FFF8,0x00000000,0x00080000,0x02000802,
+	0x0001FBF0,0x04000004,0x00000000,0x02000004,0x00020000,0x00000200,0x04000004,0x00040000,
+	0x00000200,0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,
+	0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,
+	0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,
+	0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,
+	0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,
+	0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,
+	0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,
+	0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,
+	0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,
+	0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,
+	0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,
+	0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,
+	0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,
+	0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,
+	0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,
+	0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,
+	0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,
+	0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,
+	0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,
+	0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,
+	0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,
+	0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,
+	0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,
+	0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,
+	0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,
+	0x10020010,0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,
+	0x00100200,0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,
+	0x02001002,0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,
+	0x0003FFF0,0xF0000000,0x001003FF,0x02001002,0x10020010,0x00100200,0x02001002,0x0003FFF0,
+	0x00000000,0x00000000,0x00000000,0x0003FCC0,0x00000000,0x3080001F,0x00604000,0xF0004040,
+	0x404001FF,0x00208000,0x00000000,0x42000042,0x007FF000,0x08004218,0x42080042,0x00401000,
+	0x40000000,0x0F800010,0x00088000,0x80000880,0x0F800008,0x00104000,0x30000008,0x05600005,
+	0x00058000,0x80007E00,0x05600005,0x00053000,0x00000008,0x00000000,0x00000000,0x00000000,
+	0x0003F3F0,0x00000000,0x07000000,0x010CF000,0x880118C8,0x31880110,0x00F10801,0x00000E00,
+	0x00000000,0x00000000,0x00001800,0x00000018,0x00180000,0x00001800,0x60000780,0x17A00018,
+	0x002CD000,0x50002850,0x28500028,0x00102000,0x80001860,0x00000007,0x00000000,0x04C80000,
+	0x00052800,0x28000528,0x04A80005,0x0005F000,0x00000000,0x0A000004,0x001B0000,0x00003180,
+	0x0A000004,0x001B0000,0x00003180,0x00000000,0x01000001,0x00010000,0x00000100,0x01000001,
+	0x00010000,0x00000F00,0x00000000,0x00000000,0x00040000,0x00000400,0x04000004,0x60000780,
+	0x10200018,0x002FD000,0x50002150,0x2CD00023,0x00102000,0x80001860,0x00000007,0x00000000,
+	0x00080000,0x00000800,0x08000008,0x00080000,0x00000000,0x00700000,0x00008800,0x88000088,
+	0x00700000,0x00000000,0x41000041,0x00410000,0x00004FE0,0x41000041,0x00410000,0x00000000,
+	0x00000000,0x00030800,0xC8000388,0x02700002,0x00000000,0x00000000,0x00020800,0x48000248,
+	0x02480002,0x0001B000,0x00000000,0x00000000,0x00000000,0x18000010,0x000C0000,0x00000400,
+	0xC0000000,0x200003FF,0x00400000,0x00004000,0x40000040,0x00200000,0x00007FC0,0x00000040,
+	0xE0000000,0x01F00000,0x0003F800,0xF80003F8,0x000801FF,0x00000800,0x0001FFF8,0x00000000,
+	0x00000000,0x00000000,0x00000300,0x00000003,0x00000000,0x00000000,0x02000000,0x00020000,
+	0x00000380,0x00000000,0x02080000,0x00020800,0x000003F8,0x02000002,0x00000000,0x04F00000,
+	0x00059800,0x08000508,0x05980005,0x0004F000,0x00000000,0x31800000,0x001B0000,0x00000A00,
+	0x31800004,0x001B0000,0x00000A00,0x00000004,0x04000504,0x03FC0005,0x00C30000,0x0000B300,
+	0xFE00008E,0x00810001,0x00000100,0x04000504,0x03FC0005,0x00030000,0x00000300,0xC6000186,
+	0x01650001,0x00013900,0x04000400,0x03240005,0x00C32400,0xD800B324,0xFE00008E,0x00810001,
+	0x00000100,0x00000000,0x300001E0,0x02100003,0x00020EC0,0x00000200,0x00000001,0x00000000,
+	0x1E000060,0x0009E100,0x3A00083B,0x09E00008,0x001E0000,0x00006000,0x00000000,0x1E000060,
+	0x0009E000,0x3B00083A,0x09E10008,0x001E0000,0x00006000,0x00000000,0x1E000060,0x0009E200,
+	0x39000839,0x09E20008,0x001E0000,0x00006000,0x00000000,0x1E000060,0x0009E300,0x3A000839,
+	0x09E30008,0x001E0000,0x00006000,0x00000000,0x1E030060,0x0009E300,0x38000838,0x09E30008,
+	0x001E0300,0x00006000,0x00000000,0x1E000060,0x0009C600,0x39000839,0x09C60008,0x001E0000,
+	0x00006000,0x00006000,0x0BC0001E,0x00083800,0xF8000808,0x4108007F,0x00410800,0x00004108,
+	0xC0000000,0x3030000F,0x00201000,0x08024008,0xC0080240,0x00601803,0x00002010,0xF8000000,
+	0x4108007F,0x00410900,0x0A00410B,0x41080041,0x00410800,0x00004108,0xF8000000,0x4108007F,
+	0x00410800,0x0B00410A,0x41090041,0x00410800,0x00004108,0xF8000000,0x410A007F,0x00410B00,
+	0x0B004109,0x410A0041,0x00410800,0x00004108,0xF8000000,0x4108007F,0x00410B00,0x0800410B,
+	0x410B0041,0x00410B00,0x00004108,0x00000000,0x40080000,0x00400900,0x0A007FFB,0x40080040,
+	0x00000000,0x40080000,0x00400800,0x0B007FFA,0x40090040,0x00000000,0x400A0000,0x00400B00,
+	0x0B007FF9,0x400A0040,0x00000000,0x400B0000,0x00400B00,0x0B007FF8,0x400B0040,0xF8000100,
+	0x4108007F,0x00410800,0x08004008,0x20100040,0x00303000,0x00000FC0,0xF8000000,0x0018007F,
+	0x00006300,0x02000181,0x18030006,0x00600000,0x00007FF8,0xE0000000,0x3030001F,0x00400900,
+	0x0A00400B,0x40080040,0x00303000,0x00001FE0,0xE0000000,0x3030001F,0x00400800,0x0B00400A,
+	0x40090040,0x00303000,0x00001FE0,0xE0000000,0x3030001F,0x00400A00,0x09004009,0x400A0040,
+	0x00303000,0x00001FE0,0xE0000000,0x3030001F,0x00400B00,0x0A004009,0x400B0040,0x00303000,
+	0x00001FE0,0xE0000000,0x3033001F,0x00400B00,0x08004008,0x400B0040,0x00303300,0x00001FE0,
+	0x40000000,0x08800010,0x00050000,0x00000200,0x08800005,0x00104000,0xC0004000,0x7830003F,
+	0x00440800,0x88004208,0x40C80041,0x00307800,0x00000FF8,0xF8000000,0x2000001F,0x00400100,
+	0x02004003,0x40000040,0x00200000,0x00001FF8,0xF8000000,0x2000001F,0x00400000,0x03004002,
+	0x40010040,0x00200000,0x00001FF8,0xF8000000,0x2000001F,0x00400200,0x01004001,0x40020040,
+	0x00200000,0x00001FF8,0xF8000000,0x2003001F,0x00400300,0x00004000,0x40030040,0x00200300,
+	0x00001FF8,0x10000008,0x00600000,0x00018000,0x83007E02,0x00610001,0x00001000,0x00000008,
+	0xF8000000,0x0820007F,0x00082000,0x20000820,0x08200008,0x00044000,0x000007C0,0xF0000000,
+	0x0018007F,0x00400800,0x48004388,0x44580046,0x004C3000,0x00003800,0x00000000,0x6484003C,
+	0x00424C00,0x50004258,0x62400042,0x0032C000,0x00007F80,0x00000000,0x6480003C,0x00424000,
+	0x58004250,0x624C0042,0x0032C400,0x00007F80,0x00000000,0x6490003C,0x00424800,0x48004244,
+	0x62500042,0x0032C000,0x00007F80,0x00000000,0x6498003C,0x00424800,0x50004258,0x62580042,
+	0x0032C000,0x00007F80,0x00000000,0x6480003C,0x00425800,0x40004258,0x62580042,0x0032D800,
+	0x00007F80,0x00000000,0x6480003C,0x00424C00,0x52004252,0x624C0042,0x0032C000,0x00007F80,
+	0x00000000,0x44400038,0x00444000,0x40003F80,0x44400044,0x00444000,0x00002780,0x00000000,
+	0x2080001F,0x00404000,0x40024040,0xC0400240,0x00208003,0x00000000,0x2484001F,0x00444C00,
+	0x50004458,0x44400044,0x00448000,0x00002700,0x00000000,0x2480001F,0x00444000,0x58004450,
+	0x444C0044,0x00448400,0x00002700,0x00000000,0x2490001F,0x00444800,0x48004444,0x44500044,
+	0x00448000,0x00002700,0x00000000,0x2480001F,0x00445800,0x40004458,0x44580044,0x00449800,
+	0x00002700,0x00000000,0x40440040,0x00404C00,0x10007FD8,0x40000040,0x00400000,0x00000000,
+	0x40400040,0x00404000,0x18007FD0,0x400C0040,0x00400400,0x00000000,0x40500040,0x00404800,
+	0x08007FC4,0x40100040,0x00400000,0x00000000,0x40580040,0x00405800,0x18007FC0,0x40180040,
+	0x00400000,0x00000000,0x20A0001F,0x00405800,0x50004058,0x40700040,0x0020C800,0x00001F00,
+	0xC0000000,0x0098007F,0x00004800,0x50000058,0x00580000,0x0000C000,0x00007F80,0x00000000,
+	0x2084001F,0x00404C00,0x50004058,0x40400040,0x00208000,0x00001F00,0x00000000,0x2080001F,
+	0x00404000,0x58004050,0x404C0040,0x00208400,0x00001F00,0x00000000,0x2080001F,0x00405000,
+	0x4C00404C,0x40500040,0x00208000,0x00001F00,0x00000000,0x2080001F,0x00405800,0x50004048,
+	0x40580040,0x00208000,0x00001F00,0x00000000,0x2098001F,0x00405800,0x40004040,0x40580040,
+	0x00209800,0x00001F00,0x00000000,0x04000004,0x00040000,0x80003580,0x04000035,0x00040000,
+	0x00000400,0x00000000,0x7080007F,0x00584000,0x40004C40,0x43400046,0x0021C000,0x00001FC0,
+	0xC0000000,0x6004003F,0x00400C00,0x10004018,0x40000040,0x00200000,0x00007FC0,0xC0000000,
+	0x6000003F,0x00400000,0x18004010,0x400C0040,0x00200400,0x00007FC0,0xC0000000,0x6000003F,
+	0x00401000,0x0C00400C,0x40100040,0x00200000,0x00007FC0,0xC0000000,0x6018003F,0x00401800,
+	0x00004000,0x40180040,0x00201800,0x00007FC0,0x40000000,0x03800000,0x020C0002,0x18037010,
+	0x1C0C00E0,0x00038400,0x00000040,0xF8000000,0x208003FF,0x00404000,0x40004040,0x40400040,
+	0x00208000,0x00001F00,0x40000000,0x03800000,0x020C1802,0x00037018,0x1C1800E0,0x00039800,
+	0x00000040
+};
+const IndexedFont DejaVu_Sans_Mono_16_Indexed = {DejaVu_Sans_Mono_16, DejaVu_Sans_Mono_16_glyphs, DejaVu_Sans_Mono_16_data, 32, 224, 19};
+
+const uint32_t Lato_Hairline_12_glyphs[] PROGMEM = {
+	0x03000000,	// 32
+	0x03040000,	// 33
+	0x04050001,	// 34
+	0x070C0003,	// 35
+	0x070C0006,	// 36
+	0x09100009,	// 37
+	0x0810000D,	// 38
+	0x02030011,	// 39
+	0x03060012,	// 40
+	0x03040014,	// 41
+	0x05070015,	// 42
+	0x070C0017,	// 43
+	0x0304001A,	// 44
+	0x0408001B,	// 45
+	0x0304001D,	// 46
+	0x0509001E,	// 47
+	0x070C0021,	// 48
+	0x070C0024,	// 49
+	0x070C0027,	// 50
+	0x070C002A,	// 51
+	0x070E002D,	// 52
+	0x070C0031,	// 53
+	0x070C0034,	// 54
+	0x070B0037,	// 55
+	0x070C003A,	// 56
+	0x070B003D,	// 57
+	0x03040040,	// 58
+	0x03040041,	// 59
+	0x070A0042,	// 60
+	0x070C0045,	// 61
+	0x070C0048,	// 62
+	0x0507004B,	// 63
+	0x0A12004D,	// 64
+	0x080E0052,	// 65
+	0x070E0056,	// 66
+	0x0810005A,	// 67
+	0x0910005E,	// 68
+	0x070C0062,	// 69
+	0x070B0065,	// 70
+	0x09100068,	// 71
+	0x0910006C,	// 72
+	0x03040070,	// 73
+	0x05080071,	// 74
+	0x070E0073,	// 75
+	0x060C0077,	// 76
+	0x0B12007A,	// 77
+	0x0910007F,	// 78
+	0x09120083,	// 79
+	0x070B0088,	// 80
+	0x0912008B,	// 81
+	0x070E0090,	// 82
+	0x060C0094,	// 83
+	0x070D0097,	// 84
+	0x090E009B,	// 85
+	0x080D009F,	// 86
+	0x0C1700A3,	// 87
+	0x070E00A9,	// 88
+	0x070D00AD,	// 89
+	0x070E00B1,	// 90
+	0x030600B5,	// 91
+	0x050A00B7,	// 92
+	0x030400BA,	// 93
+	0x070B00BB,	// 94
+	0x050A00BE,	// 95
+	0x050500C1,	// 96
+	0x060A00C3,	// 97
+	0x070C00C6,	// 98
+	0x060A00C9,	// 99
+	0x070A00CC,	// 100
+	0x060C00CF,	// 101
+	0x040700D2,	// 102
+	0x060C00D4,	// 103
+	0x070A00D7,	// 104
+	0x030400DA,	// 105
+	0x030400DB,	// 106
+	0x050A00DC,	// 107
+	0x030400DF,	// 108
+	0x091000E0,	// 109
+	0x070A00E4,	// 110
+	0x070C00E7,	// 111
+	0x070C00EA,	// 112
+	0x070A00ED,	// 113
+	0x040700F0,	// 114
+	0x050800F2,	// 115
+	0x040800F4,	// 116
+	0x070A00F6,	// 117
+	0x060B00F9,	// 118
+	0x091100FC,	// 119
+	0x050A0101,	// 120
+	0x060B0104,	// 121
+	0x050A0107,	// 122
+	0x0306010A,	// 123
+	0x0304010C,	// 124
+	0x0306010D,	// 125
+	0x070B010F,	// 126
+	0x060C0112,	// 127
+	0x060C0115,	// 128
+	0x060C0118,	// 129
+	0x060C011B,	// 130
+	0x060C011E,	// 131
+	0x060C0121,	// 132
+	0x060C0124,	// 133
+	0x060C0127,	// 134
+	0x060C012A,	// 135
+	0x060C012D,	// 136
+	0x060C0130,	// 137
+	0x060C0133,	// 138
+	0x060C0136,	// 139
+	0x060C0139,	// 140
+	0x060C013C,	// 141
+	0x060C013F,	// 142
+	0x060C0142,	// 143
+	0x060C0145,	// 144
+	0x060C0148,	// 145
+	0x060C014B,	// 146
+	0x060C014E,	// 147
+	0x060C0151,	// 148
+	0x060C0154,	// 149
+	0x060C0157,	// 150
+	0x060C015A,	// 151
+	0x060C015D,	// 152
+	0x060C0160,	// 153
+	0x060C0163,	// 154
+	0x060C0166,	// 155
+	0x060C0169,	// 156
+	0x060C016C,	// 157
+	0x060C016F,	// 158
+	0x060C0172,	// 159
+	0x03000000,	// 160
+	0x03040175,	// 161
+	0x070C0176,	// 162
+	0x070E0179,	// 163
+	0x070C017D,	// 164
+	0x070C0180,	// 165
+	0x03040183,	// 166
+	0x060A0184,	// 167
+	0x05070187,	// 168
+	0x0A120189,	// 169
+	0x0405018E,	// 170
+	0x04080190,	// 171
+	0x070C0192,	// 172
+	0x04080195,	// 173
+	0x0A120197,	// 174
+	0x0507019C,	// 175
+	0x0507019E,	// 176
+	0x070C01A0,	// 177
+	0x040501A3,	// 178
+	0x040501A5,	// 179
+	0x050501A7,	// 180
+	0x080E01A9,	// 181
+	0x070D01AD,	// 182
+	0x030401B1,	// 183
+	0x050601B2,	// 184
+	0x040501B4,	// 185
+	0x050701B6,	// 186
+	0x040801B8,	// 187
+	0x091001BA,	// 188
+	0x081001BE,	// 189
+	0x091001C2,	// 190
+	0x050801C6,	// 191
+	0x080E01C8,	// 192
+	0x080E01CC,	// 193
+	0x080E01D0,	// 194
+	0x080E01D4,	// 195
+	0x080E01D8,	// 196
+	0x080E01DC,	// 197
+	0x0B1401E0,	// 198
+	0x081001E5,	// 199
+	0x070C01E9,	// 200
+	0x070C01EC,	// 201
+	0x070C01EF,	// 202
+	0x070C01F2,	// 203
+	0x030401F5,	// 204
+	0x030501F6,	// 205
+	0x030501F8,	// 206
+	0x030501FA,	// 207
+	0x091001FC,	// 208
+	0x09100200,	// 209
+	0x09120204,	// 210
+	0x09120209,	// 211
+	0x0912020E,	// 212
+	0x09120213,	// 213
+	0x09120218,	// 214
+	0x070C021D,	// 215
+	0x09120220,	// 216
+	0x090E0225,	// 217
+	0x090E0229,	// 218
+	0x090E022D,	// 219
+	0x090E0231,	// 220
+	0x070D0235,	// 221
+	0x070C0239,	// 222
+	0x060C023C,	// 223
+	0x060A023F,	// 224
+	0x060A0242,	// 225
+	0x060A0245,	// 226
+	0x060A0248,	// 227
+	0x060A024B,	// 228
+	0x060A024E,	// 229
+	0x0A120251,	// 230
+	0x060A0256,	// 231
+	0x060C0259,	// 232
+	0x060C025C,	// 233
+	0x060C025F,	// 234
+	0x060C0262,	// 235
+	0x03040265,	// 236
+	0x03040266,	// 237
+	0x03050267,	// 238
+	0x03040269,	// 239
+	0x070C026A,	// 240
+	0x070A026D,	// 241
+	0x070C0270,	// 242
+	0x070C0273,	// 243
+	0x070C0276,	// 244
+	0x070C0279,	// 245
+	0x070C027C,	// 246
+	0x070C027F,	// 247
+	0x070C0282,	// 248
+	0x070A0285,	// 249
+	0x070A0288,	// 250
+	0x070A028B,	// 251
+	0x070A028E,	// 252
+	0x060B0291,	// 253
+	0x070C0294,	// 254
+	0x060B0297	// 255
+};
+const uint32_t Lato_Hairline_12_data[] PROGMEM = {
+	0x0BF00000,0x00700000,0x00000070,0x0E400000,0x0A5003E0,0x023007C0,0x08600000,0x1FFC0890,
+	0x07100910,0x08700000,0x02700490,0x0F400180,0x0F1008A0,0x0F000000,0x091008F0,0x0A100910,
+	0x08000700,0x00700000,0x1FF00000,0x00001008,0x1FF01008,0x00180000,0x00180038,0x01000000,
+	0x07E00100,0x01000100,0x18000000,0x01000000,0x01000100,0x08000000,0x0E000000,0x003001C0,
+	0x00000008,0x0FE00000,0x08100810,0x07E00810,0x00400000,0x0FF00820,0x00000800,0x08200000,
+	0x0A100C10,0x08E00910,0x0C300000,0x08900810,0x07700890,0x03800200,0x02200240,0x02000FF0,
+	0x00000200,0x08600000,0x08500850,0x07900850,0x0F800000,0x08A008C0,0x0F000890,0x00100000,
+	0x03100C10,0x003000D0,0x0F700000,0x08900890,0x0F700890,0x00E00000,0x05100910,0x00E00310,
+	0x08400000,0x18400000,0x01000000,0x02400180,0x00000240,0x01400000,0x01400140,0x01400140,
+	0x02400000,0x02400240,0x01000180,0x00100000,0x00700990,0x0FC00000,0x23901020,0x22502450,
+	0x24202590,0x000013E0,0x07000800,0x023002C0,0x03800260,0x00000C00,0x0FF00000,0x08900890,
+	0x08D00890,0x00000720,0x07E00000,0x08100810,0x08100810,0x08100810,0x0FF00000,0x08100810,
+	0x08100810,0x07E00810,0x0FF00000,0x08900890,0x08900890,0x0FF00000,0x00900090,0x00900090,
+	0x07E00000,0x08100810,0x08100810,0x0F100910,0x0FF00000,0x00800080,0x00800080,0x0FF00080,
+	0x0FF00000,0x08000800,0x07F00800,0x0FF00000,0x01400080,0x04200220,0x00000810,0x0FF00000,
+	0x08000800,0x08000800,0x0FF00000,0x00C00020,0x02000300,0x00C00100,0x00000FF0,0x0FF00000,
+	0x00C00020,0x02000100,0x0FF00400,0x07E00000,0x08100810,0x08100810,0x04200810,0x000003C0,
+	0x0FF00000,0x01100110,0x00F00110,0x07E00000,0x08100810,0x08100810,0x14200810,0x000023C0,
+	0x0FF00000,0x00900090,0x04700390,0x00000800,0x08700000,0x08900890,0x06000910,0x00100010,
+	0x0FF00010,0x00100010,0x00000010,0x07F00000,0x08000800,0x08000800,0x000007F0,0x00C00030,
+	0x0C000300,0x01800600,0x00000070,0x01C00030,0x04000E00,0x00700380,0x01800060,0x02000E00,
+	0x003001C0,0x04200810,0x01800240,0x04200240,0x00000810,0x00600010,0x0F000080,0x002000C0,
+	0x00000010,0x0C100000,0x09900A10,0x08300850,0x00000810,0x3FF80000,0x00002008,0x00380000,
+	0x060001C0,0x00000800,0x3FF80000,0x00800000,0x00100060,0x00800060,0x20002000,0x20002000,
+	0x00002000,0x00100000,0x00000010,0x0E400000,0x09400940,0x00000FC0,0x0FF80000,0x08400840,
+	0x07800840,0x0FC00000,0x08400840,0x00000840,0x0FC00000,0x08400840,0x00000FF8,0x0FC00000,
+	0x09400940,0x01800940,0x0FF00040,0x00500050,0x35C00000,0x2A402A40,0x104029C0,0x0FF80000,
+	0x00400040,0x00000FC0,0x0FD00000,0x3FD02000,0x0FF80000,0x04800280,0x00000840,0x0FF80000,
+	0x0FC00000,0x00400040,0x00400FC0,0x0FC00040,0x0FC00000,0x00400040,0x00000FC0,0x07800000,
+	0x08400840,0x07800840,0x3FC00000,0x08400840,0x07800840,0x0FC00000,0x08400840,0x00003FC0,
+	0x0FC00000,0x00400040,0x09C00000,0x0E400940,0x0FF00040,0x08400840,0x0FC00000,0x08000800,
+	0x00000FC0,0x03800040,0x06000C00,0x00400180,0x070000C0,0x03800C00,0x070000C0,0x03800C00,
+	0x00000040,0x04800840,0x04800300,0x00000840,0x03800040,0x06003C00,0x00400180,0x0C400800,
+	0x08C00B40,0x00000840,0x1FF00000,0x00002008,0x3FF80000,0x26C80000,0x00001930,0x01000000,
+	0x01000080,0x00800100,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,
+	0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,
+	0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,
+	0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,
+	0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,
+	0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,
+	0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,
+	0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,
+	0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,
+	0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,
+	0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,
+	0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x08100FF0,
+	0x08900D10,0x0FF00870,0x08100FF0,0x08900D10,0x0FF00870,0x3E400000,0x07800000,0x1FC00840,
+	0x08400830,0x0FE00100,0x09100910,0x08100910,0x00000800,0x03C00000,0x02400240,0x03C00240,
+	0x03300000,0x0F0003C0,0x033003C0,0x3EF80000,0x23F00000,0x24902250,0x00001B10,0x00100000,
+	0x00100000,0x07E00000,0x0A500990,0x0C300C30,0x08100C30,0x000007E0,0x00D00000,0x00000070,
+	0x07800000,0x04800300,0x00800000,0x00800080,0x03800080,0x01000000,0x01000100,0x07E00000,
+	0x0B500810,0x09B008B0,0x08100A50,0x000007E0,0x00100000,0x00100010,0x00700000,0x00700090,
+	0x08800000,0x0BE00880,0x08800880,0x00680000,0x0000005C,0x00480000,0x0000003C,0x00000000,
+	0x00000010,0x3FC00000,0x08000800,0x0FC00800,0x00000800,0x00F00020,0x3F1000F0,0x3FF00010,
+	0x00000010,0x01000000,0x00000000,0x00003000,0x00440000,0x00000078,0x00700000,0x00700090,
+	0x06800000,0x02000580,0x00F00000,0x02000C80,0x06600180,0x0E000510,0x08F00000,0x03000480,
+	0x092000C0,0x0B000C90,0x00900000,0x065008B0,0x06600180,0x0E000510,0x3C000000,0x20002240,
+	0x07000800,0x023202C2,0x03800264,0x00000C00,0x07000800,0x023402C0,0x03820262,0x00000C00,
+	0x07000800,0x023202C4,0x03840262,0x00000C00,0x07000800,0x023202C4,0x03820264,0x00000C00,
+	0x07000800,0x023002C2,0x03800262,0x00000C00,0x07000800,0x023602C0,0x03800264,0x00000C00,
+	0x04000800,0x02C00300,0x07D00230,0x08900890,0x08900890,0x07E00000,0x08100810,0x28103010,
+	0x08100810,0x0FF00000,0x08920892,0x08900894,0x0FF00000,0x08940890,0x08920892,0x0FF00000,
+	0x08920894,0x08940892,0x0FF00000,0x08900892,0x08900892,0x0FF40002,0x0FF40000,0x00000002,
+	0x0FF20004,0x00000004,0x0FF00002,0x00000002,0x0FF00080,0x08900890,0x08100810,0x07E00810,
+	0x0FF00000,0x00C60020,0x02040102,0x0FF00402,0x07E00000,0x08120810,0x08140812,0x04200810,
+	0x000003C0,0x07E00000,0x08100810,0x08120814,0x04200810,0x000003C0,0x07E00000,0x08140810,
+	0x08120812,0x04200814,0x000003C0,0x07E00000,0x08140810,0x08140812,0x04200812,0x000003C0,
+	0x07E00000,0x08120810,0x08120810,0x04200810,0x000003C0,0x02400000,0x00800140,0x02400140,
+	0x0FE00000,0x0A100C10,0x08900910,0x04380870,0x000003C0,0x07F00000,0x08020800,0x08000804,
+	0x000007F0,0x07F00000,0x08040800,0x08020804,0x000007F0,0x07F00000,0x08020804,0x08040802,
+	0x000007F0,0x07F00000,0x08020800,0x08020800,0x000007F0,0x00600010,0x0F040080,0x002000C2,
+	0x00000010,0x0FF00000,0x04200420,0x03C00420,0x0FE00000,0x09900810,0x0E200A50,0x0E400000,
+	0x09400950,0x00000FC0,0x0E400000,0x09500960,0x00000FC0,0x0E600000,0x09500950,0x00000FC0,
+	0x0E500000,0x09500950,0x00000FC0,0x0E500000,0x09500940,0x00000FC0,0x0E400000,0x09480958,
+	0x00000FC0,0x0E400000,0x09400940,0x094007C0,0x09400940,0x000009C0,0x0FC00000,0x30402840,
+	0x00002840,0x0FC00000,0x09500950,0x01800940,0x0FC00000,0x09500940,0x01800940,0x0FC00000,
+	0x09500950,0x01800960,0x0FC00000,0x09400950,0x01800950,0x0FE00010,0x0FD00000,0x0FD00010,
+	0x00000020,0x0FD00010,0x0F800000,0x08700850,0x07C00870,0x0FD00000,0x00500050,0x00000FD0,
+	0x0FC00000,0x08500850,0x07800840,0x0FC00000,0x08500840,0x07800840,0x0FC00000,0x08500850,
+	0x07800860,0x0FC00000,0x08500850,0x07800850,0x0FC00000,0x08400850,0x07800850,0x01000000,
+	0x05400100,0x01000100,0x0FC00000,0x0B400C40,0x07C008C0,0x0FC00000,0x08100810,0x00000FC0,
+	0x0FC00000,0x08100800,0x00000FC0,0x0FC00000,0x08100810,0x00000FE0,0x0FC00000,0x08000810,
+	0x00000FD0,0x03800040,0x06103C00,0x00400180,0x3FF80000,0x08400840,0x07800840,0x03800040,
+	0x06003C10,0x00400190
+};
+const IndexedFont Lato_Hairline_12_Indexed = {Lato_Hairline_12, Lato_Hairline_12_glyphs, Lato_Hairline_12_data, 32, 224, 15};
+
+const uint32_t Lato_Hairline_17_glyphs[] PROGMEM = {
+	0x05000000,	// 32
+	0x04090000,	// 33
+	0x050A0003,	// 34
+	0x0A1A0006,	// 35
+	0x0A17000D,	// 36
+	0x0D230013,	// 37
+	0x0C21001C,	// 38
+	0x03040025,	// 39
+	0x040C0026,	// 40
+	0x04090029,	// 41
+	0x0710002C,	// 42
+	0x0A1A0030,	// 43
+	0x04060037,	// 44
+	0x060E0039,	// 45
+	0x0409003D,	// 46
+	0x07100040,	// 47
+	0x0A1A0044,	// 48
+	0x0A18004B,	// 49
+	0x0A1B0051,	// 50
+	0x0A1A0058,	// 51
+	0x0A1A005F,	// 52
+	0x0A170066,	// 53
+	0x0A1A006C,	// 54
+	0x0A190073,	// 55
+	0x0A1A007A,	// 56
+	0x0A170081,	// 57
+	0x04090087,	// 58
+	0x0409008A,	// 59
+	0x0A17008D,	// 60
+	0x0A170093,	// 61
+	0x0A170099,	// 62
+	0x0711009F,	// 63
+	0x0E2600A4,	// 64
+	0x0B1E00AE,	// 65
+	0x0B1A00B6,	// 66
+	0x0C2000BD,	// 67
+	0x0D2300C5,	// 68
+	0x0A1B00CE,	// 69
+	0x0A1900D5,	// 70
+	0x0D2000DC,	// 71
+	0x0D2100E4,	// 72
+	0x040900ED,	// 73
+	0x070E00F0,	// 74
+	0x0A1E00F4,	// 75
+	0x091800FC,	// 76
+	0x0F270102,	// 77
+	0x0D21010C,	// 78
+	0x0D230115,	// 79
+	0x0A1A011E,	// 80
+	0x0D270125,	// 81
+	0x0A1E012F,	// 82
+	0x09170137,	// 83
+	0x0A19013D,	// 84
+	0x0C1D0144,	// 85
+	0x0B1C014C,	// 86
+	0x112F0153,	// 87
+	0x0A1E015F,	// 88
+	0x0A190167,	// 89
+	0x0A1B016E,	// 90
+	0x050C0175,	// 91
+	0x07120178,	// 92
+	0x0509017D,	// 93
+	0x0A170180,	// 94
+	0x08150186,	// 95
+	0x070A018C,	// 96
+	0x0815018F,	// 97
+	0x09170195,	// 98
+	0x0815019B,	// 99
+	0x091801A1,	// 100
+	0x091701A7,	// 101
+	0x060E01AD,	// 102
+	0x091801B1,	// 103
+	0x091801B7,	// 104
+	0x040601BD,	// 105
+	0x040601BF,	// 106
+	0x081501C1,	// 107
+	0x040601C7,	// 108
+	0x0D2401C9,	// 109
+	0x091801D2,	// 110
+	0x091701D8,	// 111
+	0x091701DE,	// 112
+	0x091801E4,	// 113
+	0x061101EA,	// 114
+	0x071201EF,	// 115
+	0x060F01F4,	// 116
+	0x091801F8,	// 117
+	0x081701FE,	// 118
+	0x0D230204,	// 119
+	0x0815020D,	// 120
+	0x08170213,	// 121
+	0x07150219,	// 122
+	0x050C021F,	// 123
+	0x04060222,	// 124
+	0x050C0224,	// 125
+	0x0A1A0227,	// 126
+	0x0818022E,	// 127
+	0x08180234,	// 128
+	0x0818023A,	// 129
+	0x08180240,	// 130
+	0x08180246,	// 131
+	0x0818024C,	// 132
+	0x08180252,	// 133
+	0x08180258,	// 134
+	0x0818025E,	// 135
+	0x08180264,	// 136
+	0x0818026A,	// 137
+	0x08180270,	// 138
+	0x08180276,	// 139
+	0x0818027C,	// 140
+	0x08180282,	// 141
+	0x08180288,	// 142
+	0x0818028E,	// 143
+	0x08180294,	// 144
+	0x0818029A,	// 145
+	0x081802A0,	// 146
+	0x081802A6,	// 147
+	0x081802AC,	// 148
+	0x081802B2,	// 149
+	0x081802B8,	// 150
+	0x081802BE,	// 151
+	0x081802C4,	// 152
+	0x081802CA,	// 153
+	0x081802D0,	// 154
+	0x081802D6,	// 155
+	0x081802DC,	// 156
+	0x081802E2,	// 157
+	0x081802E8,	// 158
+	0x081802EE,	// 159
+	0x05000000,	// 160
+	0x040602F4,	// 161
+	0x0A1802F6,	// 162
+	0x0A1B02FC,	// 163
+	0x0A170303,	// 164
+	0x0A190309,	// 165
+	0x04060310,	// 166
+	0x08150312,	// 167
+	0x070D0318,	// 168
+	0x0E26031C,	// 169
+	0x060E0326,	// 170
+	0x060E032A,	// 171
+	0x0A17032E,	// 172
+	0x060E0334,	// 173
+	0x0E260338,	// 174
+	0x07100342,	// 175
+	0x07100346,	// 176
+	0x0A1B034A,	// 177
+	0x060E0351,	// 178
+	0x060D0355,	// 179
+	0x070D0359,	// 180
+	0x0B1E035D,	// 181
+	0x0B1C0365,	// 182
+	0x0405036C,	// 183
+	0x070F036E,	// 184
+	0x060E0372,	// 185
+	0x07110376,	// 186
+	0x060E037B,	// 187
+	0x0C21037F,	// 188
+	0x0C210388,	// 189
+	0x0C230391,	// 190
+	0x0712039A,	// 191
+	0x0B1E039F,	// 192
+	0x0B1E03A7,	// 193
+	0x0B1E03AF,	// 194
+	0x0B1E03B7,	// 195
+	0x0B1E03BF,	// 196
+	0x0B1E03C7,	// 197
+	0x102D03CF,	// 198
+	0x0C2003DB,	// 199
+	0x0A1B03E3,	// 200
+	0x0A1B03EA,	// 201
+	0x0A1B03F1,	// 202
+	0x0A1B03F8,	// 203
+	0x040903FF,	// 204
+	0x040A0402,	// 205
+	0x040A0405,	// 206
+	0x040A0408,	// 207
+	0x0D23040B,	// 208
+	0x0D210414,	// 209
+	0x0D23041D,	// 210
+	0x0D230426,	// 211
+	0x0D23042F,	// 212
+	0x0D230438,	// 213
+	0x0D230441,	// 214
+	0x0A17044A,	// 215
+	0x0D230450,	// 216
+	0x0C1D0459,	// 217
+	0x0C1D0461,	// 218
+	0x0C1D0469,	// 219
+	0x0C1D0471,	// 220
+	0x0A190479,	// 221
+	0x0A1A0480,	// 222
+	0x09180487,	// 223
+	0x0815048D,	// 224
+	0x08150493,	// 225
+	0x08150499,	// 226
+	0x0815049F,	// 227
+	0x081504A5,	// 228
+	0x081504AB,	// 229
+	0x0E2604B1,	// 230
+	0x081504BB,	// 231
+	0x091704C1,	// 232
+	0x091704C7,	// 233
+	0x091704CD,	// 234
+	0x091704D3,	// 235
+	0x040604D9,	// 236
+	0x040704DB,	// 237
+	0x040A04DD,	// 238
+	0x040704E0,	// 239
+	0x091704E2,	// 240
+	0x091804E8,	// 241
+	0x091704EE,	// 242
+	0x091704F4,	// 243
+	0x091704FA,	// 244
+	0x09170500,	// 245
+	0x09170506,	// 246
+	0x0A1A050C,	// 247
+	0x09170513,	// 248
+	0x09180519,	// 249
+	0x0918051F,	// 250
+	0x09180525,	// 251
+	0x0918052B,	// 252
+	0x08170531,	// 253
+	0x09170537,	// 254
+	0x0817053D	// 255
+};
+const uint32_t Lato_Hairline_17_data[] PROGMEM = {
+	0x00000000,0x0FF00100,0x00000001,0x00000000,0x00F00000,0x0000F000,0x00000000,0xF1000011,
+	0x001F8001,0x00001170,0x1F8001F1,0x00117000,0x00000100,0x00000000,0x01E00080,0x01021001,
+	0xFC07FC10,0x04100107,0x00F81001,0xE0000000,0x04100003,0x00C41001,0xE0002410,0x0400001B,
+	0x00FB0000,0x60010480,0x04100104,0x00F80001,0x00000000,0x04C000F8,0x01032001,0x10010410,
+	0x10100108,0x00A02001,0x00004000,0x000000B8,0x00000001,0xF0000000,0x80000000,0x007000FF,
+	0x04000803,0x38000000,0xFFC00600,0x00000001,0xA0000000,0x00A00000,0x0001F000,0xA00000A0,
+	0x00000000,0x04000004,0x00040000,0x00007FC0,0x04000004,0x00040000,0x00000400,0x00000000,
+	0x00000700,0x00000000,0x08000008,0x00080000,0x00000800,0x00000000,0x00000100,0x00000001,
+	0x00000000,0x70000180,0x000C0000,0x70000380,0xC0000000,0x8020007F,0x01001000,0x10010010,
+	0x00100100,0x00802001,0x00007FC0,0x00000000,0x00400000,0x01002001,0xF0010010,0x000001FF,
+	0x01000001,0x40000000,0x80200100,0x01401001,0x10012010,0x0C100110,0x01022001,0x000101C0,
+	0x40000000,0x002000C0,0x01001001,0x10010010,0x04100104,0x008B2001,0x000070C0,0x00002000,
+	0x24000038,0x00220000,0x40002180,0xFFF00020,0x00200001,0x00002000,0x00000000,0x03F00100,
+	0x01021001,0x10010210,0x02100102,0x00FC1001,0x00000000,0x86000078,0x01030000,0x200102C0,
+	0x02100102,0x00840001,0x00007800,0x10000000,0x00100000,0x01801000,0x10007010,0x0310000C,
+	0x0000D000,0x00000030,0xC0000000,0x0A2000F1,0x01041001,0x10010410,0x04100104,0x010B2001,
+	0x0000F0C0,0xC0000000,0x04200003,0x01081000,0x1000C810,0x18100028,0x0007E000,0x00000000,
+	0x01000101,0x00000001,0x00000000,0x01000000,0x00000007,0x00000000,0x0C000000,0x000A0000,
+	0x00001200,0x21000021,0x00210000,0x00000000,0x12000000,0x00120000,0x00001200,0x12000012,
+	0x00120000,0x00000000,0x21000000,0x00210000,0x00001100,0x0C000012,0x000C0000,0x10000000,
+	0x00100000,0x011C1000,0xE0000210,0x00000001,0x00000000,0x8080007F,0x02004001,0x10023820,
+	0x41100446,0x04411004,0x10043910,0x40200446,0x02204002,0x00001F80,0x00010000,0x1C0000E0,
+	0x00130000,0x300010E0,0x10C00010,0x00170000,0x00001800,0x000001E0,0x00000000,0xFFF00000,
+	0x01041001,0x10010410,0x04100104,0x01061001,0x0000F9E0,0x80000000,0x4040003F,0x00802000,
+	0x10010010,0x00100100,0x01001001,0x10010010,0x80200100,0x00000000,0xFFF00000,0x01001001,
+	0x10010010,0x00100100,0x01001001,0x20010010,0x40400080,0x003F8000,0x00000000,0xFFF00000,
+	0x01041001,0x10010410,0x04100104,0x01041001,0x00010010,0x00000000,0xFFF00000,0x00041001,
+	0x10000410,0x04100004,0x00041000,0x00000010,0x80000000,0x4040003F,0x00802000,0x10010010,
+	0x00100100,0x01001001,0x10010810,0xF8200108,0x00000000,0xFFF00000,0x00040001,0x00000400,
+	0x04000004,0x00040000,0x00000400,0xFFF00004,0x00000001,0x00000000,0xFFF00000,0x00000001,
+	0x00010000,0x00000100,0x01000001,0x0000FFF0,0x00000000,0xFFF00000,0x00040001,0x00000A00,
+	0x20800011,0x00404000,0x10008020,0x00000100,0x00000000,0xFFF00000,0x01000001,0x00010000,
+	0x00000100,0x01000001,0x00000000,0xFFF00000,0x00008001,0x00000300,0x1000000C,0x00200000,
+	0x00001000,0x0300000C,0x0000C000,0x0001FFF0,0x00000000,0xFFF00000,0x00004001,0x00000080,
+	0x04000003,0x00180000,0x00002000,0xFFF00040,0x00000001,0x80000000,0x4040003F,0x00802000,
+	0x10010010,0x00100100,0x01001001,0x10010010,0x80200100,0x007FC000,0x00000000,0xFFF00000,
+	0x00081001,0x10000810,0x08100008,0x00042000,0x000003C0,0x80000000,0x4040003F,0x00802000,
+	0x10010010,0x00100100,0x01001001,0x10010010,0x80200100,0x0473C002,0x00080C00,0x00000000,
+	0xFFF00000,0x00041001,0x10000410,0x3410000C,0x00421000,0x000081E0,0x00000100,0xC0000000,
+	0x02200081,0x01021001,0x10010410,0x04100104,0x00F82001,0x10000010,0x00100000,0x00001000,
+	0x1001FFF0,0x00100000,0x00001000,0x00000010,0x00000000,0x7FF00000,0x00800000,0x00010000,
+	0x00000100,0x01000001,0xF0010000,0x000000FF,0xE0000010,0x07000000,0x00180000,0x0000E000,
+	0x60000180,0x001C0000,0xF0000300,0xF0000000,0x0E000001,0x00F00000,0x00018000,0x0E000070,
+	0x0001C000,0xC0000030,0x0E000001,0x00700000,0x00018000,0x0E000070,0x0001F000,0x30000000,
+	0x60400180,0x00118000,0x00000A00,0x1180000E,0x00604000,0x10008020,0x00000100,0x60000010,
+	0x00800000,0x00030000,0x0001FC00,0x03000004,0x0000C000,0x00000030,0x10000000,0x40100180,
+	0x01301001,0x10010810,0x01900106,0x01005001,0x00010030,0x00000000,0xFFF80000,0x0800080F,
+	0x70000000,0x01800000,0x000E0000,0x00003000,0x000001C0,0x08000000,0xFFF80800,0x0000000F,
+	0x00000000,0x03000000,0x0000C000,0x20000030,0x00C00000,0x00030000,0x00080000,0x00000800,
+	0x08000008,0x00080000,0x00000800,0x00000008,0x00000000,0x00100000,0x00002000,0x00000000,
+	0x210001E2,0x01110001,0x00011100,0xFE000111,0x00000001,0x00000000,0xFFF00000,0x01010001,
+	0x00010100,0x01000101,0x00FE0001,0x00000000,0x010000FE,0x01010001,0x00010100,0x01000101,
+	0x00000001,0x00000000,0x010000FE,0x01010001,0x00010100,0x01000101,0x01FFF001,0x00000000,
+	0x090000FE,0x01090001,0x00010900,0x09000109,0x008E0001,0x00000000,0xFFF00001,0x00011001,
+	0x00000110,0x00000000,0xA100075E,0x08A10008,0x0008A100,0x9F0008A1,0x07010008,0x00000000,
+	0xFFF00000,0x00010001,0x00000100,0x01000001,0x01FE0000,0x10000000,0x000001FF,0x10080000,
+	0x00000FFF,0x00000000,0xFFF00000,0x00280001,0x00004400,0x01000082,0x00000001,0xF0000000,
+	0x000001FF,0x00000000,0xFF000000,0x00010001,0x00000100,0xFE000001,0x00010001,0x00000100,
+	0x01000001,0x01FE0000,0x00000000,0xFF000000,0x00010001,0x00000100,0x01000001,0x01FE0000,
+	0x00000000,0x010000FE,0x01010001,0x00010100,0x01000101,0x00FE0001,0x00000000,0xFF000000,
+	0x0101000F,0x00010100,0x01000101,0x00FE0001,0x00000000,0x010000FE,0x01010001,0x00010100,
+	0x01000101,0x0FFF0001,0x00000000,0xFF000000,0x00010001,0x00000100,0x00000001,0x00000000,
+	0x0900010E,0x01110001,0x00011100,0x000001E1,0x00000000,0xFFF00001,0x01010001,0x00010100,
+	0x00000000,0x000000FF,0x01000001,0x00010000,0x00000100,0x01FF0001,0x00000100,0x3000000E,
+	0x01C00000,0x00008000,0x0C000070,0x00030000,0x00000000,0x7000000F,0x01800000,0x00007000,
+	0x0300000E,0x001C0000,0x0000E000,0x380001C0,0x00070000,0x00000000,0x44000183,0x00380000,
+	0x00002800,0x010000C6,0x00000001,0x00000100,0x38000006,0x06C00008,0x00018000,0x0C000070,
+	0x00030000,0x00000000,0x41000181,0x01310001,0x00010900,0x01000107,0x00000001,0xE0000000,
+	0x77100388,0x08000804,0xF8000000,0x00000FFF,0x08000000,0xF7900800,0x03086004,0x00000000,
+	0x08000010,0x00080000,0x00000800,0x10000010,0x00100000,0x00000800,0x1001FFF0,0x00500100,
+	0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,
+	0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,
+	0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,
+	0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,
+	0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,
+	0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,
+	0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,
+	0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,
+	0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,
+	0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,
+	0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,
+	0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,
+	0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,
+	0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,
+	0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,
+	0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,
+	0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,
+	0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,
+	0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,
+	0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,
+	0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,
+	0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,
+	0x00900103,0x01FFF001,0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,
+	0x1001FFF0,0x00500100,0x01005001,0x50014C50,0x00900103,0x01FFF001,0x1001FFF0,0x00500100,
+	0x01005001,0x50014C50,0x00900103,0x01FFF001,0x00000000,0x00000FF1,0x00000000,0xFE000000,
+	0x01010000,0xE0010100,0x010007FF,0x01010001,0x00000000,0xFFC00108,0x01082001,0x10010810,
+	0x08100108,0x01001001,0x00010020,0x00000000,0x3F800000,0x00210000,0x00002100,0x21000021,
+	0x003E8000,0x30000000,0x18C00000,0x001B0000,0x0001FC00,0x1980001E,0x00186000,0x00000010,
+	0xF8000000,0x00000FE3,0x60000000,0x0890010F,0x02111002,0x10021110,0xDC100222,0x00000001,
+	0x00000000,0x00200000,0x00000000,0x00000020,0x80000000,0x4040003F,0x008E2000,0x50013190,
+	0x40500140,0x01405001,0x90014050,0x80200120,0x00404000,0x00003F80,0x90000000,0x02500001,
+	0x00025000,0x000001F0,0x00000000,0xC6000038,0x00380000,0x0000C600,0x00000000,0x04000000,
+	0x00040000,0x00000400,0x04000004,0x001C0000,0x00000000,0x08000008,0x00080000,0x00000800,
+	0x80000000,0x4040003F,0x00802000,0xD0010010,0x0450017F,0x010C5001,0x90011450,0xC0200123,
+	0x00404000,0x00003F80,0x20000000,0x00200000,0x00002000,0x20000020,0xE0000000,0x01100000,
+	0x00011000,0xE0000110,0x00000000,0x08000108,0x01080001,0x00017F80,0x08000108,0x01080001,
+	0x00010800,0x88000000,0x01440001,0x00012400,0x00000118,0x88000000,0x01040000,0x00012400,
+	0x000000D8,0x00000000,0x00000000,0x00002000,0x00000010,0x00000000,0xFF000000,0x0100000F,
+	0x00010000,0x00000100,0x00FF0001,0x00010000,0x00000100,0xE0000000,0x03F00001,0x0003F000,
+	0x1003FFF0,0x00100000,0x03FFF000,0x10000010,0x00000000,0x00000008,0x00000000,0x00000000,
+	0x0A000008,0x000C0000,0x08000000,0x01040000,0x0001F800,0x00000100,0xE0000000,0x02100001,
+	0x00021000,0xE0000210,0x00000001,0x00000000,0x6C000082,0x00D20000,0x00003C00,0x20000000,
+	0x07F00004,0x00840001,0x00006000,0x06000018,0x00C18000,0x1000B060,0xF0000088,0x00000001,
+	0x20000000,0x07F00004,0x00C40001,0x00003000,0x0300000C,0x0108C000,0x00018430,0x38000144,
+	0x00000001,0x30000000,0x04100002,0x01849000,0x00006370,0x06000018,0x00C18000,0x1000A060,
+	0xE0000098,0x00800001,0x00000000,0x40000780,0x08710008,0x00080000,0x00000800,0x00010000,
+	0x1C0000E0,0x00130100,0x340010E2,0x10C00010,0x00170000,0x00001800,0x000001E0,0x00010000,
+	0x1C0000E0,0x00130000,0x340010E0,0x10C20010,0x00170100,0x00001800,0x000001E0,0x00010000,
+	0x1C0000E0,0x00130400,0x310010E2,0x10C60010,0x00170000,0x00001800,0x000001E0,0x00010000,
+	0x1C0000E0,0x00130400,0x340010E2,0x10C40010,0x00170200,0x00001800,0x000001E0,0x00010000,
+	0x1C0000E0,0x00130200,0x300010E0,0x10C20010,0x00170000,0x00001800,0x000001E0,0x00010000,
+	0x1C0000E0,0x00130000,0x390010E6,0x10C60010,0x00170000,0x00001800,0x000001E0,0x00010000,
+	0x200000C0,0x001C0000,0x80001300,0x10600010,0x0013D000,0x1001EC10,0x04100104,0x01041001,
+	0x10010410,0x00100104,0x00000001,0x80000000,0x4040003F,0x00802000,0x10010010,0x00100900,
+	0x0D00100A,0x10010010,0x80200100,0x00000000,0xFFF00000,0x01041101,0x14010412,0x04100104,
+	0x01041001,0x00010010,0x00000000,0xFFF00000,0x01041001,0x14010410,0x04120104,0x01041101,
+	0x00010010,0x00000000,0xFFF00000,0x01041401,0x11010416,0x04120104,0x01041401,0x00010010,
+	0x00000000,0xFFF00000,0x01041201,0x10010410,0x04100104,0x01041201,0x00010010,0x02000001,
+	0xFFF40000,0x00000001,0x04000000,0xFFF40000,0x00000201,0x02000004,0xFFF30000,0x00000401,
+	0x00000002,0xFFF00000,0x00000201,0x00000400,0xFFF00004,0x01041001,0x10010410,0x00100100,
+	0x01001001,0x20010010,0x40400080,0x003F8000,0x00000000,0xFFF00000,0x00004001,0x02000084,
+	0x04020003,0x00180400,0x00002002,0xFFF00040,0x00000001,0x80000000,0x4040003F,0x00802000,
+	0x12010011,0x00140100,0x01001001,0x10010010,0x80200100,0x007FC000,0x80000000,0x4040003F,
+	0x00802000,0x10010010,0x00140100,0x01001201,0x10010011,0x80200100,0x007FC000,0x80000000,
+	0x4040003F,0x00802000,0x16010010,0x00110100,0x01001201,0x10010014,0x80200100,0x007FC000,
+	0x80000000,0x4040003F,0x00802000,0x12010014,0x00120100,0x01001401,0x10010012,0x80200100,
+	0x007FC000,0x80000000,0x4040003F,0x00802000,0x12010010,0x00100100,0x01001001,0x10010012,
+	0x80200100,0x007FC000,0x00000000,0x61800000,0x00120000,0x00000C00,0x1200000C,0x00618000,
+	0x80000000,0x4040023F,0x00C02001,0x10012010,0x0C100110,0x01021001,0x50010190,0x80600100,
+	0x007F9000,0x00000000,0x7FF00000,0x00800000,0x02010001,0x00040100,0x01000001,0xF0010000,
+	0x000000FF,0x00000000,0x7FF00000,0x00800000,0x04010000,0x00040100,0x01000201,0xF0010001,
+	0x000000FF,0x00000000,0x7FF00000,0x00800000,0x02010004,0x00030100,0x01000401,0xF0010000,
+	0x000000FF,0x00000000,0x7FF00000,0x00800000,0x00010002,0x00000100,0x01000201,0xF0010000,
+	0x000000FF,0x60000010,0x00800000,0x00030000,0x0201FC04,0x03010004,0x0000C100,0x00000030,
+	0x00000000,0xFFF00000,0x00408001,0x80004080,0x40800040,0x00210000,0x00001E00,0x00000000,
+	0xFFE00000,0x01001001,0x10010410,0x1110010A,0x01F0E001,0x00000000,0x210001E2,0x01113001,
+	0x00011140,0xFE000111,0x00000001,0x00000000,0x210001E2,0x01114001,0x00011130,0xFE000111,
+	0x00000001,0x00000000,0x212001E2,0x01111001,0x20011110,0xFE000111,0x00000001,0x00000000,
+	0x213001E2,0x01111001,0x10011120,0xFE000111,0x00000001,0x00000000,0x212001E2,0x01110001,
+	0x20011100,0xFE000111,0x00000001,0x00000000,0x212001E2,0x01115001,0x20011150,0xFE000111,
+	0x00000001,0x00000000,0x110001E2,0x01090001,0x00010900,0x7E000089,0x00890000,0x00010900,
+	0x09000109,0x01090001,0x00000E00,0x00000000,0x010000FE,0x09010001,0x000A0100,0x01000D01,
+	0x00000001,0x00000000,0x090000FE,0x01091001,0x00010920,0x09000109,0x008E0001,0x00000000,
+	0x090000FE,0x01090001,0x10010920,0x09000109,0x008E0001,0x00000000,0x090000FE,0x01092001,
+	0x20010910,0x09400109,0x008E0001,0x00000000,0x090000FE,0x01092001,0x00010900,0x09200109,
+	0x008E0001,0x30000010,0x000001FF,0x20000000,0x001001FF,0x10000020,0x002001FF,0x00004000,
+	0x00000020,0x002001FF,0x00000000,0x020000FC,0x01011001,0x20010150,0x02500101,0x00FF8001,
+	0x00000000,0xFF200000,0x00011001,0x20000110,0x01100001,0x01FE0000,0x00000000,0x010000FE,
+	0x01011001,0x00010120,0x01000101,0x00FE0001,0x00000000,0x010000FE,0x01010001,0x10010120,
+	0x01000101,0x00FE0001,0x00000000,0x010000FE,0x01012001,0x20010110,0x01400101,0x00FE0001,
+	0x00000000,0x012000FE,0x01011001,0x20010110,0x01100101,0x00FE0001,0x00000000,0x010000FE,
+	0x01012001,0x00010100,0x01200101,0x00FE0001,0x00000000,0x08000008,0x00080000,0x00004900,
+	0x08000008,0x00080000,0x00000800,0x00000000,0x810001FE,0x01410001,0x00013100,0x05000109,
+	0x00FF0001,0x00000000,0x000000FF,0x01001001,0x00010020,0x00000100,0x01FF0001,0x00000000,
+	0x000000FF,0x01000001,0x10010020,0x00000100,0x01FF0001,0x00000000,0x000000FF,0x01002001,
+	0x20010010,0x00400100,0x01FF0001,0x00000000,0x000000FF,0x01002001,0x00010000,0x00200100,
+	0x01FF0001,0x00000100,0x38000006,0x06C00008,0x10018020,0x0C000070,0x00030000,0x00000000,
+	0xFFF00000,0x0101000F,0x00010100,0x01000101,0x00FE0001,0x00000100,0x38000006,0x06C02008,
+	0x20018000,0x0C000070,0x00030000
+};
+const IndexedFont Lato_Hairline_17_Indexed = {Lato_Hairline_17, Lato_Hairline_17_glyphs, Lato_Hairline_17_data, 32, 224, 21};
+
+const uint32_t Lato_Hairline_18_glyphs[] PROGMEM = {
+	0x05000000,	// 32
+	0x04090000,	// 33
+	0x060B0003,	// 34
+	0x0A1D0006,	// 35
+	0x0A1B000E,	// 36
+	0x0E270015,	// 37
+	0x0C24001F,	// 38
+	0x03050028,	// 39
+	0x050C002A,	// 40
+	0x0509002D,	// 41
+	0x08110030,	// 42
+	0x0A1A0035,	// 43
+	0x0409003C,	// 44
+	0x070E003F,	// 45
+	0x04090043,	// 46
+	0x08130046,	// 47
+	0x0A1D004B,	// 48
+	0x0A1B0053,	// 49
+	0x0A1B005A,	// 50
+	0x0A1B0061,	// 51
+	0x0A1D0068,	// 52
+	0x0A1A0070,	// 53
+	0x0A1B0077,	// 54
+	0x0A1C007E,	// 55
+	0x0A1B0085,	// 56
+	0x0A1A008C,	// 57
+	0x04090093,	// 58
+	0x04090096,	// 59
+	0x0A170099,	// 60
+	0x0A1A009F,	// 61
+	0x0A1A00A6,	// 62
+	0x081400AD,	// 63
+	0x0F2900B2,	// 64
+	0x0B2100BD,	// 65
+	0x0B1E00C6,	// 66
+	0x0C2400CE,	// 67
+	0x0E2300D7,	// 68
+	0x0A1B00E0,	// 69
+	0x0A1A00E7,	// 70
+	0x0D2400EE,	// 71
+	0x0D2100F7,	// 72
+	0x04090100,	// 73
+	0x070F0103,	// 74
+	0x0B210107,	// 75
+	0x091B0110,	// 76
+	0x102A0117,	// 77
+	0x0D210122,	// 78
+	0x0E26012B,	// 79
+	0x0A1A0135,	// 80
+	0x0E27013C,	// 81
+	0x0B1E0146,	// 82
+	0x0A18014E,	// 83
+	0x0A1C0154,	// 84
+	0x0D20015B,	// 85
+	0x0B1F0163,	// 86
+	0x1232016B,	// 87
+	0x0B1E0178,	// 88
+	0x0A1C0180,	// 89
+	0x0B1E0187,	// 90
+	0x050C018F,	// 91
+	0x08150192,	// 92
+	0x05090198,	// 93
+	0x0A1A019B,	// 94
+	0x081801A2,	// 95
+	0x070A01A8,	// 96
+	0x091501AB,	// 97
+	0x0A1A01B1,	// 98
+	0x081801B8,	// 99
+	0x0A1801BE,	// 100
+	0x091801C4,	// 101
+	0x061001CA,	// 102
+	0x091801CE,	// 103
+	0x0A1801D4,	// 104
+	0x040601DA,	// 105
+	0x040601DC,	// 106
+	0x081801DE,	// 107
+	0x040601E4,	// 108
+	0x0E2701E6,	// 109
+	0x0A1801F0,	// 110
+	0x0A1A01F6,	// 111
+	0x0A1A01FD,	// 112
+	0x0A180204,	// 113
+	0x0611020A,	// 114
+	0x0815020F,	// 115
+	0x06120215,	// 116
+	0x0A18021A,	// 117
+	0x09170220,	// 118
+	0x0D260226,	// 119
+	0x08150230,	// 120
+	0x09170236,	// 121
+	0x0815023C,	// 122
+	0x050C0242,	// 123
+	0x04090245,	// 124
+	0x050C0248,	// 125
+	0x0A1A024B,	// 126
+	0x09180252,	// 127
+	0x09180258,	// 128
+	0x0918025E,	// 129
+	0x09180264,	// 130
+	0x0918026A,	// 131
+	0x09180270,	// 132
+	0x09180276,	// 133
+	0x0918027C,	// 134
+	0x09180282,	// 135
+	0x09180288,	// 136
+	0x0918028E,	// 137
+	0x09180294,	// 138
+	0x0918029A,	// 139
+	0x091802A0,	// 140
+	0x091802A6,	// 141
+	0x091802AC,	// 142
+	0x091802B2,	// 143
+	0x091802B8,	// 144
+	0x091802BE,	// 145
+	0x091802C4,	// 146
+	0x091802CA,	// 147
+	0x091802D0,	// 148
+	0x091802D6,	// 149
+	0x091802DC,	// 150
+	0x091802E2,	// 151
+	0x091802E8,	// 152
+	0x091802EE,	// 153
+	0x091802F4,	// 154
+	0x091802FA,	// 155
+	0x09180300,	// 156
+	0x09180306,	// 157
+	0x0918030C,	// 158
+	0x09180312,	// 159
+	0x05000000,	// 160
+	0x04060318,	// 161
+	0x0A1B031A,	// 162
+	0x0A1E0321,	// 163
+	0x0A1A0329,	// 164
+	0x0A1A0330,	// 165
+	0x04090337,	// 166
+	0x0915033A,	// 167
+	0x07100340,	// 168
+	0x0F290344,	// 169
+	0x070E034F,	// 170
+	0x070F0353,	// 171
+	0x0A1A0357,	// 172
+	0x070E035E,	// 173
+	0x0F290362,	// 174
+	0x0710036D,	// 175
+	0x07110371,	// 176
+	0x0A1B0376,	// 177
+	0x060E037D,	// 178
+	0x060E0381,	// 179
+	0x070D0385,	// 180
+	0x0B210389,	// 181
+	0x0B1F0392,	// 182
+	0x0408039A,	// 183
+	0x070F039C,	// 184
+	0x060E03A0,	// 185
+	0x071103A4,	// 186
+	0x071103A9,	// 187
+	0x0D2403AE,	// 188
+	0x0D2403B7,	// 189
+	0x0D2403C0,	// 190
+	0x071203C9,	// 191
+	0x0B2103CE,	// 192
+	0x0B2103D7,	// 193
+	0x0B2103E0,	// 194
+	0x0B2103E9,	// 195
+	0x0B2103F2,	// 196
+	0x0B2103FB,	// 197
+	0x11300404,	// 198
+	0x0C240410,	// 199
+	0x0A1B0419,	// 200
+	0x0A1B0420,	// 201
+	0x0A1B0427,	// 202
+	0x0A1B042E,	// 203
+	0x04090435,	// 204
+	0x040A0438,	// 205
+	0x040A043B,	// 206
+	0x040A043E,	// 207
+	0x0E260441,	// 208
+	0x0D21044B,	// 209
+	0x0E260454,	// 210
+	0x0E26045E,	// 211
+	0x0E260468,	// 212
+	0x0E260472,	// 213
+	0x0E26047C,	// 214
+	0x0A1A0486,	// 215
+	0x0E26048D,	// 216
+	0x0D200497,	// 217
+	0x0D20049F,	// 218
+	0x0D2004A7,	// 219
+	0x0D2004AF,	// 220
+	0x0A1C04B7,	// 221
+	0x0A1A04BE,	// 222
+	0x0A1B04C5,	// 223
+	0x091504CC,	// 224
+	0x091504D2,	// 225
+	0x091504D8,	// 226
+	0x091504DE,	// 227
+	0x091504E4,	// 228
+	0x091504EA,	// 229
+	0x0E2704F0,	// 230
+	0x081804FA,	// 231
+	0x09180500,	// 232
+	0x09180506,	// 233
+	0x0918050C,	// 234
+	0x09180512,	// 235
+	0x04070518,	// 236
+	0x0407051A,	// 237
+	0x040A051C,	// 238
+	0x0407051F,	// 239
+	0x0A1A0521,	// 240
+	0x0A180528,	// 241
+	0x0A1A052E,	// 242
+	0x0A1A0535,	// 243
+	0x0A1A053C,	// 244
+	0x0A1A0543,	// 245
+	0x0A1A054A,	// 246
+	0x0A1A0551,	// 247
+	0x0A1A0558,	// 248
+	0x0A18055F,	// 249
+	0x0A180565,	// 250
+	0x0A18056B,	// 251
+	0x0A180571,	// 252
+	0x09170577,	// 253
+	0x0A1A057D,	// 254
+	0x09170584	// 255
+};
+const uint32_t Lato_Hairline_18_data[] PROGMEM = {
+	0x00000000,0x1FE00000,0x00000002,0x00000000,0x01E00000,0x0001E000,0x00000000,0xE2000022,
+	0x003E0003,0x000021E0,0x7E0003A2,0x0023C000,0x00002220,0x00000002,0x00000000,0x03C00000,
+	0x02042001,0xF8020420,0x08200FFF,0x02102002,0x0001F000,0xC0000000,0x08200007,0x01082002,
+	0xC000C820,0x18000027,0x00E40000,0x80031300,0x08600208,0x02080002,0x0001F000,0x00000000,
+	0x100001E0,0x020BC002,0x20020420,0x10200208,0x02202002,0x00014040,0x300000C0,0x02000001,
+	0xE0000000,0x00000001,0x00000000,0x00C001FF,0x08003006,0x70000000,0xFF800C00,0x00000003,
+	0x00000000,0x01400000,0x0003E000,0x40000080,0x00000001,0x00000000,0x08000008,0x00080000,
+	0x80000800,0x080000FF,0x00080000,0x00000800,0x00000000,0x00000A00,0x00000004,0x00000000,
+	0x10000010,0x00100000,0x00001000,0x00000000,0x00000000,0x00000002,0x00000000,0xC0000300,
+	0x00380000,0x80000600,0x00600001,0x80000000,0x004000FF,0x02002001,0x20020020,0x00200200,
+	0x02002002,0x000180C0,0x0000007F,0x00000000,0x01000000,0x02008000,0xE0020040,0x000003FF,
+	0x02000002,0x00020000,0x80000000,0x00400200,0x02802003,0x20024020,0x10200220,0x02082002,
+	0x000207C0,0x80000000,0x00400180,0x02002002,0x20020020,0x08200208,0x02142002,0x0001F3C0,
+	0x00000000,0x58000060,0x00440000,0x80004300,0x40600040,0x03FF8000,0x00004000,0x00000040,
+	0x00000000,0x07C00000,0x02042002,0x20020420,0x04200204,0x01082002,0x0000F020,0x00000000,
+	0x0C0000F0,0x020A0001,0xC0020500,0x04200204,0x02080002,0x0001F800,0x20000000,0x00200000,
+	0x03002000,0x2000C020,0x0C200030,0x00032000,0x200000E0,0x80000000,0x164001E1,0x02082002,
+	0x20020820,0x08200208,0x02142002,0x0001F3C0,0x80000000,0x08400007,0x02102000,0x20011020,
+	0x302000D0,0x00182000,0x000007C0,0x00000000,0x02000000,0x00000002,0x00000000,0x02000000,
+	0x0000000E,0x00000000,0x18000000,0x00180000,0x00002400,0x42000024,0x00420000,0x00000000,
+	0x24000000,0x00240000,0x00002400,0x24000024,0x00240000,0x00002400,0x00000000,0x42000000,
+	0x00420000,0x00004200,0x24000024,0x00180000,0x00001000,0x20000000,0x00200000,0x02382000,
+	0x20000420,0x01C00002,0x00000000,0x020001FC,0x04010002,0x4008E080,0x08401110,0x11044011,
+	0x40108440,0x0080117C,0x09008011,0x00088100,0x0000007E,0x00020000,0x300001C0,0x002E0000,
+	0x60002180,0x20800020,0x00270000,0x00003800,0x000000C0,0x00000003,0x00000000,0xFFE00000,
+	0x02082003,0x20020820,0x08200208,0x02082002,0x80021640,0x000001E1,0x00000000,0x8080007F,
+	0x01004000,0x20020020,0x00200200,0x02002002,0x20020020,0x00400200,0x01004001,0x00000000,
+	0xFFE00000,0x02002003,0x20020020,0x00200200,0x02002002,0x20020020,0x00400200,0x00FF8001,
+	0x00000000,0xFFE00000,0x02082003,0x20020820,0x08200208,0x02082002,0x00020020,0x00000000,
+	0xFFE00000,0x00082003,0x20000820,0x08200008,0x00082000,0x00000820,0x00000000,0x8080007F,
+	0x01004000,0x20020020,0x00200200,0x02002002,0x20020020,0x10200210,0x01F04002,0x00000000,
+	0xFFE00000,0x00080003,0x00000800,0x08000008,0x00080000,0x00000800,0xFFE00008,0x00000003,
+	0x00000000,0xFFE00000,0x00000003,0x00020000,0x00000200,0x02000002,0x0001FFE0,0x00000000,
+	0xFFE00000,0x00080003,0x00001400,0x41000022,0x00808000,0x20010040,0x00000100,0x00000002,
+	0x00000000,0xFFE00000,0x02000003,0x00020000,0x00000200,0x02000002,0x00020000,0x00000000,
+	0xFFE00000,0x00008003,0x00000300,0x3000000C,0x00400000,0x00004000,0x0C000030,0x00030000,
+	0xE0000080,0x000003FF,0x00000000,0xFFE00000,0x00008003,0x00000100,0x0C000002,0x00100000,
+	0x00006000,0xFFE00080,0x00000003,0x00000000,0x8080007F,0x01004000,0x20020020,0x00200200,
+	0x02002002,0x20020020,0x00400200,0x00808001,0x00007F00,0x00000000,0xFFE00000,0x00102003,
+	0x20001020,0x10200010,0x00082000,0x000007C0,0x00000000,0x8080007F,0x01004000,0x20020020,
+	0x00200200,0x02002002,0x20020020,0x00400200,0x08808005,0x00107F00,0x00000000,0xFFE00000,
+	0x00082003,0x20000820,0x28200018,0x00442000,0x000183C0,0x00000200,0x80000000,0x02400101,
+	0x02042002,0x20020820,0x08200208,0x01F02002,0x20000020,0x00200000,0x00002000,0xE0000020,
+	0x002003FF,0x00002000,0x20000020,0x00000000,0xFFE00000,0x01000000,0x00020000,0x00000200,
+	0x02000002,0x00020000,0xFFE00100,0xC0000020,0x06000001,0x00380000,0x0000C000,0x80000300,
+	0x00700000,0x80000C00,0x00600003,0xE0000000,0x1E000001,0x00E00000,0x00030000,0x380000C0,
+	0x00070000,0xC00000E0,0x07000000,0x00380000,0x0001C000,0xE0000300,0x001E0000,0x000001E0,
+	0x60000000,0x80800300,0x00610000,0x00001600,0x3200000C,0x00410000,0x200080C0,0x00000300,
+	0x40000020,0x01800000,0x00060000,0x00000800,0x040003F8,0x00030000,0x200000C0,0x20000000,
+	0x80200300,0x02602002,0x20021020,0x06200208,0x02012002,0x200200E0,0x00000200,0x00000000,
+	0xFFF00000,0x1000101F,0xE0000000,0x03000000,0x000C0000,0x00007000,0x00000180,0x00000002,
+	0x10000000,0xFFF01000,0x0000001F,0x00000000,0x06000000,0x00018000,0x60000040,0x00800000,
+	0x00030000,0x00000400,0x00100000,0x00001000,0x10000010,0x00100000,0x00001000,0x10000010,
+	0x00000000,0x00200000,0x00004000,0x00000000,0x420003C4,0x02220002,0x00022200,0xFC000222,
+	0x00000003,0x00000000,0xFFE00000,0x02020003,0x00020200,0x02000202,0x01040002,0x0000F800,
+	0x00000000,0x040001F8,0x02020002,0x00020200,0x02000202,0x01000002,0x00000000,0x040001F8,
+	0x02020002,0x00020200,0x02000202,0x03FFE002,0x00000000,0x120000FC,0x02120001,0x00021200,
+	0x12000212,0x021C0002,0x00000000,0xFFC00002,0x00022003,0x20000220,0x00000000,0x62000E9C,
+	0x11420011,0x00114200,0x22001142,0x0E1E0011,0x00000000,0xFFE00000,0x00020003,0x00000200,
+	0x02000002,0x03FC0000,0x20000000,0x000003FE,0x20100000,0x00001FFE,0x00000000,0xFFE00000,
+	0x00500003,0x00008800,0x02000104,0x02000001,0xE0000000,0x000003FF,0x00000000,0xFE000000,
+	0x00020003,0x00000200,0x02000002,0x03FC0000,0x00000200,0x02000002,0x00020000,0x0003FC00,
+	0x00000000,0xFE000000,0x00020003,0x00000200,0x02000002,0x03FC0000,0x00000000,0x040000F8,
+	0x02020001,0x00020200,0x02000202,0x01040002,0x0000F800,0x00000000,0xFE000000,0x0202001F,
+	0x00020200,0x02000202,0x01040002,0x0000F800,0x00000000,0x040001F8,0x02020002,0x00020200,
+	0x02000202,0x1FFE0002,0x00000000,0xFE000000,0x00020003,0x00000200,0x00000002,0x00000000,
+	0x1200021C,0x02220002,0x00022200,0xC0000222,0x00000001,0x00000000,0xFFE00002,0x02020003,
+	0x00020200,0x00000200,0x00000000,0xFE000000,0x02000003,0x00020000,0x00000200,0x03FE0002,
+	0x00000200,0x7000000C,0x01800000,0x00020000,0x300001C0,0x000E0000,0x00000000,0xE000001E,
+	0x03000000,0x0000C000,0x06000038,0x00180000,0x0000E000,0xC0000300,0x00380000,0x00000600,
+	0x00000000,0x88000306,0x00500000,0x00007000,0x06000088,0x00000003,0x00000000,0x3000000E,
+	0x19C00000,0x00070000,0x300000C0,0x000E0000,0x00000000,0x82000302,0x02620002,0x00021200,
+	0x0600020A,0x00000002,0xC0000000,0xEF200610,0x10001009,0x00000000,0xFFF00000,0x0000001F,
+	0x10000000,0xEE101000,0x0F11E010,0x00000000,0x10000020,0x00100000,0x00001000,0x20000020,
+	0x00200000,0x00001000,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,
+	0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,
+	0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,
+	0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,
+	0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,
+	0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,
+	0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,
+	0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,
+	0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,
+	0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,
+	0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,
+	0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,
+	0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,
+	0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,
+	0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,
+	0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,
+	0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,
+	0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,
+	0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,
+	0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,
+	0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,
+	0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,
+	0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,
+	0x0200A002,0xA00298A0,0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,
+	0x03200204,0x03FFE002,0x2003FFE0,0x00A00200,0x0200A002,0xA00298A0,0x03200204,0x03FFE002,
+	0x00000000,0x00001FE2,0x00000000,0xFC000000,0x02020001,0x00020200,0x01C00FFE,0x02020002,
+	0x00020200,0x00000000,0xFF800210,0x02104003,0x20021020,0x10200210,0x02002002,0x00020040,
+	0x00000200,0x00000000,0x7F000000,0x00220000,0x00004200,0x42000042,0x00260000,0x00005900,
+	0x20000000,0x30C00000,0x00330000,0x00003C00,0x360003F8,0x00318000,0x00003060,0x00000000,
+	0xC7F00000,0x0000001F,0x80000000,0x1360020C,0x04222004,0x20042220,0xFC200442,0x00000003,
+	0x00000000,0x00400000,0x00000000,0x40000000,0x00000000,0xC180003E,0x01084000,0x20023620,
+	0x80A00241,0x0280A002,0xA00280A0,0x41200280,0x01004002,0x00008080,0x0000007F,0x00000000,
+	0x04A00003,0x0004A000,0x000003E0,0x00000000,0x88000070,0x01740000,0x00018C00,0x00000000,
+	0x08000000,0x00080000,0x00000800,0x08000008,0x00080000,0x00003800,0x00000000,0x10000010,
+	0x00100000,0x00001000,0x00000000,0xC180003E,0x01004000,0xA0020020,0x08A002FF,0x0208A002,
+	0x200238A0,0x80200247,0x01004002,0x00008080,0x0000007F,0x40000000,0x00400000,0x00004000,
+	0x40000040,0xC0000000,0x02200001,0x00022000,0xE0000220,0x00000001,0x00000000,0x10000210,
+	0x02100002,0x00021000,0x100002FF,0x02100002,0x00021000,0x10000000,0x03080002,0x00028800,
+	0x00000270,0x10000000,0x02080001,0x00024800,0x000001B0,0x00000000,0x00000000,0x00004000,
+	0x00000020,0x00000000,0xFE000000,0x0200001F,0x00020000,0x00000200,0x01000002,0x0003FE00,
+	0x00000200,0x00000002,0xC0000000,0x07E00003,0x0007E000,0x2007FFE0,0x00200000,0x00002000,
+	0x2007FFE0,0x00200000,0x00000000,0x10000000,0x00000000,0x00000000,0x14000010,0x00180000,
+	0x10000000,0x02080000,0x0003F000,0x00000200,0xC0000000,0x04200003,0x00042000,0xE0000420,
+	0x00000003,0x00000000,0xD8000104,0x01240000,0x0000D800,0x00000020,0x40000000,0x0FE00008,
+	0x03080000,0x0000C000,0x08000030,0x01060000,0x6001C180,0xF0000120,0x01000003,0x40000000,
+	0x0FE00008,0x01880002,0x00006800,0x0C000010,0x00030000,0x200210C0,0xC8000308,0x02300002,
+	0x40000000,0x08200004,0x02092000,0x000186E0,0x18000060,0x00060000,0x4001C180,0xF0200120,
+	0x01000003,0x00000000,0x80000F00,0x10820010,0x00106200,0x00001000,0x00020000,0x300001C0,
+	0x002E0200,0x68002184,0x20900020,0x00270000,0x00003800,0x000000C0,0x00000003,0x00020000,
+	0x300001C0,0x002E0000,0x68002180,0x20840020,0x00270200,0x00003802,0x000000C0,0x00000003,
+	0x00020000,0x300001C0,0x002E0000,0x6200218C,0x20840020,0x00270800,0x00003800,0x000000C0,
+	0x00000003,0x00020000,0x300001C0,0x002E0800,0x64002184,0x20880020,0x00270400,0x00003800,
+	0x000000C0,0x00000003,0x00020000,0x300001C0,0x002E0000,0x60002184,0x20800020,0x00270400,
+	0x00003800,0x000000C0,0x00000003,0x00020000,0x300001C0,0x002E0000,0x7200218C,0x208C0020,
+	0x00270000,0x00003800,0x000000C0,0x00000003,0x00020000,0x40000180,0x00380000,0x00002400,
+	0x20C00023,0x0020E000,0x2000FF20,0x08200308,0x02082002,0x20020820,0x08200208,0x02002002,
+	0x00000000,0x8080007F,0x01004000,0x20020020,0x00200200,0x1A002014,0x201A0020,0x00400200,
+	0x01004001,0x00000000,0xFFE00000,0x02082203,0x28020824,0x08280208,0x02082002,0x00020020,
+	0x00000000,0xFFE00000,0x02082003,0x28020820,0x08240208,0x02082402,0x00020022,0x00000000,
+	0xFFE00000,0x02082003,0x26020828,0x08240208,0x02082802,0x00020020,0x00000000,0xFFE00000,
+	0x02082003,0x20020824,0x08200208,0x02082402,0x00020020,0x04000002,0xFFE80000,0x00000003,
+	0x00000000,0xFFE80000,0x00000403,0x04000008,0xFFE60000,0x00000803,0x00000004,0xFFE00000,
+	0x00000403,0x00000800,0xFFE00008,0x02082003,0x20020820,0x00200208,0x02002002,0x20020020,
+	0x00400200,0x00C18001,0x00003E00,0x00000000,0xFFE00000,0x00008003,0x04000108,0x0C040002,
+	0x00100800,0x04006008,0xFFE00080,0x00000003,0x00000000,0x8080007F,0x01004000,0x22020020,
+	0x00240200,0x02002802,0x20020020,0x00400200,0x00808001,0x00007F00,0x00000000,0x8080007F,
+	0x01004000,0x20020020,0x00280200,0x02002802,0x22020024,0x00400200,0x00808001,0x00007F00,
+	0x00000000,0x8080007F,0x01004000,0x28020020,0x00240200,0x02002602,0x20020028,0x00400200,
+	0x00808001,0x00007F00,0x00000000,0x8080007F,0x01004000,0x24020028,0x00240200,0x02002802,
+	0x24020028,0x00400200,0x00808001,0x00007F00,0x00000000,0x8080007F,0x01004000,0x24020020,
+	0x00200200,0x02002002,0x20020024,0x00400200,0x00808001,0x00007F00,0x00000000,0xC3000000,
+	0x00240000,0x00001800,0x24000018,0x00420000,0x00008100,0x00000000,0x8080007F,0x01004006,
+	0x2002C020,0x10200220,0x020C2002,0x20020220,0x00C00201,0x0080A001,0x00007F00,0x00000000,
+	0xFFE00000,0x01000000,0x04020002,0x00080200,0x02000002,0x00020000,0xFFE00100,0x00000000,
+	0xFFE00000,0x01000000,0x00020000,0x00080200,0x02000402,0x00020002,0xFFE00100,0x00000000,
+	0xFFE00000,0x01000000,0x04020008,0x00020200,0x02000402,0x00020008,0xFFE00100,0x00000000,
+	0xFFE00000,0x01000000,0x00020004,0x00000200,0x02000002,0x00020004,0xFFE00100,0x40000020,
+	0x01800000,0x00060000,0x08000808,0x040403F8,0x00030200,0x200000C0,0x00000000,0xFFE00000,
+	0x00810003,0x00008100,0x81000081,0x00420000,0x00003E00,0x00000000,0xFFC00000,0x02002003,
+	0x20020820,0x22200214,0x02214002,0x0001C080,0x00000000,0x420003C4,0x02222002,0x00022240,
+	0xFC000222,0x00000003,0x00000000,0x420003C4,0x02220002,0x20022240,0xFC000222,0x00000003,
+	0x00000000,0x424003C4,0x02222002,0x40022220,0xFC000222,0x00000003,0x00000000,0x426003C4,
+	0x02222002,0x40022240,0xFC200222,0x00000003,0x00000000,0x424003C4,0x02220002,0x40022200,
+	0xFC000222,0x00000003,0x00000000,0x424003C4,0x0222A002,0x600222A0,0xFC000222,0x00000003,
+	0x00000000,0x220003C4,0x02120002,0x00021200,0xFC000212,0x01140001,0x00021200,0x12000212,
+	0x02120002,0x00021C00,0x00000000,0x040001F8,0x12020002,0x00140200,0x02001A02,0x0100001A,
+	0x00000000,0x120000FC,0x02120001,0x80021260,0x12000212,0x021C0002,0x00000000,0x120000FC,
+	0x02120001,0x60021280,0x12000212,0x021C0002,0x00000000,0x120000FC,0x02124001,0x20021220,
+	0x12400212,0x021C0002,0x00000000,0x120000FC,0x02124001,0x00021200,0x12400212,0x021C0002,
+	0x60000000,0x008003FE,0x80000000,0x006003FE,0x20000040,0x002003FE,0x00004000,0x00000040,
+	0x004003FE,0x00000000,0x040000F8,0x02022001,0xC0020220,0x02600202,0x01058002,0x0000FE00,
+	0x00000000,0xFE400000,0x00022003,0x40000220,0x02200002,0x03FC0000,0x00000000,0x040000F8,
+	0x02020001,0x80020260,0x02000202,0x01040002,0x0000F800,0x00000000,0x040000F8,0x02020001,
+	0x60020280,0x02000202,0x01040002,0x0000F800,0x00000000,0x040000F8,0x02024001,0x20020220,
+	0x02400202,0x01040002,0x0000F800,0x00000000,0x040000F8,0x02026001,0x40020220,0x02600202,
+	0x01040002,0x0000F800,0x00000000,0x040000F8,0x02024001,0x00020200,0x02400202,0x01040002,
+	0x0000F800,0x00000000,0x10000010,0x00100000,0x00001000,0x10000092,0x00100000,0x00001000,
+	0x00000000,0x040003F8,0x02820003,0x00024200,0x0A000232,0x01040002,0x0000FA00,0x00000000,
+	0xFE000000,0x02000003,0x80020060,0x00000200,0x03FE0002,0x00000000,0xFE000000,0x02000003,
+	0x60020080,0x00000200,0x03FE0002,0x00000000,0xFE000000,0x02004003,0x20020020,0x00400200,
+	0x03FE0002,0x00000000,0xFE000000,0x02004003,0x00020000,0x00400200,0x03FE0002,0x00000000,
+	0x3000000E,0x19C00000,0x20070040,0x300000C0,0x000E0000,0x00000000,0xFFE00000,0x0202001F,
+	0x00020200,0x02000202,0x01040002,0x0000F800,0x00000000,0x3000000E,0x19C04000,0x00070000,
+	0x304000C0,0x000E0000
+};
+const IndexedFont Lato_Hairline_18_Indexed = {Lato_Hairline_18, Lato_Hairline_18_glyphs, Lato_Hairline_18_data, 32, 224, 22};
+
+const uint32_t Lato_Hairline_38_glyphs[] PROGMEM = {
+	0x0B000000,	// 32
+	0x09230000,	// 33
+	0x0C330009,	// 34
+	0x16750016,	// 35
+	0x16710034,	// 36
+	0x1DA10051,	// 37
+	0x1A95007A,	// 38
+	0x071500A0,	// 39
+	0x0A3000A6,	// 40
+	0x0A2900B2,	// 41
+	0x104B00BD,	// 42
+	0x167600D0,	// 43
+	0x081E00EE,	// 44
+	0x0E4000F6,	// 45
+	0x09230106,	// 46
+	0x1050010F,	// 47
+	0x16760123,	// 48
+	0x16710141,	// 49
+	0x1671015E,	// 50
+	0x1671017B,	// 51
+	0x167C0198,	// 52
+	0x167001B7,	// 53
+	0x167101D3,	// 54
+	0x167401F0,	// 55
+	0x1671020D,	// 56
+	0x166F022A,	// 57
+	0x09230246,	// 58
+	0x0923024F,	// 59
+	0x16640258,	// 60
+	0x16700271,	// 61
+	0x1670028D,	// 62
+	0x105102A9,	// 63
+	0x1FAC02BE,	// 64
+	0x188902E9,	// 65
+	0x187D030C,	// 66
+	0x1A8F032C,	// 67
+	0x1D9A0350,	// 68
+	0x16770377,	// 69
+	0x15740395,	// 70
+	0x1C9503B2,	// 71
+	0x1C8F03D8,	// 72
+	0x091D03FC,	// 73
+	0x0F410404,	// 74
+	0x17890415,	// 75
+	0x136B0438,	// 76
+	0x22AD0453,	// 77
+	0x1C8F047F,	// 78
+	0x1EA004A3,	// 79
+	0x156F04CB,	// 80
+	0x1EA804E7,	// 81
+	0x16830511,	// 82
+	0x146B0532,	// 83
+	0x167A054D,	// 84
+	0x1B89056C,	// 85
+	0x1886058F,	// 86
+	0x26DA05B1,	// 87
+	0x178305E8,	// 88
+	0x167A0609,	// 89
+	0x177D0628,	// 90
+	0x0B360648,	// 91
+	0x10530656,	// 92
+	0x0B2A066B,	// 93
+	0x16690676,	// 94
+	0x11600691,	// 95
+	0x0F3206A9,	// 96
+	0x125906B6,	// 97
+	0x156B06CD,	// 98
+	0x125F06E8,	// 99
+	0x15650700,	// 100
+	0x146A071A,	// 101
+	0x0D450735,	// 102
+	0x136C0747,	// 103
+	0x15650762,	// 104
+	0x081A077C,	// 105
+	0x081A0783,	// 106
+	0x115F078A,	// 107
+	0x081707A2,	// 108
+	0x1EA107A8,	// 109
+	0x156507D1,	// 110
+	0x157007EB,	// 111
+	0x156B0807,	// 112
+	0x15660822,	// 113
+	0x0D45083C,	// 114
+	0x1053084E,	// 115
+	0x0C470863,	// 116
+	0x15650875,	// 117
+	0x1369088F,	// 118
+	0x1C9F08AA,	// 119
+	0x115F08D2,	// 120
+	0x136908EA,	// 121
+	0x11590905,	// 122
+	0x0B36091C,	// 123
+	0x091E092A,	// 124
+	0x0B340932,	// 125
+	0x1670093F,	// 126
+	0x136B095B,	// 127
+	0x136B0976,	// 128
+	0x136B0991,	// 129
+	0x136B09AC,	// 130
+	0x136B09C7,	// 131
+	0x136B09E2,	// 132
+	0x136B09FD,	// 133
+	0x136B0A18,	// 134
+	0x136B0A33,	// 135
+	0x136B0A4E,	// 136
+	0x136B0A69,	// 137
+	0x136B0A84,	// 138
+	0x136B0A9F,	// 139
+	0x136B0ABA,	// 140
+	0x136B0AD5,	// 141
+	0x136B0AF0,	// 142
+	0x136B0B0B,	// 143
+	0x136B0B26,	// 144
+	0x136B0B41,	// 145
+	0x136B0B5C,	// 146
+	0x136B0B77,	// 147
+	0x136B0B92,	// 148
+	0x136B0BAD,	// 149
+	0x136B0BC8,	// 150
+	0x136B0BE3,	// 151
+	0x136B0BFE,	// 152
+	0x136B0C19,	// 153
+	0x136B0C34,	// 154
+	0x136B0C4F,	// 155
+	0x136B0C6A,	// 156
+	0x136B0C85,	// 157
+	0x136B0CA0,	// 158
+	0x136B0CBB,	// 159
+	0x0B000000,	// 160
+	0x081E0CD6,	// 161
+	0x16710CDE,	// 162
+	0x167D0CFB,	// 163
+	0x16710D1B,	// 164
+	0x16740D38,	// 165
+	0x091E0D55,	// 166
+	0x125E0D5D,	// 167
+	0x0F440D75,	// 168
+	0x20B20D86,	// 169
+	0x0E3F0DB3,	// 170
+	0x0E410DC3,	// 171
+	0x16700DD4,	// 172
+	0x0E400DF0,	// 173
+	0x20B20E00,	// 174
+	0x0F4A0E2D,	// 175
+	0x104B0E40,	// 176
+	0x16770E53,	// 177
+	0x0D390E71,	// 178
+	0x0D390E80,	// 179
+	0x0F3E0E8F,	// 180
+	0x18830E9F,	// 181
+	0x18800EC0,	// 182
+	0x091C0EE0,	// 183
+	0x0F420EE7,	// 184
+	0x0D390EF8,	// 185
+	0x0F4B0F07,	// 186
+	0x0E460F1A,	// 187
+	0x1B950F2C,	// 188
+	0x1B950F52,	// 189
+	0x1C9B0F78,	// 190
+	0x0F540F9F,	// 191
+	0x18890FB4,	// 192
+	0x18890FD7,	// 193
+	0x18890FFA,	// 194
+	0x1889101D,	// 195
+	0x18891040,	// 196
+	0x18891063,	// 197
+	0x23C51086,	// 198
+	0x1A8F10B8,	// 199
+	0x167710DC,	// 200
+	0x167710FA,	// 201
+	0x16771118,	// 202
+	0x16771136,	// 203
+	0x09201154,	// 204
+	0x0931115C,	// 205
+	0x09321169,	// 206
+	0x09311176,	// 207
+	0x1D9A1183,	// 208
+	0x1C8F11AA,	// 209
+	0x1EA011CE,	// 210
+	0x1EA011F6,	// 211
+	0x1EA0121E,	// 212
+	0x1EA01246,	// 213
+	0x1EA0126E,	// 214
+	0x16711296,	// 215
+	0x1EA012B3,	// 216
+	0x1B8912DB,	// 217
+	0x1B8912FE,	// 218
+	0x1B891321,	// 219
+	0x1B891344,	// 220
+	0x167A1367,	// 221
+	0x15701386,	// 222
+	0x146B13A2,	// 223
+	0x125913BD,	// 224
+	0x125913D4,	// 225
+	0x125913EB,	// 226
+	0x12591402,	// 227
+	0x12591419,	// 228
+	0x12591430,	// 229
+	0x1EA71447,	// 230
+	0x125F1471,	// 231
+	0x146A1489,	// 232
+	0x146A14A4,	// 233
+	0x146A14BF,	// 234
+	0x146A14DA,	// 235
+	0x081A14F5,	// 236
+	0x082614FC,	// 237
+	0x082C1506,	// 238
+	0x08261511,	// 239
+	0x156B151B,	// 240
+	0x15651536,	// 241
+	0x15701550,	// 242
+	0x1570156C,	// 243
+	0x15701588,	// 244
+	0x157015A4,	// 245
+	0x157015C0,	// 246
+	0x167615DC,	// 247
+	0x157015FA,	// 248
+	0x15651616,	// 249
+	0x15651630,	// 250
+	0x1565164A,	// 251
+	0x15651664,	// 252
+	0x1369167E,	// 253
+	0x156B1699,	// 254
+	0x136916B4	// 255
+};
+const uint32_t Lato_Hairline_38_data[] PROGMEM = {
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00100000,0x1FFFF800,0x00000030,
+	0x00300000,0x00000000,0x00000000,0x00000000,0x00000000,0xF8000000,0x0000000F,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000FF800,0x00000000,0x00000000,
+	0x00000000,0x20000000,0x00000000,0x00002010,0x20100000,0x00000030,0x000F2010,0xF8100000,
+	0x00000000,0x00002790,0x207C0000,0xE0000000,0x00002013,0x20101800,0x00000000,0x00302010,
+	0xA0100000,0x0000000F,0x00007810,0x27D00000,0x00000000,0x0000203E,0x2011E000,0x18000000,
+	0x00002010,0x20100000,0x00000000,0x00000010,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00040000,0x000F8000,0x40000008,0x00100010,0x00202000,0x10000020,0x00200040,
+	0x00400800,0x08000020,0x00200080,0xC0800800,0xFF8007FF,0x00203F7F,0x01000800,0x08000020,
+	0x00200100,0x01000800,0x10000020,0x00100200,0x04001000,0x20000008,0x00060800,0xF0000000,
+	0x00000001,0x00000000,0x00000000,0x00000000,0x001FC000,0x30000000,0x00000020,0x00401000,
+	0x08000000,0x00300080,0x00800800,0x08000008,0x00040080,0x00800800,0x08000003,0x00008080,
+	0x60401000,0x20000000,0x00001030,0x0C0FC000,0x00000000,0x00000200,0x01000000,0x00000000,
+	0x000000C0,0xF0200000,0x00000007,0x00080C18,0x02040000,0x00000010,0x00200103,0x01008000,
+	0x40000020,0x00200100,0x01003000,0x08000020,0x00200100,0x02000000,0x00000010,0x00080C00,
+	0xF0000000,0x00000007,0x00000000,0x00000000,0x00000000,0xE0000000,0x00000003,0x00041800,
+	0x04000000,0x00000008,0x00100200,0x010FC000,0x20000020,0x00200110,0x00E01000,0x08000020,
+	0x00200080,0x01000800,0x08000020,0x00200100,0x02000800,0x08000020,0x00200400,0x08000800,
+	0x10000010,0x00101000,0x20001000,0xE0000008,0x00044000,0x80000000,0x00000002,0x00010000,
+	0xE0000000,0x00000002,0x00041C00,0x00000000,0x00000008,0x00100000,0x00000000,0x00000020,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xF8000000,0x0000000F,0x00000000,0x00000000,
+	0x00000000,0x7FE00000,0x00000000,0x0007801E,0x00018000,0x70000018,0x00600000,0x00000800,
+	0x06000180,0x06000000,0x00000000,0x00000000,0x00000000,0x00000E00,0x10000700,0x00C00000,
+	0x0000E000,0x00000030,0x000E0007,0xFFF80000,0x00000001,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x10000000,0x00000002,0x00011000,0x20000000,0x00000001,0x0000A000,0x40000000,
+	0x00000000,0x000FFE00,0xA0000000,0x00000000,0x00012000,0x10000000,0x00000001,0x00021000,
+	0x00000000,0x00000000,0x00000000,0x01000000,0x00000000,0x00000100,0x01000000,0x00000000,
+	0x00000100,0x01000000,0x00000000,0x00000100,0x01000000,0x00000000,0x00000100,0x01000000,
+	0x00000000,0x0003FFFF,0x01000000,0x00000000,0x00000100,0x01000000,0x00000000,0x00000100,
+	0x01000000,0x00000000,0x00000100,0x01000000,0x00000000,0x00000100,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x02300000,0x00000000,0x000001F0,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000400,0x04000000,0x00000000,0x00000400,0x04000000,
+	0x00000000,0x00000400,0x04000000,0x00000000,0x00000400,0x04000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00300000,0x00000000,0x00000030,0x00100000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x000000E0,0x00180000,0x00000000,0x00000006,0x0001C000,
+	0x30000000,0x00000000,0x00000E00,0x01800000,0x00000000,0x00000060,0x001C0000,0x00000000,
+	0x00000003,0x0000C000,0x38000000,0x00000000,0x00000000,0x00000000,0xFFFE0000,0x80000000,
+	0x00030001,0x00004000,0x20000004,0x00080000,0x00001000,0x08000010,0x00200000,0x00000800,
+	0x08000020,0x00200000,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200000,
+	0x00000800,0x10000020,0x00100000,0x00002000,0x40000008,0x00040000,0x00018000,0x00000003,
+	0x0000FFFE,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00200002,0x00010000,0x80000020,0x00200000,0x00004000,0x20000020,0x00200000,
+	0x00001000,0x08000020,0x00200000,0xFFFFF000,0x0000003F,0x00200000,0x00000000,0x00000020,
+	0x00200000,0x00000000,0x00000020,0x00200000,0x00000000,0x00000020,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00300003,0x0000C000,0x20000028,0x00240000,0x00001000,
+	0x10000022,0x00210000,0x80000800,0x08000020,0x00204000,0x20000800,0x08000020,0x00201000,
+	0x08000800,0x08000020,0x00200400,0x02000800,0x10000020,0x00200100,0x00C02000,0xC0000020,
+	0x00200030,0x000F0000,0x00000020,0x00000000,0x00000000,0x00000000,0x80000000,0x00000000,
+	0x00030003,0x0000C000,0x2000000C,0x00100000,0x00001000,0x10000010,0x00200000,0x00000800,
+	0x08000020,0x00200000,0x00800800,0x08000020,0x00200080,0x00800800,0x08000020,0x00200080,
+	0x01400800,0x10000020,0x00100140,0x02202000,0xC0000008,0x00040418,0xF8070000,0x00000003,
+	0x00000000,0x00000000,0x00003000,0x28000000,0x00000000,0x00002400,0x23000000,0x00000000,
+	0x00002080,0x20400000,0x00000000,0x00002030,0x20080000,0x00000000,0x00002004,0x20030000,
+	0x80000000,0x00002000,0x20004000,0x20000000,0x00002000,0xFFFFF800,0x0000003F,0x00002000,
+	0x20000000,0x00000000,0x00002000,0x20000000,0x00000000,0x00002000,0x20000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00100000,0x00600000,0x80000010,0x0010005F,
+	0x00207800,0x08000020,0x00200020,0x00200800,0x08000020,0x00200020,0x00200800,0x08000020,
+	0x00200020,0x00200800,0x08000020,0x00200040,0x00400800,0x08000010,0x00080080,0x01800800,
+	0x08000004,0x00030600,0xF8000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x0003F800,0x07000000,0x00000004,0x00080180,0x01600000,0x00000010,0x00200090,0x00880000,
+	0x00000020,0x00200046,0x00410000,0x80000020,0x00200040,0x00406000,0x10000020,0x00200040,
+	0x00400800,0x00000020,0x00100080,0x01000000,0x00000010,0x000C0300,0xFC000000,0x00000003,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000000,0x00000800,0x08000000,
+	0x00000000,0x00000800,0x08000020,0x00180000,0x00000800,0x08000006,0x00018000,0x60000800,
+	0x08000000,0x00001800,0x06000800,0x08000000,0x00000180,0x00600800,0x08000000,0x00000018,
+	0x00060800,0x88000000,0x00000001,0x00006800,0x18000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x0007F807,0x0418C000,0x20000008,0x00100220,0x01401000,0x08000010,
+	0x00200140,0x00800800,0x08000020,0x00200080,0x00800800,0x08000020,0x00200080,0x00800800,
+	0x08000020,0x00200080,0x01400800,0x10000020,0x00100140,0x02202000,0xC0000010,0x00080418,
+	0xF8070000,0x00000007,0x00000000,0x00000000,0x00000000,0x00000000,0x80000000,0x0000007F,
+	0x00804000,0x20000000,0x00000100,0x02001000,0x08000000,0x00200200,0x04000800,0x08000010,
+	0x000C0400,0x04000800,0x08000002,0x00010400,0xC4000800,0x08000000,0x00002200,0x1A001000,
+	0x10000000,0x00000500,0x03802000,0xC0000000,0x00000040,0x003F0000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00300030,0x00300000,0x00000030,0x00100010,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x02100010,0x00300000,0x00000330,0x00F00030,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x00000000,
+	0x00000500,0x04800000,0x00000000,0x00000880,0x08400000,0x00000000,0x00001040,0x10200000,
+	0x00000000,0x00002020,0x20100000,0x00000000,0x00004010,0x40080000,0x00000000,0x00008008,
+	0x80040000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x08200000,
+	0x00000000,0x00000820,0x08200000,0x00000000,0x00000820,0x08200000,0x00000000,0x00000820,
+	0x08200000,0x00000000,0x00000820,0x08200000,0x00000000,0x00000820,0x08200000,0x00000000,
+	0x00000820,0x08200000,0x00000000,0x00000820,0x08200000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00008004,0x80080000,0x00000000,
+	0x00004008,0x40100000,0x00000000,0x00002010,0x20200000,0x00000000,0x00001020,0x10400000,
+	0x00000000,0x00000840,0x08800000,0x00000000,0x00000480,0x05000000,0x00000000,0x00000200,
+	0x02000000,0x00000000,0x00000000,0x00000000,0x00002000,0x10000000,0x00000000,0x00000800,
+	0x08000000,0x00000000,0x00000800,0x08000030,0x00301F00,0x00800800,0x08000000,0x00000040,
+	0x00200800,0x10000000,0x00000020,0x00182000,0xC0000000,0x00000007,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x0007FFC0,0x00300000,0x00000008,0x0030000C,0x00020000,
+	0x00000040,0x00800001,0x00010000,0x80000100,0x01004000,0xBC004000,0x40000201,0x02020200,
+	0x01004000,0x20000204,0x04040080,0x00402000,0x20000404,0x04040040,0x00202000,0x20000402,
+	0x04010020,0x80202000,0x20000400,0x04037820,0x07204000,0x40000404,0x040400C0,0x00004000,
+	0x80000204,0x02040000,0x00010000,0x00000204,0x01020001,0x00060000,0x00000081,0x0000C018,
+	0x3FE00000,0x00000000,0x00000000,0x00300000,0x00000000,0x0000000E,0x00018000,0x60000000,
+	0x00000000,0x00001C00,0x13000000,0x00000000,0x000010E0,0x10180000,0x00000000,0x00001007,
+	0x1000C000,0x30000000,0x00001000,0x10001800,0xE0000000,0x00001000,0x10030000,0x00000000,
+	0x0000101C,0x10600000,0x00000000,0x00001180,0x1E000000,0x00000000,0x00002000,0xC0000000,
+	0x00000001,0x00060000,0x00000000,0x00000038,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0xFFFFF800,0x0800003F,0x00200100,0x01000800,0x08000020,0x00200100,
+	0x01000800,0x08000020,0x00200100,0x01000800,0x08000020,0x00200100,0x01000800,0x08000020,
+	0x00200100,0x01000800,0x08000020,0x00200180,0x02801000,0x10000020,0x00100240,0x04306000,
+	0x80000010,0x000C080F,0xF0000000,0x00000003,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00007FFC,0x80030000,0x80000001,0x00020000,0x00004000,0x20000004,0x00080000,
+	0x00002000,0x10000010,0x00100000,0x00001000,0x08000020,0x00200000,0x00000800,0x08000020,
+	0x00200000,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200000,0x00000800,
+	0x08000020,0x00200000,0x00001000,0x10000010,0x00100000,0x00002000,0x40000008,0x00040000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF800,0x0800003F,
+	0x00200000,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200000,0x00000800,
+	0x08000020,0x00200000,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200000,
+	0x00000800,0x08000020,0x00200000,0x00000800,0x10000020,0x00100000,0x00001000,0x20000010,
+	0x00080000,0x00004000,0x80000004,0x00030001,0xC0060000,0x00000000,0x00003FF8,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF800,0x0800003F,0x00200100,
+	0x01000800,0x08000020,0x00200100,0x01000800,0x08000020,0x00200100,0x01000800,0x08000020,
+	0x00200100,0x01000800,0x08000020,0x00200100,0x01000800,0x08000020,0x00200100,0x01000800,
+	0x08000020,0x00200100,0x00000800,0x08000020,0x00200000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0xFFFFF800,0x0800003F,0x00000100,0x01000800,0x08000000,
+	0x00000100,0x01000800,0x08000000,0x00000100,0x01000800,0x08000000,0x00000100,0x01000800,
+	0x08000000,0x00000100,0x01000800,0x08000000,0x00000100,0x01000800,0x08000000,0x00000100,
+	0x00000800,0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00007FFC,
+	0x80030000,0x80000001,0x00020000,0x00004000,0x20000004,0x00080000,0x00002000,0x10000008,
+	0x00100000,0x00001000,0x08000010,0x00200000,0x00000800,0x08000020,0x00200000,0x00000800,
+	0x08000020,0x00200000,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200400,
+	0x04000800,0x10000020,0x00100400,0x04001000,0x20000010,0x00100400,0xFC004000,0x0000000F,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF800,0x0000003F,
+	0x00000100,0x01000000,0x00000000,0x00000100,0x01000000,0x00000000,0x00000100,0x01000000,
+	0x00000000,0x00000100,0x01000000,0x00000000,0x00000100,0x01000000,0x00000000,0x00000100,
+	0x01000000,0x00000000,0x00000100,0x01000000,0x00000000,0x00000100,0x01000000,0x00000000,
+	0x00000100,0x01000000,0xF8000000,0x003FFFFF,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0xFFFFF800,0x0000003F,0x00000000,0x00000000,0x00200000,0x00000000,
+	0x00000020,0x00200000,0x00000000,0x00000020,0x00200000,0x00000000,0x00000020,0x00100000,
+	0x00000000,0x00000010,0x000C0000,0xFFFFF800,0x00000003,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0xFFFFF800,0x0000003F,0x00000100,0x01000000,0x00000000,
+	0x00000100,0x02800000,0x00000000,0x00000240,0x04200000,0x00000000,0x00000810,0x10080000,
+	0x00000000,0x00002004,0x40020000,0x00000000,0x00008001,0x00008000,0x40000001,0x00020000,
+	0x00002000,0x20000004,0x00080000,0x00001000,0x08000010,0x00200000,0x00000000,0x00000020,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF800,0x0000003F,
+	0x00200000,0x00000000,0x00000020,0x00200000,0x00000000,0x00000020,0x00200000,0x00000000,
+	0x00000020,0x00200000,0x00000000,0x00000020,0x00200000,0x00000000,0x00000020,0x00200000,
+	0x00000000,0x00000020,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0xFFFFF800,0x2000003F,0x00000000,0x00004000,0x80000000,0x00000001,0x00060000,
+	0x00000000,0x00000018,0x00200000,0x00000000,0x000000C0,0x03000000,0x00000000,0x00000400,
+	0x18000000,0x00000000,0x00006000,0x80000000,0x00000000,0x00018000,0x60000000,0x00000000,
+	0x00001000,0x0C000000,0x00000000,0x00000300,0x00C00000,0x00000000,0x00000030,0x00080000,
+	0x00000000,0x00000006,0x00018000,0x60000000,0x00000000,0xFFFFF800,0x0000003F,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF800,0x1000003F,0x00000000,
+	0x00006000,0x80000000,0x00000000,0x00010000,0x00000000,0x00000006,0x00080000,0x00000000,
+	0x00000030,0x00400000,0x00000000,0x00000080,0x03000000,0x00000000,0x00000400,0x08000000,
+	0x00000000,0x00003000,0x40000000,0x00000000,0x00008000,0x00000000,0x00000003,0x00040000,
+	0x00000000,0xF8000018,0x003FFFFF,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00007FFC,0x80030000,0x80000001,0x00020000,0x00004000,0x20000004,0x00080000,0x00001000,
+	0x10000010,0x00100000,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200000,
+	0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200000,0x00000800,0x10000020,
+	0x00200000,0x00001000,0x20000010,0x00100000,0x00002000,0x40000008,0x00040000,0x00018000,
+	0x00000003,0x0000C006,0x3FF80000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0xFFFFF800,0x0800003F,0x00000400,0x04000800,0x08000000,0x00000400,0x04000800,
+	0x08000000,0x00000400,0x04000800,0x08000000,0x00000400,0x04000800,0x08000000,0x00000400,
+	0x02000800,0x10000000,0x00000200,0x01001000,0x20000000,0x00000080,0x007FC000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00007FFC,0x80030000,0x80000001,0x00020000,
+	0x00004000,0x20000004,0x00080000,0x00001000,0x10000010,0x00100000,0x00000800,0x08000020,
+	0x00200000,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200000,0x00000800,
+	0x08000020,0x00200000,0x00000800,0x10000020,0x00200000,0x00001000,0x20000010,0x00300000,
+	0x00002000,0x40000048,0x00840000,0x00018000,0x00000103,0x0200C006,0x3FF80000,0x00000400,
+	0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF800,
+	0x0800003F,0x00000100,0x01000800,0x08000000,0x00000100,0x01000800,0x08000000,0x00000100,
+	0x01000800,0x08000000,0x00000700,0x09000800,0x08000000,0x00001100,0x20800800,0x10000000,
+	0x00004080,0x80401000,0x20000001,0x00020020,0x001FC000,0x00000004,0x00080000,0x00000000,
+	0x00000030,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x80000004,0x0008000F,
+	0x00104000,0x20000010,0x00200020,0x00401000,0x08000020,0x00200040,0x00800800,0x08000020,
+	0x00200080,0x00800800,0x08000020,0x00200100,0x01000800,0x08000020,0x00100100,0x02001000,
+	0x10000010,0x00080400,0x08002000,0x00000006,0x0001F000,0x00000000,0x08000000,0x00000000,
+	0x00000800,0x08000000,0x00000000,0x00000800,0x08000000,0x00000000,0x00000800,0x08000000,
+	0x00000000,0x00000800,0x08000000,0x00000000,0xFFFFF800,0x0800003F,0x00000000,0x00000800,
+	0x08000000,0x00000000,0x00000800,0x08000000,0x00000000,0x00000800,0x08000000,0x00000000,
+	0x00000800,0x08000000,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0xFFFFF800,0x00000000,0x00030000,0x00000000,0x00000004,0x00080000,
+	0x00000000,0x00000010,0x00100000,0x00000000,0x00000020,0x00200000,0x00000000,0x00000020,
+	0x00200000,0x00000000,0x00000020,0x00200000,0x00000000,0x00000020,0x00200000,0x00000000,
+	0x00000010,0x00080000,0x00000000,0x00000004,0x00020000,0xFFFFF800,0x00000001,0x00000000,
+	0x18000000,0x00000000,0x0000E000,0x00000000,0x00000003,0x001C0000,0x00000000,0x00000060,
+	0x03800000,0x00000000,0x00000C00,0x30000000,0x00000000,0x0001C000,0x00000000,0x00000006,
+	0x00180000,0x00000000,0x00000030,0x000E0000,0x80000000,0x00000001,0x00007000,0x0C000000,
+	0x00000000,0x00000300,0x00E00000,0x00000000,0x00000018,0x00070000,0xC0000000,0x00000000,
+	0x00003800,0x00000000,0x18000000,0x00000000,0x0000E000,0x00000000,0x00000007,0x00780000,
+	0x00000000,0x00000380,0x1C000000,0x00000000,0x0000E000,0x00000000,0x00000007,0x00380000,
+	0x00000000,0x0000001C,0x00030000,0xE0000000,0x00000000,0x00001C00,0x03800000,0x00000000,
+	0x00000070,0x000E0000,0xC0000000,0x00000001,0x00003800,0x30000000,0x00000000,0x0001C000,
+	0x00000000,0x0000000E,0x00700000,0x00000000,0x00000380,0x1C000000,0x00000000,0x00006000,
+	0x80000000,0x00000003,0x000C0000,0x00000000,0x00000038,0x00070000,0xE0000000,0x00000000,
+	0x00001C00,0x03800000,0x00000000,0x00000078,0x00070000,0xE0000000,0x00000000,0x00001800,
+	0x00000000,0x00000000,0x00200000,0x00001800,0x20000010,0x000C0000,0x00004000,0x80000002,
+	0x00010001,0xC0020000,0x00000000,0x0000200C,0x10100000,0x00000000,0x00000C20,0x02C00000,
+	0x00000000,0x00000180,0x02400000,0x00000000,0x00000C20,0x10180000,0x00000000,0x00006004,
+	0x80030000,0x80000000,0x00010000,0x00004000,0x30000006,0x00080000,0x00000800,0x00000010,
+	0x00200000,0x00000000,0x18000000,0x00000000,0x00002000,0xC0000000,0x00000000,0x00010000,
+	0x00000000,0x00000006,0x00180000,0x00000000,0x00000020,0x00C00000,0x00000000,0x00000100,
+	0xFE000000,0x0000003F,0x00000200,0x01800000,0x00000000,0x00000040,0x00300000,0x00000000,
+	0x0000000C,0x00020000,0x80000000,0x00000001,0x00004000,0x30000000,0x00000000,0x00000800,
+	0x00000000,0x00000000,0x00000000,0x00000800,0x08000030,0x00280000,0x00000800,0x08000026,
+	0x00210000,0xC0000800,0x08000020,0x00202000,0x10000800,0x08000020,0x00200C00,0x02000800,
+	0x08000020,0x00200180,0x00400800,0x08000020,0x00200020,0x00180800,0x08000020,0x00200004,
+	0x00030800,0x88000020,0x00200000,0x00004800,0x38000020,0x00200000,0x00000800,0x00000020,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFFE00,0x020007FF,
+	0x04000000,0x00000200,0x02000400,0x04000000,0x00000200,0x00000400,0x00000000,0x00000000,
+	0x00000000,0x00003800,0xC0000000,0x00000000,0x00030000,0x00000000,0x0000001C,0x00600000,
+	0x00000000,0x00000380,0x0C000000,0x00000000,0x00003000,0xC0000000,0x00000001,0x00060000,
+	0x00000000,0x00000018,0x00E00000,0x00000000,0x00000000,0x00000000,0x00000200,0x02000400,
+	0x04000000,0x00000200,0x02000400,0x04000000,0xFFFFFE00,0x000007FF,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x00000000,0x00000030,0x000C0000,
+	0x00000000,0x00000002,0x00018000,0x60000000,0x00000000,0x00001000,0x18000000,0x00000000,
+	0x00006000,0x80000000,0x00000001,0x00020000,0x00000000,0x0000000C,0x00300000,0x00000000,
+	0x00000040,0x00000000,0x00000000,0x04000000,0x00000000,0x00000400,0x04000000,0x00000000,
+	0x00000400,0x04000000,0x00000000,0x00000400,0x04000000,0x00000000,0x00000400,0x04000000,
+	0x00000000,0x00000400,0x04000000,0x00000000,0x00000400,0x04000000,0x00000000,0x00000400,
+	0x04000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x08000000,0x00000000,0x00001000,0x60000000,0x00000000,0x00008000,0x00000000,0x00000000,
+	0x00000000,0x80000000,0x0000000F,0x00104020,0x40100000,0x00000020,0x00202010,0x20080000,
+	0x00000020,0x00202008,0x10080000,0x00000020,0x00201008,0x10080000,0x00000020,0x00101008,
+	0x10100000,0x00000008,0x00081060,0xFF800000,0x0000003F,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00400000,0x00000008,0x00100020,0x00100000,0x00000010,
+	0x00200010,0x00080000,0x00000020,0x00200008,0x00080000,0x00000020,0x00200008,0x00080000,
+	0x00000020,0x00200008,0x00100000,0x00000010,0x00080010,0x00600000,0x00000004,0x0003FF80,
+	0x00000000,0x00000000,0x00000000,0xFE000000,0x00000000,0x00070180,0x00600000,0x00000008,
+	0x00100010,0x00100000,0x00000010,0x00200008,0x00080000,0x00000020,0x00200008,0x00080000,
+	0x00000020,0x00200008,0x00080000,0x00000020,0x00200008,0x00100000,0x00000010,0x00080010,
+	0x00000000,0x00000000,0x00000000,0xFE000000,0x00000001,0x00060180,0x00600000,0x00000008,
+	0x00100010,0x00100000,0x00000020,0x00200008,0x00080000,0x00000020,0x00200008,0x00080000,
+	0x00000020,0x00200008,0x00080000,0x00000020,0x00100008,0x00100000,0x00000010,0x00080020,
+	0xFFFFF800,0x0000003F,0x00000000,0x00000000,0x00000000,0xFE000000,0x00000000,0x000305C0,
+	0x04200000,0x0000000C,0x00100410,0x04100000,0x00000010,0x00200408,0x04080000,0x00000020,
+	0x00200408,0x04080000,0x00000020,0x00200408,0x04080000,0x00000020,0x00200408,0x04100000,
+	0x00000020,0x00100420,0x04C00000,0x00000008,0x00000700,0x00000000,0x00000000,0x00000010,
+	0x00100000,0x00000000,0x00000010,0xFFFF8000,0x6000003F,0x00000010,0x00101000,0x08000000,
+	0x00000010,0x00100800,0x08000000,0x00000010,0x00100800,0x08000000,0x00000010,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x000007E0,0x08130FC0,0xD0200000,0x00000814,0x10082010,
+	0x40080000,0x00001008,0x10084008,0x40080000,0x00001008,0x10084008,0x40080000,0x00001008,
+	0x10084008,0x20080000,0x00001008,0x10082010,0x18700000,0x00000808,0x04100790,0x00100000,
+	0x00000220,0x01C00010,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00400000,0x00000000,0x00000020,0x00100000,0x00000000,0x00000010,0x00080000,0x00000000,
+	0x00000008,0x00080000,0x00000000,0x00000008,0x00080000,0x00000000,0x00000008,0x00100000,
+	0x00000000,0x00000010,0xFFE00000,0x0000003F,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x18000000,0x003FFFF8,0x00001800,0x00000000,0x00001000,0x10000000,0x00000000,0x18001000,
+	0x0FFFFFF8,0x00001800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x08000000,0x00000000,0x00000800,0x14000000,0x00000000,0x00002200,0x41000000,0x00000000,
+	0x00008100,0x00800000,0x00000001,0x00020040,0x00200000,0x00000004,0x00080010,0x00080000,
+	0x00000010,0x00200008,0x00000000,0x00000000,0x00000000,0x00000000,0xF8000000,0x003FFFFF,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x00000000,
+	0x00000020,0x00100000,0x00000000,0x00000008,0x00080000,0x00000000,0x00000008,0x00080000,
+	0x00000000,0x00000008,0x00080000,0x00000000,0x00000030,0x00400000,0x00000000,0x003FFFC0,
+	0x00200000,0x00000000,0x00000010,0x00080000,0x00000000,0x00000008,0x00080000,0x00000000,
+	0x00000008,0x00080000,0x00000000,0x00000008,0x00100000,0x00000000,0x00000060,0xFF800000,
+	0x0000003F,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,
+	0x00000000,0x00000020,0x00100000,0x00000000,0x00000010,0x00080000,0x00000000,0x00000008,
+	0x00080000,0x00000000,0x00000008,0x00080000,0x00000000,0x00000008,0x00100000,0x00000000,
+	0x00000010,0xFFE00000,0x0000003F,0x00000000,0x00000000,0x00000000,0xFE000000,0x00000000,
+	0x00070180,0x00600000,0x00000008,0x00100010,0x00100000,0x00000010,0x00200008,0x00080000,
+	0x00000020,0x00200008,0x00080000,0x00000020,0x00200008,0x00080000,0x00000020,0x00200008,
+	0x00100000,0x00000010,0x00100010,0x00600000,0x0000000C,0x00030180,0xFE000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x00000008,0x00100020,
+	0x00100000,0x00000010,0x00200010,0x00080000,0x00000020,0x00200008,0x00080000,0x00000020,
+	0x00200008,0x00080000,0x00000020,0x00200008,0x00100000,0x00000010,0x00080010,0x00600000,
+	0x00000004,0x0003FF80,0x00000000,0x00000000,0x00000000,0xFE000000,0x00000001,0x00060180,
+	0x00600000,0x00000008,0x00100010,0x00100000,0x00000020,0x00200008,0x00080000,0x00000020,
+	0x00200008,0x00080000,0x00000020,0x00200008,0x00080000,0x00000020,0x00100008,0x00100000,
+	0x00000010,0x00080020,0xFFF80000,0x00001FFF,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x01C00000,0x00000000,0x00000020,0x00100000,0x00000000,0x00000008,
+	0x00080000,0x00000000,0x00000008,0x00080000,0x00000000,0x00000008,0x00000000,0x00000000,
+	0x00000000,0x01C00000,0x00000008,0x00100220,0x04100000,0x00000020,0x00200808,0x08080000,
+	0x00000020,0x00200808,0x10080000,0x00000020,0x00201008,0x10080000,0x00000020,0x00102008,
+	0x40100000,0x00000008,0x00078000,0x00000000,0x00000000,0x00000010,0x00100000,0x00000000,
+	0x00000010,0xFFFFF000,0x0000000F,0x00100010,0x00100000,0x00000020,0x00200010,0x00100000,
+	0x00000020,0x00200010,0x00100000,0x00000020,0x00100000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x0003FFF8,0x00000000,0x0000000C,0x00100000,0x00000000,0x00000020,
+	0x00200000,0x00000000,0x00000020,0x00200000,0x00000000,0x00000020,0x00200000,0x00000000,
+	0x00000020,0x00100000,0x00000000,0x00000008,0x000C0000,0xFFF80000,0x0000003F,0x00000000,
+	0x00000000,0x00000018,0x00600000,0x00000000,0x00000180,0x0E000000,0x00000000,0x00003000,
+	0xC0000000,0x00000000,0x00070000,0x00000000,0x00000018,0x00300000,0x00000000,0x0000000C,
+	0x00038000,0x60000000,0x00000000,0x00001800,0x07000000,0x00000000,0x000000C0,0x00300000,
+	0x00000000,0x00000008,0x00000000,0x00000000,0x00000018,0x00E00000,0x00000000,0x00000700,
+	0x38000000,0x00000000,0x0001C000,0x00000000,0x0000000E,0x00300000,0x00000000,0x0000000C,
+	0x00038000,0x70000000,0x00000000,0x00000C00,0x03800000,0x00000000,0x00000070,0x00180000,
+	0x00000000,0x000000E0,0x07000000,0x00000000,0x00003800,0xC0000000,0x00000001,0x000E0000,
+	0x00000000,0x00000030,0x000C0000,0x80000000,0x00000003,0x00007000,0x0E000000,0x00000000,
+	0x000001C0,0x00380000,0x00000000,0x00000000,0x00200008,0x00180000,0x00000010,0x000C0020,
+	0x00C00000,0x00000002,0x00010100,0xC2000000,0x00000000,0x00002C00,0x10000000,0x00000000,
+	0x00002C00,0xC2000000,0x00000000,0x00010180,0x00400000,0x00000006,0x00080020,0x00180000,
+	0x00000010,0x00200000,0x00000000,0x00000000,0x00000018,0x00600000,0x00000000,0x00000180,
+	0x0E000000,0x00000000,0x00003000,0xC0000000,0x00001800,0x06070000,0x00000000,0x000001D8,
+	0x00300000,0x00000000,0x0000000C,0x00038000,0x60000000,0x00000000,0x00001800,0x07000000,
+	0x00000000,0x000000C0,0x00300000,0x00000000,0x00000008,0x00000000,0x00000000,0x00200000,
+	0x00080000,0x00000030,0x002C0008,0x00080000,0x00000022,0x00210008,0xC0080000,0x00000020,
+	0x00202008,0x18080000,0x00000020,0x00200408,0x02080000,0x00000020,0x00200188,0x00480000,
+	0x00000020,0x00200028,0x00180000,0x00000020,0x00000000,0x00000000,0x00000000,0x04000000,
+	0x40000000,0x00600400,0x0B1FB800,0x0400019F,0x0200F0E0,0x00000200,0x02000400,0x04000000,
+	0x00000200,0x00000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xFFFFFE00,0x00001FFF,0x00000000,0x00000000,0x00000000,0x00000200,0x02000400,0x04000000,
+	0x00000200,0x04000400,0x0200F1E0,0x0A1FB800,0x4000019F,0x00600400,0x04000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00003800,0x04000000,0x00000000,0x00000200,
+	0x02000000,0x00000000,0x00000200,0x02000000,0x00000000,0x00000400,0x04000000,0x00000000,
+	0x00000800,0x08000000,0x00000000,0x00001000,0x10000000,0x00000000,0x00001000,0x10000000,
+	0x00000000,0x00000800,0x06000000,0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,
+	0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,
+	0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,
+	0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,
+	0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,
+	0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,
+	0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,
+	0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,
+	0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,
+	0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,
+	0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,
+	0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,
+	0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,
+	0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,
+	0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,
+	0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,
+	0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,
+	0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,
+	0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,
+	0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,
+	0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,
+	0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,
+	0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,
+	0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,
+	0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,
+	0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,
+	0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,
+	0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,
+	0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,
+	0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,
+	0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,
+	0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,
+	0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,
+	0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,
+	0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,
+	0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,
+	0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,
+	0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,
+	0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,
+	0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,
+	0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,
+	0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,
+	0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,
+	0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,
+	0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,
+	0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,
+	0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,
+	0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,
+	0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,
+	0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,
+	0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,
+	0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,
+	0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,
+	0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,
+	0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,
+	0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,
+	0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,
+	0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,
+	0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,
+	0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,
+	0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,
+	0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,
+	0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,
+	0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,
+	0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,
+	0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,
+	0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,
+	0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,
+	0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,
+	0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,
+	0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,
+	0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,
+	0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,
+	0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,
+	0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,
+	0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,
+	0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,
+	0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,
+	0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,
+	0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,
+	0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,
+	0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,
+	0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,
+	0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,
+	0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,
+	0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,
+	0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,
+	0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,
+	0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,
+	0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,
+	0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,
+	0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,
+	0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,
+	0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,
+	0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,
+	0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,
+	0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,
+	0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,
+	0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,
+	0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,
+	0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,
+	0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,
+	0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,
+	0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,
+	0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,
+	0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,
+	0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,0x48000023,0x00220100,0x00804800,
+	0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,0x00000800,0x08000020,0x00200000,
+	0x00000800,0xF8000020,0x003FFFFF,0x00000000,0xF8000000,0x003FFFFF,0x00000800,0x08000020,
+	0x00200000,0x00000800,0x08000020,0x00200001,0x00008800,0x88000020,0x00200000,0x0E004800,
+	0x48000023,0x00220100,0x00804800,0x88000020,0x00200040,0x00210800,0x08000020,0x0020001E,
+	0x00000800,0x08000020,0x00200000,0x00000800,0xF8000020,0x003FFFFF,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00004018,0xB0180000,0x00001FFF,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xFF800000,0x00000003,0x00040040,0x00200000,
+	0x00000008,0x00100010,0x00100000,0x00000020,0x00200008,0x00080000,0x00000020,0x07200008,
+	0xFFFFC000,0x000000FF,0x00200008,0x00080000,0x00000020,0x00200008,0x00100000,0x00000010,
+	0x00100010,0x00000000,0x00000008,0x00000000,0x00000000,0x00000200,0x02000000,0x00000020,
+	0x00300200,0x02000000,0x00000028,0x0027FFFF,0x0200C000,0x20000020,0x00200200,0x02001000,
+	0x08000020,0x00200200,0x02000800,0x08000020,0x00200200,0x02000800,0x08000020,0x00200200,
+	0x02000800,0x08000020,0x00200000,0x00001000,0x20000020,0x00200000,0x00004000,0x00000020,
+	0x00200000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00010004,0x83040000,0x00000000,0x00005CC8,0x20300000,0x00000000,0x00004010,0x40080000,
+	0x00000000,0x00008008,0x80080000,0x00000000,0x00008008,0x80080000,0x00000000,0x00004008,
+	0x40100000,0x00000000,0x00002030,0x58C80000,0x00000000,0x00008704,0x00040000,0x00000001,
+	0x00000000,0x00000000,0x00000000,0x00000800,0x10000000,0x00002400,0x24006000,0x80000000,
+	0x00002401,0x24060000,0x00000000,0x00002418,0x24600000,0x00000000,0x00002580,0x26000000,
+	0x00000000,0x003FFE00,0x25800000,0x00000000,0x00002460,0x24180000,0x00000000,0x00002406,
+	0x24018000,0x40000000,0x00002400,0x24003000,0x08000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0xC0FFFE00,0x00001FFF,0x00000000,0x00000000,0x00000000,
+	0x03800000,0x00000000,0x00400460,0x0813E000,0x10000080,0x00801014,0x10080800,0x08000100,
+	0x01002010,0x20100800,0x08000100,0x01004010,0x40200800,0x08000100,0x00808020,0x80400800,
+	0x10000080,0x00414080,0x21001000,0x0000003E,0x00001E00,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x20000000,0x00000000,0x00006000,0x20000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00006000,0x60000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00003FF8,0xC0060000,0x00000000,0x00010001,0x00008000,
+	0x40000002,0x00040000,0x0FE02000,0x10000008,0x00103018,0x40041000,0x10000010,0x00108002,
+	0x80020800,0x08000020,0x00210001,0x00010800,0x08000021,0x00210001,0x00010800,0x08000021,
+	0x00210001,0x00010800,0x08000021,0x00210001,0x80020800,0x10000020,0x00108002,0x40001000,
+	0x20000010,0x00080000,0x00004000,0x80000004,0x00020000,0x00010000,0x00000001,0x00008002,
+	0x701C0000,0x00000000,0x00000FE0,0x00000000,0x00000000,0x00000000,0x00000000,0x10000000,
+	0x0000001C,0x00221000,0x08000000,0x00000022,0x00210800,0x08000000,0x00000021,0x00110800,
+	0x10000000,0x00000011,0x003FE000,0x00000000,0x00000000,0x00000000,0x10000000,0x00000000,
+	0x00006C00,0x83000000,0x00000000,0x00030080,0x10600000,0x00000004,0x00002C00,0xC2000000,
+	0x00000000,0x00010180,0x00600000,0x00000006,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000200,0x02000000,0x00000000,0x00000200,0x02000000,0x00000000,0x00000200,
+	0x02000000,0x00000000,0x00000200,0x02000000,0x00000000,0x00000200,0x02000000,0x00000000,
+	0x00000200,0x02000000,0x00000000,0x00000200,0x02000000,0x00000000,0x00000200,0x7E000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000400,0x04000000,0x00000000,
+	0x00000400,0x04000000,0x00000000,0x00000400,0x04000000,0x00000000,0x00000400,0x04000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00003FF8,0xC0060000,0x00000000,
+	0x00010001,0x00008000,0x40000002,0x00040000,0x00002000,0x10000008,0x00100000,0x00001000,
+	0x10000010,0x0011FEFE,0x01010800,0x08000020,0x00200101,0x01010800,0x08000020,0x00200101,
+	0x03010800,0x08000020,0x00200501,0x18810800,0x08000020,0x00202082,0x407C0800,0x10000020,
+	0x00108000,0x00001000,0x20000011,0x00080000,0x00004000,0x80000004,0x00020000,0x00010000,
+	0x00000001,0x00008002,0x701C0000,0x00000000,0x00000FE0,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x20000000,0x00000000,0x00002000,0x20000000,0x00000000,0x00002000,0x20000000,
+	0x00000000,0x00002000,0x20000000,0x00000000,0x00002000,0x20000000,0x00000000,0x00002000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xE0000000,0x0000000F,0x00101000,0x08000000,
+	0x00000010,0x00200800,0x08000000,0x00000020,0x00200800,0x08000000,0x00000020,0x00100800,
+	0x10000000,0x00000008,0x0007E000,0x00000000,0x00000000,0x00000000,0x02000000,0x00000010,
+	0x00100200,0x02000000,0x00000010,0x00100200,0x02000000,0x00000010,0x00100200,0x02000000,
+	0x00000010,0x00100200,0xFFFE0000,0x00000013,0x00100200,0x02000000,0x00000010,0x00100200,
+	0x02000000,0x00000010,0x00100200,0x02000000,0x00000010,0x00100200,0x02000000,0x00000010,
+	0x00100200,0x00000000,0x00000000,0x00000000,0x00100400,0x03000000,0x00000018,0x00140080,
+	0x00800000,0x00000012,0x00110080,0x80800000,0x00000010,0x00106100,0x1F000000,0x00000010,
+	0x00000000,0x00000000,0x00000000,0x00060600,0x01000000,0x00000008,0x00100080,0x00800000,
+	0x00000010,0x00102080,0x20800000,0x00000010,0x00085100,0xCF000000,0x00000007,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00008000,0x40000000,0x00000000,0x00002000,0x18000000,0x00000000,0x00000800,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFFF80000,0x00001FFF,0x00080000,
+	0x00000000,0x00000010,0x00200000,0x00000000,0x00000020,0x00200000,0x00000000,0x00000020,
+	0x00200000,0x00000000,0x00000020,0x00200000,0x00000000,0x00000010,0x00080000,0x00000000,
+	0x00000004,0x000FFFF8,0x00000000,0x00000010,0x00200000,0x00000000,0x00000020,0x00200000,
+	0x00000000,0x00000000,0x00000000,0x000FC000,0xE0000000,0x0000003F,0x003FF000,0xF0000000,
+	0x0000007F,0x007FF800,0xF8000000,0x0000007F,0x007FF800,0xF8000000,0x000000FF,0xFF000800,
+	0x080001FF,0x00000000,0x00000800,0x08000000,0x00000000,0x00000800,0x08000000,0x00000000,
+	0x00000800,0xF8000000,0x01FFFFFF,0x00000800,0x08000000,0x00000000,0x00000800,0x08000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000C00,0x0C000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000000,
+	0x00000000,0x00001000,0x11C00000,0x00000000,0x00001100,0x12000000,0x00000000,0x00000E00,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x04000000,0x00000010,0x00100200,0x01000000,
+	0x00000010,0x001FFF80,0x00000000,0x00000010,0x00100000,0x00000000,0x00000010,0x00000000,
+	0x00000000,0x00000000,0x00000000,0xE0000000,0x0000001F,0x00201000,0x08000000,0x00000040,
+	0x00400800,0x08000000,0x00000040,0x00400800,0x08000000,0x00000040,0x00200800,0x30000000,
+	0x00000010,0x000FC000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00040060,
+	0x01800000,0x00000003,0x0000C200,0x2C000000,0x00000000,0x00041060,0x00800000,0x00000003,
+	0x00008300,0x64000000,0x00000000,0x00001800,0x00000000,0x00000000,0x00000000,0x00004000,
+	0x20000000,0x00000100,0x01001000,0x08000000,0x00000100,0x01FFF000,0x00000030,0x00080100,
+	0x01000000,0x00000006,0x00018000,0x60000000,0x00000000,0x00001800,0x04000000,0x00000000,
+	0x00000300,0x00C00000,0x00000000,0x00000030,0x000C0000,0x00000003,0x00028002,0x60018000,
+	0x60000002,0x00021000,0x08001800,0x00000002,0x00020400,0xFE000000,0x0000003F,0x00020000,
+	0x00000000,0x00000002,0x00000000,0x00000000,0x00000000,0x00004000,0x20000000,0x00000100,
+	0x01001000,0x08000000,0x00200100,0x01FFF000,0x00000018,0x00060100,0x81000000,0x00000001,
+	0x00006100,0x10000000,0x00000000,0x00000C00,0x03000000,0x00000000,0x000000C0,0x00300000,
+	0x00000000,0x00000008,0x08060000,0x80000020,0x00300401,0x02006000,0x18000028,0x00240100,
+	0x01000800,0x00000022,0x00210100,0x81000000,0x00000020,0x00206600,0x18000000,0x00000020,
+	0x00000000,0x00000000,0x00000000,0x00600000,0x30000000,0x00000080,0x01000800,0x08000000,
+	0x00000100,0x01020800,0x08000020,0x00100102,0x00820800,0xB000000C,0x000300C5,0xC0384000,
+	0x00000000,0x00002000,0x18000000,0x00000000,0x00000600,0x01800000,0x00000000,0x00000060,
+	0x00100000,0x00000003,0x0002800C,0x40030000,0xC0000002,0x00023000,0x08003000,0x08000002,
+	0x00020400,0xFE000000,0x0000003F,0x00020000,0x00000000,0x00000002,0x00020000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x000003F0,0x0C080000,0x00000000,0x00000804,0x10020000,
+	0x00000000,0x00001002,0x10010010,0xF8180000,0x00001000,0x10000010,0x00000000,0x00001000,
+	0x08000000,0x00000000,0x00000800,0x04000000,0x00000000,0x00000000,0x00300000,0x00000000,
+	0x0000000E,0x00018000,0x60000000,0x00000000,0x00001C00,0x13000000,0x00080000,0x000010E0,
+	0x10180008,0x00100000,0x00001007,0x1000C020,0x30400000,0x00001000,0x10001880,0xE1000000,
+	0x00001000,0x10030000,0x00000000,0x0000101C,0x10600000,0x00000000,0x00001180,0x1E000000,
+	0x00000000,0x00002000,0xC0000000,0x00000001,0x00060000,0x00000000,0x00000038,0x00000000,
+	0x00000000,0x00300000,0x00000000,0x0000000E,0x00018000,0x60000000,0x00000000,0x00001C00,
+	0x13000000,0x00000000,0x000010E0,0x10180000,0x00000000,0x00001007,0x1000C100,0x30800000,
+	0x00001000,0x10001840,0xE0400000,0x00001000,0x10030020,0x00100000,0x0000101C,0x10600008,
+	0x00000000,0x00001180,0x1E000000,0x00000000,0x00002000,0xC0000000,0x00000001,0x00060000,
+	0x00000000,0x00000038,0x00000000,0x00000000,0x00300000,0x00000000,0x0000000E,0x00018000,
+	0x60000000,0x00000000,0x00001C00,0x13000000,0x01000000,0x000010E0,0x10180080,0x00400000,
+	0x00001007,0x1000C020,0x30100000,0x00001000,0x10001818,0xE0200000,0x00001000,0x10030040,
+	0x00800000,0x0000101C,0x10600100,0x00000000,0x00001180,0x1E000000,0x00000000,0x00002000,
+	0xC0000000,0x00000001,0x00060000,0x00000000,0x00000038,0x00000000,0x00000000,0x00300000,
+	0x00000000,0x0000000E,0x00018000,0x60000000,0x00000000,0x00001C00,0x13000000,0x01800000,
+	0x000010E0,0x10180040,0x00200000,0x00001007,0x1000C020,0x30400000,0x00001000,0x10001880,
+	0xE1000000,0x00001000,0x10030100,0x01000000,0x0000101C,0x106000E0,0x00000000,0x00001180,
+	0x1E000000,0x00000000,0x00002000,0xC0000000,0x00000001,0x00060000,0x00000000,0x00000038,
+	0x00000000,0x00000000,0x00300000,0x00000000,0x0000000E,0x00018000,0x60000000,0x00000000,
+	0x00001C00,0x13000000,0x00000000,0x000010E0,0x10180060,0x00400000,0x00001007,0x1000C000,
+	0x30000000,0x00001000,0x10001800,0xE0000000,0x00001000,0x10030000,0x00600000,0x0000101C,
+	0x10600040,0x00000000,0x00001180,0x1E000000,0x00000000,0x00002000,0xC0000000,0x00000001,
+	0x00060000,0x00000000,0x00000038,0x00000000,0x00000000,0x00300000,0x00000000,0x0000000E,
+	0x00018000,0x60000000,0x00000000,0x00001C00,0x13000000,0x00000000,0x000010E0,0x10180000,
+	0x00E00000,0x00001007,0x1000C090,0x31080000,0x00001000,0x10001908,0xE1080000,0x00001000,
+	0x100300F0,0x00000000,0x0000101C,0x10600000,0x00000000,0x00001180,0x1E000000,0x00000000,
+	0x00002000,0xC0000000,0x00000001,0x00060000,0x00000000,0x00000038,0x00000000,0x00000020,
+	0x00300000,0x00000000,0x0000000C,0x00030000,0xC0000000,0x00000000,0x00002000,0x18000000,
+	0x00000000,0x00001600,0x11800000,0x00000000,0x00001040,0x10300000,0x00000000,0x0000100C,
+	0x10030000,0x80000000,0x00001000,0x10006000,0x18000000,0x00001000,0x1003F800,0x08000000,
+	0x000012FC,0xFD000800,0x08000003,0x003C0100,0x01000800,0x08000020,0x00200100,0x01000800,
+	0x08000020,0x00200100,0x01000800,0x08000020,0x00200100,0x01000800,0x08000020,0x00200100,
+	0x01000800,0x08000020,0x00200100,0x01000800,0x08000020,0x00200000,0x00000800,0x00000020,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00007FFC,0x80030000,0x80000001,
+	0x00020000,0x00004000,0x20000004,0x00080000,0x00002000,0x10000010,0x00100000,0x00001000,
+	0x08000020,0x00200000,0x00000800,0x08000020,0x10200000,0x00000800,0x080010C0,0x11200000,
+	0x00000800,0x08001120,0x0A200000,0x00000800,0x08000420,0x00200000,0x00001000,0x10000010,
+	0x00100000,0x00002000,0x40000008,0x00040000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0xFFFFF800,0x0800003F,0x00200100,0x01000800,0x08000020,0x00200100,
+	0x01000808,0x08100020,0x00200100,0x01000820,0x08400020,0x00200100,0x01000880,0x09000020,
+	0x00200100,0x01000800,0x08000020,0x00200100,0x01000800,0x08000020,0x00200100,0x00000800,
+	0x08000020,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xFFFFF800,0x0800003F,0x00200100,0x01000800,0x08000020,0x00200100,0x01000800,0x08000020,
+	0x00200100,0x01000900,0x09000020,0x00200100,0x01000880,0x08400020,0x00200100,0x01000820,
+	0x08100020,0x00200100,0x01000808,0x08080020,0x00200100,0x00000800,0x08000020,0x00200000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF800,0x0800003F,
+	0x00200100,0x01000800,0x09000020,0x00200100,0x01000880,0x08400020,0x00200100,0x01000820,
+	0x08100020,0x00200100,0x01000808,0x08300020,0x00200100,0x01000840,0x08800020,0x00200100,
+	0x01000900,0x08000020,0x00200100,0x00000800,0x08000020,0x00200000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF800,0x0800003F,0x00200100,0x01000800,
+	0x08000020,0x00200100,0x01000860,0x08600020,0x00200100,0x01000800,0x08000020,0x00200100,
+	0x01000800,0x08000020,0x00200100,0x01000800,0x08600020,0x00200100,0x01000860,0x08000020,
+	0x00200100,0x00000800,0x08000020,0x00200000,0x00000008,0x00080000,0x00000000,0x00000010,
+	0x00200000,0x00000000,0xFFFFF840,0x0180003F,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x01000000,0x00000000,0xFFFFF880,0x0040003F,0x00000000,0x00000020,0x00100000,0x00000000,
+	0x00000008,0x00000100,0x00800000,0x00000000,0x00000040,0x00300000,0x00000000,0xFFFFF808,
+	0x0010003F,0x00000000,0x00000020,0x00400000,0x00000000,0x00000180,0x00000060,0x00600000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF800,0x0000003F,0x00000000,0x00000000,
+	0x00600000,0x00000000,0x00000060,0x01000000,0x00000000,0x00000100,0x01000000,0x00000000,
+	0x00000100,0xFFFFF800,0x0800003F,0x00200100,0x01000800,0x08000020,0x00200100,0x01000800,
+	0x08000020,0x00200100,0x01000800,0x08000020,0x00200100,0x00000800,0x08000020,0x00200000,
+	0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200000,0x00000800,0x10000020,
+	0x00100000,0x00001000,0x20000010,0x00080000,0x00004000,0x80000004,0x00020000,0x80030000,
+	0x00000001,0x00007FFC,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xFFFFF800,0x1000003F,0x00000000,0x00006000,0x80000000,0x00000000,0x00010000,0x00000000,
+	0x00000006,0x000801C0,0x00200000,0x00000030,0x00400020,0x00200000,0x00000080,0x03000040,
+	0x00800000,0x00000400,0x08000100,0x01000000,0x00003000,0x40000080,0x00600000,0x00008000,
+	0x00000000,0x00000003,0x00040000,0x00000000,0xF8000018,0x003FFFFF,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00007FFC,0x80030000,0x80000001,0x00020000,0x00004000,
+	0x20000004,0x00080000,0x00001000,0x10000010,0x00100000,0x00000808,0x08080020,0x00200000,
+	0x00000810,0x08200020,0x00200000,0x00000840,0x08800020,0x00200000,0x00000900,0x08000020,
+	0x00200000,0x00000800,0x10000020,0x00200000,0x00001000,0x20000010,0x00100000,0x00002000,
+	0x40000008,0x00040000,0x00018000,0x00000003,0x0000C006,0x3FF80000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00007FFC,0x80030000,0x80000001,0x00020000,0x00004000,
+	0x20000004,0x00080000,0x00001000,0x10000010,0x00100000,0x00000800,0x08000020,0x00200000,
+	0x00000800,0x09000020,0x00200000,0x00000880,0x08400020,0x00200000,0x00000820,0x08100020,
+	0x00200000,0x00000810,0x10080020,0x00200000,0x00001000,0x20000010,0x00100000,0x00002000,
+	0x40000008,0x00040000,0x00018000,0x00000003,0x0000C006,0x3FF80000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00007FFC,0x80030000,0x80000001,0x00020000,0x00004000,
+	0x20000004,0x00080000,0x00001000,0x10000010,0x00100000,0x00000900,0x08800020,0x00200000,
+	0x00000840,0x08200020,0x00200000,0x00000818,0x08100020,0x00200000,0x00000820,0x08400020,
+	0x00200000,0x00000880,0x11000020,0x00200000,0x00001000,0x20000010,0x00100000,0x00002000,
+	0x40000008,0x00040000,0x00018000,0x00000003,0x0000C006,0x3FF80000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00007FFC,0x80030000,0x80000001,0x00020000,0x00004000,
+	0x20000004,0x00080000,0x00001000,0x10000010,0x00100000,0x000008C0,0x08200020,0x00200000,
+	0x00000820,0x08200020,0x00200000,0x00000840,0x08400020,0x00200000,0x00000880,0x08800020,
+	0x00200000,0x00000880,0x10600020,0x00200000,0x00001000,0x20000010,0x00100000,0x00002000,
+	0x40000008,0x00040000,0x00018000,0x00000003,0x0000C006,0x3FF80000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00007FFC,0x80030000,0x80000001,0x00020000,0x00004000,
+	0x20000004,0x00080000,0x00001000,0x10000010,0x00100000,0x00000820,0x08600020,0x00200000,
+	0x00000800,0x08000020,0x00200000,0x00000800,0x08000020,0x00200000,0x00000800,0x08200020,
+	0x00200000,0x00000860,0x10000020,0x00200000,0x00001000,0x20000010,0x00100000,0x00002000,
+	0x40000008,0x00040000,0x00018000,0x00000003,0x0000C006,0x3FF80000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00010004,0x80040000,0x00000000,0x00004008,0x20100000,
+	0x00000000,0x00001020,0x08400000,0x00000000,0x00000480,0x03000000,0x00000000,0x00000300,
+	0x04800000,0x00000000,0x00000840,0x10200000,0x00000000,0x00002010,0x40080000,0x00000000,
+	0x00008004,0x00040000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00407FFC,0x80030000,0x80000041,0x00320000,0x00004000,0x2000000C,0x000C0000,0x00001000,
+	0x10000012,0x00118000,0x40000800,0x08000020,0x00202000,0x18000800,0x08000020,0x00200400,
+	0x02000800,0x08000020,0x00200180,0x00400800,0x08000020,0x00200020,0x00180800,0x10000020,
+	0x00200004,0x00021000,0xA0000010,0x00100001,0x00004000,0x60000008,0x00040000,0x00019800,
+	0x04000003,0x0000C006,0x3FF80000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0xFFFFF800,0x00000000,0x00030000,0x00000000,0x00000004,0x00080000,0x00000000,
+	0x00040010,0x00100000,0x00000008,0x00100020,0x00200000,0x00000020,0x00400020,0x00200000,
+	0x00000080,0x01000020,0x00200000,0x00000000,0x00000020,0x00200000,0x00000000,0x00000010,
+	0x00080000,0x00000000,0x00000004,0x00020000,0xFFFFF800,0x00000001,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF800,0x00000000,0x00030000,0x00000000,
+	0x00000004,0x00080000,0x00000000,0x00000010,0x00100000,0x00000000,0x00000020,0x00200000,
+	0x00000100,0x00800020,0x00200000,0x00000040,0x00200020,0x00200000,0x00000010,0x00080020,
+	0x00200000,0x00000004,0x00000010,0x00080000,0x00000000,0x00000004,0x00020000,0xFFFFF800,
+	0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF800,
+	0x00000000,0x00030000,0x00000000,0x00000004,0x00080000,0x00000000,0x01000010,0x00100000,
+	0x00000080,0x00400020,0x00200000,0x00000030,0x00080020,0x00200000,0x00000010,0x00200020,
+	0x00200000,0x00000040,0x00800020,0x00200000,0x00000100,0x00000010,0x00080000,0x00000000,
+	0x00000004,0x00020000,0xFFFFF800,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0xFFFFF800,0x00000000,0x00030000,0x00000000,0x00000004,0x00080000,
+	0x00000000,0x00600010,0x00100000,0x00000060,0x00000020,0x00200000,0x00000000,0x00000020,
+	0x00200000,0x00000000,0x00000020,0x00200000,0x00000060,0x00600020,0x00200000,0x00000000,
+	0x00000010,0x00080000,0x00000000,0x00000004,0x00020000,0xFFFFF800,0x00000001,0x00000000,
+	0x18000000,0x00000000,0x00002000,0xC0000000,0x00000000,0x00010000,0x00000000,0x00000006,
+	0x00180000,0x00000000,0x00000020,0x00C00000,0x01000000,0x00000100,0xFE000080,0x0040003F,
+	0x00000200,0x01800020,0x00100000,0x00000040,0x00300008,0x00080000,0x0000000C,0x00020000,
+	0x80000000,0x00000001,0x00004000,0x30000000,0x00000000,0x00000800,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF800,0x0000003F,0x00010002,0x00020000,
+	0x00000001,0x00010002,0x00020000,0x00000001,0x00010002,0x00020000,0x00000001,0x00010002,
+	0x00020000,0x00000001,0x00010002,0x80040000,0x00000000,0x00008004,0x40080000,0x00000000,
+	0x00002018,0x1FE00000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x0003C000,0x20000000,0x00000000,0x00001000,0x08000000,0x00100000,0x00000800,0x08000010,
+	0x00200000,0x03800800,0x08000020,0x00200440,0x08200800,0x08000020,0x00200810,0x10101000,
+	0x10000020,0x00201008,0x2007E000,0x00000010,0x000FE000,0x00000000,0x00000000,0x00000000,
+	0x80000000,0x0000000F,0x00104020,0x40100000,0x00000020,0x00202010,0x20080800,0x10000020,
+	0x00202008,0x10082000,0xC0000020,0x00201008,0x10080000,0x00000020,0x00101008,0x10100000,
+	0x00000008,0x00081060,0xFF800000,0x0000003F,0x00000000,0x00000000,0x00000000,0x80000000,
+	0x0000000F,0x00104020,0x40100000,0x00000020,0x00202010,0x20080000,0x00000020,0x00202008,
+	0x1008C000,0x20000020,0x00201008,0x10081000,0x08000020,0x00101008,0x10100000,0x00000008,
+	0x00081060,0xFF800000,0x0000003F,0x00000000,0x00000000,0x00000000,0x80000000,0x0000000F,
+	0x00104020,0x40108000,0x40000020,0x00202010,0x20082000,0x10000020,0x00202008,0x10080800,
+	0x08000020,0x00201008,0x10083000,0x40000020,0x00101008,0x10108000,0x00000008,0x00081060,
+	0xFF800000,0x0000003F,0x00000000,0x00000000,0x00000000,0x80000000,0x0000000F,0x00104020,
+	0x40104000,0x20000020,0x00202010,0x20081000,0x10000020,0x00202008,0x10082000,0x20000020,
+	0x00201008,0x10084000,0x40000020,0x00101008,0x10102000,0x10000008,0x00081060,0xFF800000,
+	0x0000003F,0x00000000,0x00000000,0x00000000,0x80000000,0x0000000F,0x00104020,0x40100000,
+	0x30000020,0x00202010,0x20083000,0x00000020,0x00202008,0x10080000,0x00000020,0x00201008,
+	0x10080000,0x30000020,0x00101008,0x10103000,0x00000008,0x00081060,0xFF800000,0x0000003F,
+	0x00000000,0x00000000,0x00000000,0x80000000,0x0000000F,0x00104020,0x40100000,0x00000020,
+	0x00202010,0x20087000,0x88000020,0x00202008,0x10088800,0x88000020,0x00201008,0x10084800,
+	0x70000020,0x00101008,0x10100000,0x00000008,0x00081060,0xFF800000,0x0000003F,0x00000000,
+	0x00000000,0x00000000,0x80000000,0x0000000F,0x00104020,0x20100000,0x00000020,0x00201010,
+	0x10080000,0x00000020,0x00201008,0x10080000,0x00000020,0x00200808,0x08080000,0x00000020,
+	0x00100808,0x08100000,0x00000008,0x00060860,0xFF800000,0x00000001,0x000608C0,0x08200000,
+	0x00000008,0x00100810,0x08080000,0x00000020,0x00200808,0x08080000,0x00000020,0x00200808,
+	0x08080000,0x00000020,0x00200808,0x08080000,0x00000020,0x00100810,0x08600000,0x00000010,
+	0x00080F80,0x00000000,0x00000000,0x00000000,0xFE000000,0x00000000,0x00070180,0x00600000,
+	0x00000008,0x00100010,0x00100000,0x00000010,0x00200008,0x00080000,0x00001020,0x10A00008,
+	0x00080000,0x00001140,0x11200008,0x00080000,0x00001120,0x0E200008,0x00100000,0x00000010,
+	0x00080010,0x00000000,0x00000000,0x00000000,0xFE000000,0x00000000,0x000305C0,0x04200000,
+	0x0000000C,0x00100410,0x04100000,0x00000010,0x00200408,0x04080800,0x30000020,0x00200408,
+	0x04084000,0x80000020,0x00200408,0x04080000,0x00000020,0x00200408,0x04100000,0x00000010,
+	0x00100420,0x04C00000,0x00000008,0x00000700,0x00000000,0x00000000,0x00000000,0xFE000000,
+	0x00000000,0x000305C0,0x04200000,0x0000000C,0x00100410,0x04100000,0x00000010,0x00200408,
+	0x04080000,0x80000020,0x00200408,0x04084000,0x30000020,0x00200408,0x04080800,0x08000020,
+	0x00200408,0x04100000,0x00000010,0x00100420,0x04C00000,0x00000008,0x00000700,0x00000000,
+	0x00000000,0x00000000,0xFE000000,0x00000000,0x000305C0,0x04200000,0x0000000C,0x00100410,
+	0x04108000,0x40000010,0x00200408,0x04082000,0x10000020,0x00200408,0x04080800,0x10000020,
+	0x00200408,0x04082000,0x40000020,0x00200408,0x04108000,0x00000010,0x00100420,0x04C00000,
+	0x00000008,0x00000700,0x00000000,0x00000000,0x00000000,0xFE000000,0x00000000,0x000305C0,
+	0x04200000,0x0000000C,0x00100410,0x04103000,0x30000010,0x00200408,0x04080000,0x00000020,
+	0x00200408,0x04080000,0x00000020,0x00200408,0x04082000,0x30000020,0x00200408,0x04102000,
+	0x00000010,0x00100420,0x04C00000,0x00000008,0x00000700,0x00000000,0x08000000,0x00000000,
+	0x00001000,0x20000000,0x003FFFF8,0x0000C000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC0000000,0x003FFFF8,0x00002000,0x10000000,0x00000000,0x00000800,0x00004000,0x20000000,
+	0x00000000,0x00001000,0x08000000,0x003FFFF8,0x00000800,0x10000000,0x00000000,0x00002000,
+	0x40000000,0x00000000,0x60000000,0x00000000,0x00002000,0x00000000,0x003FFFF8,0x00000000,
+	0x60000000,0x00000000,0x00006000,0x00000000,0x00000000,0x00000000,0xFC000000,0x00000000,
+	0x00030300,0x00800000,0x0000000C,0x00100040,0x00200800,0x10000010,0x00200010,0x00101000,
+	0x10000020,0x00200010,0x00112000,0xA0000020,0x00200010,0x00104000,0x60000020,0x00200020,
+	0x00209800,0x00000010,0x00080043,0x008C0000,0x00000006,0x0001FFF0,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x00000000,0x00000020,0x00106000,
+	0x10000000,0x00000010,0x00081000,0x10000000,0x00000008,0x00082000,0x40000000,0x00000008,
+	0x00084000,0x40000000,0x00000008,0x00103000,0x00000000,0x00000010,0xFFE00000,0x0000003F,
+	0x00000000,0x00000000,0x00000000,0xFE000000,0x00000000,0x00070180,0x00600000,0x00000008,
+	0x00100010,0x00100000,0x00000010,0x00200008,0x00080800,0x30000020,0x00200008,0x00084000,
+	0x80000020,0x00200008,0x00080000,0x00000020,0x00200008,0x00100000,0x00000010,0x00100010,
+	0x00600000,0x0000000C,0x00030180,0xFE000000,0x00000000,0x00000000,0x00000000,0xFE000000,
+	0x00000000,0x00070180,0x00600000,0x00000008,0x00100010,0x00100000,0x00000010,0x00200008,
+	0x00080000,0x80000020,0x00200008,0x00084000,0x20000020,0x00200008,0x00081800,0x08000020,
+	0x00200008,0x00100000,0x00000010,0x00100010,0x00600000,0x0000000C,0x00030180,0xFE000000,
+	0x00000000,0x00000000,0x00000000,0xFE000000,0x00000000,0x00070180,0x00600000,0x00000008,
+	0x00100010,0x00108000,0x40000010,0x00200008,0x00082000,0x10000020,0x00200008,0x00080800,
+	0x10000020,0x00200008,0x00082000,0x40000020,0x00200008,0x00108000,0x00000010,0x00100010,
+	0x00600000,0x0000000C,0x00030180,0xFE000000,0x00000000,0x00000000,0x00000000,0xFE000000,
+	0x00000000,0x00070180,0x00600000,0x00000008,0x00100010,0x00106000,0x10000010,0x00200008,
+	0x00081000,0x10000020,0x00200008,0x00082000,0x40000020,0x00200008,0x00084000,0x40000020,
+	0x00200008,0x00103000,0x00000010,0x00100010,0x00600000,0x0000000C,0x00030180,0xFE000000,
+	0x00000000,0x00000000,0x00000000,0xFE000000,0x00000000,0x00070180,0x00600000,0x00000008,
+	0x00100010,0x00103000,0x30000010,0x00200008,0x00080000,0x00000020,0x00200008,0x00080000,
+	0x00000020,0x00200008,0x00080000,0x30000020,0x00200008,0x00102000,0x00000010,0x00100010,
+	0x00600000,0x0000000C,0x00030180,0xFE000000,0x00000000,0x00000000,0x00000000,0x01000000,
+	0x00000000,0x00000100,0x01000000,0x00000000,0x00000100,0x01000000,0x00000000,0x00000100,
+	0x01000000,0x00000000,0x00000100,0x81060000,0x00000001,0x00018106,0x01000000,0x00000000,
+	0x00000100,0x01000000,0x00000000,0x00000100,0x01000000,0x00000000,0x00000100,0x01000000,
+	0x00000000,0x00000100,0x00000000,0x00000000,0x00000000,0xFE000000,0x00000000,0x00470180,
+	0x00600000,0x00000038,0x00180010,0x00100000,0x00000014,0x00230008,0x80080000,0x00000020,
+	0x00204008,0x30080000,0x00000020,0x00200808,0x04080000,0x00000020,0x00200308,0x00900000,
+	0x00000010,0x00100060,0x00700000,0x0000000C,0x00030188,0xFE040000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x0003FFF8,0x00000000,0x0000000C,0x00100000,0x00000000,
+	0x08000020,0x00200000,0x00000800,0x30000020,0x00200000,0x00004000,0x80000020,0x00200000,
+	0x00000000,0x00000020,0x00100000,0x00000000,0x00000008,0x000C0000,0xFFF80000,0x0000003F,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0003FFF8,0x00000000,0x0000000C,
+	0x00100000,0x00000000,0x00000020,0x00200000,0x00000000,0x80000020,0x00200000,0x00004000,
+	0x30000020,0x00200000,0x00000800,0x08000020,0x00100000,0x00000000,0x00000008,0x000C0000,
+	0xFFF80000,0x0000003F,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0003FFF8,
+	0x00000000,0x0000000C,0x00100000,0x00008000,0x40000020,0x00200000,0x00002000,0x10000020,
+	0x00200000,0x00000800,0x10000020,0x00200000,0x00002000,0x40000020,0x00100000,0x00008000,
+	0x00000008,0x000C0000,0xFFF80000,0x0000003F,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x0003FFF8,0x00000000,0x0000000C,0x00100000,0x00003000,0x30000020,0x00200000,
+	0x00000000,0x00000020,0x00200000,0x00000000,0x00000020,0x00200000,0x00002000,0x30000020,
+	0x00100000,0x00002000,0x00000008,0x000C0000,0xFFF80000,0x0000003F,0x00000000,0x00000000,
+	0x00000018,0x00600000,0x00000000,0x00000180,0x0E000000,0x00000000,0x00003000,0xC0000000,
+	0x00001800,0x06070000,0x00000000,0xC00001D8,0x00300000,0x00002000,0x1000000C,0x00038000,
+	0x60000800,0x00000000,0x00001800,0x07000000,0x00000000,0x000000C0,0x00300000,0x00000000,
+	0x00000008,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,
+	0x00000008,0x00100020,0x00100000,0x00000010,0x00200010,0x00080000,0x00000020,0x00200008,
+	0x00080000,0x00000020,0x00200008,0x00080000,0x00000020,0x00200008,0x00100000,0x00000010,
+	0x00080010,0x00600000,0x00000004,0x0003FF80,0x00000000,0x00000000,0x00000018,0x00600000,
+	0x00000000,0x00000180,0x0E000000,0x00000000,0x00003000,0xC0006000,0x60001800,0x06070000,
+	0x00000000,0x000001D8,0x00300000,0x00000000,0x0000000C,0x00038000,0x60006000,0x60000000,
+	0x00001800,0x07000000,0x00000000,0x000000C0,0x00300000,0x00000000,0x00000008
+};
+const IndexedFont Lato_Hairline_38_Indexed = {Lato_Hairline_38, Lato_Hairline_38_glyphs, Lato_Hairline_38_data, 32, 224, 47};
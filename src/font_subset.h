@@ -0,0 +1,1730 @@
+/**************************************************************************
+ * font_subset.h
+ *
+ * GENERATED by tools/font_subset.py out of font.h - do not edit!
+ * The fonts contain only the characters used by the watch.
+ * Size in bytes:
+ * font                  chars   font.h   subset  saved
+ * DejaVu_Sans_Mono_12      94     3696     2060    44%
+ * DejaVu_Sans_Mono_16      73     6383     2676    58%
+ * Lato_Hairline_12         73     3362     1694    50%
+ * Lato_Hairline_17         11     5982     1161    81%
+ * Lato_Hairline_18         11     6275     1182    81%
+ * Lato_Hairline_38         11    23899     2081    91%
+ * total                          49597    10854    78%
+**************************************************************************/
+
+#include <Arduino.h>
+
+// easy to remember and easy to handle font names
+#define FONT_0_SMALL ArialMT_Plain_10
+#define FONT_0_NORMAL ArialMT_Plain_16 
+#define FONT_0_LARGE ArialMT_Plain_24 
+#define FONT_1_NORMAL DejaVu_Sans_Mono_12
+#define FONT_1_LARGE DejaVu_Sans_Mono_16
+#define FONT_2_SMALL Lato_Hairline_12
+#define FONT_2_NORMAL Lato_Hairline_17
+#define FONT_2_LARGE Lato_Hairline_18
+#define FONT_2_XLARGE Lato_Hairline_38
+
+// DejaVu_Sans_Mono_12 --> Height = 15 --> lineHeight = 12
+// DejaVu_Sans_Mono_16 --> Height = 19
+// Lato_Hairline_12 --> Height = 15
+// Lato_Hairline_16 --> Height = 20
+// Lato_Hairline_18 --> Height = 22
+// Lato_Hairline_38 --> Height = 47
+
+// Created by http://oleddisplay.squix.ch/ Consider a donation
+// In case of problems make sure that you are using the font file with the correct version!
+const uint8_t DejaVu_Sans_Mono_12[] PROGMEM = {
+	0x07, // Width: 7
+	0x0F, // Height: 15
+	0x20, // First Char: 32
+	0xE0, // Numbers of Chars: 224
+
+	// Jump Table:
+	0xFF, 0xFF, 0x00, 0x07,  // 32:65535
+	0x00, 0x00, 0x08, 0x07,  // 33:0
+	0x00, 0x08, 0x09, 0x07,  // 34:8
+	0x00, 0x11, 0x0D, 0x07,  // 35:17
+	0x00, 0x1E, 0x0C, 0x07,  // 36:30
+	0x00, 0x2A, 0x0E, 0x07,  // 37:42
+	0x00, 0x38, 0x0E, 0x07,  // 38:56
+	0x00, 0x46, 0x07, 0x07,  // 39:70
+	0x00, 0x4D, 0x0C, 0x07,  // 40:77
+	0x00, 0x59, 0x0A, 0x07,  // 41:89
+	0x00, 0x63, 0x0B, 0x07,  // 42:99
+	0x00, 0x6E, 0x0E, 0x07,  // 43:110
+	0x00, 0x7C, 0x08, 0x07,  // 44:124
+	0x00, 0x84, 0x0A, 0x07,  // 45:132
+	0x00, 0x8E, 0x08, 0x07,  // 46:142
+	0x00, 0x96, 0x0D, 0x07,  // 47:150
+	0x00, 0xA3, 0x0E, 0x07,  // 48:163
+	0x00, 0xB1, 0x0C, 0x07,  // 49:177
+	0x00, 0xBD, 0x0E, 0x07,  // 50:189
+	0x00, 0xCB, 0x0E, 0x07,  // 51:203
+	0x00, 0xD9, 0x0E, 0x07,  // 52:217
+	0x00, 0xE7, 0x0E, 0x07,  // 53:231
+	0x00, 0xF5, 0x0E, 0x07,  // 54:245
+	0x01, 0x03, 0x0D, 0x07,  // 55:259
+	0x01, 0x10, 0x0E, 0x07,  // 56:272
+	0x01, 0x1E, 0x0E, 0x07,  // 57:286
+	0x01, 0x2C, 0x08, 0x07,  // 58:300
+	0x01, 0x34, 0x08, 0x07,  // 59:308
+	0x01, 0x3C, 0x0E, 0x07,  // 60:316
+	0x01, 0x4A, 0x0E, 0x07,  // 61:330
+	0x01, 0x58, 0x0E, 0x07,  // 62:344
+	0x01, 0x66, 0x0D, 0x07,  // 63:358
+	0x01, 0x73, 0x0E, 0x07,  // 64:371
+	0x01, 0x81, 0x0E, 0x07,  // 65:385
+	0x01, 0x8F, 0x0E, 0x07,  // 66:399
+	0x01, 0x9D, 0x0E, 0x07,  // 67:413
+	0x01, 0xAB, 0x0E, 0x07,  // 68:427
+	0x01, 0xB9, 0x0E, 0x07,  // 69:441
+	0x01, 0xC7, 0x0D, 0x07,  // 70:455
+	0x01, 0xD4, 0x0E, 0x07,  // 71:468
+	0x01, 0xE2, 0x0E, 0x07,  // 72:482
+	0x01, 0xF0, 0x0C, 0x07,  // 73:496
+	0x01, 0xFC, 0x0C, 0x07,  // 74:508
+	0x02, 0x08, 0x0E, 0x07,  // 75:520
+	0x02, 0x16, 0x0E, 0x07,  // 76:534
+	0x02, 0x24, 0x0E, 0x07,  // 77:548
+	0x02, 0x32, 0x0E, 0x07,  // 78:562
+	0x02, 0x40, 0x0E, 0x07,  // 79:576
+	0x02, 0x4E, 0x0D, 0x07,  // 80:590
+	0x02, 0x5B, 0x0E, 0x07,  // 81:603
+	0x02, 0x69, 0x0E, 0x07,  // 82:617
+	0x02, 0x77, 0x0E, 0x07,  // 83:631
+	0x02, 0x85, 0x0D, 0x07,  // 84:645
+	0x02, 0x92, 0x0E, 0x07,  // 85:658
+	0x02, 0xA0, 0x0D, 0x07,  // 86:672
+	0x02, 0xAD, 0x0E, 0x07,  // 87:685
+	0x02, 0xBB, 0x0E, 0x07,  // 88:699
+	0x02, 0xC9, 0x0D, 0x07,  // 89:713
+	0x02, 0xD6, 0x0E, 0x07,  // 90:726
+	0x02, 0xE4, 0x0A, 0x07,  // 91:740
+	0x02, 0xEE, 0x0E, 0x07,  // 92:750
+	0x02, 0xFC, 0x08, 0x07,  // 93:764
+	0x03, 0x04, 0x0B, 0x07,  // 94:772
+	0x03, 0x0F, 0x0E, 0x07,  // 95:783
+	0x03, 0x1D, 0x09, 0x07,  // 96:797
+	0x03, 0x26, 0x0C, 0x07,  // 97:806
+	0x03, 0x32, 0x0C, 0x07,  // 98:818
+	0x03, 0x3E, 0x0C, 0x07,  // 99:830
+	0x03, 0x4A, 0x0C, 0x07,  // 100:842
+	0x03, 0x56, 0x0C, 0x07,  // 101:854
+	0x03, 0x62, 0x0B, 0x07,  // 102:866
+	0x03, 0x6D, 0x0C, 0x07,  // 103:877
+	0x03, 0x79, 0x0C, 0x07,  // 104:889
+	0x03, 0x85, 0x0C, 0x07,  // 105:901
+	0x03, 0x91, 0x0A, 0x07,  // 106:913
+	0x03, 0x9B, 0x0C, 0x07,  // 107:923
+	0x03, 0xA7, 0x0C, 0x07,  // 108:935
+	0x03, 0xB3, 0x0C, 0x07,  // 109:947
+	0x03, 0xBF, 0x0C, 0x07,  // 110:959
+	0x03, 0xCB, 0x0C, 0x07,  // 111:971
+	0x03, 0xD7, 0x0C, 0x07,  // 112:983
+	0x03, 0xE3, 0x0C, 0x07,  // 113:995
+	0x03, 0xEF, 0x0D, 0x07,  // 114:1007
+	0x03, 0xFC, 0x0C, 0x07,  // 115:1020
+	0x04, 0x08, 0x0C, 0x07,  // 116:1032
+	0x04, 0x14, 0x0C, 0x07,  // 117:1044
+	0x04, 0x20, 0x0B, 0x07,  // 118:1056
+	0x04, 0x2B, 0x0D, 0x07,  // 119:1067
+	0x04, 0x38, 0x0C, 0x07,  // 120:1080
+	0x04, 0x44, 0x0B, 0x07,  // 121:1092
+	0x04, 0x4F, 0x0C, 0x07,  // 122:1103
+	0x04, 0x5B, 0x0C, 0x07,  // 123:1115
+	0x04, 0x67, 0x08, 0x07,  // 124:1127
+	0x04, 0x6F, 0x0B, 0x07,  // 125:1135
+	0x04, 0x7A, 0x0E, 0x07,  // 126:1146
+	0xFF, 0xFF, 0x00, 0x07,  // 127:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 128:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 129:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 130:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 131:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 132:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 133:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 134:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 135:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 136:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 137:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 138:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 139:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 140:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 141:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 142:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 143:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 144:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 145:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 146:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 147:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 148:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 149:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 150:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 151:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 152:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 153:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 154:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 155:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 156:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 157:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 158:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 159:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 160:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 161:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 162:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 163:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 164:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 165:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 166:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 167:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 168:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 169:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 170:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 171:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 172:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 173:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 174:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 175:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 176:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 177:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 178:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 179:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 180:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 181:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 182:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 183:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 184:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 185:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 186:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 187:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 188:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 189:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 190:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 191:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 192:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 193:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 194:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 195:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 196:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 197:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 198:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 199:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 200:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 201:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 202:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 203:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 204:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 205:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 206:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 207:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 208:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 209:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 210:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 211:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 212:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 213:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 214:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 215:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 216:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 217:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 218:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 219:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 220:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 221:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 222:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 223:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 224:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 225:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 226:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 227:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 228:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 229:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 230:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 231:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 232:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 233:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 234:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 235:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 236:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 237:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 238:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 239:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 240:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 241:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 242:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 243:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 244:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 245:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 246:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 247:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 248:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 249:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 250:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 251:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 252:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 253:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 254:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 255:65535
+
+	// Font Data:
+	0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x0D,	// 33
+	0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,	// 34
+	0x00,0x02,0x40,0x0E,0xE0,0x03,0x50,0x0A,0xC0,0x07,0x70,0x02,0x40,	// 35
+	0x00,0x00,0xE0,0x04,0x90,0x08,0xF8,0x3F,0x10,0x09,0x20,0x07,	// 36
+	0x30,0x00,0x48,0x01,0x48,0x01,0xB0,0x06,0x80,0x09,0x40,0x09,0x00,0x06,	// 37
+	0x00,0x00,0x00,0x07,0xF0,0x0C,0xC8,0x08,0x08,0x0B,0x08,0x06,0x00,0x0B,	// 38
+	0x00,0x00,0x00,0x00,0x00,0x00,0x38,	// 39
+	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0x1C,0x1C,0x04,0x10,	// 40
+	0x00,0x00,0x00,0x00,0x04,0x10,0x1C,0x1C,0xE0,0x03,	// 41
+	0x00,0x00,0x90,0x00,0x60,0x00,0xF8,0x01,0x60,0x00,0x90,	// 42
+	0x00,0x01,0x00,0x01,0x00,0x01,0xE0,0x0F,0x00,0x01,0x00,0x01,0x00,0x01,	// 43
+	0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x0C,	// 44
+	0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,	// 45
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,	// 46
+	0x00,0x00,0x00,0x10,0x00,0x0C,0x00,0x03,0xC0,0x00,0x30,0x00,0x08,	// 47
+	0x00,0x00,0xE0,0x03,0x18,0x0C,0x08,0x08,0x88,0x08,0x18,0x0C,0xE0,0x03,	// 48
+	0x00,0x00,0x08,0x08,0x08,0x08,0xF8,0x0F,0x00,0x08,0x00,0x08,	// 49
+	0x00,0x00,0x10,0x08,0x08,0x0C,0x08,0x0A,0x08,0x09,0x88,0x08,0x70,0x08,	// 50
+	0x00,0x00,0x10,0x04,0x08,0x08,0x88,0x08,0x88,0x08,0x88,0x08,0x70,0x07,	// 51
+	0x00,0x00,0x00,0x03,0xC0,0x02,0x60,0x02,0x18,0x02,0xF8,0x0F,0x00,0x02,	// 52
+	0x00,0x00,0x78,0x04,0x48,0x08,0x48,0x08,0x48,0x08,0xC8,0x0C,0x80,0x07,	// 53
+	0x00,0x00,0xE0,0x03,0x90,0x0C,0x48,0x08,0x48,0x08,0xC8,0x0C,0x90,0x07,	// 54
+	0x00,0x00,0x08,0x00,0x08,0x08,0x08,0x06,0x88,0x01,0x78,0x00,0x18,	// 55
+	0x00,0x00,0x70,0x07,0x88,0x08,0x88,0x08,0x88,0x08,0x88,0x08,0x70,0x07,	// 56
+	0x00,0x00,0xF0,0x04,0x18,0x09,0x08,0x09,0x08,0x09,0x98,0x04,0xE0,0x03,	// 57
+	0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x0C,	// 58
+	0x00,0x00,0x00,0x00,0x00,0x10,0xC0,0x0C,	// 59
+	0x00,0x00,0x80,0x01,0x80,0x01,0x40,0x02,0x40,0x02,0x40,0x02,0x20,0x04,	// 60
+	0x00,0x00,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,	// 61
+	0x00,0x00,0x20,0x04,0x40,0x02,0x40,0x02,0x40,0x02,0x80,0x01,0x80,0x01,	// 62
+	0x00,0x00,0x00,0x00,0x10,0x00,0x88,0x0D,0xC8,0x00,0x48,0x00,0x30,	// 63
+	0x00,0x00,0xC0,0x0F,0x20,0x18,0x10,0x23,0x90,0x24,0xB0,0x24,0xE0,0x07,	// 64
+	0x00,0x00,0x00,0x0C,0xC0,0x03,0x38,0x02,0x38,0x02,0xC0,0x03,0x00,0x0C,	// 65
+	0x00,0x00,0xF8,0x0F,0x88,0x08,0x88,0x08,0x88,0x08,0x88,0x08,0x70,0x07,	// 66
+	0x00,0x00,0xE0,0x03,0x10,0x04,0x08,0x08,0x08,0x08,0x08,0x08,0x10,0x04,	// 67
+	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0x10,0x04,0xE0,0x03,	// 68
+	0x00,0x00,0xF8,0x0F,0x88,0x08,0x88,0x08,0x88,0x08,0x88,0x08,0x88,0x08,	// 69
+	0x00,0x00,0xF8,0x0F,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,	// 70
+	0x00,0x00,0xE0,0x03,0x10,0x04,0x08,0x08,0x08,0x08,0x88,0x08,0x90,0x07,	// 71
+	0x00,0x00,0xF8,0x0F,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xF8,0x0F,	// 72
+	0x00,0x00,0x08,0x08,0x08,0x08,0xF8,0x0F,0x08,0x08,0x08,0x08,	// 73
+	0x00,0x00,0x00,0x04,0x00,0x08,0x08,0x08,0x08,0x08,0xF8,0x07,	// 74
+	0x00,0x00,0xF8,0x0F,0x80,0x00,0xC0,0x00,0x20,0x03,0x10,0x06,0x08,0x08,	// 75
+	0x00,0x00,0xF8,0x0F,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,	// 76
+	0x00,0x00,0xF8,0x0F,0x30,0x00,0xC0,0x01,0xC0,0x01,0x30,0x00,0xF8,0x0F,	// 77
+	0x00,0x00,0xF8,0x0F,0x18,0x00,0xE0,0x00,0x80,0x03,0x00,0x0C,0xF8,0x0F,	// 78
+	0x00,0x00,0xE0,0x03,0x18,0x0C,0x08,0x08,0x08,0x08,0x18,0x0C,0xE0,0x03,	// 79
+	0x00,0x00,0xF8,0x0F,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x70,	// 80
+	0x00,0x00,0xE0,0x03,0x18,0x0C,0x08,0x08,0x08,0x08,0x18,0x3C,0xE0,0x07,	// 81
+	0x00,0x00,0xF8,0x0F,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x01,0x70,0x06,	// 82
+	0x00,0x00,0x70,0x04,0xC8,0x08,0x88,0x08,0x88,0x08,0x88,0x08,0x10,0x07,	// 83
+	0x08,0x00,0x08,0x00,0x08,0x00,0xF8,0x0F,0x08,0x00,0x08,0x00,0x08,	// 84
+	0x00,0x00,0xF8,0x07,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0xF8,0x07,	// 85
+	0x00,0x00,0x18,0x00,0xE0,0x01,0x00,0x0E,0x00,0x0E,0xE0,0x01,0x18,	// 86
+	0xF8,0x01,0x00,0x0E,0xC0,0x03,0x30,0x00,0xC0,0x03,0x00,0x0E,0xF8,0x01,	// 87
+	0x00,0x00,0x08,0x08,0x30,0x06,0xC0,0x01,0xC0,0x01,0x30,0x06,0x08,0x08,	// 88
+	0x08,0x00,0x10,0x00,0x60,0x00,0x80,0x0F,0x60,0x00,0x10,0x00,0x08,	// 89
+	0x00,0x00,0x08,0x0C,0x08,0x0E,0x88,0x09,0xC8,0x08,0x38,0x08,0x18,0x08,	// 90
+	0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x1F,0x04,0x10,	// 91
+	0x00,0x00,0x08,0x00,0x30,0x00,0xC0,0x00,0x00,0x03,0x00,0x0C,0x00,0x10,	// 92
+	0x00,0x00,0x00,0x00,0x04,0x10,0xFC,0x1F,	// 93
+	0x20,0x00,0x10,0x00,0x08,0x00,0x08,0x00,0x10,0x00,0x20,	// 94
+	0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,	// 95
+	0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x08,	// 96
+	0x00,0x00,0x40,0x06,0x20,0x09,0x20,0x09,0x20,0x09,0xC0,0x0F,	// 97
+	0x00,0x00,0xFC,0x0F,0x20,0x08,0x20,0x08,0x20,0x08,0xC0,0x07,	// 98
+	0x00,0x00,0xC0,0x07,0x60,0x0C,0x20,0x08,0x20,0x08,0x40,0x08,	// 99
+	0x00,0x00,0xC0,0x07,0x20,0x08,0x20,0x08,0x20,0x08,0xFC,0x0F,	// 100
+	0x00,0x00,0xC0,0x07,0x60,0x09,0x20,0x09,0x20,0x09,0xC0,0x05,	// 101
+	0x00,0x00,0x20,0x00,0x20,0x00,0xF8,0x0F,0x24,0x00,0x24,	// 102
+	0x00,0x00,0xC0,0x07,0x20,0x28,0x20,0x48,0x20,0x48,0xE0,0x3F,	// 103
+	0x00,0x00,0xFC,0x0F,0x40,0x00,0x20,0x00,0x20,0x00,0xC0,0x0F,	// 104
+	0x00,0x00,0x20,0x08,0x20,0x08,0xE4,0x0F,0x00,0x08,0x00,0x08,	// 105
+	0x00,0x00,0x00,0x00,0x20,0x40,0x20,0x40,0xE4,0x3F,	// 106
+	0x00,0x00,0xFC,0x0F,0x00,0x01,0x80,0x02,0x40,0x04,0x20,0x08,	// 107
+	0x00,0x00,0x04,0x00,0x04,0x00,0xFC,0x07,0x00,0x08,0x00,0x08,	// 108
+	0x00,0x00,0xE0,0x0F,0x20,0x00,0xE0,0x0F,0x20,0x00,0xE0,0x0F,	// 109
+	0x00,0x00,0xE0,0x0F,0x40,0x00,0x20,0x00,0x20,0x00,0xC0,0x0F,	// 110
+	0x00,0x00,0xC0,0x07,0x20,0x08,0x20,0x08,0x20,0x08,0xC0,0x07,	// 111
+	0x00,0x00,0xE0,0x7F,0x20,0x08,0x20,0x08,0x20,0x08,0xC0,0x07,	// 112
+	0x00,0x00,0xC0,0x07,0x20,0x08,0x20,0x08,0x20,0x08,0xE0,0x7F,	// 113
+	0x00,0x00,0x00,0x00,0xE0,0x0F,0x60,0x00,0x20,0x00,0x20,0x00,0x40,	// 114
+	0x00,0x00,0xC0,0x04,0x20,0x09,0x20,0x09,0x20,0x09,0x40,0x06,	// 115
+	0x00,0x00,0x20,0x00,0x20,0x00,0xF8,0x0F,0x20,0x08,0x20,0x08,	// 116
+	0x00,0x00,0xE0,0x07,0x00,0x08,0x00,0x08,0x00,0x08,0xE0,0x0F,	// 117
+	0x00,0x00,0x60,0x00,0x80,0x03,0x00,0x0C,0x80,0x03,0x60,	// 118
+	0x60,0x00,0x80,0x03,0x00,0x0E,0x80,0x01,0x00,0x0E,0x80,0x03,0x60,	// 119
+	0x00,0x00,0x20,0x08,0xC0,0x06,0x00,0x01,0xC0,0x06,0x20,0x08,	// 120
+	0x00,0x00,0x60,0x40,0x80,0x67,0x00,0x1C,0x80,0x03,0x60,	// 121
+	0x00,0x00,0x20,0x0C,0x20,0x0A,0x20,0x09,0xA0,0x08,0x60,0x08,	// 122
+	0x00,0x00,0x80,0x00,0x80,0x00,0x7C,0x1F,0x04,0x10,0x04,0x10,	// 123
+	0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,	// 124
+	0x00,0x00,0x04,0x10,0x04,0x10,0x7C,0x1F,0x80,0x00,0x80,	// 125
+	0x00,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x01,0x00,0x01,0x00,0x01	// 126
+};
+
+// Created by http://oleddisplay.squix.ch/ Consider a donation
+// In case of problems make sure that you are using the font file with the correct version!
+const uint8_t DejaVu_Sans_Mono_16[] PROGMEM = {
+	0x0A, // Width: 10
+	0x13, // Height: 19
+	0x20, // First Char: 32
+	0xE0, // Numbers of Chars: 224
+
+	// Jump Table:
+	0xFF, 0xFF, 0x00, 0x0A,  // 32:65535
+	0x00, 0x00, 0x0E, 0x0A,  // 33:0
+	0xFF, 0xFF, 0x00, 0x0A,  // 34:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 35:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 36:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 37:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 38:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 39:65535
+	0x00, 0x0E, 0x15, 0x0A,  // 40:14
+	0x00, 0x23, 0x11, 0x0A,  // 41:35
+	0xFF, 0xFF, 0x00, 0x0A,  // 42:65535
+	0x00, 0x34, 0x17, 0x0A,  // 43:52
+	0x00, 0x4B, 0x11, 0x0A,  // 44:75
+	0x00, 0x5C, 0x14, 0x0A,  // 45:92
+	0x00, 0x70, 0x11, 0x0A,  // 46:112
+	0x00, 0x81, 0x16, 0x0A,  // 47:129
+	0x00, 0x97, 0x1A, 0x0A,  // 48:151
+	0x00, 0xB1, 0x17, 0x0A,  // 49:177
+	0x00, 0xC8, 0x1A, 0x0A,  // 50:200
+	0x00, 0xE2, 0x1A, 0x0A,  // 51:226
+	0x00, 0xFC, 0x1A, 0x0A,  // 52:252
+	0x01, 0x16, 0x1A, 0x0A,  // 53:278
+	0x01, 0x30, 0x1A, 0x0A,  // 54:304
+	0x01, 0x4A, 0x19, 0x0A,  // 55:330
+	0x01, 0x63, 0x1A, 0x0A,  // 56:355
+	0x01, 0x7D, 0x1A, 0x0A,  // 57:381
+	0x01, 0x97, 0x11, 0x0A,  // 58:407
+	0xFF, 0xFF, 0x00, 0x0A,  // 59:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 60:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 61:65535
+	0x01, 0xA8, 0x1A, 0x0A,  // 62:424
+	0x01, 0xC2, 0x16, 0x0A,  // 63:450
+	0xFF, 0xFF, 0x00, 0x0A,  // 64:65535
+	0x01, 0xD8, 0x1A, 0x0A,  // 65:472
+	0x01, 0xF2, 0x1A, 0x0A,  // 66:498
+	0x02, 0x0C, 0x1A, 0x0A,  // 67:524
+	0x02, 0x26, 0x1A, 0x0A,  // 68:550
+	0x02, 0x40, 0x1A, 0x0A,  // 69:576
+	0x02, 0x5A, 0x19, 0x0A,  // 70:602
+	0x02, 0x73, 0x1A, 0x0A,  // 71:627
+	0x02, 0x8D, 0x1A, 0x0A,  // 72:653
+	0x02, 0xA7, 0x14, 0x0A,  // 73:679
+	0x02, 0xBB, 0x17, 0x0A,  // 74:699
+	0x02, 0xD2, 0x1A, 0x0A,  // 75:722
+	0x02, 0xEC, 0x1A, 0x0A,  // 76:748
+	0x03, 0x06, 0x1A, 0x0A,  // 77:774
+	0x03, 0x20, 0x1A, 0x0A,  // 78:800
+	0x03, 0x3A, 0x1A, 0x0A,  // 79:826
+	0x03, 0x54, 0x19, 0x0A,  // 80:852
+	0xFF, 0xFF, 0x00, 0x0A,  // 81:65535
+	0x03, 0x6D, 0x1D, 0x0A,  // 82:877
+	0x03, 0x8A, 0x1A, 0x0A,  // 83:906
+	0x03, 0xA4, 0x19, 0x0A,  // 84:932
+	0x03, 0xBD, 0x1A, 0x0A,  // 85:957
+	0x03, 0xD7, 0x19, 0x0A,  // 86:983
+	0x03, 0xF0, 0x1C, 0x0A,  // 87:1008
+	0x04, 0x0C, 0x1A, 0x0A,  // 88:1036
+	0xFF, 0xFF, 0x00, 0x0A,  // 89:65535
+	0x04, 0x26, 0x1A, 0x0A,  // 90:1062
+	0x04, 0x40, 0x15, 0x0A,  // 91:1088
+	0xFF, 0xFF, 0x00, 0x0A,  // 92:65535
+	0x04, 0x55, 0x12, 0x0A,  // 93:1109
+	0xFF, 0xFF, 0x00, 0x0A,  // 94:65535
+	0x04, 0x67, 0x1E, 0x0A,  // 95:1127
+	0xFF, 0xFF, 0x00, 0x0A,  // 96:65535
+	0x04, 0x85, 0x1A, 0x0A,  // 97:1157
+	0x04, 0x9F, 0x1A, 0x0A,  // 98:1183
+	0x04, 0xB9, 0x17, 0x0A,  // 99:1209
+	0x04, 0xD0, 0x1A, 0x0A,  // 100:1232
+	0x04, 0xEA, 0x1A, 0x0A,  // 101:1258
+	0x05, 0x04, 0x16, 0x0A,  // 102:1284
+	0x05, 0x1A, 0x1A, 0x0A,  // 103:1306
+	0x05, 0x34, 0x1A, 0x0A,  // 104:1332
+	0x05, 0x4E, 0x17, 0x0A,  // 105:1358
+	0x05, 0x65, 0x12, 0x0A,  // 106:1381
+	0x05, 0x77, 0x1A, 0x0A,  // 107:1399
+	0x05, 0x91, 0x17, 0x0A,  // 108:1425
+	0x05, 0xA8, 0x17, 0x0A,  // 109:1448
+	0x05, 0xBF, 0x1A, 0x0A,  // 110:1471
+	0x05, 0xD9, 0x1A, 0x0A,  // 111:1497
+	0x05, 0xF3, 0x1A, 0x0A,  // 112:1523
+	0xFF, 0xFF, 0x00, 0x0A,  // 113:65535
+	0x06, 0x0D, 0x19, 0x0A,  // 114:1549
+	0x06, 0x26, 0x1A, 0x0A,  // 115:1574
+	0x06, 0x40, 0x14, 0x0A,  // 116:1600
+	0x06, 0x54, 0x1A, 0x0A,  // 117:1620
+	0x06, 0x6E, 0x19, 0x0A,  // 118:1646
+	0x06, 0x87, 0x1C, 0x0A,  // 119:1671
+	0x06, 0xA3, 0x1A, 0x0A,  // 120:1699
+	0x06, 0xBD, 0x19, 0x0A,  // 121:1725
+	0x06, 0xD6, 0x1A, 0x0A,  // 122:1750
+	0xFF, 0xFF, 0x00, 0x0A,  // 123:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 124:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 125:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 126:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 127:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 128:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 129:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 130:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 131:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 132:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 133:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 134:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 135:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 136:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 137:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 138:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 139:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 140:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 141:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 142:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 143:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 144:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 145:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 146:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 147:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 148:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 149:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 150:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 151:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 152:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 153:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 154:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 155:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 156:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 157:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 158:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 159:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 160:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 161:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 162:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 163:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 164:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 165:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 166:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 167:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 168:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 169:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 170:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 171:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 172:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 173:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 174:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 175:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 176:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 177:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 178:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 179:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 180:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 181:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 182:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 183:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 184:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 185:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 186:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 187:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 188:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 189:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 190:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 191:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 192:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 193:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 194:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 195:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 196:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 197:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 198:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 199:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 200:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 201:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 202:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 203:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 204:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 205:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 206:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 207:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 208:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 209:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 210:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 211:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 212:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 213:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 214:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 215:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 216:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 217:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 218:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 219:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 220:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 221:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 222:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 223:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 224:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 225:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 226:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 227:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 228:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 229:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 230:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 231:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 232:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 233:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 234:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 235:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 236:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 237:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 238:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 239:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 240:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 241:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 242:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 243:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 244:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 245:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 246:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 247:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 248:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 249:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 250:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 251:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 252:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 253:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 254:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 255:65535
+
+	// Font Data:
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x67,	// 33
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x70,0xE0,0x00,0x18,0x80,0x01,0x08,0x00,0x01,	// 40
+	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x01,0x18,0x80,0x01,0x70,0xE0,0x00,0x80,0x1F,	// 41
+	0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x80,0x3F,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,	// 43
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0xE0,0x01,0x00,0xE0,	// 44
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,	// 45
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x60,	// 46
+	0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x60,0x00,0x00,0x18,0x00,0x00,0x07,0x00,0xC0,0x00,0x00,0x30,0x00,0x00,0x08,	// 47
+	0x00,0x00,0x00,0xC0,0x0F,0x00,0x30,0x30,0x00,0x08,0x40,0x00,0x08,0x43,0x00,0x08,0x43,0x00,0x08,0x40,0x00,0x30,0x30,0x00,0xC0,0x0F,	// 48
+	0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x18,0x40,0x00,0x08,0x40,0x00,0xF8,0x7F,0x00,0x00,0x40,0x00,0x00,0x40,	// 49
+	0x00,0x00,0x00,0x30,0x40,0x00,0x18,0x60,0x00,0x08,0x70,0x00,0x08,0x48,0x00,0x08,0x44,0x00,0x08,0x42,0x00,0x10,0x41,0x00,0xE0,0x40,	// 50
+	0x00,0x00,0x00,0x10,0x20,0x00,0x08,0x40,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x90,0x22,0x00,0xE0,0x1C,	// 51
+	0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x0B,0x00,0xC0,0x08,0x00,0x70,0x08,0x00,0x18,0x08,0x00,0xF8,0x7F,0x00,0x00,0x08,0x00,0x00,0x08,	// 52
+	0x00,0x00,0x00,0x00,0x20,0x00,0xF8,0x41,0x00,0x88,0x40,0x00,0x88,0x40,0x00,0x88,0x40,0x00,0x88,0x40,0x00,0x08,0x21,0x00,0x00,0x1E,	// 53
+	0x00,0x00,0x00,0xC0,0x1F,0x00,0x30,0x21,0x00,0x98,0x40,0x00,0x88,0x40,0x00,0x88,0x40,0x00,0x88,0x40,0x00,0x10,0x21,0x00,0x00,0x1E,	// 54
+	0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x40,0x00,0x08,0x30,0x00,0x08,0x0E,0x00,0x88,0x01,0x00,0x68,0x00,0x00,0x18,	// 55
+	0x00,0x00,0x00,0xF0,0x1C,0x00,0x90,0x22,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x90,0x22,0x00,0xF0,0x1E,	// 56
+	0x00,0x00,0x00,0xE0,0x01,0x00,0x10,0x22,0x00,0x08,0x44,0x00,0x08,0x44,0x00,0x08,0x44,0x00,0x08,0x64,0x00,0x10,0x32,0x00,0xE0,0x0F,	// 57
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x61,0x00,0x80,0x61,	// 58
+	0x00,0x00,0x00,0xC0,0x30,0x00,0x80,0x10,0x00,0x80,0x10,0x00,0x80,0x19,0x00,0x00,0x09,0x00,0x00,0x0F,0x00,0x00,0x06,0x00,0x00,0x06,	// 62
+	0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x08,0x6E,0x00,0x08,0x01,0x00,0x98,0x01,0x00,0xF0,	// 63
+	0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x1E,0x00,0xE0,0x09,0x00,0x38,0x08,0x00,0x38,0x08,0x00,0xE0,0x09,0x00,0x00,0x1E,0x00,0x00,0x60,	// 65
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x90,0x22,0x00,0xF0,0x3E,	// 66
+	0x00,0x00,0x00,0xC0,0x0F,0x00,0x30,0x30,0x00,0x10,0x20,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x18,0x60,0x00,0x10,0x20,	// 67
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x10,0x20,0x00,0x30,0x30,0x00,0xC0,0x0F,	// 68
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,0x00,0x08,0x41,	// 69
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x08,0x01,0x00,0x08,0x01,0x00,0x08,0x01,0x00,0x08,0x01,0x00,0x08,0x01,0x00,0x08,0x01,0x00,0x08,	// 70
+	0x00,0x00,0x00,0xC0,0x0F,0x00,0x30,0x30,0x00,0x10,0x20,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x42,0x00,0x18,0x42,0x00,0x10,0x3E,	// 71
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0xF8,0x7F,	// 72
+	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0xF8,0x7F,0x00,0x08,0x40,0x00,0x08,0x40,	// 73
+	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x20,0x00,0xF8,0x1F,	// 74
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x01,0x00,0x80,0x00,0x00,0x40,0x03,0x00,0x20,0x04,0x00,0x10,0x18,0x00,0x08,0x20,0x00,0x00,0x40,	// 75
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,	// 76
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x38,0x00,0x00,0xE0,0x00,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0xE0,0x00,0x00,0x38,0x00,0x00,0xF8,0x7F,	// 77
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x18,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x06,0x00,0x00,0x18,0x00,0x00,0x60,0x00,0xF8,0x7F,	// 78
+	0x00,0x00,0x00,0xE0,0x1F,0x00,0x30,0x30,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x30,0x30,0x00,0xE0,0x1F,	// 79
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x10,0x01,0x00,0xE0,	// 80
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x08,0x02,0x00,0x10,0x05,0x00,0xE0,0x39,0x00,0x00,0x40,	// 82
+	0x00,0x00,0x00,0xE0,0x30,0x00,0x10,0x61,0x00,0x08,0x41,0x00,0x08,0x43,0x00,0x08,0x42,0x00,0x18,0x42,0x00,0x10,0x22,0x00,0x00,0x3C,	// 83
+	0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0xF8,0x7F,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,	// 84
+	0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x20,0x00,0xF8,0x1F,	// 85
+	0x00,0x00,0x00,0x18,0x00,0x00,0xE0,0x01,0x00,0x00,0x1E,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x1E,0x00,0xE0,0x01,0x00,0x18,	// 86
+	0x38,0x00,0x00,0xC0,0x1F,0x00,0x00,0x60,0x00,0x00,0x1C,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0x00,0x1C,0x00,0x00,0x60,0x00,0xC0,0x1F,0x00,0x38,	// 87
+	0x00,0x00,0x00,0x08,0x40,0x00,0x30,0x30,0x00,0xC0,0x0C,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0xC0,0x0C,0x00,0x30,0x30,0x00,0x08,0x40,	// 88
+	0x00,0x00,0x00,0x08,0x60,0x00,0x08,0x50,0x00,0x08,0x4C,0x00,0x08,0x46,0x00,0x88,0x41,0x00,0xC8,0x40,0x00,0x28,0x40,0x00,0x18,0x40,	// 90
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x01,0x08,0x00,0x01,0x08,0x00,0x01,	// 91
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x01,0x08,0x00,0x01,0xF8,0xFF,0x01,	// 93
+	0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,	// 95
+	0x00,0x00,0x00,0x00,0x3C,0x00,0x80,0x64,0x00,0x40,0x42,0x00,0x40,0x42,0x00,0x40,0x42,0x00,0x40,0x62,0x00,0xC0,0x32,0x00,0x80,0x7F,	// 97
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x80,0x20,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x80,0x20,0x00,0x00,0x1F,	// 98
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x20,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x80,0x20,	// 99
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x20,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x80,0x20,0x00,0xF8,0x7F,	// 100
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x24,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x80,0x44,0x00,0x00,0x27,	// 101
+	0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0xF0,0x7F,0x00,0x48,0x00,0x00,0x48,0x00,0x00,0x48,	// 102
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x20,0x01,0x40,0x40,0x02,0x40,0x40,0x02,0x40,0x40,0x02,0x40,0x40,0x02,0x80,0x20,0x01,0xC0,0xFF,	// 103
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0xC0,0x00,0x00,0x80,0x7F,	// 104
+	0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0xD8,0x7F,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,	// 105
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x02,0xD8,0xFF,0x01,	// 106
+	0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x05,0x00,0x80,0x08,0x00,0x40,0x10,0x00,0x00,0x20,0x00,0x00,0x40,	// 107
+	0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0xF8,0x3F,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,	// 108
+	0x00,0x00,0x00,0xC0,0x7F,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0xC0,0x7F,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x80,0x7F,	// 109
+	0x00,0x00,0x00,0xC0,0x7F,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0xC0,0x00,0x00,0x80,0x7F,	// 110
+	0x00,0x00,0x00,0x00,0x1F,0x00,0x80,0x20,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x80,0x20,0x00,0x00,0x1F,	// 111
+	0x00,0x00,0x00,0xC0,0xFF,0x03,0x80,0x20,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x80,0x20,0x00,0x00,0x1F,	// 112
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x7F,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x80,	// 114
+	0x00,0x00,0x00,0x80,0x23,0x00,0x80,0x46,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x40,0x2C,0x00,0x80,0x38,	// 115
+	0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0xF0,0x3F,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,	// 116
+	0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x20,0x00,0xC0,0x7F,	// 117
+	0x00,0x00,0x00,0x40,0x00,0x00,0x80,0x03,0x00,0x00,0x1C,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x1C,0x00,0x80,0x03,0x00,0x40,	// 118
+	0xC0,0x00,0x00,0x00,0x1F,0x00,0x00,0x60,0x00,0x00,0x1C,0x00,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x18,0x00,0x00,0x60,0x00,0x00,0x1F,0x00,0xC0,	// 119
+	0x00,0x00,0x00,0x40,0x40,0x00,0xC0,0x60,0x00,0x00,0x11,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x11,0x00,0xC0,0x60,0x00,0x40,0x40,	// 120
+	0x00,0x00,0x00,0x40,0x00,0x00,0x80,0x03,0x02,0x00,0x0C,0x02,0x00,0x70,0x03,0x00,0xE0,0x00,0x00,0x1C,0x00,0x80,0x03,0x00,0x40,	// 121
+	0x00,0x00,0x00,0x40,0x60,0x00,0x40,0x50,0x00,0x40,0x48,0x00,0x40,0x44,0x00,0x40,0x44,0x00,0x40,0x42,0x00,0x40,0x41,0x00,0xC0,0x40	// 122
+};
+// Created by http://oleddisplay.squix.ch/ Consider a donation
+// In case of problems make sure that you are using the font file with the correct version!
+const uint8_t Lato_Hairline_12[] PROGMEM = {
+	0x0C, // Width: 12
+	0x0F, // Height: 15
+	0x20, // First Char: 32
+	0xE0, // Numbers of Chars: 224
+
+	// Jump Table:
+	0xFF, 0xFF, 0x00, 0x03,  // 32:65535
+	0x00, 0x00, 0x04, 0x03,  // 33:0
+	0xFF, 0xFF, 0x00, 0x04,  // 34:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 35:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 36:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 37:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 38:65535
+	0xFF, 0xFF, 0x00, 0x02,  // 39:65535
+	0x00, 0x04, 0x06, 0x03,  // 40:4
+	0x00, 0x0A, 0x04, 0x03,  // 41:10
+	0xFF, 0xFF, 0x00, 0x05,  // 42:65535
+	0x00, 0x0E, 0x0C, 0x07,  // 43:14
+	0x00, 0x1A, 0x04, 0x03,  // 44:26
+	0x00, 0x1E, 0x08, 0x04,  // 45:30
+	0x00, 0x26, 0x04, 0x03,  // 46:38
+	0x00, 0x2A, 0x09, 0x05,  // 47:42
+	0x00, 0x33, 0x0C, 0x07,  // 48:51
+	0x00, 0x3F, 0x0C, 0x07,  // 49:63
+	0x00, 0x4B, 0x0C, 0x07,  // 50:75
+	0x00, 0x57, 0x0C, 0x07,  // 51:87
+	0x00, 0x63, 0x0E, 0x07,  // 52:99
+	0x00, 0x71, 0x0C, 0x07,  // 53:113
+	0x00, 0x7D, 0x0C, 0x07,  // 54:125
+	0x00, 0x89, 0x0B, 0x07,  // 55:137
+	0x00, 0x94, 0x0C, 0x07,  // 56:148
+	0x00, 0xA0, 0x0B, 0x07,  // 57:160
+	0x00, 0xAB, 0x04, 0x03,  // 58:171
+	0xFF, 0xFF, 0x00, 0x03,  // 59:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 60:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 61:65535
+	0x00, 0xAF, 0x0C, 0x07,  // 62:175
+	0x00, 0xBB, 0x07, 0x05,  // 63:187
+	0xFF, 0xFF, 0x00, 0x0A,  // 64:65535
+	0x00, 0xC2, 0x0E, 0x08,  // 65:194
+	0x00, 0xD0, 0x0E, 0x07,  // 66:208
+	0x00, 0xDE, 0x10, 0x08,  // 67:222
+	0x00, 0xEE, 0x10, 0x09,  // 68:238
+	0x00, 0xFE, 0x0C, 0x07,  // 69:254
+	0x01, 0x0A, 0x0B, 0x07,  // 70:266
+	0x01, 0x15, 0x10, 0x09,  // 71:277
+	0x01, 0x25, 0x10, 0x09,  // 72:293
+	0x01, 0x35, 0x04, 0x03,  // 73:309
+	0x01, 0x39, 0x08, 0x05,  // 74:313
+	0x01, 0x41, 0x0E, 0x07,  // 75:321
+	0x01, 0x4F, 0x0C, 0x06,  // 76:335
+	0x01, 0x5B, 0x12, 0x0B,  // 77:347
+	0x01, 0x6D, 0x10, 0x09,  // 78:365
+	0x01, 0x7D, 0x12, 0x09,  // 79:381
+	0x01, 0x8F, 0x0B, 0x07,  // 80:399
+	0xFF, 0xFF, 0x00, 0x09,  // 81:65535
+	0x01, 0x9A, 0x0E, 0x07,  // 82:410
+	0x01, 0xA8, 0x0C, 0x06,  // 83:424
+	0x01, 0xB4, 0x0D, 0x07,  // 84:436
+	0x01, 0xC1, 0x0E, 0x09,  // 85:449
+	0x01, 0xCF, 0x0D, 0x08,  // 86:463
+	0x01, 0xDC, 0x17, 0x0C,  // 87:476
+	0x01, 0xF3, 0x0E, 0x07,  // 88:499
+	0xFF, 0xFF, 0x00, 0x07,  // 89:65535
+	0x02, 0x01, 0x0E, 0x07,  // 90:513
+	0x02, 0x0F, 0x06, 0x03,  // 91:527
+	0xFF, 0xFF, 0x00, 0x05,  // 92:65535
+	0x02, 0x15, 0x04, 0x03,  // 93:533
+	0xFF, 0xFF, 0x00, 0x07,  // 94:65535
+	0x02, 0x19, 0x0A, 0x05,  // 95:537
+	0xFF, 0xFF, 0x00, 0x05,  // 96:65535
+	0x02, 0x23, 0x0A, 0x06,  // 97:547
+	0x02, 0x2D, 0x0C, 0x07,  // 98:557
+	0x02, 0x39, 0x0A, 0x06,  // 99:569
+	0x02, 0x43, 0x0A, 0x07,  // 100:579
+	0x02, 0x4D, 0x0C, 0x06,  // 101:589
+	0x02, 0x59, 0x07, 0x04,  // 102:601
+	0x02, 0x60, 0x0C, 0x06,  // 103:608
+	0x02, 0x6C, 0x0A, 0x07,  // 104:620
+	0x02, 0x76, 0x04, 0x03,  // 105:630
+	0x02, 0x7A, 0x04, 0x03,  // 106:634
+	0x02, 0x7E, 0x0A, 0x05,  // 107:638
+	0x02, 0x88, 0x04, 0x03,  // 108:648
+	0x02, 0x8C, 0x10, 0x09,  // 109:652
+	0x02, 0x9C, 0x0A, 0x07,  // 110:668
+	0x02, 0xA6, 0x0C, 0x07,  // 111:678
+	0x02, 0xB2, 0x0C, 0x07,  // 112:690
+	0xFF, 0xFF, 0x00, 0x07,  // 113:65535
+	0x02, 0xBE, 0x07, 0x04,  // 114:702
+	0x02, 0xC5, 0x08, 0x05,  // 115:709
+	0x02, 0xCD, 0x08, 0x04,  // 116:717
+	0x02, 0xD5, 0x0A, 0x07,  // 117:725
+	0x02, 0xDF, 0x0B, 0x06,  // 118:735
+	0x02, 0xEA, 0x11, 0x09,  // 119:746
+	0x02, 0xFB, 0x0A, 0x05,  // 120:763
+	0x03, 0x05, 0x0B, 0x06,  // 121:773
+	0x03, 0x10, 0x0A, 0x05,  // 122:784
+	0xFF, 0xFF, 0x00, 0x03,  // 123:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 124:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 125:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 126:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 127:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 128:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 129:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 130:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 131:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 132:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 133:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 134:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 135:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 136:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 137:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 138:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 139:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 140:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 141:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 142:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 143:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 144:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 145:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 146:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 147:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 148:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 149:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 150:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 151:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 152:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 153:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 154:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 155:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 156:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 157:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 158:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 159:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 160:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 161:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 162:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 163:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 164:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 165:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 166:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 167:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 168:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 169:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 170:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 171:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 172:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 173:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 174:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 175:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 176:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 177:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 178:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 179:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 180:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 181:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 182:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 183:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 184:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 185:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 186:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 187:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 188:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 189:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 190:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 191:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 192:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 193:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 194:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 195:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 196:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 197:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 198:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 199:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 200:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 201:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 202:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 203:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 204:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 205:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 206:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 207:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 208:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 209:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 210:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 211:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 212:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 213:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 214:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 215:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 216:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 217:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 218:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 219:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 220:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 221:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 222:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 223:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 224:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 225:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 226:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 227:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 228:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 229:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 230:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 231:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 232:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 233:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 234:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 235:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 236:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 237:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 238:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 239:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 240:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 241:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 242:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 243:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 244:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 245:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 246:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 247:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 248:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 249:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 250:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 251:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 252:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 253:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 254:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 255:65535
+
+	// Font Data:
+	0x00,0x00,0xF0,0x0B,	// 33
+	0x00,0x00,0xF0,0x1F,0x08,0x10,	// 40
+	0x08,0x10,0xF0,0x1F,	// 41
+	0x00,0x00,0x00,0x01,0x00,0x01,0xE0,0x07,0x00,0x01,0x00,0x01,	// 43
+	0x00,0x00,0x00,0x18,	// 44
+	0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,	// 45
+	0x00,0x00,0x00,0x08,	// 46
+	0x00,0x00,0x00,0x0E,0xC0,0x01,0x30,0x00,0x08,	// 47
+	0x00,0x00,0xE0,0x0F,0x10,0x08,0x10,0x08,0x10,0x08,0xE0,0x07,	// 48
+	0x00,0x00,0x40,0x00,0x20,0x08,0xF0,0x0F,0x00,0x08,0x00,0x00,	// 49
+	0x00,0x00,0x20,0x08,0x10,0x0C,0x10,0x0A,0x10,0x09,0xE0,0x08,	// 50
+	0x00,0x00,0x30,0x0C,0x10,0x08,0x90,0x08,0x90,0x08,0x70,0x07,	// 51
+	0x00,0x02,0x80,0x03,0x40,0x02,0x20,0x02,0xF0,0x0F,0x00,0x02,0x00,0x02,	// 52
+	0x00,0x00,0x60,0x08,0x50,0x08,0x50,0x08,0x50,0x08,0x90,0x07,	// 53
+	0x00,0x00,0x80,0x0F,0xC0,0x08,0xA0,0x08,0x90,0x08,0x00,0x0F,	// 54
+	0x00,0x00,0x10,0x00,0x10,0x0C,0x10,0x03,0xD0,0x00,0x30,	// 55
+	0x00,0x00,0x70,0x0F,0x90,0x08,0x90,0x08,0x90,0x08,0x70,0x0F,	// 56
+	0x00,0x00,0xE0,0x00,0x10,0x09,0x10,0x05,0x10,0x03,0xE0,	// 57
+	0x00,0x00,0x40,0x08,	// 58
+	0x00,0x00,0x40,0x02,0x40,0x02,0x40,0x02,0x80,0x01,0x00,0x01,	// 62
+	0x00,0x00,0x10,0x00,0x90,0x09,0x70,	// 63
+	0x00,0x08,0x00,0x07,0xC0,0x02,0x30,0x02,0x60,0x02,0x80,0x03,0x00,0x0C,	// 65
+	0x00,0x00,0xF0,0x0F,0x90,0x08,0x90,0x08,0x90,0x08,0xD0,0x08,0x20,0x07,	// 66
+	0x00,0x00,0xE0,0x07,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,	// 67
+	0x00,0x00,0xF0,0x0F,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0xE0,0x07,	// 68
+	0x00,0x00,0xF0,0x0F,0x90,0x08,0x90,0x08,0x90,0x08,0x90,0x08,	// 69
+	0x00,0x00,0xF0,0x0F,0x90,0x00,0x90,0x00,0x90,0x00,0x90,	// 70
+	0x00,0x00,0xE0,0x07,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x09,0x10,0x0F,	// 71
+	0x00,0x00,0xF0,0x0F,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xF0,0x0F,	// 72
+	0x00,0x00,0xF0,0x0F,	// 73
+	0x00,0x08,0x00,0x08,0x00,0x08,0xF0,0x07,	// 74
+	0x00,0x00,0xF0,0x0F,0x80,0x00,0x40,0x01,0x20,0x02,0x20,0x04,0x10,0x08,	// 75
+	0x00,0x00,0xF0,0x0F,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,	// 76
+	0x00,0x00,0xF0,0x0F,0x20,0x00,0xC0,0x00,0x00,0x03,0x00,0x02,0x00,0x01,0xC0,0x00,0xF0,0x0F,	// 77
+	0x00,0x00,0xF0,0x0F,0x20,0x00,0xC0,0x00,0x00,0x01,0x00,0x02,0x00,0x04,0xF0,0x0F,	// 78
+	0x00,0x00,0xE0,0x07,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x20,0x04,0xC0,0x03,	// 79
+	0x00,0x00,0xF0,0x0F,0x10,0x01,0x10,0x01,0x10,0x01,0xF0,	// 80
+	0x00,0x00,0xF0,0x0F,0x90,0x00,0x90,0x00,0x90,0x03,0x70,0x04,0x00,0x08,	// 82
+	0x00,0x00,0x70,0x08,0x90,0x08,0x90,0x08,0x10,0x09,0x00,0x06,	// 83
+	0x10,0x00,0x10,0x00,0x10,0x00,0xF0,0x0F,0x10,0x00,0x10,0x00,0x10,	// 84
+	0x00,0x00,0xF0,0x07,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0xF0,0x07,	// 85
+	0x30,0x00,0xC0,0x00,0x00,0x03,0x00,0x0C,0x00,0x06,0x80,0x01,0x70,	// 86
+	0x30,0x00,0xC0,0x01,0x00,0x0E,0x00,0x04,0x80,0x03,0x70,0x00,0x60,0x00,0x80,0x01,0x00,0x0E,0x00,0x02,0xC0,0x01,0x30,	// 87
+	0x10,0x08,0x20,0x04,0x40,0x02,0x80,0x01,0x40,0x02,0x20,0x04,0x10,0x08,	// 88
+	0x00,0x00,0x10,0x0C,0x10,0x0A,0x90,0x09,0x50,0x08,0x30,0x08,0x10,0x08,	// 90
+	0x00,0x00,0xF8,0x3F,0x08,0x20,	// 91
+	0x00,0x00,0xF8,0x3F,	// 93
+	0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,	// 95
+	0x00,0x00,0x40,0x0E,0x40,0x09,0x40,0x09,0xC0,0x0F,	// 97
+	0x00,0x00,0xF8,0x0F,0x40,0x08,0x40,0x08,0x40,0x08,0x80,0x07,	// 98
+	0x00,0x00,0xC0,0x0F,0x40,0x08,0x40,0x08,0x40,0x08,	// 99
+	0x00,0x00,0xC0,0x0F,0x40,0x08,0x40,0x08,0xF8,0x0F,	// 100
+	0x00,0x00,0xC0,0x0F,0x40,0x09,0x40,0x09,0x40,0x09,0x80,0x01,	// 101
+	0x40,0x00,0xF0,0x0F,0x50,0x00,0x50,	// 102
+	0x00,0x00,0xC0,0x35,0x40,0x2A,0x40,0x2A,0xC0,0x29,0x40,0x10,	// 103
+	0x00,0x00,0xF8,0x0F,0x40,0x00,0x40,0x00,0xC0,0x0F,	// 104
+	0x00,0x00,0xD0,0x0F,	// 105
+	0x00,0x20,0xD0,0x3F,	// 106
+	0x00,0x00,0xF8,0x0F,0x80,0x02,0x80,0x04,0x40,0x08,	// 107
+	0x00,0x00,0xF8,0x0F,	// 108
+	0x00,0x00,0xC0,0x0F,0x40,0x00,0x40,0x00,0xC0,0x0F,0x40,0x00,0x40,0x00,0xC0,0x0F,	// 109
+	0x00,0x00,0xC0,0x0F,0x40,0x00,0x40,0x00,0xC0,0x0F,	// 110
+	0x00,0x00,0x80,0x07,0x40,0x08,0x40,0x08,0x40,0x08,0x80,0x07,	// 111
+	0x00,0x00,0xC0,0x3F,0x40,0x08,0x40,0x08,0x40,0x08,0x80,0x07,	// 112
+	0x00,0x00,0xC0,0x0F,0x40,0x00,0x40,	// 114
+	0x00,0x00,0xC0,0x09,0x40,0x09,0x40,0x0E,	// 115
+	0x40,0x00,0xF0,0x0F,0x40,0x08,0x40,0x08,	// 116
+	0x00,0x00,0xC0,0x0F,0x00,0x08,0x00,0x08,0xC0,0x0F,	// 117
+	0x40,0x00,0x80,0x03,0x00,0x0C,0x00,0x06,0x80,0x01,0x40,	// 118
+	0xC0,0x00,0x00,0x07,0x00,0x0C,0x80,0x03,0xC0,0x00,0x00,0x07,0x00,0x0C,0x80,0x03,0x40,	// 119
+	0x40,0x08,0x80,0x04,0x00,0x03,0x80,0x04,0x40,0x08,	// 120
+	0x40,0x00,0x80,0x03,0x00,0x3C,0x00,0x06,0x80,0x01,0x40,	// 121
+	0x00,0x08,0x40,0x0C,0x40,0x0B,0xC0,0x08,0x40,0x08	// 122
+};
+
+
+// Created by http://oleddisplay.squix.ch/ Consider a donation
+// In case of problems make sure that you are using the font file with the correct version!
+const uint8_t Lato_Hairline_17[] PROGMEM = {
+	0x11, // Width: 17
+	0x15, // Height: 21
+	0x20, // First Char: 32
+	0xE0, // Numbers of Chars: 224
+
+	// Jump Table:
+	0xFF, 0xFF, 0x00, 0x05,  // 32:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 33:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 34:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 35:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 36:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 37:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 38:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 39:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 40:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 41:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 42:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 43:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 44:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 45:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 46:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 47:65535
+	0x00, 0x00, 0x1A, 0x0A,  // 48:0
+	0x00, 0x1A, 0x18, 0x0A,  // 49:26
+	0x00, 0x32, 0x1B, 0x0A,  // 50:50
+	0x00, 0x4D, 0x1A, 0x0A,  // 51:77
+	0x00, 0x67, 0x1A, 0x0A,  // 52:103
+	0x00, 0x81, 0x17, 0x0A,  // 53:129
+	0x00, 0x98, 0x1A, 0x0A,  // 54:152
+	0x00, 0xB2, 0x19, 0x0A,  // 55:178
+	0x00, 0xCB, 0x1A, 0x0A,  // 56:203
+	0x00, 0xE5, 0x17, 0x0A,  // 57:229
+	0x00, 0xFC, 0x09, 0x04,  // 58:252
+	0xFF, 0xFF, 0x00, 0x04,  // 59:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 60:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 61:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 62:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 63:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 64:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 65:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 66:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 67:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 68:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 69:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 70:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 71:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 72:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 73:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 74:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 75:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 76:65535
+	0xFF, 0xFF, 0x00, 0x0F,  // 77:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 78:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 79:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 80:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 81:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 82:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 83:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 84:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 85:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 86:65535
+	0xFF, 0xFF, 0x00, 0x11,  // 87:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 88:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 89:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 90:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 91:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 92:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 93:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 94:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 95:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 96:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 97:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 98:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 99:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 100:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 101:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 102:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 103:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 104:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 105:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 106:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 107:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 108:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 109:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 110:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 111:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 112:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 113:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 114:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 115:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 116:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 117:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 118:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 119:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 120:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 121:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 122:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 123:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 124:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 125:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 126:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 127:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 128:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 129:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 130:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 131:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 132:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 133:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 134:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 135:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 136:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 137:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 138:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 139:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 140:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 141:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 142:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 143:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 144:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 145:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 146:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 147:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 148:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 149:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 150:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 151:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 152:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 153:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 154:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 155:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 156:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 157:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 158:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 159:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 160:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 161:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 162:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 163:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 164:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 165:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 166:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 167:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 168:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 169:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 170:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 171:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 172:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 173:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 174:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 175:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 176:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 177:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 178:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 179:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 180:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 181:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 182:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 183:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 184:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 185:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 186:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 187:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 188:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 189:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 190:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 191:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 192:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 193:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 194:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 195:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 196:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 197:65535
+	0xFF, 0xFF, 0x00, 0x10,  // 198:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 199:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 200:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 201:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 202:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 203:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 204:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 205:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 206:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 207:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 208:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 209:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 210:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 211:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 212:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 213:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 214:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 215:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 216:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 217:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 218:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 219:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 220:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 221:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 222:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 223:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 224:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 225:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 226:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 227:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 228:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 229:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 230:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 231:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 232:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 233:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 234:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 235:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 236:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 237:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 238:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 239:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 240:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 241:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 242:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 243:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 244:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 245:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 246:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 247:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 248:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 249:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 250:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 251:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 252:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 253:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 254:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 255:65535
+
+	// Font Data:
+	0x00,0x00,0x00,0xC0,0x7F,0x00,0x20,0x80,0x00,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x20,0x80,0x00,0xC0,0x7F,	// 48
+	0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x01,0x20,0x00,0x01,0x10,0x00,0x01,0xF0,0xFF,0x01,0x00,0x00,0x01,0x00,0x00,0x01,	// 49
+	0x00,0x00,0x00,0x40,0x00,0x01,0x20,0x80,0x01,0x10,0x40,0x01,0x10,0x20,0x01,0x10,0x10,0x01,0x10,0x0C,0x01,0x20,0x02,0x01,0xC0,0x01,0x01,	// 50
+	0x00,0x00,0x00,0x40,0xC0,0x00,0x20,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x20,0x8B,0x00,0xC0,0x70,	// 51
+	0x00,0x20,0x00,0x00,0x38,0x00,0x00,0x24,0x00,0x00,0x22,0x00,0x80,0x21,0x00,0x40,0x20,0x00,0xF0,0xFF,0x01,0x00,0x20,0x00,0x00,0x20,	// 52
+	0x00,0x00,0x00,0x00,0x00,0x01,0xF0,0x03,0x01,0x10,0x02,0x01,0x10,0x02,0x01,0x10,0x02,0x01,0x10,0x02,0x01,0x10,0xFC,	// 53
+	0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x86,0x00,0x00,0x03,0x01,0xC0,0x02,0x01,0x20,0x02,0x01,0x10,0x02,0x01,0x00,0x84,0x00,0x00,0x78,	// 54
+	0x00,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x80,0x01,0x10,0x70,0x00,0x10,0x0C,0x00,0x10,0x03,0x00,0xD0,0x00,0x00,0x30,	// 55
+	0x00,0x00,0x00,0xC0,0xF1,0x00,0x20,0x0A,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x20,0x0B,0x01,0xC0,0xF0,	// 56
+	0x00,0x00,0x00,0xC0,0x03,0x00,0x20,0x04,0x00,0x10,0x08,0x01,0x10,0xC8,0x00,0x10,0x28,0x00,0x10,0x18,0x00,0xE0,0x07,	// 57
+	0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x01,0x01	// 58
+};
+
+
+// Created by http://oleddisplay.squix.ch/ Consider a donation
+// In case of problems make sure that you are using the font file with the correct version!
+const uint8_t Lato_Hairline_18[] PROGMEM = {
+	0x12, // Width: 18
+	0x16, // Height: 22
+	0x20, // First Char: 32
+	0xE0, // Numbers of Chars: 224
+
+	// Jump Table:
+	0xFF, 0xFF, 0x00, 0x05,  // 32:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 33:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 34:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 35:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 36:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 37:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 38:65535
+	0xFF, 0xFF, 0x00, 0x03,  // 39:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 40:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 41:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 42:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 43:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 44:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 45:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 46:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 47:65535
+	0x00, 0x00, 0x1D, 0x0A,  // 48:0
+	0x00, 0x1D, 0x1B, 0x0A,  // 49:29
+	0x00, 0x38, 0x1B, 0x0A,  // 50:56
+	0x00, 0x53, 0x1B, 0x0A,  // 51:83
+	0x00, 0x6E, 0x1D, 0x0A,  // 52:110
+	0x00, 0x8B, 0x1A, 0x0A,  // 53:139
+	0x00, 0xA5, 0x1B, 0x0A,  // 54:165
+	0x00, 0xC0, 0x1C, 0x0A,  // 55:192
+	0x00, 0xDC, 0x1B, 0x0A,  // 56:220
+	0x00, 0xF7, 0x1A, 0x0A,  // 57:247
+	0x01, 0x11, 0x09, 0x04,  // 58:273
+	0xFF, 0xFF, 0x00, 0x04,  // 59:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 60:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 61:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 62:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 63:65535
+	0xFF, 0xFF, 0x00, 0x0F,  // 64:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 65:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 66:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 67:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 68:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 69:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 70:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 71:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 72:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 73:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 74:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 75:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 76:65535
+	0xFF, 0xFF, 0x00, 0x10,  // 77:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 78:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 79:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 80:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 81:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 82:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 83:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 84:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 85:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 86:65535
+	0xFF, 0xFF, 0x00, 0x12,  // 87:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 88:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 89:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 90:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 91:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 92:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 93:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 94:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 95:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 96:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 97:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 98:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 99:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 100:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 101:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 102:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 103:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 104:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 105:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 106:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 107:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 108:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 109:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 110:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 111:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 112:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 113:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 114:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 115:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 116:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 117:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 118:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 119:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 120:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 121:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 122:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 123:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 124:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 125:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 126:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 127:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 128:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 129:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 130:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 131:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 132:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 133:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 134:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 135:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 136:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 137:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 138:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 139:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 140:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 141:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 142:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 143:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 144:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 145:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 146:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 147:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 148:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 149:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 150:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 151:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 152:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 153:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 154:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 155:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 156:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 157:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 158:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 159:65535
+	0xFF, 0xFF, 0x00, 0x05,  // 160:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 161:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 162:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 163:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 164:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 165:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 166:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 167:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 168:65535
+	0xFF, 0xFF, 0x00, 0x0F,  // 169:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 170:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 171:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 172:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 173:65535
+	0xFF, 0xFF, 0x00, 0x0F,  // 174:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 175:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 176:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 177:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 178:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 179:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 180:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 181:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 182:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 183:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 184:65535
+	0xFF, 0xFF, 0x00, 0x06,  // 185:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 186:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 187:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 188:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 189:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 190:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 191:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 192:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 193:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 194:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 195:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 196:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 197:65535
+	0xFF, 0xFF, 0x00, 0x11,  // 198:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 199:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 200:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 201:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 202:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 203:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 204:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 205:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 206:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 207:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 208:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 209:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 210:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 211:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 212:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 213:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 214:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 215:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 216:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 217:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 218:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 219:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 220:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 221:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 222:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 223:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 224:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 225:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 226:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 227:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 228:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 229:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 230:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 231:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 232:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 233:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 234:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 235:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 236:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 237:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 238:65535
+	0xFF, 0xFF, 0x00, 0x04,  // 239:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 240:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 241:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 242:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 243:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 244:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 245:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 246:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 247:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 248:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 249:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 250:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 251:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 252:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 253:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 254:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 255:65535
+
+	// Font Data:
+	0x00,0x00,0x00,0x80,0xFF,0x00,0x40,0x00,0x01,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0xC0,0x80,0x01,0x00,0x7F,	// 48
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x80,0x00,0x02,0x40,0x00,0x02,0xE0,0xFF,0x03,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,	// 49
+	0x00,0x00,0x00,0x80,0x00,0x02,0x40,0x00,0x03,0x20,0x80,0x02,0x20,0x40,0x02,0x20,0x20,0x02,0x20,0x10,0x02,0x20,0x08,0x02,0xC0,0x07,0x02,	// 50
+	0x00,0x00,0x00,0x80,0x80,0x01,0x40,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x14,0x02,0xC0,0xF3,0x01,	// 51
+	0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x58,0x00,0x00,0x44,0x00,0x00,0x43,0x00,0x80,0x40,0x00,0x60,0x40,0x00,0x80,0xFF,0x03,0x00,0x40,0x00,0x00,0x40,	// 52
+	0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x07,0x02,0x20,0x04,0x02,0x20,0x04,0x02,0x20,0x04,0x02,0x20,0x04,0x02,0x20,0x08,0x01,0x20,0xF0,	// 53
+	0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x0C,0x01,0x00,0x0A,0x02,0x00,0x05,0x02,0xC0,0x04,0x02,0x20,0x04,0x02,0x00,0x08,0x02,0x00,0xF8,0x01,	// 54
+	0x00,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x03,0x20,0xC0,0x00,0x20,0x30,0x00,0x20,0x0C,0x00,0x20,0x03,0x00,0xE0,0x00,0x00,0x20,	// 55
+	0x00,0x00,0x00,0x80,0xE1,0x01,0x40,0x16,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x08,0x02,0x20,0x14,0x02,0xC0,0xF3,0x01,	// 56
+	0x00,0x00,0x00,0x80,0x07,0x00,0x40,0x08,0x00,0x20,0x10,0x02,0x20,0x10,0x01,0x20,0xD0,0x00,0x20,0x30,0x00,0x20,0x18,0x00,0xC0,0x07,	// 57
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02	// 58
+};
+// Created by http://oleddisplay.squix.ch/ Consider a donation
+// In case of problems make sure that you are using the font file with the correct version!
+const uint8_t Lato_Hairline_38[] PROGMEM = {
+	0x26, // Width: 38
+	0x2F, // Height: 47
+	0x20, // First Char: 32
+	0xE0, // Numbers of Chars: 224
+
+	// Jump Table:
+	0xFF, 0xFF, 0x00, 0x0B,  // 32:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 33:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 34:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 35:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 36:65535
+	0xFF, 0xFF, 0x00, 0x1D,  // 37:65535
+	0xFF, 0xFF, 0x00, 0x1A,  // 38:65535
+	0xFF, 0xFF, 0x00, 0x07,  // 39:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 40:65535
+	0xFF, 0xFF, 0x00, 0x0A,  // 41:65535
+	0xFF, 0xFF, 0x00, 0x10,  // 42:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 43:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 44:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 45:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 46:65535
+	0xFF, 0xFF, 0x00, 0x10,  // 47:65535
+	0x00, 0x00, 0x76, 0x16,  // 48:0
+	0x00, 0x76, 0x71, 0x16,  // 49:118
+	0x00, 0xE7, 0x71, 0x16,  // 50:231
+	0x01, 0x58, 0x71, 0x16,  // 51:344
+	0x01, 0xC9, 0x7C, 0x16,  // 52:457
+	0x02, 0x45, 0x70, 0x16,  // 53:581
+	0x02, 0xB5, 0x71, 0x16,  // 54:693
+	0x03, 0x26, 0x74, 0x16,  // 55:806
+	0x03, 0x9A, 0x71, 0x16,  // 56:922
+	0x04, 0x0B, 0x6F, 0x16,  // 57:1035
+	0x04, 0x7A, 0x23, 0x09,  // 58:1146
+	0xFF, 0xFF, 0x00, 0x09,  // 59:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 60:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 61:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 62:65535
+	0xFF, 0xFF, 0x00, 0x10,  // 63:65535
+	0xFF, 0xFF, 0x00, 0x1F,  // 64:65535
+	0xFF, 0xFF, 0x00, 0x18,  // 65:65535
+	0xFF, 0xFF, 0x00, 0x18,  // 66:65535
+	0xFF, 0xFF, 0x00, 0x1A,  // 67:65535
+	0xFF, 0xFF, 0x00, 0x1D,  // 68:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 69:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 70:65535
+	0xFF, 0xFF, 0x00, 0x1C,  // 71:65535
+	0xFF, 0xFF, 0x00, 0x1C,  // 72:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 73:65535
+	0xFF, 0xFF, 0x00, 0x0F,  // 74:65535
+	0xFF, 0xFF, 0x00, 0x17,  // 75:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 76:65535
+	0xFF, 0xFF, 0x00, 0x22,  // 77:65535
+	0xFF, 0xFF, 0x00, 0x1C,  // 78:65535
+	0xFF, 0xFF, 0x00, 0x1E,  // 79:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 80:65535
+	0xFF, 0xFF, 0x00, 0x1E,  // 81:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 82:65535
+	0xFF, 0xFF, 0x00, 0x14,  // 83:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 84:65535
+	0xFF, 0xFF, 0x00, 0x1B,  // 85:65535
+	0xFF, 0xFF, 0x00, 0x18,  // 86:65535
+	0xFF, 0xFF, 0x00, 0x26,  // 87:65535
+	0xFF, 0xFF, 0x00, 0x17,  // 88:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 89:65535
+	0xFF, 0xFF, 0x00, 0x17,  // 90:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 91:65535
+	0xFF, 0xFF, 0x00, 0x10,  // 92:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 93:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 94:65535
+	0xFF, 0xFF, 0x00, 0x11,  // 95:65535
+	0xFF, 0xFF, 0x00, 0x0F,  // 96:65535
+	0xFF, 0xFF, 0x00, 0x12,  // 97:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 98:65535
+	0xFF, 0xFF, 0x00, 0x12,  // 99:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 100:65535
+	0xFF, 0xFF, 0x00, 0x14,  // 101:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 102:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 103:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 104:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 105:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 106:65535
+	0xFF, 0xFF, 0x00, 0x11,  // 107:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 108:65535
+	0xFF, 0xFF, 0x00, 0x1E,  // 109:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 110:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 111:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 112:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 113:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 114:65535
+	0xFF, 0xFF, 0x00, 0x10,  // 115:65535
+	0xFF, 0xFF, 0x00, 0x0C,  // 116:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 117:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 118:65535
+	0xFF, 0xFF, 0x00, 0x1C,  // 119:65535
+	0xFF, 0xFF, 0x00, 0x11,  // 120:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 121:65535
+	0xFF, 0xFF, 0x00, 0x11,  // 122:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 123:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 124:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 125:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 126:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 127:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 128:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 129:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 130:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 131:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 132:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 133:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 134:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 135:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 136:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 137:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 138:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 139:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 140:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 141:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 142:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 143:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 144:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 145:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 146:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 147:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 148:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 149:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 150:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 151:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 152:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 153:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 154:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 155:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 156:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 157:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 158:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 159:65535
+	0xFF, 0xFF, 0x00, 0x0B,  // 160:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 161:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 162:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 163:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 164:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 165:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 166:65535
+	0xFF, 0xFF, 0x00, 0x12,  // 167:65535
+	0xFF, 0xFF, 0x00, 0x0F,  // 168:65535
+	0xFF, 0xFF, 0x00, 0x20,  // 169:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 170:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 171:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 172:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 173:65535
+	0xFF, 0xFF, 0x00, 0x20,  // 174:65535
+	0xFF, 0xFF, 0x00, 0x0F,  // 175:65535
+	0xFF, 0xFF, 0x00, 0x10,  // 176:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 177:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 178:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 179:65535
+	0xFF, 0xFF, 0x00, 0x0F,  // 180:65535
+	0xFF, 0xFF, 0x00, 0x18,  // 181:65535
+	0xFF, 0xFF, 0x00, 0x18,  // 182:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 183:65535
+	0xFF, 0xFF, 0x00, 0x0F,  // 184:65535
+	0xFF, 0xFF, 0x00, 0x0D,  // 185:65535
+	0xFF, 0xFF, 0x00, 0x0F,  // 186:65535
+	0xFF, 0xFF, 0x00, 0x0E,  // 187:65535
+	0xFF, 0xFF, 0x00, 0x1B,  // 188:65535
+	0xFF, 0xFF, 0x00, 0x1B,  // 189:65535
+	0xFF, 0xFF, 0x00, 0x1C,  // 190:65535
+	0xFF, 0xFF, 0x00, 0x0F,  // 191:65535
+	0xFF, 0xFF, 0x00, 0x18,  // 192:65535
+	0xFF, 0xFF, 0x00, 0x18,  // 193:65535
+	0xFF, 0xFF, 0x00, 0x18,  // 194:65535
+	0xFF, 0xFF, 0x00, 0x18,  // 195:65535
+	0xFF, 0xFF, 0x00, 0x18,  // 196:65535
+	0xFF, 0xFF, 0x00, 0x18,  // 197:65535
+	0xFF, 0xFF, 0x00, 0x23,  // 198:65535
+	0xFF, 0xFF, 0x00, 0x1A,  // 199:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 200:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 201:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 202:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 203:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 204:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 205:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 206:65535
+	0xFF, 0xFF, 0x00, 0x09,  // 207:65535
+	0xFF, 0xFF, 0x00, 0x1D,  // 208:65535
+	0xFF, 0xFF, 0x00, 0x1C,  // 209:65535
+	0xFF, 0xFF, 0x00, 0x1E,  // 210:65535
+	0xFF, 0xFF, 0x00, 0x1E,  // 211:65535
+	0xFF, 0xFF, 0x00, 0x1E,  // 212:65535
+	0xFF, 0xFF, 0x00, 0x1E,  // 213:65535
+	0xFF, 0xFF, 0x00, 0x1E,  // 214:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 215:65535
+	0xFF, 0xFF, 0x00, 0x1E,  // 216:65535
+	0xFF, 0xFF, 0x00, 0x1B,  // 217:65535
+	0xFF, 0xFF, 0x00, 0x1B,  // 218:65535
+	0xFF, 0xFF, 0x00, 0x1B,  // 219:65535
+	0xFF, 0xFF, 0x00, 0x1B,  // 220:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 221:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 222:65535
+	0xFF, 0xFF, 0x00, 0x14,  // 223:65535
+	0xFF, 0xFF, 0x00, 0x12,  // 224:65535
+	0xFF, 0xFF, 0x00, 0x12,  // 225:65535
+	0xFF, 0xFF, 0x00, 0x12,  // 226:65535
+	0xFF, 0xFF, 0x00, 0x12,  // 227:65535
+	0xFF, 0xFF, 0x00, 0x12,  // 228:65535
+	0xFF, 0xFF, 0x00, 0x12,  // 229:65535
+	0xFF, 0xFF, 0x00, 0x1E,  // 230:65535
+	0xFF, 0xFF, 0x00, 0x12,  // 231:65535
+	0xFF, 0xFF, 0x00, 0x14,  // 232:65535
+	0xFF, 0xFF, 0x00, 0x14,  // 233:65535
+	0xFF, 0xFF, 0x00, 0x14,  // 234:65535
+	0xFF, 0xFF, 0x00, 0x14,  // 235:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 236:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 237:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 238:65535
+	0xFF, 0xFF, 0x00, 0x08,  // 239:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 240:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 241:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 242:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 243:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 244:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 245:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 246:65535
+	0xFF, 0xFF, 0x00, 0x16,  // 247:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 248:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 249:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 250:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 251:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 252:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 253:65535
+	0xFF, 0xFF, 0x00, 0x15,  // 254:65535
+	0xFF, 0xFF, 0x00, 0x13,  // 255:65535
+
+	// Font Data:
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x00,0x00,0x00,0x80,0x01,0x00,0x03,0x00,0x00,0x40,0x00,0x00,0x04,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x40,0x00,0x00,0x04,0x00,0x00,0x80,0x01,0x00,0x03,0x00,0x00,0x00,0xFE,0xFF,	// 48
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x20,0x00,0x00,0x00,0x01,0x00,0x20,0x00,0x00,0x80,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0xF0,0xFF,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,	// 49
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x30,0x00,0x00,0xC0,0x00,0x00,0x28,0x00,0x00,0x20,0x00,0x00,0x24,0x00,0x00,0x10,0x00,0x00,0x22,0x00,0x00,0x10,0x00,0x00,0x21,0x00,0x00,0x08,0x00,0x80,0x20,0x00,0x00,0x08,0x00,0x40,0x20,0x00,0x00,0x08,0x00,0x20,0x20,0x00,0x00,0x08,0x00,0x10,0x20,0x00,0x00,0x08,0x00,0x08,0x20,0x00,0x00,0x08,0x00,0x04,0x20,0x00,0x00,0x08,0x00,0x02,0x20,0x00,0x00,0x10,0x00,0x01,0x20,0x00,0x00,0x20,0xC0,0x00,0x20,0x00,0x00,0xC0,0x30,0x00,0x20,0x00,0x00,0x00,0x0F,0x00,0x20,	// 50
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x00,0xC0,0x00,0x00,0x0C,0x00,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x08,0x80,0x00,0x20,0x00,0x00,0x08,0x80,0x00,0x20,0x00,0x00,0x08,0x80,0x00,0x20,0x00,0x00,0x08,0x80,0x00,0x20,0x00,0x00,0x08,0x40,0x01,0x20,0x00,0x00,0x10,0x40,0x01,0x10,0x00,0x00,0x20,0x20,0x02,0x08,0x00,0x00,0xC0,0x18,0x04,0x04,0x00,0x00,0x00,0x07,0xF8,0x03,	// 51
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x80,0x20,0x00,0x00,0x00,0x00,0x40,0x20,0x00,0x00,0x00,0x00,0x30,0x20,0x00,0x00,0x00,0x00,0x08,0x20,0x00,0x00,0x00,0x00,0x04,0x20,0x00,0x00,0x00,0x00,0x03,0x20,0x00,0x00,0x00,0x80,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x3F,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,	// 52
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x60,0x00,0x10,0x00,0x00,0x80,0x5F,0x00,0x10,0x00,0x00,0x78,0x20,0x00,0x20,0x00,0x00,0x08,0x20,0x00,0x20,0x00,0x00,0x08,0x20,0x00,0x20,0x00,0x00,0x08,0x20,0x00,0x20,0x00,0x00,0x08,0x20,0x00,0x20,0x00,0x00,0x08,0x20,0x00,0x20,0x00,0x00,0x08,0x20,0x00,0x20,0x00,0x00,0x08,0x40,0x00,0x20,0x00,0x00,0x08,0x40,0x00,0x10,0x00,0x00,0x08,0x80,0x00,0x08,0x00,0x00,0x08,0x80,0x01,0x04,0x00,0x00,0x08,0x00,0x06,0x03,0x00,0x00,0x00,0x00,0xF8,	// 53
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0x00,0x07,0x04,0x00,0x00,0x00,0x80,0x01,0x08,0x00,0x00,0x00,0x60,0x01,0x10,0x00,0x00,0x00,0x90,0x00,0x20,0x00,0x00,0x00,0x88,0x00,0x20,0x00,0x00,0x00,0x46,0x00,0x20,0x00,0x00,0x00,0x41,0x00,0x20,0x00,0x00,0x80,0x40,0x00,0x20,0x00,0x00,0x60,0x40,0x00,0x20,0x00,0x00,0x10,0x40,0x00,0x20,0x00,0x00,0x08,0x40,0x00,0x20,0x00,0x00,0x00,0x80,0x00,0x10,0x00,0x00,0x00,0x00,0x01,0x10,0x00,0x00,0x00,0x00,0x03,0x0C,0x00,0x00,0x00,0x00,0xFC,0x03,	// 54
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x06,0x00,0x00,0x08,0x00,0x80,0x01,0x00,0x00,0x08,0x00,0x60,0x00,0x00,0x00,0x08,0x00,0x18,0x00,0x00,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x80,0x01,0x00,0x00,0x00,0x08,0x60,0x00,0x00,0x00,0x00,0x08,0x18,0x00,0x00,0x00,0x00,0x08,0x06,0x00,0x00,0x00,0x00,0x88,0x01,0x00,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x00,0x00,0x18,	// 55
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xF8,0x07,0x00,0x00,0xC0,0x18,0x04,0x08,0x00,0x00,0x20,0x20,0x02,0x10,0x00,0x00,0x10,0x40,0x01,0x10,0x00,0x00,0x08,0x40,0x01,0x20,0x00,0x00,0x08,0x80,0x00,0x20,0x00,0x00,0x08,0x80,0x00,0x20,0x00,0x00,0x08,0x80,0x00,0x20,0x00,0x00,0x08,0x80,0x00,0x20,0x00,0x00,0x08,0x80,0x00,0x20,0x00,0x00,0x08,0x80,0x00,0x20,0x00,0x00,0x08,0x40,0x01,0x20,0x00,0x00,0x10,0x40,0x01,0x10,0x00,0x00,0x20,0x20,0x02,0x10,0x00,0x00,0xC0,0x18,0x04,0x08,0x00,0x00,0x00,0x07,0xF8,0x07,	// 56
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x00,0x40,0x80,0x00,0x00,0x00,0x00,0x20,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x02,0x00,0x00,0x00,0x08,0x00,0x02,0x20,0x00,0x00,0x08,0x00,0x04,0x10,0x00,0x00,0x08,0x00,0x04,0x0C,0x00,0x00,0x08,0x00,0x04,0x02,0x00,0x00,0x08,0x00,0x04,0x01,0x00,0x00,0x08,0x00,0xC4,0x00,0x00,0x00,0x08,0x00,0x22,0x00,0x00,0x00,0x10,0x00,0x1A,0x00,0x00,0x00,0x10,0x00,0x05,0x00,0x00,0x00,0x20,0x80,0x03,0x00,0x00,0x00,0xC0,0x40,0x00,0x00,0x00,0x00,0x00,0x3F,	// 57
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x30,0x00,0x00,0x00,0x30,0x00,0x30,0x00,0x00,0x00,0x10,0x00,0x10	// 58
+};
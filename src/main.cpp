@@ -49,9 +49,27 @@ String WiFI_Locations[][3] = {{"ESP-AP", "ESP32-AP2", "123456789"},
 
 // Library for basic functions of the DSTIKE Hardware
 #include "Watch.h"
+// retained screen elements: only changed values are drawn again
+#include "Widget.h"
+// time and date strings without heap memory
+#include "TimeFormat.h"
+// 64 bit up-time and time with the fraction of the second
+#include "SystemClock.h"
+// drift of the up-time out of the NTP times
+#include "DriftEstimator.h"
+// DST transitions of the time zone rule calculated once
+#include "TimeZone.h"
+// local time without a time zone conversion every loop
+#include "Calendar.h"
+// time, drift and WiFi location over a reset
+#include "Persistence.h"
 
 // library to handle times in seconds, minutes and so on...
 #include <Time.h>
+// gettimeofday(): the NTP time with the fraction of the second
+#include <sys/time.h>
+// settimeofday_cb(): called when SNTP has set the time
+#include <coredecls.h>
 
 // network address of the Time Server
 const char* NTP_SERVER = "ch.pool.ntp.org";
@@ -73,19 +91,56 @@ const char* TZ_INFO    = "CET-1CEST-2,M3.5.0/02:00:00,M10.5.0/03:00:00";
 //  int	tm_isdst; --> Daylight Saving Time flag
 //
 tm dateTime;
+// the rule of the selected time zone is parsed once, the local time
+// is converted only at midnight, at a DST transition and after the
+// time was set: in between it is counted on
+TimeZone timeZone;
+Calendar calendar(timeZone);
 
 time_t actualTime;      // epoch of the current time.
-time_t NTPTime;         // epoch from the NTP Server
-time_t NTPdiffTime = 0; // example: 1014409342 = 22.02.2002 20:22
+ClockTime NTPTime;      // epoch from the NTP Server with the fraction
 uint8_t last_second;
-uint8_t last_minute;
 
 // Screen flag to let the scrren stay perment on or not
 bool Screen_permanent_on = false;
 
-// variabled to establish a system time in seconds since boot up.
-uint32_t prevMillis = 0;
-uint32_t sysTime;
+// UP-Time screen (PUSH button): shown since upTime_timer,
+// show_upTime is false after the screen timer was changed
+bool upTime_shown = false;
+bool show_upTime = false;
+unsigned long upTime_timer = 0;
+// the up-time in s on the UP-Time screen, -1 to draw it again
+time_t upTime_second = -1;
+
+// system time since boot up in us, the time is the up-time plus an
+// offset that is set from the NTP time (example: 1014409342 s =
+// 22.02.2002 20:22)
+SystemClock systemClock;
+// every NTP time is a sample of the drift,
+// the fitted rate is corrected by the clock
+DriftEstimator clockDrift;
+// the time set by SNTP and the up-time at that moment (see
+// receive_sntpTime()), the drift is sampled from them: gettimeofday()
+// runs on with the same crystal as the up-time
+ClockTime sntp_time;
+uint64_t sntp_upTime;
+bool sntp_received = false;
+
+// the state is saved every second into the RTC memory and every hour
+// (and after a change) into the EEPROM, it is restored at the start
+RtcStorage rtcStorage;
+EepromStorage eepromStorage;
+StateStore stateStore(rtcStorage, eepromStorage);
+WatchState watchState;
+// true if the clock has the time (from NTP or restored)
+bool time_valid = false;
+// true if the time is restored from the EEPROM (after a power loss):
+// it can be an hour plus the time without power old, it is not valid
+// and the date is shown with a '?' until the next NTP time
+bool time_approximate = false;
+// hour of the last save into the EEPROM (after a restore: the hour of
+// the restored time), -1 = not saved yet
+int8_t durable_hour = -1;
 
 // German
 //const char dayNames[7][10]={"So","Mo","Di","Mi","Do","Fr","Sa"};
@@ -95,6 +150,57 @@ uint32_t sysTime;
 const char dayNames[7][10]={"Sun","Mo","Tue","Wed","Thu","Fri","Sat"};
 const char monthNames[12][6]={"Jan","Feb","Mar","Apr","May","Jun","Jul","Aug","Sep","Oct","Nov","Dec"};
 
+// Clock face
+// every second only the seconds are drawn again,
+// every minute the time and once per day the date
+// the time and the seconds are volatile texts, so the layout of the
+// date stays in the text layout cache when it is drawn again
+// With CLOCK_PAGE_ALIGNED all texts start at a display page (a multiple
+// of 8 pixel rows), so they are drawn without bit shifts.
+// The seconds and the date are then 3 and 2 pixel rows lower.
+#ifdef CLOCK_PAGE_ALIGNED
+#define CLOCK_SECONDS_Y 24
+#define CLOCK_DATE_Y    48
+#else
+#define CLOCK_SECONDS_Y 21
+#define CLOCK_DATE_Y    (OLED_HEIGHT-18)
+#endif
+Screen clockFace;
+// With CLOCK_STROKE_DIGITS the time is drawn with procedural digits
+// (lines and arcs) instead of FONT_2_XLARGE: the font is not used and
+// doesn't need flash memory. 27 pixel is the digit height of the font,
+// the digits start 11 pixel below the top of the font.
+// With CLOCK_SCALED_FONT the time is drawn with FONT_2_NORMAL at 2x
+// (26 pixel digits, the top 3 + 2 * 4 pixel below y=0).
+#if defined(CLOCK_STROKE_DIGITS)
+StrokeDigits clockDigits(27);
+DigitsWidget timeText(clockFace, 96, 11, clockDigits, TEXT_ALIGN_RIGHT);
+#elif defined(CLOCK_SCALED_FONT)
+ScaledTextWidget timeText(clockFace, 96, 3, FONT_2_NORMAL, 2, TEXT_ALIGN_RIGHT, TEXT_VOLATILE);
+#else
+#define CLOCK_XLARGE_FONT
+TextWidget timeText(clockFace, 96, 0, FONT_2_XLARGE, TEXT_ALIGN_RIGHT, TEXT_VOLATILE);
+#endif
+TextWidget secondsText(clockFace, 98, CLOCK_SECONDS_Y, FONT_2_NORMAL, TEXT_ALIGN_LEFT, TEXT_VOLATILE);
+TextWidget dateText(clockFace, OLED_CENTER_W, CLOCK_DATE_Y, FONT_2_SMALL, TEXT_ALIGN_CENTER);
+
+// UP-Time screen
+Screen upTimeScreen;
+TextWidget upTimeTitle(upTimeScreen, 0, OLED_Line_1, FONT_1_NORMAL, TEXT_ALIGN_LEFT);
+TextWidget upTimeDays(upTimeScreen, OLED_CENTER_W, OLED_Line_3, FONT_1_NORMAL, TEXT_ALIGN_CENTER);
+TextWidget upTimeClock(upTimeScreen, OLED_CENTER_W, OLED_Line_4, FONT_1_NORMAL, TEXT_ALIGN_CENTER, TEXT_VOLATILE);
+
+// Screen Timer message
+Screen screenTimerScreen;
+TextWidget screenTimerText(screenTimerScreen, OLED_CENTER_W, OLED_Line_3, FONT_1_NORMAL, TEXT_ALIGN_CENTER);
+
+// progress while waiting for the NTP server
+// the bar is filled from left to right: every step sends only the
+// new columns of the two pages of the filled rows (50..60)
+Screen NTPScreen;
+TextWidget NTPTitle(NTPScreen, 0, OLED_Line_1, FONT_1_NORMAL, TEXT_ALIGN_LEFT);
+ProgressWidget NTPProgress(NTPScreen, 5, OLED_HEIGHT-16, OLED_WIDTH-10, 14);
+
 // variable to establish a display OFF-Timer
 const unsigned long displayTimeout = 10*1000; // 10 seconds
 unsigned long displayOffTimer = 0;
@@ -103,12 +209,40 @@ unsigned long displayOffTimer = 0;
 bool WiFi_connection(bool force_reconnect = false);
 bool connect_Wifi(const char * _name, const char * _ssid, const char * _password);
 void print_dateTime(time_t epochTime, bool refreshAll);
-time_t sysTime_now();
+bool cache_clockFonts();
+const uint8_t *clock_timeFont();
+const uint8_t *clock_secondsFont();
+void add_compressedFonts();
+void catchUp_clockFace();
+bool print_upTime();
+bool fetch_NTPTime(const char *title);
+void sample_clockDrift();
+void receive_sntpTime();
+uint8_t restore_watchState();
+void save_watchState(bool durable);
+void save_watchState_everySecond();
+void select_timeZone(const char *rule);
 
 
 void setup() {
   // init DSTRIKE Watch
   Watch.begin();
+  // the rule of the time zone is parsed once
+  select_timeZone(TZ_INFO);
+  // the time is restored right at the start:
+  // the clock shows the right time after a reset
+  switch(restore_watchState()){
+    case STATE_RTC:
+      Serial.println("[OK] restore state from RTC memory");
+      break;
+    case STATE_EEPROM:
+      Serial.println("[OK] restore state from EEPROM");
+      break;
+    default:
+      Serial.println("[--] no saved state");
+      break;
+  }
+  upTimeTitle.setText("UP-Time:");
   delay(1000);
 
   // print Welcome screen over Serial connection
@@ -125,6 +259,9 @@ void setup() {
   // with reduced brightness
   Watch.RGBLED.cycle(10, 100);
   Serial.println("[OK] cycle RGB LED");
+  add_compressedFonts();
+  if(cache_clockFonts())
+    Serial.println("[OK] cache clock fonts");
   // Show Welcome Screen
   Watch.setTextAlignment(TEXT_ALIGN_CENTER);
   Watch.setFont(FONT_1_NORMAL);
@@ -156,20 +293,23 @@ void setup() {
     Watch.println("");
     Watch.println("- NO WiFi!");
   }
+  // show the console lines
+  Watch.updateDisplay();
   // configure the NTP Server
   configTime(0, 0, NTP_SERVER);
-  // define the timezone (POSIX)
-  // set TZ environment variable to the correct value depending on your location
-  // see: https://www.gnu.org/software/libc/manual/html_node/TZ-Variable.html
-  // Note:
-  // this will also change the display at reboot.
-  // Comment this line to get UTC
-  setenv("TZ", TZ_INFO, 1);
+  settimeofday_cb(receive_sntpTime);
+  // the timezone (POSIX rule) is not set with the TZ environment
+  // variable: the clock converts with timeZone (see select_timeZone())
   // to trigger the seconds-loop every second
   last_second = 0;
-  // to trigger the minutes.loop
-  last_minute = 100;
+  // the clock face is drawn completely the first time
+  clockFace.invalidate();
+  // nothing is drawn while the screen is off,
+  // the clock face is updated when it is switched on again
+  Watch.setCatchUpRender(catchUp_clockFace);
   delay(3000);
+  // the button presses of the start up are no gestures
+  Watch.gestures.clear();
   // to switch the display off after the specified time
   displayOffTimer = millis();
 }
@@ -179,172 +319,150 @@ void loop() {
   Watch.updateButtons();
 
   // get actual time as epoch time
-  actualTime = sysTime_now()+NTPdiffTime;
-  // converts the epoch into the tm-structure
-  localtime_r(&actualTime, &dateTime);
+  actualTime = systemClock.now().seconds;
+  // the tm-structure of the epoch
+  dateTime = calendar.update(actualTime);
 
   // display OFF timer
-  // millis() will overflow after round about 49 days
-  // better calculate the absolute value of the difference
+  // millis() will overflow after round about 49 days:
+  // the unsigned difference is right also after the overflow
+  // (abs() of an unsigned difference is never small)
   if(!Screen_permanent_on){
-    if(Watch.screenState && abs(displayOffTimer - millis()) > displayTimeout){
+    if(Watch.screenState && millis() - displayOffTimer > displayTimeout){
       Watch.screenOff();
     }
   }
 
+  // the UP-Time is shown for 2.5 seconds
+  // while it is shown, the seconds keep counting
+  if(upTime_shown){
+    if(millis() - upTime_timer >= 2500){
+      upTime_shown = false;
+      Watch.setTextAlignment(TEXT_ALIGN_LEFT);
+    } else if(show_upTime && print_upTime()){
+      Watch.flushAsync();
+    }
+  }
+
   // trigger every second:
-  if (dateTime.tm_sec != last_second) {
+  if (!upTime_shown && dateTime.tm_sec != last_second) {
     last_second = dateTime.tm_sec;
     // to prevent a flicker of the display every second
-    // only the area of the seconds is updated every second
-    // every minute, the hole display is updated
-    if(dateTime.tm_min != last_minute){
-      last_minute= dateTime.tm_min;
-      print_dateTime(actualTime, true);
-    } else
-      print_dateTime(actualTime, false);
+    // only the parts of the clock face that have changed are updated
+    print_dateTime(actualTime, false);
+    // the flash is written once per hour
+    save_watchState_everySecond();
   }
 
-  /***** Nav Button UP *****/
-  if(Watch.NavBtn_UP.wasPressed()){
+  /***** Nav Buttons *****/
+  // the gestures of the buttons (see Gestures.h):
+  // UP, DOWN and PUSH react when they are pressed
+  GestureEvent gesture;
+  while(Watch.gestures.next(gesture)){
     if(!Watch.screenState){
+      // the first gesture only switches the screen on
       Watch.screenOn();
-      // delay to prevent false button presses
-      delay(250);
-    } else{
+      Watch.gestures.clear();
+      displayOffTimer = millis();
+      break;
+    }
+    if(gesture.gesture != GESTURE_PRESS)
+      continue;
+
+    /***** Nav Button UP *****/
+    if(gesture.buttons == NAV_UP){
+      upTime_shown = false;
       // check if connected to the Internet
       if(!WiFi_connection()){
         Watch.clearScreen();
         Watch.println("");
         Watch.println("- NO WiFi");
       } else {
-        Watch.clearScreen();
-        Watch.println("Compare Time");
         // get the actual time from NTP Server
-        int nTrials = 0;
-        do {
-          Watch.OLED.drawProgressBar(5, OLED_HEIGHT-16, OLED_WIDTH-10, 14, nTrials);
-          Watch.updateDisplay();
-          nTrials++;
-          delay(25);
-          // time() fetch the actual time from the NTP server 
-          // and store it as epoch into the variable
-          time(&NTPTime);
-          // localtime_r() converts the epoch into the tm-structure
-          localtime_r(&NTPTime, &dateTime);
-          // tm_year can be used to indicate if the data is valid
-        } while ((dateTime.tm_year < (2016 - 1900)) && nTrials < 100);
+        bool validTime = fetch_NTPTime("Compare Time");
         Watch.clearScreen();
         Watch.println("Compare Time");
         // compare with system time if data is valid
-        if(dateTime.tm_year > (2016 - 1900)){
+        if(validTime){
           char TextBuffer[100];
+          // in ms
+          long difference = systemClock.difference(NTPTime) / 1000;
+          sample_clockDrift();
           Watch.println("");
           Watch.println("Time difference:");
-          Watch.println("");
-          sprintf(TextBuffer, "-->    %lds", (sysTime_now()+NTPdiffTime)-NTPTime);
+          sprintf(TextBuffer, "-->    %s%ld.%03lds", difference < 0 ? "-" : "", abs(difference) / 1000, abs(difference) % 1000);
           Watch.println(String(TextBuffer));
+          // the drift of the watch without correction:
+          // the opposite of the corrected rate, in 1/10 ppm
+          if(clockDrift.valid()){
+            long drift = -clockDrift.rate() / 100;
+            sprintf(TextBuffer, "Drift: %s%ld.%ld ppm", drift < 0 ? "-" : "+", abs(drift) / 10, abs(drift) % 10);
+            Watch.println(String(TextBuffer));
+          } else {
+            Watch.println("");
+          }
         } else {
           Watch.println("");
           Watch.println("- invalid data");
         }
       }
+      // show the result before waiting
+      Watch.updateDisplay();
       // to trigger the full screen update
-      last_minute = 100;
+      clockFace.invalidate();
       delay(2500);
     }
-    displayOffTimer = millis();
-  }
-  
-  /***** Nav Button PUSH *****/
-  if(Watch.NavBtn_PUSH.wasPressed()){
-    if(!Watch.screenState){
-      Watch.screenOn();
-      // delay to prevent false button presses
-      delay(250);
-    } else{
-      Watch.clearScreen();
-      Watch.drawString(0, OLED_Line_1,  "UP-Time:");
-      // get the system up-time in seconds
-      time_t UpTime = sysTime_now();
-      // the uptime is calculated directly out of the seconds since start
-      // to test, here are some known values:
-      // UpTime = 93784; // Friday, 2. January 1970 02:03:04 ==> UpTime 1day, 2h 3min 4sec
-      // UpTime = 1264577; // Thursday, 15. January 1970 15:16:17 ==> UpTime 14day, 15h 16min 17sec
-      // UpTime = 63158399; // Saturday, 1. January 1972 23:59:59 ==> UpTime 730day, 23h 59min 59sec
-      char TextBuffer[100];
-      Watch.setTextAlignment(TEXT_ALIGN_CENTER);
-      sprintf(TextBuffer, "%i days", int(trunc(UpTime/(60*60*24)))); // s -> min -> h -> days
-      Watch.drawString(OLED_CENTER_W, OLED_Line_3,  String(TextBuffer));
-      sprintf(TextBuffer, "%02d:%02d:%02d", int(trunc(UpTime/(60*60))) % 24, 
-                                            int(trunc(UpTime/(60))) % 60, 
-                                            int(UpTime) % 60);
-      Watch.drawString(OLED_CENTER_W, OLED_Line_4,  String(TextBuffer));
-      Watch.updateDisplay();
-      Watch.setTextAlignment(TEXT_ALIGN_LEFT);
-      // to trigger the full screen update
-      last_minute = 100;
-      // diplay the uptime for 2.3 seconds
-      // check if the button is pushed agian
-      // then togle the display-timeout flag
-      unsigned long display_timer = millis();
-      while((display_timer + 2500) > millis()){
-        Watch.updateButtons();
-        if(Watch.NavBtn_PUSH.wasPressed()){
-          Screen_permanent_on = !Screen_permanent_on;
-          display_timer = millis();
-          Watch.clearScreen();
-          Watch.setTextAlignment(TEXT_ALIGN_CENTER);
-          if(Screen_permanent_on){
-            Watch.drawString(OLED_CENTER_W, OLED_Line_3,  "Screen Timer: OFF");
-          } else {
-            Watch.drawString(OLED_CENTER_W, OLED_Line_3,  "Screen Timer: ON");
-          }
-          Watch.updateDisplay();
-          Watch.setTextAlignment(TEXT_ALIGN_LEFT);
+
+    /***** Nav Button PUSH *****/
+    if(gesture.buttons == NAV_PUSH){
+      if(upTime_shown){
+        // pushed again while the UP-Time is shown:
+        // togle the display-timeout flag
+        Screen_permanent_on = !Screen_permanent_on;
+        upTime_timer = millis();
+        show_upTime = false;
+        if(Screen_permanent_on){
+          screenTimerText.setText("Screen Timer: OFF");
+        } else {
+          screenTimerText.setText("Screen Timer: ON");
         }
-        // short delay to calm the watchdog
-        delay(10);
+        screenTimerScreen.invalidate();
+        screenTimerScreen.update(Watch);
+        Watch.updateDisplay();
+      } else {
+        upTimeScreen.invalidate();
+        upTime_second = -1;
+        print_upTime();
+        Watch.updateDisplay();
+        // to trigger the full screen update
+        clockFace.invalidate();
+        upTime_shown = true;
+        show_upTime = true;
+        upTime_timer = millis();
       }
     }
-    displayOffTimer = millis();
-  }
 
-  /***** Nav Button DOWN *****/
-  if(Watch.NavBtn_DOWN.wasPressed()){
-    if(!Watch.screenState){
-      Watch.screenOn();
-      // delay to prevent false button presses
-      delay(250);
-    } else {
+    /***** Nav Button DOWN *****/
+    if(gesture.buttons == NAV_DOWN){
+      upTime_shown = false;
       // check if connected to the Internet
       if(!WiFi_connection()){
         Watch.clearScreen();
         Watch.println("");
         Watch.println("- NO WiFi");
       } else {
-        Watch.clearScreen();
-        Watch.drawString(0, OLED_Line_1,  "Get Server Time");
-        Watch.updateDisplay();
         // get the actual time from NTP Server
-        int nTrials = 0;
-        do {
-          Watch.OLED.drawProgressBar(5, OLED_HEIGHT-16, OLED_WIDTH-10, 14, nTrials);
-          Watch.updateDisplay();
-          nTrials++;
-          delay(25);
-          // time() fetch the actual time from the NTP server 
-          // and store it as epoch into the variable
-          time(&NTPTime);
-          // localtime_r() converts the epoch into the tm-structure
-          localtime_r(&NTPTime, &dateTime);
-          // tm_year can be used to indicate if the data is valid
-        } while ((dateTime.tm_year < (2016 - 1900)) && nTrials < 100);
+        bool validTime = fetch_NTPTime("Get Server Time");
         Watch.clearScreen();
         Watch.drawString(0, OLED_Line_1,  "Get Server Time");
-        if(dateTime.tm_year > (2016 - 1900)){
+        if(validTime){
           // calculate the difference to the NTP Server time
-          NTPdiffTime = NTPTime-sysTime_now();
+          systemClock.setTime(NTPTime);
+          calendar.invalidate();
+          time_valid = true;
+          time_approximate = false;
+          sample_clockDrift();
+          save_watchState(true);
           // Show the NTP Server time          
           char TextBuffer[100];
           sprintf(TextBuffer, "%02d:%02d", dateTime.tm_hour, dateTime.tm_min);
@@ -360,8 +478,10 @@ void loop() {
           Watch.println("- invalid data");
         }
       }
+      // show the result before waiting
+      Watch.updateDisplay();
       // to trigger the full screen update
-      last_minute = 100;
+      clockFace.invalidate();
       delay(2500);
     }
     displayOffTimer = millis();
@@ -385,11 +505,15 @@ bool WiFi_connection(bool force_reconnect){
       Watch.println("- Refresh WiFi");
     else
       Watch.println("- No WiFi");
+    Watch.updateDisplay();
     delay(1000);
     // fist always disconnect
     WiFi.disconnect();
     // Indicate the WiFi locations out of the list
-    int WIFI_location = 0;
+    // start with the location of the last connection
+    int WIFI_location = watchState.wifiLocation;
+    if(WIFI_location >= (int)(sizeof(WiFI_Locations)/sizeof(WiFI_Locations[0])))
+      WIFI_location = 0;
     // It should only attempt to establish a connection 3 times.
     // so, the function will go throw the list of WiFi loactions 3 times
     // and try to establish a connection...
@@ -409,6 +533,11 @@ bool WiFi_connection(bool force_reconnect){
         }
       }
     }
+    // try this location first the next time
+    if(WiFi.status() == WL_CONNECTED && WIFI_location != watchState.wifiLocation){
+      watchState.wifiLocation = WIFI_location;
+      save_watchState(true);
+    }
   }
   // return true, if connected
   return WiFi.status() == WL_CONNECTED;
@@ -423,6 +552,7 @@ bool connect_Wifi(const char * _name, const char * _ssid, const char * _password
   WiFi.disconnect();
   Watch.println("Connecting to ");
   Watch.println(_name);
+  Watch.updateDisplay();
   delay(1500);
   //Start connecting (done by the ESP in the background)
   WiFi.begin(_ssid, _password);
@@ -463,6 +593,7 @@ bool connect_Wifi(const char * _name, const char * _ssid, const char * _password
           Watch.println("-unknown Status");
           break;
     }
+    Watch.updateDisplay();
     // wait a long time between attemts
     if(wifi_Status == WL_DISCONNECTED)
       delay(2000);
@@ -475,75 +606,245 @@ bool connect_Wifi(const char * _name, const char * _ssid, const char * _password
     Watch.clearScreen();
     Watch.println("IP address: ");
     Watch.println(WiFi.localIP().toString());
+    Watch.updateDisplay();
     return true;
   } else {
     // not connected
     Watch.println("");
     Watch.println("-unable to connect");
+    Watch.updateDisplay();
     return false;
   }
 }
 
 
-//==============================================================
-// Returns the system time in seconds
-// THis is the (Up)-Time of the system since last reset
-time_t sysTime_now() {
-	// calculate number of seconds passed since last call to sysTime_now()
-  while (millis() - prevMillis >= 1000) {
-		// millis() and prevMillis are both unsigned ints thus the subtraction 
-    // will always be the absolute value of the difference
-    sysTime++;
-    prevMillis += 1000;	
-  }  
-  return (time_t)sysTime;
-}
-
-
 //==============================================================
 // Print the time and date on the display
-// To prevent a flicker of the display every second, only the
-// part of the screen that shows the seconds is refreshed
+// To prevent a flicker of the display, only the parts of the
+// clock face that have changed are drawn and transferred
 // The parameter refreshAll=true will force a complete update
 void print_dateTime(time_t epochTime, bool refreshAll){
-    tm _dateTime;
-    // converts the epoch into the tm-structure
-    localtime_r(&epochTime, &_dateTime);
-    // create the String for the hours and minutes
-    char timeString[100];
-    sprintf(timeString, "%02d:%02d", _dateTime.tm_hour, _dateTime.tm_min);
-    // create the String for the seconds
-    char secondsString[100];
-    sprintf(secondsString, ": %02d", _dateTime.tm_sec);
-    // create the String for the date including week names and month names
-    String dateString = String(dayNames[_dateTime.tm_wday])+' ';
-    dateString += String(_dateTime.tm_mday)+'.';
-    dateString += String(monthNames[_dateTime.tm_mon])+'.';
-    dateString += String(_dateTime.tm_year+1900);
+    // the tm-structure of the epoch
+    // (loop() has already updated the calendar to this second)
+    const tm &_dateTime = calendar.update(epochTime);
+    // create the Strings for the hours and minutes, the seconds
+    // and the date including week names and month names
+    // (fixed buffers: this is called every second and must not
+    // fragment the heap)
+    char timeString[TIME_STRING_SIZE];
+    char secondsString[SECONDS_STRING_SIZE];
+    // with " ?" if the time is approximate
+    char dateString[DATE_STRING_SIZE + 2];
+    timeText.setText(formatTime(timeString, _dateTime));
+    secondsText.setText(formatSeconds(secondsString, _dateTime));
+    formatDate(dateString, _dateTime, dayNames, monthNames);
+    // the restored time of the EEPROM is not exact
+    if(time_approximate)
+      strcat(dateString, " ?");
+    dateText.setText(dateString);
     // if the entrire screen should be updated
-    if(refreshAll){
-      Watch.clearScreen();
-      Watch.setFont(FONT_2_XLARGE);
-      Watch.setTextAlignment(TEXT_ALIGN_RIGHT);
-      Watch.drawString(96, 0, String(timeString));
-      Watch.setFont(FONT_2_NORMAL);
-      Watch.setTextAlignment(TEXT_ALIGN_LEFT);
-      Watch.drawString(98, 21, String(secondsString));
-      Watch.setFont(FONT_2_SMALL);
-      Watch.setTextAlignment(TEXT_ALIGN_CENTER);
-      Watch.drawString(OLED_CENTER_W, OLED_HEIGHT-18, dateString);
-      Watch.updateDisplay();
-    } else {
-      // or only the part with the seconds
-      Watch.OLED.setColor(BLACK);
-      Watch.OLED.fillRect(98, 21, 128-98, 17);
-      Watch.OLED.setColor(WHITE);
-      Watch.setFont(FONT_2_NORMAL);
-      Watch.setTextAlignment(TEXT_ALIGN_LEFT);
-      Watch.drawString(98, 21, String(secondsString));
-      Watch.updateDisplay();
-    }
+    if(refreshAll)
+      clockFace.invalidate();
+    clockFace.update(Watch);
+    // the frame is sent page by page in the background of loop()
+    // so the buttons are still read during the transfer
+    Watch.flushAsync();
     // default font and alignment for other text outputs
     Watch.setFont(FONT_1_NORMAL);
     Watch.setTextAlignment(TEXT_ALIGN_LEFT);
 }
+
+
+//==============================================================
+// Draw the clock face with the actual time
+// called by Watch.screenOn() before the display is switched on
+void catchUp_clockFace(){
+  print_dateTime(systemClock.now().seconds, false);
+}
+
+
+//==============================================================
+// The time and the seconds are drawn every second:
+// decode the digits of these fonts only once
+// return value: true if the fonts are cached
+bool cache_clockFonts(){
+#ifdef CLOCK_XLARGE_FONT
+  return Watch.cacheFont(FONT_2_XLARGE) && Watch.cacheFont(FONT_2_NORMAL);
+#else
+  return Watch.cacheFont(FONT_2_NORMAL);
+#endif
+}
+
+
+//==============================================================
+// The fonts of the time and the seconds of this file
+// (the font arrays of font.h exist once per source file, only the
+// ones of main.cpp are cached by cache_clockFonts())
+// return value: NULL if the time is not drawn with a font
+const uint8_t *clock_timeFont(){
+#ifdef CLOCK_XLARGE_FONT
+  return FONT_2_XLARGE;
+#else
+  return NULL;
+#endif
+}
+
+const uint8_t *clock_secondsFont(){
+  return FONT_2_NORMAL;
+}
+
+
+//==============================================================
+// With FONT_COMPRESSED the clock font has no glyph data:
+// it is drawn with its compressed version.
+// Call this before cache_clockFonts()
+void add_compressedFonts(){
+#ifdef FONT_COMPRESSED
+#ifdef CLOCK_XLARGE_FONT
+  Watch.addCompressedFont(&Lato_Hairline_38_Compressed);
+#endif
+#endif
+}
+
+
+//==============================================================
+// Update the UP-Time screen
+// only the changed lines are drawn
+// returns false if the shown second has not changed
+bool print_upTime(){
+  // get the system up-time in seconds
+  time_t UpTime = systemClock.upTime().seconds;
+  // the loop calls this every pass: format and draw only a new second
+  if(UpTime == upTime_second)
+    return false;
+  upTime_second = UpTime;
+  // the uptime is calculated directly out of the seconds since start
+  // to test, here are some known values:
+  // UpTime = 93784; // Friday, 2. January 1970 02:03:04 ==> UpTime 1day, 2h 3min 4sec
+  // UpTime = 1264577; // Thursday, 15. January 1970 15:16:17 ==> UpTime 14day, 15h 16min 17sec
+  // UpTime = 63158399; // Saturday, 1. January 1972 23:59:59 ==> UpTime 730day, 23h 59min 59sec
+  char daysString[DAYS_STRING_SIZE];
+  upTimeDays.setText(formatUpTimeDays(daysString, UpTime));
+  char clockString[UPTIME_STRING_SIZE];
+  upTimeClock.setText(formatUpTime(clockString, UpTime));
+  upTimeScreen.update(Watch);
+  return true;
+}
+
+
+//==============================================================
+// Store the time of SNTP and the up-time when it was set
+// called by the SNTP client with every answer of the server
+void receive_sntpTime(){
+  sntp_upTime = systemClock.upTimeMicros();
+  timeval sntpValue;
+  gettimeofday(&sntpValue, NULL);
+  sntp_time.seconds = sntpValue.tv_sec;
+  sntp_time.micros = sntpValue.tv_usec;
+  sntp_received = true;
+}
+
+
+//==============================================================
+// Store the offset of the last SNTP time to the up-time as sample of
+// the drift and correct the clock with the fitted rate from now on
+// call this right after fetch_NTPTime()
+// without a new SNTP time since the last sample, nothing is stored
+void sample_clockDrift(){
+  if(!sntp_received)
+    return;
+  sntp_received = false;
+  if(!clockDrift.add(sntp_upTime, SystemClock::toMicros(sntp_time) - (int64_t)sntp_upTime))
+    Serial.printf("[--] drift fit rejected (%u times), the rate is kept\n", clockDrift.rejected);
+  // until the samples span enough time, the restored rate is kept
+  if(clockDrift.valid())
+    systemClock.setRate(clockDrift.rate());
+}
+
+
+//==============================================================
+// Restore the time, the drift correction and the WiFi location
+// of the last run, the boot counter is incremented.
+// The time between the last save and the restore is lost
+// (less than a second plus the reset after a save every second)
+// return value: STATE_NONE, STATE_RTC or STATE_EEPROM
+uint8_t restore_watchState(){
+  uint8_t source = stateStore.restore(watchState);
+  if(source != STATE_NONE && watchState.time != 0){
+    systemClock.setTime(SystemClock::fromMicros(watchState.time));
+    systemClock.setRate(watchState.rate);
+    calendar.invalidate();
+    // only the RTC memory has the time of the last second, the time of
+    // the EEPROM stays approximate also over the next reset
+    time_approximate = watchState.approximate;
+    time_valid = !time_approximate;
+    // the EEPROM is written again in the next hour, not at once
+    durable_hour = calendar.update(systemClock.now().seconds).tm_hour;
+  }
+  return source;
+}
+
+
+//==============================================================
+// Save the time and the drift correction
+// durable: also into the EEPROM (flash), not only the RTC memory
+void save_watchState(bool durable){
+  watchState.time = time_valid || time_approximate ? SystemClock::toMicros(systemClock.now()) : 0;
+  watchState.approximate = time_approximate;
+  watchState.rate = systemClock.rate;
+  stateStore.save(watchState, durable);
+  if(durable)
+    durable_hour = dateTime.tm_hour;
+}
+
+
+//==============================================================
+// Save the state of this second (dateTime) into the RTC memory and,
+// if the hour has changed since the last save into the EEPROM, also
+// into the EEPROM. Not only at hh:00:00: that second is missed while
+// a screen blocks the seconds of loop()
+void save_watchState_everySecond(){
+  save_watchState(dateTime.tm_hour != durable_hour);
+}
+
+
+//==============================================================
+// Select the time zone with a POSIX rule (like TZ_INFO): the rule is
+// parsed and the DST transitions are calculated once, the clock face
+// shows the new local time with the next second
+void select_timeZone(const char *rule){
+  timeZone.begin(rule);
+  calendar.invalidate();
+  clockFace.invalidate();
+}
+
+
+//==============================================================
+// Get the actual time from the NTP server
+// the progress is shown on the screen with the given title.
+// The time is stored in NTPTime (with the fraction of the second)
+// and dateTime.
+// return value: true if the time is valid
+bool fetch_NTPTime(const char *title){
+  NTPTitle.setText(title);
+  NTPProgress.setProgress(0);
+  NTPScreen.invalidate();
+  int nTrials = 0;
+  do {
+    NTPProgress.setProgress(nTrials);
+    NTPScreen.update(Watch);
+    Watch.updateDisplay();
+    nTrials++;
+    delay(25);
+    // gettimeofday() fetch the actual time from the NTP server 
+    // and store it as epoch and us into the variable
+    timeval NTPValue;
+    gettimeofday(&NTPValue, NULL);
+    NTPTime.seconds = NTPValue.tv_sec;
+    NTPTime.micros = NTPValue.tv_usec;
+    // the time zone converts the epoch into the tm-structure
+    timeZone.localTime(NTPTime.seconds, dateTime);
+    // tm_year can be used to indicate if the data is valid
+  } while ((dateTime.tm_year < (2016 - 1900)) && nTrials < 100);
+  return dateTime.tm_year > (2016 - 1900);
+}
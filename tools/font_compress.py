@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+##########################################################################
+# font_compress.py
+#
+# Compressed fonts for the DSTIKE OLED Wrist-Watch
+#
+# Writes src/font_compressed.h: a copy of src/font.h in which the large
+# fonts, that are mostly empty bytes, are compressed (see CompressedFont
+# in Watch.h). The squix array of a compressed font keeps its name and
+# its jump table with the width and the size of every glyph, but has no
+# glyph data: all glyphs are marked as not drawable for the OLED library.
+# The glyph data is bit-packed in <font>_packed, <font>_offsets contains
+# the position of every glyph:
+#   one bit per glyph byte (bit 0 of the first byte = glyph byte 0):
+#   1 = the byte is not empty, followed by all bytes that are not empty
+# The watch decompresses a glyph into RAM when it is used first.
+# Compile with -DFONT_COMPRESSED to use the file (see platformio.ini).
+#
+# usage: python3 tools/font_compress.py [--check]
+#   --check: only print the size report, don't write the file
+# As PlatformIO extra script, the file is written before every build.
+#
+# https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+#
+#
+# Distributed as-is; no warranty is given.
+##########################################################################
+
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from font_subset import FONT_PATTERN, Font, parse_numbers  # noqa: E402
+
+# fonts that are compressed: the clock font, whose glyphs fit into the
+# glyph cache of the watch (a font drawn with more different characters
+# is decompressed again and again)
+COMPRESSED_FONTS = ("Lato_Hairline_38",)
+
+VALUES_PER_LINE = 16
+
+
+def compress(glyph):
+    mask = [0] * ((len(glyph) + 7) // 8)
+    for k, value in enumerate(glyph):
+        if value:
+            mask[k // 8] |= 1 << (k % 8)
+    return mask + [value for value in glyph if value]
+
+
+def decompress(data, size):
+    output = []
+    position = (size + 7) // 8
+    for k in range(size):
+        if data[k // 8] & (1 << (k % 8)):
+            output.append(data[position])
+            position += 1
+        else:
+            output.append(0)
+    return output
+
+
+def compressed_source(font):
+    stub = font.subset("")
+    offsets = []
+    data = []
+    for i, (width, glyph) in enumerate(font.glyphs):
+        code = font.first_char + i
+        offsets.append((len(data), code))
+        if glyph:
+            packed = compress(glyph)
+            assert decompress(packed, len(glyph)) == list(glyph)
+            data.extend(packed)
+    if len(data) > 0xFFFF:
+        raise ValueError("%s: too much glyph data for a 16 bit offset" % font.name)
+
+    # not drawable, but with the size of the glyph
+    lines = [stub.source([len(glyph) if glyph else 0 for width, glyph in font.glyphs]),
+             "const uint16_t %s_offsets[] PROGMEM = {" % font.name]
+    for i, (offset, code) in enumerate(offsets):
+        separator = "," if i < len(offsets) - 1 else ""
+        lines.append("\t%d%s\t// %d" % (offset, separator, code))
+    lines.append("};")
+    lines.append("const uint8_t %s_packed[] PROGMEM = {" % font.name)
+    for i in range(0, len(data), VALUES_PER_LINE):
+        separator = "," if i + VALUES_PER_LINE < len(data) else ""
+        lines.append("\t" + ",".join("0x%02X" % value for value in data[i:i + VALUES_PER_LINE]) + separator)
+    lines.append("};")
+    lines.append("const CompressedFont %s_Compressed = {%s, %s_offsets, %s_packed};" %
+                 (font.name, font.name, font.name, font.name))
+    size = stub.size() + 2 * len(offsets) + len(data)
+    return "\n".join(lines), size
+
+
+def generate(project_dir, write=True):
+    source_dir = os.path.join(project_dir, "src")
+    with open(os.path.join(source_dir, "font.h"), encoding="utf-8") as f:
+        font_h = f.read()
+
+    report = ["%-20s %8s %10s %6s" % ("font", "font.h", "compressed", "saved")]
+    total = [0, 0]
+    output = []
+    position = 0
+    for match in FONT_PATTERN.finditer(font_h):
+        font = Font(match.group(1), parse_numbers(match.group(2)))
+        output.append(font_h[position:match.start()])
+        position = match.end()
+        if font.name in COMPRESSED_FONTS:
+            source, size = compressed_source(font)
+            output.append(source)
+            report.append("%-20s %8d %10d %5.0f%%" % (font.name, font.size(), size,
+                                                       100.0 * (font.size() - size) / font.size()))
+        else:
+            output.append(match.group(0))
+            size = font.size()
+        total[0] += font.size()
+        total[1] += size
+    output.append(font_h[position:])
+    report.append("%-20s %8d %10d %5.0f%%" % ("all fonts", total[0], total[1],
+                                               100.0 * (total[0] - total[1]) / total[0]))
+
+    header = ("/**************************************************************************\n"
+              " * font_compressed.h\n"
+              " *\n"
+              " * GENERATED by tools/font_compress.py out of font.h - do not edit!\n"
+              " * Same fonts as font.h, some of them compressed.\n"
+              " * Size in bytes:\n" +
+              "".join(" * %s\n" % line for line in report) +
+              "**************************************************************************/\n\n")
+    body = "".join(output)
+    body = body[body.index("*/") + 2:].lstrip("\n") if body.startswith("/*") else body
+    if write:
+        path = os.path.join(source_dir, "font_compressed.h")
+        content = header + body
+        old = None
+        if os.path.exists(path):
+            with open(path, encoding="utf-8") as f:
+                old = f.read()
+        if content != old:
+            with open(path, "w", encoding="utf-8") as f:
+                f.write(content)
+    return report
+
+
+def main():
+    project_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    report = generate(project_dir, write="--check" not in sys.argv[1:])
+    print("\n".join(report))
+
+
+if __name__ == "__main__":
+    main()
+else:
+    try:
+        # PlatformIO extra script (pre:)
+        Import("env")  # noqa: F821
+        generate(env["PROJECT_DIR"])  # noqa: F821
+    except NameError:
+        pass
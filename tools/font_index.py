@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+##########################################################################
+# font_index.py
+#
+# Indexed fonts for the DSTIKE OLED Wrist-Watch
+#
+# Writes src/font_indexed.h with all fonts of src/font.h in the indexed
+# format (see IndexedFont in Watch.h):
+# - one 32 bit entry per character: bits 0..15 = position of the glyph
+#   data in 32 bit words, bits 16..23 = number of data bytes,
+#   bits 24..31 = width
+# - the glyph data of every character starts at a 32 bit word
+# The entries are calculated here, so the watch finds a glyph with one
+# aligned read instead of four byte reads out of the jump table.
+#
+# usage: python3 tools/font_index.py
+#
+# https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+#
+#
+# Distributed as-is; no warranty is given.
+##########################################################################
+
+import os
+
+from font_subset import FONT_PATTERN, Font, parse_numbers
+
+WORD_BYTES = 4
+VALUES_PER_LINE = 8
+
+
+def words(glyph):
+    # little endian, like the ESP8266: byte 0 is the lowest byte
+    glyph = list(glyph) + [0] * (-len(glyph) % WORD_BYTES)
+    return [glyph[i] | glyph[i + 1] << 8 | glyph[i + 2] << 16 | glyph[i + 3] << 24
+            for i in range(0, len(glyph), WORD_BYTES)]
+
+
+def indexed_source(font):
+    entries = []
+    data = []
+    for i, (width, glyph) in enumerate(font.glyphs):
+        code = font.first_char + i
+        if glyph:
+            entries.append((width << 24 | len(glyph) << 16 | len(data), code))
+            data.extend((value, code) for value in words(glyph))
+        else:
+            entries.append((width << 24, code))
+    if len(data) > 0xFFFF:
+        raise ValueError("%s: too much glyph data for a 16 bit word offset" % font.name)
+
+    lines = ["const uint32_t %s_glyphs[] PROGMEM = {" % font.name]
+    for i, (entry, code) in enumerate(entries):
+        separator = "," if i < len(entries) - 1 else ""
+        lines.append("\t0x%08X%s\t// %d" % (entry, separator, code))
+    lines.append("};")
+    lines.append("const uint32_t %s_data[] PROGMEM = {" % font.name)
+    if not data:
+        lines.append("\t0")
+    for i in range(0, len(data), VALUES_PER_LINE):
+        separator = "," if i + VALUES_PER_LINE < len(data) else ""
+        lines.append("\t" + ",".join("0x%08X" % value for value, code in data[i:i + VALUES_PER_LINE]) + separator)
+    lines.append("};")
+    lines.append("const IndexedFont %s_Indexed = {%s, %s_glyphs, %s_data, %d, %d, %d};" %
+                 (font.name, font.name, font.name, font.name, font.first_char, font.num_chars, font.height))
+    return "\n".join(lines)
+
+
+def main():
+    project_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    source_dir = os.path.join(project_dir, "src")
+    with open(os.path.join(source_dir, "font.h"), encoding="utf-8") as f:
+        font_h = f.read()
+    fonts = [Font(match.group(1), parse_numbers(match.group(2))) for match in FONT_PATTERN.finditer(font_h)]
+
+    output = ["/**************************************************************************\n"
+              " * font_indexed.h\n"
+              " *\n"
+              " * GENERATED by tools/font_index.py out of font.h - do not edit!\n"
+              " * The fonts of font.h in the indexed format (see IndexedFont in Watch.h)\n"
+              " * Use: Watch.indexFont(&Lato_Hairline_38_Indexed);\n"
+              "**************************************************************************/\n"]
+    for font in fonts:
+        output.append(indexed_source(font))
+        print("%-20s %6d glyphs" % (font.name, font.drawable()))
+    with open(os.path.join(source_dir, "font_indexed.h"), "w", encoding="utf-8") as f:
+        f.write("\n\n".join(output) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+##########################################################################
+# font_subset.py
+#
+# Font subsetting for the DSTIKE OLED Wrist-Watch
+#
+# src/font.h contains complete fonts with 224 characters, but the watch
+# draws only a few of them (e.g. the clock font only digits and ':').
+# This script writes src/font_subset.h with the same fonts, but only
+# with the glyph data of the characters that are used. The format
+# (squix jump table) is not changed: the fonts can be used as before.
+# Characters that are not in the subset keep their width, but are
+# not drawn (like the space).
+#
+# The characters of a font are either declared below, or collected
+# from all strings in the source files (src/*.cpp and src/*.h).
+# Compile with -DFONT_SUBSET to use the subset (see platformio.ini).
+#
+# usage: python3 tools/font_subset.py [--check]
+#   --check: only print the size report, don't write the file
+# As PlatformIO extra script, the file is written before every build.
+#
+# https://github.com/electricidea/DSTIKE-NTP-Wristwatch
+#
+#
+# Distributed as-is; no warranty is given.
+##########################################################################
+
+import os
+import re
+import sys
+
+# characters of the fonts
+# SCAN: all characters of the strings in the source files
+# If you change a text or the day and month names, run the script again.
+DIGITS = "0123456789"
+PRINTABLE = "".join(chr(c) for c in range(32, 127))
+SCAN = None
+FONT_CHARSETS = {
+    # console (println) with WiFi names and IP addresses
+    "DejaVu_Sans_Mono_12": PRINTABLE,
+    "DejaVu_Sans_Mono_16": SCAN,
+    # date
+    "Lato_Hairline_12": SCAN,
+    # seconds
+    "Lato_Hairline_17": DIGITS + ": ",
+    # time received from the NTP server
+    "Lato_Hairline_18": DIGITS + ": ",
+    # clock
+    "Lato_Hairline_38": DIGITS + ": ",
+}
+
+# squix font format
+HEADER_SIZE = 4
+JUMPTABLE_BYTES = 4
+NOT_DRAWABLE = 0xFFFF
+
+FONT_PATTERN = re.compile(r"const uint8_t (\w+)\[\] PROGMEM = \{(.*?)\};", re.S)
+
+
+class Font:
+    def __init__(self, name, data):
+        self.name = name
+        self.width, self.height, self.first_char, self.num_chars = data[:HEADER_SIZE]
+        table_end = HEADER_SIZE + self.num_chars * JUMPTABLE_BYTES
+        self.glyphs = []
+        for i in range(self.num_chars):
+            msb, lsb, size, width = data[HEADER_SIZE + i * JUMPTABLE_BYTES:HEADER_SIZE + (i + 1) * JUMPTABLE_BYTES]
+            offset = (msb << 8) | lsb
+            glyph = None
+            if offset != NOT_DRAWABLE:
+                glyph = data[table_end + offset:table_end + offset + size]
+            self.glyphs.append((width, glyph))
+
+    def subset(self, charset):
+        codes = set(ord(c) for c in charset)
+        font = Font.__new__(Font)
+        font.name = self.name
+        font.width, font.height = self.width, self.height
+        font.first_char, font.num_chars = self.first_char, self.num_chars
+        font.glyphs = [(width, glyph if self.first_char + i in codes else None)
+                       for i, (width, glyph) in enumerate(self.glyphs)]
+        return font
+
+    def size(self):
+        return (HEADER_SIZE + self.num_chars * JUMPTABLE_BYTES +
+                sum(len(glyph) for width, glyph in self.glyphs if glyph))
+
+    def drawable(self):
+        return sum(1 for width, glyph in self.glyphs if glyph)
+
+    # sizes: size entries of the glyphs that are not drawable (default 0)
+    def source(self, sizes=None):
+        lines = ["const uint8_t %s[] PROGMEM = {" % self.name,
+                 "\t0x%02X, // Width: %d" % (self.width, self.width),
+                 "\t0x%02X, // Height: %d" % (self.height, self.height),
+                 "\t0x%02X, // First Char: %d" % (self.first_char, self.first_char),
+                 "\t0x%02X, // Numbers of Chars: %d" % (self.num_chars, self.num_chars),
+                 "",
+                 "\t// Jump Table:"]
+        offset = 0
+        data = []
+        for i, (width, glyph) in enumerate(self.glyphs):
+            code = self.first_char + i
+            if glyph:
+                lines.append("\t0x%02X, 0x%02X, 0x%02X, 0x%02X,  // %d:%d" %
+                             (offset >> 8, offset & 0xFF, len(glyph), width, code, offset))
+                data.append((code, glyph))
+                offset += len(glyph)
+            else:
+                size = sizes[i] if sizes else 0
+                lines.append("\t0xFF, 0xFF, 0x%02X, 0x%02X,  // %d:65535" % (size, width, code))
+        lines.append("")
+        lines.append("\t// Font Data:")
+        for i, (code, glyph) in enumerate(data):
+            separator = "," if i < len(data) - 1 else ""
+            lines.append("\t%s%s\t// %d" % (",".join("0x%02X" % b for b in glyph), separator, code))
+        if not data:
+            # the jump table ends with a comma
+            lines[-3] = lines[-3].replace(",  //", "  //")
+        lines.append("};")
+        return "\n".join(lines)
+
+
+def parse_numbers(text):
+    text = re.sub(r"//[^\n]*", "", text)
+    return [int(value, 0) for value in re.findall(r"0x[0-9A-Fa-f]+|\d+", text)]
+
+
+def strip_comments(source):
+    # keep the strings, remove // and /* */ comments
+    pattern = re.compile(r'("(?:\\.|[^"\\])*"|\'(?:\\.|[^\'\\])*\')|//[^\n]*|/\*.*?\*/', re.S)
+    return pattern.sub(lambda match: match.group(1) or "", source)
+
+
+def scan_strings(source_dir, skip):
+    characters = set()
+    for file_name in sorted(os.listdir(source_dir)):
+        if not file_name.endswith((".cpp", ".h")) or file_name in skip:
+            continue
+        with open(os.path.join(source_dir, file_name), encoding="utf-8") as f:
+            source = strip_comments(f.read())
+        for string in re.findall(r'"((?:\\.|[^"\\])*)"', source):
+            string = re.sub(r"\\.", "", string)
+            # printf formats: the numbers are digits
+            string = re.sub(r"%[-+ 0#]*\d*(?:\.\d+)?[a-zA-Z]+", DIGITS, string)
+            characters.update(c for c in string if 32 <= ord(c) < 256)
+    return "".join(sorted(characters)) + DIGITS + " "
+
+
+def generate(project_dir, write=True):
+    source_dir = os.path.join(project_dir, "src")
+    with open(os.path.join(source_dir, "font.h"), encoding="utf-8") as f:
+        font_h = f.read()
+    scanned = scan_strings(source_dir, ("font.h", "font_subset.h"))
+
+    report = ["%-20s %6s %8s %8s %6s" % ("font", "chars", "font.h", "subset", "saved")]
+    total = [0, 0]
+    output = []
+    position = 0
+    for match in FONT_PATTERN.finditer(font_h):
+        font = Font(match.group(1), parse_numbers(match.group(2)))
+        charset = FONT_CHARSETS.get(font.name, SCAN)
+        subset = font.subset(scanned if charset is SCAN else charset)
+        output.append(font_h[position:match.start()])
+        output.append(subset.source())
+        position = match.end()
+        total[0] += font.size()
+        total[1] += subset.size()
+        report.append("%-20s %6d %8d %8d %5.0f%%" % (font.name, subset.drawable(), font.size(), subset.size(),
+                                                     100.0 * (font.size() - subset.size()) / font.size()))
+    output.append(font_h[position:])
+    report.append("%-20s %6s %8d %8d %5.0f%%" % ("total", "", total[0], total[1],
+                                                 100.0 * (total[0] - total[1]) / total[0]))
+
+    header = ("/**************************************************************************\n"
+              " * font_subset.h\n"
+              " *\n"
+              " * GENERATED by tools/font_subset.py out of font.h - do not edit!\n"
+              " * The fonts contain only the characters used by the watch.\n"
+              " * Size in bytes:\n" +
+              "".join(" * %s\n" % line for line in report) +
+              "**************************************************************************/\n\n")
+    body = "".join(output)
+    # the original file header is replaced
+    body = body[body.index("*/") + 2:].lstrip("\n") if body.startswith("/*") else body
+    if write:
+        path = os.path.join(source_dir, "font_subset.h")
+        content = header + body
+        old = None
+        if os.path.exists(path):
+            with open(path, encoding="utf-8") as f:
+                old = f.read()
+        # only write if changed, otherwise everything is compiled again
+        if content != old:
+            with open(path, "w", encoding="utf-8") as f:
+                f.write(content)
+    return report
+
+
+def main():
+    project_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    report = generate(project_dir, write="--check" not in sys.argv[1:])
+    print("\n".join(report))
+
+
+if __name__ == "__main__":
+    main()
+else:
+    try:
+        # PlatformIO extra script (pre:)
+        Import("env")  # noqa: F821
+        generate(env["PROJECT_DIR"])  # noqa: F821
+    except NameError:
+        pass